@@ -0,0 +1,24 @@
+/* Helpers shared by the benchmarks built with make bench. */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <time.h>
+
+/* Monotonic time in seconds. */
+static inline double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+/* Fills pcm with n samples of noise, the same for every call with the same seed. */
+static inline void bench_noise(float *pcm, long n, unsigned seed) {
+  long i;
+  for (i=0;i<n;i++) {
+    seed = seed*1664525 + 1013904223;
+    pcm[i] = ((int)(seed>>16&0xffff) - 32768)*(.25f/32768);
+  }
+}
+
+#endif
@@ -0,0 +1,123 @@
+/* Measures how long a new stream takes to start when it is created and
+   configured with ctls and when it is cloned from a configured prototype
+   with ope_encoder_clone(), for a few configurations. The first columns stop
+   once the encoder is ready to take audio, the last ones include the first
+   write (20 ms), which sets up the stream. Destroying the encoder is counted
+   in all of them.
+
+   usage: bench_clone [streams] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "opusenc.h"
+#include "bench.h"
+
+typedef struct {
+  const char *name;
+  opus_int32 rate;
+  int channels;
+  int family;
+  opus_int32 bitrate;
+} Config;
+
+static int discard(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  (void)user_data;
+  (void)ptr;
+  (void)len;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  (void)user_data;
+  return 0;
+}
+
+static const OpusEncCallbacks callbacks = {discard, close_nothing};
+
+static void check(OggOpusEnc *enc, int err) {
+  if (enc == NULL || err != OPE_OK) {
+    fprintf(stderr, "cannot set up an encoder: %s\n", ope_strerror(err));
+    exit(1);
+  }
+}
+
+/* The settings every stream of a configuration gets. */
+static OggOpusEnc *create(const Config *c, OggOpusComments *comments) {
+  OggOpusEnc *enc;
+  int err;
+  enc = ope_encoder_create_callbacks(&callbacks, NULL, comments, c->rate, c->channels, c->family, &err);
+  check(enc, err);
+  err = ope_encoder_ctl(enc, OPUS_SET_BITRATE(c->bitrate));
+  if (err == OPE_OK) err = ope_encoder_ctl(enc, OPUS_SET_COMPLEXITY(5));
+  if (err == OPE_OK) err = ope_encoder_ctl(enc, OPUS_SET_VBR(1));
+  if (err == OPE_OK) err = ope_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_20_MS));
+  if (err == OPE_OK) err = ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(48000));
+  if (err == OPE_OK) err = ope_encoder_ctl(enc, OPE_SET_COMMENT_PADDING(256));
+  check(enc, err);
+  return enc;
+}
+
+/* Both return the time per stream, with a first write of pcm unless it is
+   NULL. */
+static double run_create(const Config *c, OggOpusComments *comments, int streams, const float *pcm) {
+  double t = bench_now();
+  int i;
+  for (i=0;i<streams;i++) {
+    OggOpusEnc *enc = create(c, comments);
+    if (pcm) ope_encoder_write_float(enc, pcm, c->rate/50);
+    ope_encoder_destroy(enc);
+  }
+  return (bench_now() - t)/streams;
+}
+
+static double run_clone(const Config *c, OggOpusComments *comments, int streams, const float *pcm) {
+  OggOpusEnc *proto = create(c, comments);
+  double t = bench_now();
+  int i;
+  for (i=0;i<streams;i++) {
+    OggOpusEnc *enc;
+    int err;
+    enc = ope_encoder_clone(proto, &callbacks, NULL, &err);
+    check(enc, err);
+    if (pcm) ope_encoder_write_float(enc, pcm, c->rate/50);
+    ope_encoder_destroy(enc);
+  }
+  t = bench_now() - t;
+  ope_encoder_destroy(proto);
+  return t/streams;
+}
+
+int main(int argc, char **argv) {
+  static const Config configs[] = {
+    {"16 kHz mono", 16000, 1, 0, 24000},
+    {"48 kHz stereo", 48000, 2, 0, 96000},
+    {"48 kHz 5.1", 48000, 6, 1, 256000}
+  };
+  int streams = argc > 1 ? atoi(argv[1]) : 1000;
+  OggOpusComments *comments;
+  float *pcm;
+  int c;
+  if (streams <= 0) {
+    fprintf(stderr, "usage: %s [streams]\n", argv[0]);
+    return 1;
+  }
+  pcm = malloc(sizeof(*pcm)*960*6);
+  comments = ope_comments_create();
+  if (pcm == NULL || comments == NULL || ope_comments_add(comments, "ARTIST", "Someone") != OPE_OK) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(pcm, 960*6, 1);
+  printf("%d streams per configuration\n", streams);
+  /* Microseconds per stream. */
+  printf("configuration    create   clone   create+write   clone+write\n");
+  for (c=0;c<(int)(sizeof(configs)/sizeof(configs[0]));c++) {
+    const Config *cf = &configs[c];
+    printf("%-13s   %7.1f   %5.1f   %12.1f   %11.1f\n", cf->name,
+        1e6*run_create(cf, comments, streams, NULL), 1e6*run_clone(cf, comments, streams, NULL),
+        1e6*run_create(cf, comments, streams, pcm), 1e6*run_clone(cf, comments, streams, pcm));
+  }
+  ope_comments_destroy(comments);
+  free(pcm);
+  return 0;
+}
@@ -0,0 +1,73 @@
+/* Measures how long ope_encoder_create_callbacks() takes for a stereo
+   encoder, depending on the input rate. "first" is the first encoder created
+   for each rate, which has to compute the filter table of its resampler
+   unless it is precomputed, and "next" the following ones, which get it from
+   the cache. 48 kHz input needs no resampler, the 44.1 kHz table is
+   precomputed, and 88.2 and 96 kHz first go through half-band stages.
+   Destroying the encoder is counted as well.
+
+   usage: bench_create [count] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "opusenc.h"
+#include "bench.h"
+
+#define CHANNELS 2
+
+static int discard(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  (void)user_data;
+  (void)ptr;
+  (void)len;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  (void)user_data;
+  return 0;
+}
+
+static const OpusEncCallbacks callbacks = {discard, close_nothing};
+
+/* Microseconds per encoder of creating and destroying count of them. */
+static double create(OggOpusComments *comments, opus_int32 rate, int count) {
+  double t;
+  int i;
+  t = bench_now();
+  for (i=0;i<count;i++) {
+    int err;
+    OggOpusEnc *enc = ope_encoder_create_callbacks(&callbacks, NULL, comments, rate, CHANNELS, 0, &err);
+    if (enc == NULL) {
+      fprintf(stderr, "cannot create an encoder: %s\n", ope_strerror(err));
+      exit(1);
+    }
+    ope_encoder_destroy(enc);
+  }
+  return 1e6*(bench_now() - t)/count;
+}
+
+int main(int argc, char **argv) {
+  static const opus_int32 rates[] = {48000, 44100, 8000, 11025, 22050, 32000, 88200, 96000};
+  int count = argc > 1 ? atoi(argv[1]) : 100;
+  OggOpusComments *comments;
+  int r;
+  if (count <= 0) {
+    fprintf(stderr, "usage: %s [count]\n", argv[0]);
+    return 1;
+  }
+  comments = ope_comments_create();
+  if (comments == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  printf("Stereo encoders, %d of each\n", count);
+  /* Microseconds per encoder. */
+  printf(" rate       first        next\n");
+  for (r=0;r<(int)(sizeof(rates)/sizeof(rates[0]));r++) {
+    double first = create(comments, rates[r], 1);
+    double next = create(comments, rates[r], count);
+    printf("%5d   %9.1f   %9.1f\n", (int)rates[r], first, next);
+  }
+  ope_comments_destroy(comments);
+  return 0;
+}
@@ -0,0 +1,135 @@
+/* Measures how many stereo 48 kHz streams a core can encode, with every
+   encoder on a thread pool (OPE_SET_ENCODER_POOL) and with each stream
+   encoded synchronously on the calling thread, for a few write sizes. The
+   pool gets all the audio of all the streams as fast as they take it (the
+   rings hold all of it), so its figure is the throughput per pool thread,
+   queueing and wake-ups included.
+
+   usage: bench_pool [streams] [threads] [seconds] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "opusenc.h"
+#include "bench.h"
+
+#define RATE 48000
+#define CHANNELS 2
+
+static int discard(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  (void)user_data;
+  (void)ptr;
+  (void)len;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  (void)user_data;
+  return 0;
+}
+
+static const OpusEncCallbacks callbacks = {discard, close_nothing};
+
+static OggOpusEnc *create(OggOpusComments *comments) {
+  OggOpusEnc *enc;
+  int err;
+  enc = ope_encoder_create_callbacks(&callbacks, NULL, comments, RATE, CHANNELS, 0, &err);
+  if (enc == NULL) {
+    fprintf(stderr, "cannot create an encoder: %s\n", ope_strerror(err));
+    exit(1);
+  }
+  return enc;
+}
+
+/* Seconds of CPU a stream takes to encode synchronously. */
+static double encode_sync(OggOpusComments *comments, const float *in, long samples, int write) {
+  OggOpusEnc *enc = create(comments);
+  double t = bench_now();
+  long pos;
+  for (pos=0;pos+write<=samples;pos+=write) ope_encoder_write_float(enc, &in[pos*CHANNELS], write);
+  ope_encoder_drain(enc);
+  t = bench_now() - t;
+  ope_encoder_destroy(enc);
+  return t;
+}
+
+/* Wall time the pool takes to encode all the streams, or a negative value if
+   a ring overflowed. */
+static double encode_pool(OggOpusComments *comments, OggOpusEncPool *pool, int streams,
+    const float *in, long samples, int write) {
+  OggOpusEnc **encs = malloc(sizeof(*encs)*streams);
+  opus_int32 overruns = 0;
+  double t;
+  long pos;
+  int i;
+  if (encs == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  for (i=0;i<streams;i++) {
+    encs[i] = create(comments);
+    if (ope_encoder_ctl(encs[i], OPE_SET_ENCODER_POOL(pool)) != OPE_OK
+        || ope_encoder_ctl(encs[i], OPE_SET_ASYNC_BUFFER((opus_int32)samples)) != OPE_OK) {
+      fprintf(stderr, "cannot set up the pool\n");
+      exit(1);
+    }
+  }
+  t = bench_now();
+  for (pos=0;pos+write<=samples;pos+=write) {
+    for (i=0;i<streams;i++) ope_encoder_write_float(encs[i], &in[pos*CHANNELS], write);
+  }
+  for (i=0;i<streams;i++) {
+    opus_int32 n;
+    ope_encoder_ctl(encs[i], OPE_GET_ASYNC_OVERRUNS(&n));
+    overruns += n;
+    ope_encoder_drain(encs[i]);
+  }
+  t = bench_now() - t;
+  for (i=0;i<streams;i++) ope_encoder_destroy(encs[i]);
+  free(encs);
+  return overruns ? -1 : t;
+}
+
+int main(int argc, char **argv) {
+  static const int writes[] = {120, 480, 960, 4800};
+  int streams = argc > 1 ? atoi(argv[1]) : 32;
+  int threads = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+  double seconds = argc > 3 ? atof(argv[3]) : 2;
+  long samples = (long)(seconds*RATE);
+  OggOpusComments *comments;
+  OggOpusEncPool *pool;
+  float *in;
+  int w;
+  int err;
+  if (streams <= 0 || threads <= 0 || samples < writes[3]) {
+    fprintf(stderr, "usage: %s [streams] [threads] [seconds]\n", argv[0]);
+    return 1;
+  }
+  pool = ope_pool_create(threads, &err);
+  if (pool == NULL) {
+    fprintf(stderr, "cannot create the pool: %s\n", ope_strerror(err));
+    return 1;
+  }
+  in = malloc(sizeof(*in)*samples*CHANNELS);
+  comments = ope_comments_create();
+  if (in == NULL || comments == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, samples*CHANNELS, 1);
+  printf("%d streams of %.1f s of stereo 48 kHz audio, pool of %d threads\n", streams, seconds, threads);
+  /* Streams encoded in real time by one core (or one pool thread). */
+  printf("write samples   sync streams/core   pool streams/core\n");
+  for (w=0;w<(int)(sizeof(writes)/sizeof(writes[0]));w++) {
+    long encoded = samples/writes[w]*writes[w];
+    double t_sync = encode_sync(comments, in, samples, writes[w]);
+    double t_pool = encode_pool(comments, pool, streams, in, samples, writes[w]);
+    printf("%13d   %17.1f", writes[w], encoded/(double)RATE/t_sync);
+    if (t_pool < 0) printf("   %17s\n", "ring overflow");
+    else printf("   %17.1f\n", streams*encoded/(double)RATE/(t_pool*threads));
+  }
+  ope_comments_destroy(comments);
+  ope_pool_destroy(pool);
+  free(in);
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Compares the two ways the resampler handles interleaved audio: one channel
+   at a time, and all channels in one pass (the multi-channel path the library
+   takes from 4 channels on), from 1 to 16 channels. Both go from 44.1 kHz to
+   48 kHz at quality 5 (the default of libopusenc) in blocks of 1024 samples,
+   with the C kernels and with the ones the library picks. Times are per input
+   sample and channel, so they would stay flat if the cost were linear in the
+   number of channels.
+
+   usage: bench_resample_channels [seconds] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "resampler.h"
+
+#define IN_RATE 44100
+#define OUT_RATE 48000
+#define QUALITY 5
+#define BLOCK 1024
+#define MAX_CHANNELS 16
+
+/* Nanoseconds per sample and channel of resampling samples of in, one channel
+   at a time if each is set. */
+static double resample(const BenchResampler *r, int each, int channels, const float *in, long samples, float *out) {
+  void *st;
+  double t;
+  long pos = 0;
+  st = r->create(channels, IN_RATE, OUT_RATE, QUALITY);
+  if (st == NULL) {
+    fprintf(stderr, "cannot create a resampler\n");
+    exit(1);
+  }
+  t = bench_now();
+  while (pos < samples) {
+    unsigned in_len = (unsigned)(samples - pos < BLOCK ? samples - pos : BLOCK);
+    unsigned out_len = 2*BLOCK;
+    if (each) r->process_each(st, &in[pos*channels], &in_len, out, &out_len);
+    else r->process(st, &in[pos*channels], &in_len, out, &out_len);
+    pos += in_len;
+  }
+  t = bench_now() - t;
+  r->destroy(st);
+  return 1e9*t/((double)samples*channels);
+}
+
+int main(int argc, char **argv) {
+  static const int channels[] = {1, 2, 6, 8, 16};
+  static const BenchResampler *const variants[] = {&bench_resampler_c, &bench_resampler_default};
+  double seconds = argc > 1 ? atof(argv[1]) : 10;
+  long samples = (long)(seconds*IN_RATE);
+  float *in;
+  float *out;
+  int c;
+  if (samples < BLOCK) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*samples*MAX_CHANNELS);
+  out = malloc(sizeof(*out)*2*BLOCK*MAX_CHANNELS);
+  if (in == NULL || out == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, samples*MAX_CHANNELS, 1);
+  printf("%.1f s of audio, %d Hz to %d Hz, quality %d, library kernels: %s\n", seconds, IN_RATE, OUT_RATE,
+      QUALITY, bench_resampler_default.kernels());
+  /* Nanoseconds per input sample and channel. */
+  printf("channels   c: per channel   multi   ratio   %4s: per channel   multi   ratio\n", bench_resampler_default.kernels());
+  for (c=0;c<(int)(sizeof(channels)/sizeof(channels[0]));c++) {
+    int v;
+    printf("%8d", channels[c]);
+    for (v=0;v<2;v++) {
+      double each = resample(variants[v], 1, channels[c], in, samples, out);
+      double multi = resample(variants[v], 0, channels[c], in, samples, out);
+      printf("   %14.1f   %5.1f   %5.2f", each, multi, multi/each);
+    }
+    printf("\n");
+  }
+  free(out);
+  free(in);
+  return 0;
+}
@@ -0,0 +1,109 @@
+/* Compares downsampling to 48 kHz through half-band stages (as the library
+   does from about twice the output rate: 96, 176.4 and 192 kHz) with the
+   polyphase filter alone, at a few qualities. For each: the CPU time of stereo in ns per input sample (the
+   best of 3 rounds), the passband ripple (the spread of the gain of tones
+   from 100 Hz to 20 kHz) and the stopband (how far below a tone its alias is,
+   for the worst alias landing under 20 kHz, from tones above 24 kHz).
+
+   usage: bench_resample_halfband [seconds] */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "resampler.h"
+
+#define OUT_RATE 48000
+#define BLOCK 1024
+#define ROUNDS 3
+
+/* Nanoseconds per input sample of resampling samples of stereo in. */
+static double cpu(const BenchResampler *r, int rate, int quality, const float *in, long samples, float *out) {
+  void *st;
+  double t;
+  long pos = 0;
+  st = r->create(2, rate, OUT_RATE, quality);
+  if (st == NULL) {
+    fprintf(stderr, "cannot create a resampler\n");
+    exit(1);
+  }
+  t = bench_now();
+  while (pos < samples) {
+    unsigned in_len = (unsigned)(samples - pos < BLOCK ? samples - pos : BLOCK);
+    unsigned out_len = BLOCK;
+    r->process(st, &in[2*pos], &in_len, out, &out_len);
+    pos += in_len;
+  }
+  t = bench_now() - t;
+  r->destroy(st);
+  return 1e9*t/samples;
+}
+
+static double ripple(const BenchResampler *r, int rate, int quality) {
+  double lo = 1000;
+  double hi = -1000;
+  double f;
+  for (f=100;f<=20000;f+=100) {
+    double g = bench_tone_gain(r, quality, rate, OUT_RATE, f, f);
+    lo = fmin(lo, g);
+    hi = fmax(hi, g);
+  }
+  return hi - lo;
+}
+
+static double stopband(const BenchResampler *r, int rate, int quality) {
+  double worst = -200;
+  double f;
+  for (f=24000+250;f<rate/2;f+=250) {
+    double alias = fmod(f, OUT_RATE);
+    if (alias > OUT_RATE/2) alias = OUT_RATE - alias;
+    if (alias <= 20000) worst = fmax(worst, bench_tone_gain(r, quality, rate, OUT_RATE, f, alias));
+  }
+  return -worst;
+}
+
+int main(int argc, char **argv) {
+  static const int rates[] = {96000, 176400, 192000};
+  static const int qualities[] = {3, 5, 8, 10};
+  static const BenchResampler *const variants[] = {&bench_resampler_default, &bench_resampler_polyphase};
+  double seconds = argc > 1 ? atof(argv[1]) : 5;
+  float *in;
+  float *out;
+  int r;
+  int q;
+  if (seconds*rates[0] < BLOCK) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*2*(long)(seconds*192000));
+  out = malloc(sizeof(*out)*2*BLOCK);
+  if (in == NULL || out == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, 2*(long)(seconds*192000), 1);
+  printf("Stereo to %d Hz, library kernels: %s\n", OUT_RATE, bench_resampler_default.kernels());
+  printf("  rate   quality   ----------- half-band ----------   ----------- polyphase ----------\n");
+  printf("                   ns/sample   ripple     stopband    ns/sample   ripple     stopband\n");
+  for (r=0;r<(int)(sizeof(rates)/sizeof(rates[0]));r++) {
+    long samples = (long)(seconds*rates[r]);
+    for (q=0;q<(int)(sizeof(qualities)/sizeof(qualities[0]));q++) {
+      double ns[2];
+      int v;
+      int i;
+      for (v=0;v<2;v++) ns[v] = cpu(variants[v], rates[r], qualities[q], in, samples, out);
+      for (i=1;i<ROUNDS;i++) {
+        for (v=0;v<2;v++) ns[v] = fmin(ns[v], cpu(variants[v], rates[r], qualities[q], in, samples, out));
+      }
+      printf("%6d   %7d", rates[r], qualities[q]);
+      for (v=0;v<2;v++) {
+        printf("   %9.1f   %5.3f dB   %5.0f dB ", ns[v], ripple(variants[v], rates[r], qualities[q]),
+            stopband(variants[v], rates[r], qualities[q]));
+      }
+      printf("\n");
+    }
+  }
+  free(out);
+  free(in);
+  return 0;
+}
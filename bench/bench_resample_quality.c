@@ -0,0 +1,118 @@
+/* Generates the table of resampler qualities in the documentation of
+   OPE_SET_RESAMPLER_QUALITY, with the resampler as built into the library.
+   For each quality:
+   - the taps of the filter from 44.1 kHz to 48 kHz;
+   - the bandwidth: the highest frequency a 44.1 kHz tone can have and still
+     come out at most 3 dB down at 48 kHz;
+   - the stopband: how far below a tone its alias is, for the worst alias
+     landing under 20 kHz when going from 64 kHz to 48 kHz (tones from 28 to
+     32 kHz);
+   - the latency at 44.1 kHz;
+   - the CPU time of stereo from 44.1 kHz to 48 kHz relative to quality 5,
+     and in ns per input sample (the best of 3 rounds).
+
+   usage: bench_resample_quality [seconds] */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "resampler.h"
+
+#define BLOCK 1024
+#define ROUNDS 3
+
+static void *create(int channels, int in_rate, int out_rate, int quality) {
+  void *st = bench_resampler_default.create(channels, in_rate, out_rate, quality);
+  if (st == NULL) {
+    fprintf(stderr, "cannot create a resampler\n");
+    exit(1);
+  }
+  return st;
+}
+
+static double tone_gain(int quality, int in_rate, int out_rate, double in_freq, double out_freq) {
+  return bench_tone_gain(&bench_resampler_default, quality, in_rate, out_rate, in_freq, out_freq);
+}
+
+static double bandwidth(int quality) {
+  double lo = 11025;
+  double hi = 22050;
+  while (hi - lo > 5) {
+    double f = (lo + hi)/2;
+    if (tone_gain(quality, 44100, 48000, f, f) >= -3) lo = f;
+    else hi = f;
+  }
+  return lo;
+}
+
+static double stopband(int quality) {
+  double worst = -200;
+  double f;
+  for (f=28000;f<32000;f+=50) worst = fmax(worst, tone_gain(quality, 64000, 48000, f, 48000 - f));
+  return -worst;
+}
+
+/* Nanoseconds per input sample of resampling samples of stereo in. */
+static double cpu(int quality, const float *in, long samples, float *out) {
+  void *st;
+  double t;
+  long pos = 0;
+  st = create(2, 44100, 48000, quality);
+  t = bench_now();
+  while (pos < samples) {
+    unsigned in_len = (unsigned)(samples - pos < BLOCK ? samples - pos : BLOCK);
+    unsigned out_len = 2*BLOCK;
+    bench_resampler_default.process(st, &in[2*pos], &in_len, out, &out_len);
+    pos += in_len;
+  }
+  t = bench_now() - t;
+  bench_resampler_default.destroy(st);
+  return 1e9*t/samples;
+}
+
+int main(int argc, char **argv) {
+  double seconds = argc > 1 ? atof(argv[1]) : 5;
+  long samples = (long)(seconds*44100);
+  double ns[11];
+  float *in;
+  float *out;
+  int q;
+  int r;
+  if (samples < BLOCK) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*2*samples);
+  out = malloc(sizeof(*out)*4*BLOCK);
+  if (in == NULL || out == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, 2*samples, 1);
+  /* Best of a few rounds, which makes the ratios a lot more stable. */
+  for (q=0;q<=10;q++) ns[q] = cpu(q, in, samples, out);
+  for (r=1;r<ROUNDS;r++) {
+    for (q=0;q<=10;q++) ns[q] = fmin(ns[q], cpu(q, in, samples, out));
+  }
+  printf("Library kernels: %s\n\n", bench_resampler_default.kernels());
+  printf("Quality | Filter taps | Bandwidth | Stopband | Latency at 44.1 kHz | Relative CPU | ns/sample\n");
+  printf("--------|-------------|-----------|----------|---------------------|--------------|----------\n");
+  for (q=0;q<=10;q++) {
+    void *st = create(1, 44100, 48000, q);
+    char bw[16];
+    char sb[16];
+    char lat[16];
+    char rel[16];
+    snprintf(bw, sizeof(bw), "%.1f kHz", bandwidth(q)/1000);
+    snprintf(sb, sizeof(sb), "%.0f dB", stopband(q));
+    snprintf(lat, sizeof(lat), "%.2f ms", 1000.*bench_resampler_default.latency(st)/48000);
+    snprintf(rel, sizeof(rel), "%.2fx", ns[q]/ns[5]);
+    printf("%-7d | %-11d | %-9s | %-8s | %-19s | %-12s | %.1f\n", q, bench_resampler_default.filter_length(st),
+        bw, sb, lat, rel, ns[q]);
+    bench_resampler_default.destroy(st);
+  }
+  free(out);
+  free(in);
+  return 0;
+}
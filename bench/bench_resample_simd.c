@@ -0,0 +1,83 @@
+/* Compares the resampler kernels: plain C, SSE, and the ones the library
+   picks at run time (AVX2/FMA when the CPU has them), for every quality, on
+   stereo audio going from 44.1 kHz to 48 kHz in blocks of 1024 samples.
+   Times are per input sample (per channel pair). The last column is the
+   largest difference between the output of the library kernels and that of
+   the C ones. Qualities above 8 use double precision kernels, which have no
+   AVX2 version.
+
+   usage: bench_resample_simd [seconds] */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "resampler.h"
+
+#define CHANNELS 2
+#define IN_RATE 44100
+#define OUT_RATE 48000
+#define BLOCK 1024
+
+/* Resamples samples of in to out, returning the time it took. */
+static double resample(const BenchResampler *r, int quality, const float *in, long samples, float *out) {
+  void *st;
+  double t;
+  long pos = 0;
+  long out_pos = 0;
+  st = r->create(CHANNELS, IN_RATE, OUT_RATE, quality);
+  if (st == NULL) {
+    fprintf(stderr, "cannot create a resampler\n");
+    exit(1);
+  }
+  t = bench_now();
+  while (pos < samples) {
+    unsigned in_len = (unsigned)(samples - pos < BLOCK ? samples - pos : BLOCK);
+    unsigned out_len = 2*BLOCK;
+    r->process(st, &in[pos*CHANNELS], &in_len, &out[out_pos*CHANNELS], &out_len);
+    pos += in_len;
+    out_pos += out_len;
+  }
+  t = bench_now() - t;
+  r->destroy(st);
+  return t;
+}
+
+int main(int argc, char **argv) {
+  static const BenchResampler *const variants[] = {&bench_resampler_c, &bench_resampler_sse, &bench_resampler_default};
+  double seconds = argc > 1 ? atof(argv[1]) : 10;
+  long samples = (long)(seconds*IN_RATE);
+  long out_samples = samples*OUT_RATE/IN_RATE + 2*BLOCK;
+  float *in;
+  float *out[3];
+  int q;
+  int v;
+  if (samples < BLOCK) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*samples*CHANNELS);
+  for (v=0;v<3;v++) out[v] = calloc(out_samples*CHANNELS, sizeof(*out[v]));
+  if (in == NULL || out[0] == NULL || out[1] == NULL || out[2] == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, samples*CHANNELS, 1);
+  printf("%.1f s of stereo audio, %d Hz to %d Hz, library kernels: %s\n", seconds, IN_RATE, OUT_RATE,
+      bench_resampler_default.kernels());
+  /* Nanoseconds per input sample. */
+  printf("quality        c      sse   %7s   sse/c   %s/c   max diff\n", bench_resampler_default.kernels(),
+      bench_resampler_default.kernels());
+  for (q=0;q<=10;q++) {
+    double ns[3];
+    double diff = 0;
+    long i;
+    for (v=0;v<3;v++) ns[v] = 1e9*resample(variants[v], q, in, samples, out[v])/samples;
+    for (i=0;i<out_samples*CHANNELS;i++) diff = fmax(diff, fabs(out[2][i] - out[0][i]));
+    printf("%7d   %6.1f   %6.1f   %7.1f   %5.2f   %6.2f   %8.1e\n", q, ns[0], ns[1], ns[2],
+        ns[1]/ns[0], ns[2]/ns[0], diff);
+  }
+  for (v=0;v<3;v++) free(out[v]);
+  free(in);
+  return 0;
+}
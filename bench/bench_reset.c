@@ -0,0 +1,106 @@
+/* Measures the cost per clip of encoding many short clips with a new encoder
+   for each (ope_encoder_create_callbacks() and ope_encoder_destroy()) and
+   with one encoder reused through ope_encoder_reset(), for mono input at
+   48 kHz and (resampled) at 24 kHz. Creating an encoder leaves most of the
+   setup to the first write, so both include encoding the clip, and the last
+   column is the difference.
+
+   usage: bench_reset [clips] [clip seconds] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "opusenc.h"
+#include "bench.h"
+
+static int discard(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  (void)user_data;
+  (void)ptr;
+  (void)len;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  (void)user_data;
+  return 0;
+}
+
+static const OpusEncCallbacks callbacks = {discard, close_nothing};
+
+static OggOpusEnc *create(OggOpusComments *comments, opus_int32 rate) {
+  OggOpusEnc *enc;
+  int err;
+  enc = ope_encoder_create_callbacks(&callbacks, NULL, comments, rate, 1, 0, &err);
+  if (enc == NULL) {
+    fprintf(stderr, "cannot create an encoder: %s\n", ope_strerror(err));
+    exit(1);
+  }
+  return enc;
+}
+
+static void encode_clip(OggOpusEnc *enc, const float *in, long samples, opus_int32 rate) {
+  long pos;
+  for (pos=0;pos<samples;pos+=rate/50) {
+    ope_encoder_write_float(enc, &in[pos], (int)(samples - pos < rate/50 ? samples - pos : rate/50));
+  }
+  ope_encoder_drain(enc);
+}
+
+/* Both return the time per clip, encoding samples of in for each. */
+static double run_create(OggOpusComments *comments, int clips, const float *in, long samples, opus_int32 rate) {
+  double t = bench_now();
+  int i;
+  for (i=0;i<clips;i++) {
+    OggOpusEnc *enc = create(comments, rate);
+    encode_clip(enc, in, samples, rate);
+    ope_encoder_destroy(enc);
+  }
+  return (bench_now() - t)/clips;
+}
+
+static double run_reset(OggOpusComments *comments, int clips, const float *in, long samples, opus_int32 rate) {
+  OggOpusEnc *enc = create(comments, rate);
+  double t = bench_now();
+  int i;
+  for (i=0;i<clips;i++) {
+    if (ope_encoder_reset(enc, NULL, comments) != OPE_OK) {
+      fprintf(stderr, "cannot reset the encoder\n");
+      exit(1);
+    }
+    encode_clip(enc, in, samples, rate);
+  }
+  t = bench_now() - t;
+  ope_encoder_destroy(enc);
+  return t/clips;
+}
+
+int main(int argc, char **argv) {
+  static const opus_int32 rates[] = {48000, 24000};
+  int clips = argc > 1 ? atoi(argv[1]) : 1000;
+  double seconds = argc > 2 ? atof(argv[2]) : 1;
+  OggOpusComments *comments;
+  float *in;
+  int r;
+  if (clips <= 0 || seconds <= 0) {
+    fprintf(stderr, "usage: %s [clips] [clip seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*(long)(seconds*48000));
+  comments = ope_comments_create();
+  if (in == NULL || comments == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, (long)(seconds*48000), 1);
+  printf("%d clips of %.1f s of mono audio\n", clips, seconds);
+  /* Microseconds per clip. */
+  printf("    rate   create/destroy    reset   saved\n");
+  for (r=0;r<(int)(sizeof(rates)/sizeof(rates[0]));r++) {
+    long samples = (long)(seconds*rates[r]);
+    double t_create = run_create(comments, clips, in, samples, rates[r]);
+    double t_reset = run_reset(comments, clips, in, samples, rates[r]);
+    printf("%8d   %14.1f   %6.1f   %5.1f\n", rates[r], 1e6*t_create, 1e6*t_reset, 1e6*(t_create - t_reset));
+  }
+  ope_comments_destroy(comments);
+  free(in);
+  return 0;
+}
@@ -0,0 +1,75 @@
+/* Times ope_encoder_write_float() on a 48 kHz stream with no decision delay
+   and with the default 2 s one, for a few channel counts. libopus runs at
+   complexity 0, where it doesn't look at the lookahead, so the difference
+   between the two is mostly what staging the longer window in the buffer
+   costs. The worst write shows whether any write has to move the window
+   around.
+
+   usage: bench_ring [seconds] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "opusenc.h"
+#include "bench.h"
+
+#define FRAME 960
+
+/* Returns the time per sample (all channels included) spent writing frames
+   of audio, and the longest write in *worst. */
+static double run(const float *in, int channels, int delay, long frames, double *worst) {
+  OggOpusComments *comments;
+  OggOpusEnc *enc;
+  unsigned char *page;
+  opus_int32 len;
+  double total = 0;
+  long i;
+  int err;
+  comments = ope_comments_create();
+  enc = ope_encoder_create_pull(comments, 48000, channels, channels > 8 ? 255 : channels > 2, &err);
+  if (enc == NULL) {
+    fprintf(stderr, "cannot create an encoder: %s\n", ope_strerror(err));
+    exit(1);
+  }
+  ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(delay));
+  ope_encoder_ctl(enc, OPUS_SET_COMPLEXITY(0));
+  *worst = 0;
+  for (i=0;i<frames;i++) {
+    double t = bench_now();
+    ope_encoder_write_float(enc, in, FRAME);
+    t = bench_now() - t;
+    total += t;
+    if (t > *worst) *worst = t;
+    while (ope_encoder_get_page(enc, &page, &len, 0)) {}
+  }
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  return total/((double)frames*FRAME);
+}
+
+int main(int argc, char **argv) {
+  static const int channels[] = {1, 2, 6, 16, 255};
+  double seconds = argc > 1 ? atof(argv[1]) : 10;
+  long frames = (long)(seconds*48000/FRAME);
+  int c;
+  if (frames <= 0) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  printf("%.1f s of 48 kHz audio, %d ms writes, complexity 0\n", frames*FRAME/48000., FRAME/48);
+  printf("channels   no delay ns/sample worst us   2 s delay ns/sample worst us\n");
+  for (c=0;c<(int)(sizeof(channels)/sizeof(channels[0]));c++) {
+    int ch = channels[c];
+    float *in = malloc(sizeof(*in)*FRAME*ch);
+    double t0, t2, worst0, worst2;
+    if (in == NULL) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+    bench_noise(in, FRAME*ch, ch);
+    t0 = run(in, ch, 0, frames, &worst0);
+    t2 = run(in, ch, 96000, frames, &worst2);
+    printf("%8d   %18.1f %8.0f   %19.1f %8.0f\n", ch, 1e9*t0, 1e6*worst0, 1e9*t2, 1e6*worst2);
+    free(in);
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+/* Measures the cost per input sample of ope_encoder_write_float() for write
+   sizes from 1 to 4096 samples, for stereo input at 48 kHz and (resampled)
+   at 44.1 kHz. Small writes are gathered before resampling, so the cost
+   should stay about the same down to the smallest writes. The encoder runs
+   at complexity 0 so that what writing costs on top of it shows.
+
+   usage: bench_write_size [seconds] */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "opusenc.h"
+#include "bench.h"
+
+static int discard(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  (void)user_data;
+  (void)ptr;
+  (void)len;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  (void)user_data;
+  return 0;
+}
+
+static const OpusEncCallbacks callbacks = {discard, close_nothing};
+
+/* Returns the time per sample (per channel) of writing samples of in, size at a time. */
+static double run(OggOpusComments *comments, const float *in, long samples, opus_int32 rate, int size) {
+  OggOpusEnc *enc;
+  long pos;
+  double t;
+  int err;
+  enc = ope_encoder_create_callbacks(&callbacks, NULL, comments, rate, 2, 0, &err);
+  if (enc == NULL) {
+    fprintf(stderr, "cannot create an encoder: %s\n", ope_strerror(err));
+    exit(1);
+  }
+  ope_encoder_ctl(enc, OPUS_SET_COMPLEXITY(0));
+  t = bench_now();
+  for (pos=0;pos<samples;pos+=size) {
+    ope_encoder_write_float(enc, &in[2*pos], (int)(samples - pos < size ? samples - pos : size));
+  }
+  ope_encoder_drain(enc);
+  t = bench_now() - t;
+  ope_encoder_destroy(enc);
+  return t/samples;
+}
+
+int main(int argc, char **argv) {
+  static const opus_int32 rates[] = {48000, 44100};
+  double seconds = argc > 1 ? atof(argv[1]) : 10;
+  OggOpusComments *comments;
+  float *in;
+  int size;
+  int r;
+  if (seconds <= 0) {
+    fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+    return 1;
+  }
+  in = malloc(sizeof(*in)*2*(long)(seconds*48000));
+  comments = ope_comments_create();
+  if (in == NULL || comments == NULL) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  bench_noise(in, 2*(long)(seconds*48000), 1);
+  printf("%.1f s of stereo audio\n", seconds);
+  /* Nanoseconds per sample. */
+  printf("  write size");
+  for (r=0;r<(int)(sizeof(rates)/sizeof(rates[0]));r++) printf("   %8d", rates[r]);
+  printf("\n");
+  for (size=1;size<=4096;size*=2) {
+    printf("%12d", size);
+    for (r=0;r<(int)(sizeof(rates)/sizeof(rates[0]));r++) {
+      printf("   %8.1f", 1e9*run(comments, in, (long)(seconds*rates[r]), rates[r], size));
+    }
+    printf("\n");
+  }
+  ope_comments_destroy(comments);
+  free(in);
+  return 0;
+}
@@ -0,0 +1,43 @@
+/* Builds of the resampler (src/resample.c) compiled into the benchmarks
+   themselves, since the library doesn't export it. Each one is made by a
+   resampler_*.c file including resampler_variant.h. */
+
+#ifndef BENCH_RESAMPLER_H
+#define BENCH_RESAMPLER_H
+
+typedef struct {
+  const char *name;
+  /* The kernels this build uses on this CPU: "c", "sse" or "avx2". */
+  const char *(*kernels)(void);
+  void *(*create)(int channels, int in_rate, int out_rate, int quality);
+  void (*destroy)(void *st);
+  /* Interleaved, with the multi-channel path when the resampler has one. */
+  void (*process)(void *st, const float *in, unsigned *in_len, float *out, unsigned *out_len);
+  /* Interleaved too, but one channel at a time. */
+  void (*process_each)(void *st, const float *in, unsigned *in_len, float *out, unsigned *out_len);
+  void (*skip_zeros)(void *st);
+  /* Taps of the polyphase filter. */
+  int (*filter_length)(void *st);
+  /* Delay of the output, in output samples. */
+  int (*latency)(void *st);
+} BenchResampler;
+
+/* Plain C kernels. */
+extern const BenchResampler bench_resampler_c;
+/* SSE kernels. */
+extern const BenchResampler bench_resampler_sse;
+/* As in the library: SSE, or AVX2/FMA when the CPU has them. */
+extern const BenchResampler bench_resampler_default;
+/* The same without the cache of filter tables, so that each one created
+   computes its own (unless it is one of the precomputed ones). */
+extern const BenchResampler bench_resampler_uncached;
+/* The same without half-band stages, the polyphase filter doing all the
+   downsampling. */
+extern const BenchResampler bench_resampler_polyphase;
+
+/* Gain in dB at out_freq of resampling a tone at in_freq from in_rate to
+   out_rate with r (in resampler_tone.c). */
+double bench_tone_gain(const BenchResampler *r, int quality, int in_rate, int out_rate, double in_freq,
+    double out_freq);
+
+#endif
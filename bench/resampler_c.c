@@ -0,0 +1,5 @@
+/* The resampler with plain C kernels, see resampler.h. */
+#define VARIANT bench_resampler_c
+#define VARIANT_NAME "c"
+#define VARIANT_NO_SSE
+#include "resampler_variant.h"
@@ -0,0 +1,4 @@
+/* The resampler as built into the library, see resampler.h. */
+#define VARIANT bench_resampler_default
+#define VARIANT_NAME "default"
+#include "resampler_variant.h"
@@ -0,0 +1,6 @@
+/* The resampler as built into the library but without half-band stages, see
+   resampler.h. */
+#define VARIANT bench_resampler_polyphase
+#define VARIANT_NAME "polyphase"
+#define VARIANT_NO_HALFBAND
+#include "resampler_variant.h"
@@ -0,0 +1,5 @@
+/* The resampler with SSE kernels, see resampler.h. */
+#define VARIANT bench_resampler_sse
+#define VARIANT_NAME "sse"
+#define VARIANT_NO_AVX2
+#include "resampler_variant.h"
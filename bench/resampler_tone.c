@@ -0,0 +1,53 @@
+/* Measures the response of a resampler to a tone, see resampler.h. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "resampler.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/* Output samples skipped for the filters to settle, and measured. */
+#define SETTLE 1024
+#define MEASURE 8192
+
+double bench_tone_gain(const BenchResampler *r, int quality, int in_rate, int out_rate, double in_freq,
+    double out_freq) {
+  float *in;
+  float *out;
+  void *st;
+  unsigned in_len = (unsigned)((SETTLE + MEASURE)*(double)in_rate/out_rate) + 1024;
+  unsigned out_len = SETTLE + MEASURE;
+  double re = 0;
+  double im = 0;
+  double sum_w = 0;
+  unsigned i;
+  in = malloc(sizeof(*in)*in_len);
+  out = malloc(sizeof(*out)*out_len);
+  st = r->create(1, in_rate, out_rate, quality);
+  if (in == NULL || out == NULL || st == NULL) {
+    fprintf(stderr, "cannot create a resampler\n");
+    exit(1);
+  }
+  for (i=0;i<in_len;i++) in[i] = (float)(.5*sin(2*M_PI*in_freq*i/in_rate));
+  r->skip_zeros(st);
+  r->process(st, in, &in_len, out, &out_len);
+  r->destroy(st);
+  if (out_len < SETTLE + MEASURE) {
+    fprintf(stderr, "not enough output\n");
+    exit(1);
+  }
+  /* Hann window, so that the measure doesn't depend on the phase. */
+  for (i=0;i<MEASURE;i++) {
+    double w = .5 - .5*cos(2*M_PI*(i + .5)/MEASURE);
+    double x = out[SETTLE + i]*w;
+    re += x*cos(2*M_PI*out_freq*i/out_rate);
+    im += x*sin(2*M_PI*out_freq*i/out_rate);
+    sum_w += w;
+  }
+  free(out);
+  free(in);
+  return 20*log10(2*sqrt(re*re + im*im)/sum_w/.5 + 1e-20);
+}
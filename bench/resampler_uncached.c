@@ -0,0 +1,6 @@
+/* The resampler as built into the library but without the cache of filter
+   tables, see resampler.h. */
+#define VARIANT bench_resampler_uncached
+#define VARIANT_NAME "uncached"
+#define VARIANT_NO_CACHE
+#include "resampler_variant.h"
@@ -0,0 +1,84 @@
+/* Compiles src/resample.c into one of the builds declared in resampler.h,
+   called VARIANT and described as VARIANT_NAME. Defining VARIANT_NO_SSE or
+   VARIANT_NO_AVX2 first leaves out those kernels, VARIANT_NO_CACHE the cache
+   of filter tables (which needs pthreads) and VARIANT_NO_HALFBAND the
+   half-band stages. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#undef HAVE_CONFIG_H
+#endif
+
+#ifdef VARIANT_NO_SSE
+#undef __SSE__
+#undef __SSE2__
+#define VARIANT_NO_AVX2
+#endif
+#ifdef VARIANT_NO_AVX2
+#undef RESAMPLE_AVX2
+#endif
+#ifdef VARIANT_NO_CACHE
+#undef HAVE_PTHREAD
+#endif
+#ifdef VARIANT_NO_HALFBAND
+#define RESAMPLE_NO_HALFBAND
+#endif
+
+#undef RANDOM_PREFIX
+#define RANDOM_PREFIX VARIANT
+#include "../src/resample.c"
+#include "resampler.h"
+
+static const char *variant_kernels(void) {
+#ifdef RESAMPLE_AVX2
+  if (resampler_cpu_has_avx2()) return "avx2";
+#endif
+#ifdef __SSE__
+  return "sse";
+#else
+  return "c";
+#endif
+}
+
+static void *variant_create(int channels, int in_rate, int out_rate, int quality) {
+  return speex_resampler_init(channels, in_rate, out_rate, quality, NULL);
+}
+
+static void variant_destroy(void *st) {
+  speex_resampler_destroy((SpeexResamplerState *)st);
+}
+
+static void variant_process(void *st, const float *in, unsigned *in_len, float *out, unsigned *out_len) {
+  speex_resampler_process_interleaved_float((SpeexResamplerState *)st, in, in_len, out, out_len);
+}
+
+static void variant_process_each(void *st, const float *in, unsigned *in_len, float *out, unsigned *out_len) {
+  SpeexResamplerState *s = (SpeexResamplerState *)st;
+  unsigned in_avail = *in_len;
+  unsigned out_avail = *out_len;
+  spx_uint32_t c;
+  speex_resampler_set_input_stride(s, s->nb_channels);
+  speex_resampler_set_output_stride(s, s->nb_channels);
+  for (c=0;c<s->nb_channels;c++) {
+    *in_len = in_avail;
+    *out_len = out_avail;
+    speex_resampler_process_float(s, c, in + c, in_len, out + c, out_len);
+  }
+}
+
+static void variant_skip_zeros(void *st) {
+  speex_resampler_skip_zeros((SpeexResamplerState *)st);
+}
+
+static int variant_filter_length(void *st) {
+  return (int)((SpeexResamplerState *)st)->filt_len;
+}
+
+static int variant_latency(void *st) {
+  return speex_resampler_get_output_latency((SpeexResamplerState *)st);
+}
+
+const BenchResampler VARIANT = {
+  VARIANT_NAME, variant_kernels, variant_create, variant_destroy,
+  variant_process, variant_process_each, variant_skip_zeros, variant_filter_length, variant_latency
+};
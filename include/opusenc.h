@@ -100,6 +100,48 @@ extern "C" {
 #define OPE_INVALID_ICON -33
 #define OPE_WRITE_FAIL -34
 #define OPE_CLOSE_FAIL -35
+#define OPE_BUFFER_FULL -36
+
+/**@}*/
+/**@}*/
+
+/**\defgroup sample_formats Sample Formats*/
+/**@{*/
+
+/**\name Input sample formats
+
+   Formats accepted by ope_encoder_write_format(). Integer formats are scaled so
+   that their full range maps to +/-1.*/
+/**@{*/
+
+/** Signed 16-bit, native byte order (same as ope_encoder_write()) */
+#define OPE_FORMAT_S16 0
+/** Signed 32-bit, native byte order */
+#define OPE_FORMAT_S32 1
+/** 32-bit float, native byte order (same as ope_encoder_write_float()) */
+#define OPE_FORMAT_FLOAT 2
+/** 64-bit float, native byte order */
+#define OPE_FORMAT_F64 3
+/** Signed 16-bit, little-endian */
+#define OPE_FORMAT_S16LE 4
+/** Signed 16-bit, big-endian */
+#define OPE_FORMAT_S16BE 5
+/** Signed 24-bit packed in 3 bytes, little-endian */
+#define OPE_FORMAT_S24LE 6
+/** Signed 24-bit packed in 3 bytes, big-endian */
+#define OPE_FORMAT_S24BE 7
+/** Signed 32-bit, little-endian */
+#define OPE_FORMAT_S32LE 8
+/** Signed 32-bit, big-endian */
+#define OPE_FORMAT_S32BE 9
+/** 32-bit float, little-endian */
+#define OPE_FORMAT_F32LE 10
+/** 32-bit float, big-endian */
+#define OPE_FORMAT_F32BE 11
+/** 64-bit float, little-endian */
+#define OPE_FORMAT_F64LE 12
+/** 64-bit float, big-endian */
+#define OPE_FORMAT_F64BE 13
 
 /**@}*/
 /**@}*/
@@ -119,6 +161,36 @@ extern "C" {
 #define OPE_GET_HEADER_GAIN_REQUEST         14011
 #define OPE_GET_NB_STREAMS_REQUEST          14013
 #define OPE_GET_NB_COUPLED_STREAMS_REQUEST  14015
+#define OPE_SET_MAX_DECISION_DELAY_REQUEST  14016
+#define OPE_GET_MAX_DECISION_DELAY_REQUEST  14017
+#define OPE_SET_RESAMPLER_QUALITY_REQUEST   14018
+#define OPE_GET_RESAMPLER_QUALITY_REQUEST   14019
+#define OPE_SET_INPUT_RATE_REQUEST          14020
+#define OPE_GET_INPUT_RATE_REQUEST          14021
+#define OPE_SET_RATE_CORRECTION_REQUEST     14022
+#define OPE_GET_RATE_CORRECTION_REQUEST     14023
+#define OPE_SET_DRIFT_TARGET_REQUEST        14024
+#define OPE_GET_DRIFT_TARGET_REQUEST        14025
+#define OPE_SET_DRIFT_FILL_REQUEST          14026
+/*#define OPE_GET_DRIFT_FILL_REQUEST          14027*/
+#define OPE_SET_ASYNC_BUFFER_REQUEST        14028
+#define OPE_GET_ASYNC_BUFFER_REQUEST        14029
+#define OPE_GET_ASYNC_OVERRUNS_REQUEST      14031
+#define OPE_GET_ASYNC_UNDERRUNS_REQUEST     14033
+#define OPE_SET_DEFERRED_ENCODING_REQUEST   14034
+#define OPE_GET_DEFERRED_ENCODING_REQUEST   14035
+#define OPE_SET_ENCODER_POOL_REQUEST        14036
+/*#define OPE_GET_ENCODER_POOL_REQUEST        14037*/
+#define OPE_SET_ENCODE_THREADS_REQUEST      14038
+#define OPE_GET_ENCODE_THREADS_REQUEST      14039
+#define OPE_SET_STREAM_THREADS_REQUEST      14040
+#define OPE_GET_STREAM_THREADS_REQUEST      14041
+#define OPE_SET_RESAMPLER_THREADS_REQUEST   14042
+#define OPE_GET_RESAMPLER_THREADS_REQUEST   14043
+#define OPE_SET_NATIVE_RATE_REQUEST         14044
+#define OPE_GET_NATIVE_RATE_REQUEST         14045
+#define OPE_SET_MAX_BACKLOG_REQUEST         14046
+#define OPE_GET_MAX_BACKLOG_REQUEST         14047
 
 /* Macros to trigger compilation errors when the wrong types are provided to a CTL. */
 /* These macros are not part of the API and are only for use within the macros below. */
@@ -126,6 +198,7 @@ extern "C" {
 #define ope_check_int_ptr(ptr) ((ptr) + ((ptr) - (opus_int32*)(ptr)))
 #define ope_check_packet_func(x) ((void)((void (*)(void *, const unsigned char *, opus_int32, opus_uint32))0 == (x)), (x))
 #define ope_check_void_ptr(x) ((void)((void *)0 == (x)), (x))
+#define ope_check_pool_ptr(x) ((void)((OggOpusEncPool *)0 == (x)), (x))
 
 /**\defgroup encoder_ctl Encoding Options*/
 /**@{*/
@@ -149,6 +222,162 @@ extern "C" {
 #define OPE_GET_HEADER_GAIN(x) OPE_GET_HEADER_GAIN_REQUEST, ope_check_int_ptr(x)
 #define OPE_GET_NB_STREAMS(x) OPE_GET_NB_STREAMS_REQUEST, ope_check_int_ptr(x)
 #define OPE_GET_NB_COUPLED_STREAMS(x) OPE_GET_NB_COUPLED_STREAMS_REQUEST, ope_check_int_ptr(x)
+/** Sets the largest decision delay, in samples at 48 kHz, from 0 to 96000
+    (the default). Longer values are capped at 96000 and negative ones fail with
+    OPE_BAD_ARG. OPE_SET_DECISION_DELAY clamps its value to this, and lowering
+    it also lowers a longer current decision delay, shrinking the buffer. The
+    starting value is the max_decision_delay given to
+    ope_encoder_create_with_max_delay(). */
+#define OPE_SET_MAX_DECISION_DELAY(x) OPE_SET_MAX_DECISION_DELAY_REQUEST, ope_check_int(x)
+/** Gets the largest decision delay, in samples at 48 kHz. */
+#define OPE_GET_MAX_DECISION_DELAY(x) OPE_GET_MAX_DECISION_DELAY_REQUEST, ope_check_int_ptr(x)
+/** Sets the quality of the resampler used when the input is not at the rate
+    libopus runs at (48 kHz unless OPE_SET_NATIVE_RATE is set), from 0 (fastest)
+    to 10 (best). The default is 5. This can only be changed before the first
+    samples are written.
+
+    Quality | Filter taps | Bandwidth | Stopband | Latency at 44.1 kHz | Relative CPU
+    --------|-------------|-----------|----------|---------------------|-------------
+    0       | 8           | 16.6 kHz  | 62 dB    | 0.08 ms             | 0.5x
+    1       | 16          | 18.2 kHz  | 67 dB    | 0.19 ms             | 0.5x
+    2       | 32          | 19.5 kHz  | 72 dB    | 0.35 ms             | 0.6x
+    3       | 48          | 19.8 kHz  | 88 dB    | 0.54 ms             | 0.8x
+    4       | 64          | 20.4 kHz  | 90 dB    | 0.73 ms             | 0.9x
+    5       | 80          | 20.4 kHz  | 107 dB   | 0.92 ms             | 1x
+    6       | 96          | 20.6 kHz  | 108 dB   | 1.08 ms             | 1.2x
+    7       | 128         | 20.8 kHz  | 108 dB   | 1.46 ms             | 1.6x
+    8       | 160         | 21.0 kHz  | 110 dB   | 1.81 ms             | 1.8x
+    9       | 192         | 21.2 kHz  | 128 dB   | 2.17 ms             | 8.5x
+    10      | 256         | 21.4 kHz  | 127 dB   | 2.90 ms             | 11x
+
+    The bandwidth is where 44.1 kHz input is 3 dB down, the stopband how far
+    below a tone its worst alias under 20 kHz is, from 64 kHz input. The CPU
+    time is for 44.1 kHz input with the AVX2 kernels, and depends on the
+    machine. bench/bench_resample_quality generates the table. Qualities 9 and
+    10 accumulate in double precision, hence the jump in cost. */
+#define OPE_SET_RESAMPLER_QUALITY(x) OPE_SET_RESAMPLER_QUALITY_REQUEST, ope_check_int(x)
+#define OPE_GET_RESAMPLER_QUALITY(x) OPE_GET_RESAMPLER_QUALITY_REQUEST, ope_check_int_ptr(x)
+/** When set to 1, input at 8, 12, 16 or 24 kHz is encoded by libopus at that
+    rate instead of being resampled to 48 kHz, which saves the resampler's CPU
+    time and latency. Granule positions and the pre-skip stay at 48 kHz. The
+    default is 0. Since libopus has to be set up again, this must come before
+    any libopus ctl, before ope_encoder_deferred_init_with_mapping() and before
+    the first samples are written, or it returns OPE_TOO_LATE. */
+#define OPE_SET_NATIVE_RATE(x) OPE_SET_NATIVE_RATE_REQUEST, ope_check_int(x)
+#define OPE_GET_NATIVE_RATE(x) OPE_GET_NATIVE_RATE_REQUEST, ope_check_int_ptr(x)
+/** Changes the rate of the samples passed to the write functions, in the
+    middle of a stream. The granule positions stay continuous and keep counting
+    what was written at each rate, so no new stream or header is needed. When
+    resampling on both sides of the change, the audio that follows moves by
+    the difference in resampler delay between the two rates, which is largest
+    with high resampler qualities and low input rates.
+    Opus keeps encoding at the rate it started with (see OPE_SET_NATIVE_RATE),
+    so switching from 48 kHz to 16 kHz input still produces a 48 kHz stream. The
+    input rate recorded in the header only changes for streams that have not
+    started yet. */
+#define OPE_SET_INPUT_RATE(x) OPE_SET_INPUT_RATE_REQUEST, ope_check_int(x)
+#define OPE_GET_INPUT_RATE(x) OPE_GET_INPUT_RATE_REQUEST, ope_check_int_ptr(x)
+/** Corrects for the clock of the source drifting from its nominal rate, in
+    parts per billion, between -10000000 and 10000000 (+/-1%). A positive value
+    means the source runs fast: its samples are treated as if they were at
+    rate*(1+x/1e9) Hz, so each one lasts a little less. This works at any
+    input rate, including 48 kHz, where a resampler is added for it. */
+#define OPE_SET_RATE_CORRECTION(x) OPE_SET_RATE_CORRECTION_REQUEST, ope_check_int(x)
+/** Gets the current correction, including the one set by the drift controller. */
+#define OPE_GET_RATE_CORRECTION(x) OPE_GET_RATE_CORRECTION_REQUEST, ope_check_int_ptr(x)
+/** Enables the built-in drift controller, which adjusts the rate correction
+    to keep a buffer of the caller at the given fill level (in 48 kHz samples).
+    -1 (the default) disables it. */
+#define OPE_SET_DRIFT_TARGET(x) OPE_SET_DRIFT_TARGET_REQUEST, ope_check_int(x)
+#define OPE_GET_DRIFT_TARGET(x) OPE_GET_DRIFT_TARGET_REQUEST, ope_check_int_ptr(x)
+/** Reports the current fill level (in 48 kHz samples) of the buffer regulated
+    by the drift controller, e.g. samples captured but not yet written. Any
+    measure that grows when the source runs fast works. Reports can come at any
+    interval, once per write is typical. The correction moves in steps of
+    10 ppm. Returns OPE_BAD_ARG unless OPE_SET_DRIFT_TARGET() enabled
+    the controller. */
+#define OPE_SET_DRIFT_FILL(x) OPE_SET_DRIFT_FILL_REQUEST, ope_check_int(x)
+/*#define OPE_GET_DRIFT_FILL(x) OPE_GET_DRIFT_FILL_REQUEST, (x)*/
+/** Moves encoding to a background thread. The write functions then only copy
+    the samples to a ring of x samples per channel (rounded up to a power of
+    two, which OPE_GET_ASYNC_BUFFER() reports) and never block, which
+    makes them safe to call from a real-time audio callback; samples that do
+    not fit are dropped. 0 (the default) stops the thread after it has encoded
+    everything already written. While the thread runs, the only other calls
+    allowed are the write functions, these four ctls and ope_encoder_drain(),
+    which finishes encoding and stops the thread; other ctls return
+    OPE_TOO_LATE, as do the chaining functions. Returns OPE_UNIMPLEMENTED for
+    encoders created with ope_encoder_create_pull() or when the library was
+    built without threads. */
+#define OPE_SET_ASYNC_BUFFER(x) OPE_SET_ASYNC_BUFFER_REQUEST, ope_check_int(x)
+#define OPE_GET_ASYNC_BUFFER(x) OPE_GET_ASYNC_BUFFER_REQUEST, ope_check_int_ptr(x)
+/** Gets the number of samples per channel dropped because the ring was full. */
+#define OPE_GET_ASYNC_OVERRUNS(x) OPE_GET_ASYNC_OVERRUNS_REQUEST, ope_check_int_ptr(x)
+/** Gets the number of times the writes fell behind: the background thread (or
+    the pool) encoded everything written and then got more than 20 ms less
+    audio than the time that passed before the writes resumed. Running out of
+    samples while the writes keep up doesn't count, and a gap counts once,
+    when the writes resume. */
+#define OPE_GET_ASYNC_UNDERRUNS(x) OPE_GET_ASYNC_UNDERRUNS_REQUEST, ope_check_int_ptr(x)
+/** When set to 1, the write functions only buffer the samples and the
+    encoding is done by ope_encoder_step(), a bounded number of frames at a
+    time. The buffer grows as needed to hold everything not encoded yet, up to
+    OPE_SET_MAX_BACKLOG(). Setting it back to 0 encodes the backlog on the next
+    write. Cannot be combined with OPE_SET_ASYNC_BUFFER(). */
+#define OPE_SET_DEFERRED_ENCODING(x) OPE_SET_DEFERRED_ENCODING_REQUEST, ope_check_int(x)
+#define OPE_GET_DEFERRED_ENCODING(x) OPE_GET_DEFERRED_ENCODING_REQUEST, ope_check_int_ptr(x)
+/** Limits the audio (in 48 kHz samples per channel) that deferred encoding
+    and OPE_SET_ENCODE_THREADS() buffer on top of the decision delay. In
+    deferred mode, a write that would go over it takes nothing and returns
+    OPE_BUFFER_FULL: encode some with ope_encoder_step() and write again.
+    Bigger writes than the limit never fit. The default is 480000 (10
+    seconds). */
+#define OPE_SET_MAX_BACKLOG(x) OPE_SET_MAX_BACKLOG_REQUEST, ope_check_int(x)
+#define OPE_GET_MAX_BACKLOG(x) OPE_GET_MAX_BACKLOG_REQUEST, ope_check_int_ptr(x)
+/** Makes OPE_SET_ASYNC_BUFFER() hand the encoding to the threads of a pool
+    created with ope_pool_create() instead of starting a thread for this
+    encoder. Once the samples written make up a frame to encode (or fill half
+    the ring), the encoder is queued and the first free thread of the pool
+    encodes them. Queuing takes no lock, so the write functions still never
+    block; a thread that misses the wake-up picks the encoder up within 20 ms.
+    Must be set before OPE_SET_ASYNC_BUFFER(), NULL (the default) goes back to
+    a dedicated thread. The pool must outlive the encoder. */
+#define OPE_SET_ENCODER_POOL(x) OPE_SET_ENCODER_POOL_REQUEST, ope_check_pool_ptr(x)
+/*#define OPE_GET_ENCODER_POOL(x) OPE_GET_ENCODER_POOL_REQUEST, (x)*/
+/** For offline encoding: splits the audio into 20-second segments and encodes
+    x of them at a time in parallel, each on its own thread with its own copy
+    of the encoder. Every segment after the first is primed by encoding the
+    half second before it, then starts with a frame that does not depend on
+    the previous ones. The packets go into the stream in order, so the result
+    is a single regular stream. Writes only buffer the audio until there is
+    enough for all the threads (x*20 seconds, or OPE_SET_MAX_BACKLOG() split
+    into shorter segments if that is less), and ope_encoder_drain() encodes
+    the rest. When the limit leaves less than 2 seconds per segment for 2
+    segments, the audio is encoded sequentially. Settings changed in the
+    meantime apply to everything still buffered. 1 (the default) encodes
+    sequentially. */
+#define OPE_SET_ENCODE_THREADS(x) OPE_SET_ENCODE_THREADS_REQUEST, ope_check_int(x)
+#define OPE_GET_ENCODE_THREADS(x) OPE_GET_ENCODE_THREADS_REQUEST, ope_check_int_ptr(x)
+/** For multistream encoders: encodes the elementary streams of each frame in
+    parallel on x threads, the calling one included, then assembles the
+    packet the way libopus does. Only available for mapping families 2 and
+    255 with more than one stream, anything else but 1 returns
+    OPE_UNIMPLEMENTED (a deferred encoder takes it before its family is known,
+    then ignores it if the family doesn't allow it). Only used with VBR: with
+    CBR, and for the frame after any settings change, frames are encoded
+    normally. 1 (the default) disables it. Each stream keeps its own copy of
+    the audio libopus analyses, up to 1.9 s from the frame on, with room
+    for as much again: with the default decision delay that is about
+    730 kB per channel at 48 kHz, or 186 MB for 255 channels. */
+#define OPE_SET_STREAM_THREADS(x) OPE_SET_STREAM_THREADS_REQUEST, ope_check_int(x)
+#define OPE_GET_STREAM_THREADS(x) OPE_GET_STREAM_THREADS_REQUEST, ope_check_int_ptr(x)
+/** Resamples the channels of each write on x threads, the calling one
+    included, each taking a group of consecutive channels. Only matters when
+    the input is resampled: when it is not at the rate libopus runs at (48 kHz
+    unless OPE_SET_NATIVE_RATE is set), or when OPE_SET_RATE_CORRECTION is in
+    use. 1 (the default) resamples all channels on the calling thread. */
+#define OPE_SET_RESAMPLER_THREADS(x) OPE_SET_RESAMPLER_THREADS_REQUEST, ope_check_int(x)
+#define OPE_GET_RESAMPLER_THREADS(x) OPE_GET_RESAMPLER_THREADS_REQUEST, ope_check_int_ptr(x)
 /**@}*/
 /**@}*/
 
@@ -193,6 +422,24 @@ typedef struct {
   /** Callback for closing the stream. */
   ope_close_func close;
 } OpusEncCallbacks;
+
+/** Memory allocation functions, used for all the memory of an encoder or a
+    comments object. Either all three functions are set, or none of them to
+    use malloc(), realloc() and free(). alloc() need not clear the memory.
+    Some memory always comes from malloc(): the resampler filter tables
+    (which encoders share through a cache when built with threads), the thread
+    pools of ope_pool_create(), and the file handles of
+    ope_encoder_create_file() and ope_encoder_continue_new_file(). */
+typedef struct {
+  /** Allocates size bytes, returning NULL on failure. */
+  void *(*alloc)(void *user_data, size_t size);
+  /** Resizes a block, like realloc(). ptr may be NULL. */
+  void *(*realloc)(void *user_data, void *ptr, size_t size);
+  /** Frees a block. ptr is never NULL. */
+  void (*free)(void *user_data, void *ptr);
+  /** Passed to the functions above. */
+  void *user_data;
+} OpeAllocator;
 /**@}*/
 /**@}*/
 
@@ -202,6 +449,9 @@ typedef struct OggOpusComments OggOpusComments;
 /** Opaque encoder struct. */
 typedef struct OggOpusEnc OggOpusEnc;
 
+/** Opaque thread pool struct. */
+typedef struct OggOpusEncPool OggOpusEncPool;
+
 /**\defgroup comments Comments Handling */
 /**@{*/
 
@@ -214,6 +464,12 @@ typedef struct OggOpusEnc OggOpusEnc;
     \return Newly-created comments object. */
 OPE_EXPORT OggOpusComments *ope_comments_create(void);
 
+/** Create a new comments object whose memory comes from an allocator. Copies
+    of it use the same allocator.
+    \param allocator Allocation functions, copied (NULL for the default)
+    \return Newly-created comments object. */
+OPE_EXPORT OggOpusComments *ope_comments_create_with_allocator(const OpeAllocator *allocator);
+
 /** Create a deep copy of a comments object.
     \param comments Comments object to copy
     \return Deep copy of input. */
@@ -303,6 +559,87 @@ OPE_EXPORT OggOpusEnc *ope_encoder_create_callbacks(const OpusEncCallbacks *call
     */
 OPE_EXPORT OggOpusEnc *ope_encoder_create_pull(OggOpusComments *comments, opus_int32 rate, int channels, int family, int *error);
 
+/** Create a new OggOpus stream whose memory comes from an allocator. This
+  covers the libopus and resampler states too, but not the filter tables the
+  resampler shares between encoders. Clones of the encoder use the same
+  allocator.
+    \param callbacks  Callback functions, or NULL to use ope_encoder_get_page()
+    \param user_data  Pointer to be associated with the stream and passed to the callbacks
+    \param comments   Comments associated with the stream
+    \param rate       Input sampling rate (48 kHz is faster)
+    \param channels   Number of channels
+    \param family     Mapping family (0 for mono/stereo, 1 for surround)
+    \param allocator  Allocation functions, copied (NULL for the default)
+    \param[out] error Error code (NULL if no error is to be returned)
+    \return Newly-created encoder.
+    */
+OPE_EXPORT OggOpusEnc *ope_encoder_create_with_allocator(const OpusEncCallbacks *callbacks, void *user_data,
+    OggOpusComments *comments, opus_int32 rate, int channels, int family, const OpeAllocator *allocator, int *error);
+
+/** Create a new OggOpus stream whose decision delay is capped from the start,
+  as with OPE_SET_MAX_DECISION_DELAY, so that no buffer is ever allocated for
+  a longer delay than max_decision_delay.
+    \param callbacks          Callback functions, or NULL to use ope_encoder_get_page()
+    \param user_data          Pointer to be associated with the stream and passed to the callbacks
+    \param comments           Comments associated with the stream
+    \param rate               Input sampling rate (48 kHz is faster)
+    \param channels           Number of channels
+    \param family             Mapping family (0 for mono/stereo, 1 for surround)
+    \param max_decision_delay Largest decision delay, in samples at 48 kHz (also the initial one if lower than the default)
+    \param[out] error         Error code (NULL if no error is to be returned)
+    \return Newly-created encoder.
+    */
+OPE_EXPORT OggOpusEnc *ope_encoder_create_with_max_delay(const OpusEncCallbacks *callbacks, void *user_data,
+    OggOpusComments *comments, opus_int32 rate, int channels, int family, opus_int32 max_decision_delay, int *error);
+
+/** Get the size of the memory block ope_encoder_init_in_place() needs for
+  these settings, with comments of up to 1024 bytes plus the default padding.
+    \param rate               Input sampling rate (48 kHz is faster)
+    \param channels           Number of channels
+    \param family             Mapping family (0 for mono/stereo, 1 for surround)
+    \param max_decision_delay Largest decision delay, in samples at 48 kHz
+    \return Size in bytes, or 0 if the settings are invalid. */
+OPE_EXPORT size_t ope_encoder_get_size(opus_int32 rate, int channels, int family, opus_int32 max_decision_delay);
+
+/** Create a new OggOpus stream inside a caller-provided memory block, as
+  sized by ope_encoder_get_size(). Nothing else is allocated while creating
+  and encoding, except the filter tables the resampler shares between
+  encoders. The pages go out through the callbacks as soon as they are
+  complete, so the callbacks are required. Threads, OPE_SET_ASYNC_BUFFER and
+  deferred encoding fail with OPE_UNIMPLEMENTED, as does cloning the encoder.
+  Larger comments or padding than the block was sized for make the calls that
+  need them fail with OPE_ALLOC_FAIL. Destroy the encoder with
+  ope_encoder_destroy() before freeing the block.
+    \param mem                Memory block, kept until the encoder is destroyed
+    \param size               Size of mem in bytes
+    \param callbacks          Callback functions
+    \param user_data          Pointer to be associated with the stream and passed to the callbacks
+    \param comments           Comments associated with the stream
+    \param rate               Input sampling rate (48 kHz is faster)
+    \param channels           Number of channels
+    \param family             Mapping family (0 for mono/stereo, 1 for surround)
+    \param max_decision_delay Largest decision delay, in samples at 48 kHz
+    \param[out] error         Error code (NULL if no error is to be returned)
+    \return Newly-created encoder.
+    */
+OPE_EXPORT OggOpusEnc *ope_encoder_init_in_place(void *mem, size_t size, const OpusEncCallbacks *callbacks,
+    void *user_data, OggOpusComments *comments, opus_int32 rate, int channels, int family,
+    opus_int32 max_decision_delay, int *error);
+
+/** Create a new OggOpus stream with the same settings (ctls included) and
+  comments as an existing encoder, copying its state rather than setting up a
+  new one. Intended for configuring a prototype once and cloning it for every
+  stream. The prototype must not have started encoding and is left unchanged.
+  The new stream gets its own serial number.
+    \param proto      Encoder to copy
+    \param callbacks  Callback functions, or NULL to use ope_encoder_get_page()
+    \param user_data  Pointer to be associated with the stream and passed to the callbacks
+    \param[out] error Error code (NULL if no error is to be returned)
+    \return Newly-created encoder.
+    */
+OPE_EXPORT OggOpusEnc *ope_encoder_clone(const OggOpusEnc *proto, const OpusEncCallbacks *callbacks,
+    void *user_data, int *error);
+
 /** Deferred initialization of the encoder to force an explicit channel mapping. This can be used to override the default channel coupling,
     but using it for regular surround will almost certainly lead to worse quality.
     \param[in,out] enc         Encoder
@@ -329,6 +666,29 @@ OPE_EXPORT int ope_encoder_write_float(OggOpusEnc *enc, const float *pcm, int sa
     \return Error code*/
 OPE_EXPORT int ope_encoder_write(OggOpusEnc *enc, const opus_int16 *pcm, int samples_per_channel);
 
+/** Add/encode any number of samples in one of the OPE_FORMAT_* formats to the stream.
+    The byte-order specific formats need no particular alignment.
+    \param[in,out] enc         Encoder
+    \param pcm                 PCM values (interleaved if multiple channels)
+    \param format              Sample format (OPE_FORMAT_*)
+    \param samples_per_channel Number of samples for each channel
+    \return Error code*/
+OPE_EXPORT int ope_encoder_write_format(OggOpusEnc *enc, const void *pcm, int format, int samples_per_channel);
+
+/** Add/encode any number of planar (non-interleaved) float samples to the stream.
+    \param[in,out] enc         Encoder
+    \param pcm                 One pointer per channel to floating-point PCM values in the +/-1 range
+    \param samples_per_channel Number of samples for each channel
+    \return Error code*/
+OPE_EXPORT int ope_encoder_write_float_planar(OggOpusEnc *enc, const float *const *pcm, int samples_per_channel);
+
+/** Add/encode any number of planar (non-interleaved) 16-bit linear samples to the stream.
+    \param[in,out] enc         Encoder
+    \param pcm                 One pointer per channel to linear 16-bit PCM values in the [-32768,32767] range
+    \param samples_per_channel Number of samples for each channel
+    \return Error code*/
+OPE_EXPORT int ope_encoder_write_planar(OggOpusEnc *enc, const opus_int16 *const *pcm, int samples_per_channel);
+
 /** Get the next page from the stream (only if using ope_encoder_create_pull()).
     \param[in,out] enc Encoder
     \param[out] page   Next available encoded page
@@ -343,11 +703,45 @@ OPE_EXPORT int ope_encoder_get_page(OggOpusEnc *enc, unsigned char **page, opus_
  */
 OPE_EXPORT int ope_encoder_drain(OggOpusEnc *enc);
 
+/** Encodes buffered samples when OPE_SET_DEFERRED_ENCODING() is enabled,
+    producing at most max_frames Opus frames (pages are output as usual).
+    Frames held back by the decision delay are not encoded early, and
+    ope_encoder_drain() still encodes everything left.
+    \param[in,out] enc         Encoder
+    \param max_frames          Maximum number of frames to encode
+    \return Number of frames encoded, fewer than max_frames once the backlog
+            is done, or an error code*/
+OPE_EXPORT int ope_encoder_step(OggOpusEnc *enc, int max_frames);
+
 /** Deallocate the object. To ensure that the stream is finalized, ope_encoder_drain() should be called first.
     \param[in,out] enc Encoder
  */
 OPE_EXPORT void ope_encoder_destroy(OggOpusEnc *enc);
 
+/** Returns the encoder to the state it had after being created, keeping all
+    its memory, so it can encode another file. Anything not yet drained is
+    dropped and the current streams are closed. The settings (ctls) and the
+    callbacks are kept, and the new stream gets a new serial number.
+    \param[in,out] enc Encoder
+    \param user_data   Pointer to be associated with the new stream and passed to the callbacks
+    \param comments    Comments associated with the new stream
+    \return Error code
+ */
+OPE_EXPORT int ope_encoder_reset(OggOpusEnc *enc, void *user_data, OggOpusComments *comments);
+
+/** Create a pool of threads to encode many streams with. See
+    OPE_SET_ENCODER_POOL().
+    \param nb_threads   Number of threads, typically one per core
+    \param[out] error   Error code (NULL if no error is to be returned)
+    \return Newly-created pool, or NULL on failure (OPE_UNIMPLEMENTED if the
+            library was built without threads). */
+OPE_EXPORT OggOpusEncPool *ope_pool_create(int nb_threads, int *error);
+
+/** Stop the threads and deallocate the pool. All the encoders using it must
+    have been drained or destroyed first.
+    \param[in,out] pool Pool */
+OPE_EXPORT void ope_pool_destroy(OggOpusEncPool *pool);
+
 /** End the stream and create a new stream within the same file.
     \param[in,out] enc Encoder
     \param comments   Comments associated with the stream
@@ -0,0 +1,93 @@
+/* Copyright (C) 2026 Xiph.Org Foundation */
+/**
+   @file gen_resample_tables.c
+   @brief Generates the precomputed resampler filter tables
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* Writes src/resample_tables.h to stdout. Run "make resample-tables" after
+   changing the filter design in resample.c. */
+
+#define RESAMPLE_NO_STATIC_TABLES
+#include "resample.c"
+
+#include <stdio.h>
+
+static const struct {
+   spx_uint32_t in_rate;
+   spx_uint32_t out_rate;
+   int quality;
+} tables[] = {
+   /* No 96 kHz table: a half-band stage takes it to 48 kHz, with no sinc
+      filter after it. */
+   {44100, 48000, 5}
+};
+
+#define NB_TABLES ((int)(sizeof(tables)/sizeof(tables[0])))
+
+int main(void)
+{
+   SpeexResamplerState *st[NB_TABLES];
+   int i;
+   printf("/* Precomputed resampler filter tables.\n"
+          "   Generated by gen_resample_tables.c, do not edit. */\n\n");
+   for (i=0;i<NB_TABLES;i++)
+   {
+      spx_uint32_t j, n;
+      spx_word16_t *table;
+      st[i] = speex_resampler_init(1, tables[i].in_rate, tables[i].out_rate, tables[i].quality, NULL);
+      if (!st[i])
+         return 1;
+      n = st[i]->filt_len*st[i]->den_rate;
+      table = (spx_word16_t *)speex_alloc(n*sizeof(*table));
+      if (!table)
+         return 1;
+      sinc_table_fill(st[i], table, 1);
+      printf("/* %u Hz -> %u Hz, quality %d */\n", (unsigned)tables[i].in_rate,
+         (unsigned)tables[i].out_rate, tables[i].quality);
+      printf("static const float sinc_table_%u_%u_q%d[%u] = {",
+         (unsigned)st[i]->num_rate, (unsigned)st[i]->den_rate, st[i]->quality, (unsigned)n);
+      for (j=0;j<n;j++)
+         printf("%s%.8ef%s", j%4 ? " " : "\n   ", table[j], j+1<n ? "," : "");
+      printf("\n};\n\n");
+      speex_free(table);
+   }
+   printf("static const struct StaticSincTable static_sinc_tables[%d] = {\n", NB_TABLES);
+   for (i=0;i<NB_TABLES;i++)
+   {
+      printf("   {%u, %u, %d, %u, sinc_table_%u_%u_q%d}%s\n",
+         (unsigned)st[i]->num_rate, (unsigned)st[i]->den_rate, st[i]->quality,
+         (unsigned)st[i]->filt_len, (unsigned)st[i]->num_rate, (unsigned)st[i]->den_rate,
+         st[i]->quality, i+1<NB_TABLES ? "," : "");
+      speex_resampler_destroy(st[i]);
+   }
+   printf("};\n");
+   return 0;
+}
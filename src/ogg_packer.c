@@ -31,6 +31,7 @@
 
 #include <stdio.h>
 #include "ogg_packer.h"
+#include "opus_header.h"
 
 #define MAX_HEADER_SIZE (27+255)
 
@@ -128,9 +129,12 @@ typedef struct {
   size_t lacing_size;
   int flags;
   size_t pageno;
+  /* Pages of a stream that was chained away from may still be waiting. */
+  oggp_int32 serialno;
 } oggp_page;
 
 struct oggpacker {
+  OpeAllocator allocator;
   oggp_int32 serialno;
   unsigned char *buf;
   unsigned char *alloc_buf;
@@ -150,25 +154,30 @@ struct oggpacker {
   oggp_uint64 curr_granule;
   oggp_uint64 last_granule;
   size_t pageno;
+  /* The buffers never grow, see oggp_create_fixed(). */
+  int fixed;
 };
 
-/** Allocates an oggpacker object */
-oggpacker *oggp_create(oggp_int32 serialno) {
+static oggpacker *packer_create(oggp_int32 serialno, const OpeAllocator *allocator, size_t buf_size,
+    size_t lacing_size, size_t pages_size, int fixed) {
   oggpacker *oggp;
-  oggp = malloc(sizeof(*oggp));
+  oggp = opeint_malloc(allocator, sizeof(*oggp));
   if (oggp == NULL) goto fail;
+  if (allocator) oggp->allocator = *allocator;
+  else memset(&oggp->allocator, 0, sizeof(oggp->allocator));
   oggp->alloc_buf = NULL;
   oggp->lacing = NULL;
   oggp->pages = NULL;
   oggp->user_buf = NULL;
 
-  oggp->buf_size = MAX_PAGE_SIZE;
-  oggp->lacing_size = 256;
-  oggp->pages_size = 10;
+  oggp->buf_size = buf_size;
+  oggp->lacing_size = lacing_size;
+  oggp->pages_size = pages_size;
+  oggp->fixed = fixed;
 
-  oggp->alloc_buf = malloc(oggp->buf_size + MAX_HEADER_SIZE);
-  oggp->lacing = malloc(oggp->lacing_size);
-  oggp->pages = malloc(oggp->pages_size * sizeof(oggp->pages[0]));
+  oggp->alloc_buf = opeint_malloc(allocator, oggp->buf_size + MAX_HEADER_SIZE);
+  oggp->lacing = opeint_malloc(allocator, oggp->lacing_size);
+  oggp->pages = opeint_malloc(allocator, oggp->pages_size * sizeof(oggp->pages[0]));
   if (!oggp->alloc_buf || !oggp->lacing || !oggp->pages) goto fail;
   oggp->buf = oggp->alloc_buf + MAX_HEADER_SIZE;
 
@@ -187,20 +196,36 @@ oggpacker *oggp_create(oggp_int32 serialno) {
   return oggp;
 fail:
   if (oggp) {
-    if (oggp->lacing) free(oggp->lacing);
-    if (oggp->alloc_buf) free(oggp->alloc_buf);
-    if (oggp->pages) free(oggp->pages);
-    free(oggp);
+    if (oggp->lacing) opeint_free(allocator, oggp->lacing);
+    if (oggp->alloc_buf) opeint_free(allocator, oggp->alloc_buf);
+    if (oggp->pages) opeint_free(allocator, oggp->pages);
+    opeint_free(allocator, oggp);
   }
   return NULL;
 }
 
+/** Allocates an oggpacker object. All its memory comes from allocator, which
+    may be NULL. */
+oggpacker *oggp_create(oggp_int32 serialno, const OpeAllocator *allocator) {
+  return packer_create(serialno, allocator, MAX_PAGE_SIZE, 256, 10, 0);
+}
+
+/** Allocates an oggpacker object whose buffers never grow. They have room
+    for a full page and a packet of up to max_packet bytes. */
+oggpacker *oggp_create_fixed(oggp_int32 serialno, const OpeAllocator *allocator, oggp_int32 max_packet) {
+  /* The lacing values of a page that isn't complete yet and of the packet,
+     and the pages that packet can close. */
+  return packer_create(serialno, allocator, MAX_PAGE_SIZE + max_packet, 2*256 + max_packet/255,
+      4 + max_packet/(255*255), 1);
+}
+
 /** Frees memory associated with an oggpacker object */
 void oggp_destroy(oggpacker *oggp) {
-  free(oggp->lacing);
-  free(oggp->alloc_buf);
-  free(oggp->pages);
-  free(oggp);
+  OpeAllocator allocator = oggp->allocator;
+  opeint_free(&allocator, oggp->lacing);
+  opeint_free(&allocator, oggp->alloc_buf);
+  opeint_free(&allocator, oggp->pages);
+  opeint_free(&allocator, oggp);
 }
 
 /** Sets the maximum muxing delay in granulepos units. Pages will be auto-flushed
@@ -209,19 +234,21 @@ void oggp_set_muxing_delay(oggpacker *oggp, oggp_uint64 delay) {
   oggp->muxing_delay = delay;
 }
 
+/* Moves the data still needed to the start of the buffers. This is only done
+   when it frees enough to be worth it, unless the buffers can't grow. */
 static void shift_buffer(oggpacker *oggp) {
   size_t buf_shift;
   size_t lacing_shift;
   size_t i;
   buf_shift = oggp->pages_fill ? oggp->pages[0].buf_pos : oggp->buf_begin;
   lacing_shift = oggp->pages_fill ? oggp->pages[0].lacing_pos : oggp->lacing_begin;
-  if (4*lacing_shift > oggp->lacing_fill) {
+  if (4*lacing_shift > oggp->lacing_fill || (oggp->fixed && lacing_shift)) {
     memmove(&oggp->lacing[0], &oggp->lacing[lacing_shift], oggp->lacing_fill-lacing_shift);
     for (i=0;i<oggp->pages_fill;i++) oggp->pages[i].lacing_pos -= lacing_shift;
     oggp->lacing_fill -= lacing_shift;
     oggp->lacing_begin -= lacing_shift;
   }
-  if (4*buf_shift > oggp->buf_fill) {
+  if (4*buf_shift > oggp->buf_fill || (oggp->fixed && buf_shift)) {
     memmove(&oggp->buf[0], &oggp->buf[buf_shift], oggp->buf_fill-buf_shift);
     for (i=0;i<oggp->pages_fill;i++) oggp->pages[i].buf_pos -= buf_shift;
     oggp->buf_fill -= buf_shift;
@@ -229,12 +256,26 @@ static void shift_buffer(oggpacker *oggp) {
   }
 }
 
+/* Whether the buffers of a fixed oggpacker have room for a packet of the size
+   given: the packet, its lacing values, and the pages committing it can
+   close (the one pending and those the packet itself fills). */
+static int fixed_room(oggpacker *oggp, oggp_int32 bytes) {
+  size_t nb_lacing = bytes/255 + 1;
+  return oggp->buf_fill + bytes <= oggp->buf_size && oggp->lacing_fill + nb_lacing <= oggp->lacing_size &&
+      oggp->pages_fill + 2 + (oggp->lacing_fill - oggp->lacing_begin + nb_lacing)/255 <= oggp->pages_size;
+}
+
 /** Get a buffer where to write the next packet. The buffer will have
     size "bytes", but fewer bytes can be written. The buffer remains valid through
     a call to oggp_close_page() or oggp_get_next_page(), but is invalidated by
     another call to oggp_get_packet_buffer() or by a call to oggp_commit_packet(). */
 unsigned char *oggp_get_packet_buffer(oggpacker *oggp, oggp_int32 bytes) {
-  if (oggp->buf_fill + bytes > oggp->buf_size) {
+  if (oggp->fixed) {
+    if (!fixed_room(oggp, bytes)) {
+      shift_buffer(oggp);
+      if (!fixed_room(oggp, bytes)) return NULL;
+    }
+  } else if (oggp->buf_fill + bytes > oggp->buf_size) {
     shift_buffer(oggp);
 
     /* If we didn't shift the buffer or if we did and there's still not enough room, make some more. */
@@ -244,7 +285,7 @@ unsigned char *oggp_get_packet_buffer(oggpacker *oggp, oggp_int32 bytes) {
       newsize = oggp->buf_fill + bytes + MAX_HEADER_SIZE;
       /* Making sure we don't need to do that too often. */
       newsize = newsize*3/2;
-      newbuf = realloc(oggp->alloc_buf, newsize);
+      newbuf = opeint_realloc(&oggp->allocator, oggp->alloc_buf, newsize);
       if (newbuf != NULL) {
         oggp->alloc_buf = newbuf;
         oggp->buf_size = newsize;
@@ -282,7 +323,9 @@ int oggp_commit_packet(oggpacker *oggp, oggp_int32 bytes, oggp_uint64 granulepos
       newsize = oggp->lacing_fill + nb_255s + 1;
       /* Making sure we don't need to do that too often. */
       newsize = newsize*3/2;
-      newbuf = realloc(oggp->lacing, newsize);
+      /* Can't happen after oggp_get_packet_buffer() made sure there's room. */
+      if (oggp->fixed) return 1;
+      newbuf = opeint_realloc(&oggp->allocator, oggp->lacing, newsize);
       if (newbuf != NULL) {
         oggp->lacing = newbuf;
         oggp->lacing_size = newsize;
@@ -318,17 +361,19 @@ int oggp_flush_page(oggpacker *oggp) {
     return 1;
   }
   nb_lacing = oggp->lacing_fill - oggp->lacing_begin;
+  /* Make room for all the pages first, so that failing leaves none half done. */
+  if (oggp->pages_fill + (nb_lacing + 254)/255 > oggp->pages_size) {
+    size_t newsize;
+    oggp_page *newbuf;
+    if (oggp->fixed) return 1;
+    /* Making sure we don't need to do that too often. */
+    newsize = 1 + (oggp->pages_fill + (nb_lacing + 254)/255)*3/2;
+    newbuf = opeint_realloc(&oggp->allocator, oggp->pages, newsize*sizeof(oggp_page));
+    if (newbuf == NULL) return 1;
+    oggp->pages = newbuf;
+    oggp->pages_size = newsize;
+  }
   do {
-    if (oggp->pages_fill >= oggp->pages_size) {
-      size_t newsize;
-      oggp_page *newbuf;
-      /* Making sure we don't need to do that too often. */
-      newsize = 1 + oggp->pages_size*3/2;
-      newbuf = realloc(oggp->pages, newsize*sizeof(oggp_page));
-      assert(newbuf != NULL);
-      oggp->pages = newbuf;
-      oggp->pages_size = newsize;
-    }
     p = &oggp->pages[oggp->pages_fill++];
     p->granulepos = oggp->curr_granule;
 
@@ -352,6 +397,7 @@ int oggp_flush_page(oggpacker *oggp) {
     oggp->lacing_begin += p->lacing_size;
     oggp->buf_begin += p->buf_size;
     p->pageno = oggp->pageno++;
+    p->serialno = oggp->serialno;
     if (p->pageno == 0)
       p->flags |= 0x02;
   } while (nb_lacing>0);
@@ -396,7 +442,7 @@ int oggp_get_next_page(oggpacker *oggp, unsigned char **page, oggp_int32 *bytes)
 
   /* 32 bits of stream serial number */
   {
-    oggp_int32 serialno=oggp->serialno;
+    oggp_int32 serialno=p->serialno;
     for(i=14;i<18;i++){
       ptr[i]=(unsigned char)(serialno&0xff);
       serialno>>=8;
@@ -434,3 +480,15 @@ int oggp_chain(oggpacker *oggp, oggp_int32 serialno) {
   oggp->pageno = 0;
   return 0;
 }
+
+/** Drops all the data and pages that have not been retrieved yet, keeping the
+    buffers. The next stream is then started with oggp_chain(). */
+void oggp_reset(oggpacker *oggp) {
+  oggp->buf_fill = 0;
+  oggp->buf_begin = 0;
+  oggp->lacing_fill = 0;
+  oggp->lacing_begin = 0;
+  oggp->pages_fill = 0;
+  oggp->user_buf = NULL;
+  oggp->is_eos = 0;
+}
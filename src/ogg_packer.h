@@ -27,6 +27,7 @@
 #ifndef OGGPACKER_H
 # define OGGPACKER_H
 
+#include "opusenc.h"
 
 # if defined(__cplusplus)
 extern "C" {
@@ -38,8 +39,15 @@ typedef int oggp_int32;
 
 typedef struct oggpacker oggpacker;
 
-/** Allocates an oggpacker object */
-oggpacker *oggp_create(oggp_int32 serialno);
+/** Allocates an oggpacker object. All its memory comes from allocator, which
+    may be NULL. */
+oggpacker *oggp_create(oggp_int32 serialno, const OpeAllocator *allocator);
+
+/** Allocates an oggpacker object whose buffers never grow. They have room
+    for a full page and a packet of up to max_packet bytes. When a packet
+    doesn't fit, oggp_get_packet_buffer() returns NULL instead of reallocating,
+    and the pages have to be retrieved before trying again. */
+oggpacker *oggp_create_fixed(oggp_int32 serialno, const OpeAllocator *allocator, oggp_int32 max_packet);
 
 /** Frees memory associated with an oggpacker object */
 void oggp_destroy(oggpacker *oggp);
@@ -71,6 +79,10 @@ int oggp_get_next_page(oggpacker *oggp, unsigned char **page, oggp_int32 *bytes)
     pages remain available with oggp_get_next_page(). */
 int oggp_chain(oggpacker *oggp, oggp_int32 serialno);
 
+/** Drops all the data and pages that have not been retrieved yet, keeping the
+    buffers. The next stream is then started with oggp_chain(). */
+void oggp_reset(oggpacker *oggp);
+
 # if defined(__cplusplus)
 }
 # endif
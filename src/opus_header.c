@@ -248,13 +248,13 @@ The comment header is decoded as follows:
                                      buf[base]=(val)&0xff; \
                                  }while(0)
 
-void opeint_comment_init(char **comments, int* length, const char *vendor_string)
+void opeint_comment_init(const OpeAllocator *allocator, char **comments, int* length, const char *vendor_string)
 {
   /*The 'vendor' field should be the actual encoding library used.*/
   int vendor_length=strlen(vendor_string);
   int user_comment_list_length=0;
   int len=8+4+vendor_length+4;
-  char *p=(char*)malloc(len);
+  char *p=(char*)opeint_malloc(allocator, len);
   if (p == NULL) {
     len=0;
   } else {
@@ -267,7 +267,7 @@ void opeint_comment_init(char **comments, int* length, const char *vendor_string
   *comments=p;
 }
 
-int opeint_comment_add(char **comments, int* length, const char *tag, const char *val)
+int opeint_comment_add(const OpeAllocator *allocator, char **comments, int* length, const char *tag, const char *val)
 {
   char* p=*comments;
   int vendor_length=readint(p, 8);
@@ -276,7 +276,7 @@ int opeint_comment_add(char **comments, int* length, const char *tag, const char
   int val_len=strlen(val);
   int len=(*length)+4+tag_len+val_len;
 
-  p=(char*)realloc(p, len);
+  p=(char*)opeint_realloc(allocator, p, len);
   if (p == NULL) return 1;
 
   writeint(p, *length, tag_len+val_len);      /* length of comment */
@@ -291,7 +291,7 @@ int opeint_comment_add(char **comments, int* length, const char *tag, const char
   return 0;
 }
 
-void opeint_comment_pad(char **comments, int* length, int amount)
+void opeint_comment_pad(const OpeAllocator *allocator, char **comments, int* length, int amount)
 {
   if(amount>0){
     int i;
@@ -300,7 +300,7 @@ void opeint_comment_pad(char **comments, int* length, int amount)
     /*Make sure there is at least amount worth of padding free, and
        round up to the maximum that fits in the current ogg segments.*/
     newlen=(*length+amount+255)/255*255-1;
-    p=realloc(p,newlen);
+    p=opeint_realloc(allocator, p, newlen);
     if (p == NULL) return;
     for(i=*length;i<newlen;i++)p[i]=0;
     *comments=p;
@@ -30,27 +30,40 @@
 
 #include <stdlib.h>
 #include <opus.h>
+#include "opusenc.h"
 
 #include <opus_multistream.h>
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
 #include <opus_projection.h>
 #endif
 
+/* Allocation through an OpeAllocator, falling back to malloc() and friends when
+   it has no functions. */
+void *opeint_malloc(const OpeAllocator *allocator, size_t size);
+
+void *opeint_realloc(const OpeAllocator *allocator, void *ptr, size_t size);
+
+void opeint_free(const OpeAllocator *allocator, void *ptr);
+
 typedef struct OpusGenericEncoder OpusGenericEncoder;
 struct OpusGenericEncoder {
   OpusMSEncoder *ms;
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
   OpusProjectionEncoder *pr;
 #endif
+  /* Size of the libopus state, for copying it. */
+  opus_int32 size;
 };
 
 int opeint_use_projection(int channel_mapping);
 
-int opeint_encoder_surround_init(OpusGenericEncoder *st, int Fs, int channels, int channel_mapping, int *nb_streams, int *nb_coupled, unsigned char *stream_map, int application);
+int opeint_encoder_surround_init(OpusGenericEncoder *st, const OpeAllocator *allocator, int Fs, int channels, int channel_mapping, int *nb_streams, int *nb_coupled, unsigned char *stream_map, int application);
+
+void opeint_encoder_cleanup(OpusGenericEncoder *st, const OpeAllocator *allocator);
 
-void opeint_encoder_cleanup(OpusGenericEncoder *st);
+int opeint_encoder_copy(OpusGenericEncoder *dst, const OpusGenericEncoder *src, const OpeAllocator *allocator);
 
-int opeint_encoder_init(OpusGenericEncoder *st, opus_int32 Fs, int channels, int streams, int coupled_streams, const unsigned char *mapping, int application);
+int opeint_encoder_init(OpusGenericEncoder *st, const OpeAllocator *allocator, opus_int32 Fs, int channels, int streams, int coupled_streams, const unsigned char *mapping, int application);
 
 int opeint_encode_float(OpusGenericEncoder *st, const float *pcm, int frame_size, unsigned char *data, opus_int32 max_data_bytes);
 
@@ -87,10 +100,10 @@ int opeint_opus_header_get_size(const OpusHeader *h);
 
 int opeint_opus_header_to_packet(const OpusHeader *h, unsigned char *packet, int len, const OpusGenericEncoder *st);
 
-void opeint_comment_init(char **comments, int* length, const char *vendor_string);
+void opeint_comment_init(const OpeAllocator *allocator, char **comments, int* length, const char *vendor_string);
 
-int opeint_comment_add(char **comments, int* length, const char *tag, const char *val);
+int opeint_comment_add(const OpeAllocator *allocator, char **comments, int* length, const char *tag, const char *val);
 
-void opeint_comment_pad(char **comments, int* length, int amount);
+void opeint_comment_pad(const OpeAllocator *allocator, char **comments, int* length, int amount);
 
 #endif
@@ -36,6 +36,14 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+#if defined(HAVE_PTHREAD) && defined(HAVE_ATOMIC_BUILTINS)
+#define OPE_ASYNC
+#include <errno.h>
+#include <time.h>
+#endif
 #include "opusenc.h"
 #include "opus_header.h"
 #include "speex_resampler.h"
@@ -49,15 +57,32 @@
 #define LPC_PADDING 120
 #define LPC_ORDER 24
 #define LPC_INPUT 480
+/* Writes shorter than this are gathered until there's this much to resample. */
+#define WRITE_COALESCE 256
 /* Make the following constant always equal to 2*cos(M_PI/LPC_PADDING) */
 #define LPC_GOERTZEL_CONST 1.99931465f
 
 /* Allow up to 2 seconds for delayed decision. */
 #define MAX_LOOKAHEAD 96000
-/* We can't have a circular buffer (because of delayed decision), so let's not copy too often. */
-#define BUFFER_EXTRA 24000
-
-#define BUFFER_SAMPLES (MAX_LOOKAHEAD + BUFFER_EXTRA)
+/* Longest frame (120 ms) at 48 kHz. */
+#define MAX_FRAME_SIZE 5760
+/* Room ope_encoder_get_size() leaves for the comments of each stream, not
+   counting the padding. */
+#define IN_PLACE_COMMENT_SIZE 1024
+/* Slack so that writes don't get split into too many small chunks. */
+#define BUFFER_EXTRA 4800
+/* Default limit of the audio held on top of the decision delay in deferred
+   mode (10 seconds). */
+#define DEFAULT_MAX_BACKLOG 480000
+/* The tonality analysis of libopus looks at most this far ahead (DETECT_SIZE-5
+   blocks of 20 ms), anything past it makes no difference. */
+#define MAX_ANALYSIS_MS 1900
+/* Largest lookahead (preskip) libopus uses at 48 kHz. Only used for sizing the buffer. */
+#define ENCODER_LOOKAHEAD 312
+/* Length of the segments encoded in parallel with OPE_SET_ENCODE_THREADS, and
+   how much is encoded before each to prime the encoder, in ms. */
+#define SEGMENT_MS 20000
+#define WARMUP_MS 500
 
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
 #define MAX(a,b) ((a) > (b) ? (a) : (b))
@@ -72,25 +97,189 @@ struct StdioObject {
   FILE *file;
 };
 
+void *opeint_malloc(const OpeAllocator *allocator, size_t size) {
+  if (allocator && allocator->alloc) return allocator->alloc(allocator->user_data, size);
+  return malloc(size);
+}
+
+void *opeint_realloc(const OpeAllocator *allocator, void *ptr, size_t size) {
+  if (allocator && allocator->alloc) return allocator->realloc(allocator->user_data, ptr, size);
+  return realloc(ptr, size);
+}
+
+void opeint_free(const OpeAllocator *allocator, void *ptr) {
+  if (allocator && allocator->alloc) {
+    if (ptr) allocator->free(allocator->user_data, ptr);
+  } else {
+    free(ptr);
+  }
+}
+
+/* Copies an allocator given to one of the create functions, which may be NULL,
+   but not have only some of the functions. */
+static int allocator_init(OpeAllocator *dst, const OpeAllocator *src) {
+  if (src == NULL) {
+    memset(dst, 0, sizeof(*dst));
+    return OPE_OK;
+  }
+  if ((src->alloc == NULL) != (src->realloc == NULL) || (src->alloc == NULL) != (src->free == NULL)) return OPE_BAD_ARG;
+  *dst = *src;
+  return OPE_OK;
+}
+
+/* Memory of encoders initialized in place. Blocks are carved one after the
+   other from the memory the caller gave, each after a header. Freeing the last
+   block gives it back, along with the free blocks before it. Other blocks go to
+   a free list, from which allocations take the smallest block that fits, so
+   that chaining keeps reusing the same memory. The last block grows in place.
+   When only measuring, base is NULL and each block comes from malloc(). */
+typedef struct ArenaBlock ArenaBlock;
+struct ArenaBlock {
+  ArenaBlock *prev;
+  ArenaBlock *next_free;
+  size_t size;
+  int is_free;
+};
+
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(x) (((x) + (ARENA_ALIGN-1)) & ~(size_t)(ARENA_ALIGN-1))
+#define ARENA_HEADER ARENA_ROUND(sizeof(ArenaBlock))
+
+typedef struct {
+  unsigned char *base;
+  size_t size;
+  size_t top;
+  /* Largest top so far. */
+  size_t peak;
+  ArenaBlock *last;
+  ArenaBlock *free_list;
+} OpeArena;
+
+static void arena_init(OpeArena *arena, unsigned char *base, size_t size) {
+  arena->base = base;
+  arena->size = size;
+  arena->top = 0;
+  arena->peak = 0;
+  arena->last = NULL;
+  arena->free_list = NULL;
+}
+
+static void *arena_alloc(void *user_data, size_t size) {
+  OpeArena *arena = (OpeArena *)user_data;
+  ArenaBlock **best = NULL;
+  ArenaBlock **p;
+  ArenaBlock *blk;
+  if (size > arena->size) return NULL;
+  size = ARENA_ROUND(size);
+  for (p=&arena->free_list;*p;p=&(*p)->next_free) {
+    if ((*p)->size >= size && (best == NULL || (*p)->size < (*best)->size)) best = p;
+  }
+  if (best != NULL) {
+    blk = *best;
+    *best = blk->next_free;
+    blk->is_free = 0;
+    return (unsigned char *)blk + ARENA_HEADER;
+  }
+  if (arena->size - arena->top < ARENA_HEADER + size) return NULL;
+  if (arena->base) blk = (ArenaBlock *)(arena->base + arena->top);
+  else if ( (blk = malloc(ARENA_HEADER + size)) == NULL) return NULL;
+  blk->prev = arena->last;
+  blk->next_free = NULL;
+  blk->size = size;
+  blk->is_free = 0;
+  arena->last = blk;
+  arena->top += ARENA_HEADER + size;
+  arena->peak = MAX(arena->peak, arena->top);
+  return (unsigned char *)blk + ARENA_HEADER;
+}
+
+static void arena_free(void *user_data, void *ptr) {
+  OpeArena *arena = (OpeArena *)user_data;
+  ArenaBlock *blk = (ArenaBlock *)((unsigned char *)ptr - ARENA_HEADER);
+  if (blk != arena->last) {
+    blk->is_free = 1;
+    blk->next_free = arena->free_list;
+    arena->free_list = blk;
+    return;
+  }
+  do {
+    ArenaBlock *prev = blk->prev;
+    if (blk->is_free) {
+      ArenaBlock **p = &arena->free_list;
+      while (*p != blk) p = &(*p)->next_free;
+      *p = blk->next_free;
+    }
+    arena->top -= ARENA_HEADER + blk->size;
+    if (!arena->base) free(blk);
+    blk = prev;
+  } while (blk != NULL && blk->is_free);
+  arena->last = blk;
+}
+
+static void *arena_realloc(void *user_data, void *ptr, size_t size) {
+  OpeArena *arena = (OpeArena *)user_data;
+  ArenaBlock *blk;
+  void *new_ptr;
+  if (ptr == NULL) return arena_alloc(user_data, size);
+  blk = (ArenaBlock *)((unsigned char *)ptr - ARENA_HEADER);
+  if (size <= blk->size) return ptr;
+  if (size > arena->size) return NULL;
+  size = ARENA_ROUND(size);
+  if (blk == arena->last) {
+    if (arena->size - arena->top < size - blk->size) return NULL;
+    if (!arena->base) {
+      if ( (blk = realloc(blk, ARENA_HEADER + size)) == NULL) return NULL;
+      arena->last = blk;
+    }
+    arena->top += size - blk->size;
+    arena->peak = MAX(arena->peak, arena->top);
+    blk->size = size;
+    return (unsigned char *)blk + ARENA_HEADER;
+  }
+  if ( (new_ptr = arena_alloc(user_data, size)) == NULL) return NULL;
+  memcpy(new_ptr, ptr, blk->size);
+  arena_free(user_data, ptr);
+  return new_ptr;
+}
+
+/* Releases the blocks still allocated when only measuring. */
+static void arena_clear(OpeArena *arena) {
+  while (arena->last) {
+    ArenaBlock *prev = arena->last->prev;
+    if (!arena->base) free(arena->last);
+    arena->last = prev;
+  }
+  arena->top = 0;
+  arena->free_list = NULL;
+}
+
 struct OggOpusComments {
   char *comment;
   int comment_length;
   int seen_file_icons;
+  OpeAllocator allocator;
 };
 
 /* Create a new comments object. The vendor string is optional. */
 OggOpusComments *ope_comments_create(void) {
+  return ope_comments_create_with_allocator(NULL);
+}
+
+OggOpusComments *ope_comments_create_with_allocator(const OpeAllocator *allocator) {
   OggOpusComments *c;
+  OpeAllocator a;
   const char *libopus_str;
   char vendor_str[1024];
-  c = malloc(sizeof(*c));
+  if (allocator_init(&a, allocator) != OPE_OK) return NULL;
+  c = opeint_malloc(&a, sizeof(*c));
   if (c == NULL) return NULL;
+  c->allocator = a;
   libopus_str = opus_get_version_string();
   snprintf(vendor_str, sizeof(vendor_str), "%s, %s %s", libopus_str, PACKAGE_NAME, PACKAGE_VERSION);
-  opeint_comment_init(&c->comment, &c->comment_length, vendor_str);
+  opeint_comment_init(&c->allocator, &c->comment, &c->comment_length, vendor_str);
   c->seen_file_icons = 0;
   if (c->comment == NULL) {
-    free(c);
+    opeint_free(&a, c);
     return NULL;
   } else {
     return c;
@@ -100,12 +289,12 @@ OggOpusComments *ope_comments_create(void) {
 /* Create a deep copy of a comments object. */
 OggOpusComments *ope_comments_copy(OggOpusComments *comments) {
   OggOpusComments *c;
-  c = malloc(sizeof(*c));
+  c = opeint_malloc(&comments->allocator, sizeof(*c));
   if (c == NULL) return NULL;
   memcpy(c, comments, sizeof(*c));
-  c->comment = malloc(comments->comment_length);
+  c->comment = opeint_malloc(&comments->allocator, comments->comment_length);
   if (c->comment == NULL) {
-    free(c);
+    opeint_free(&comments->allocator, c);
     return NULL;
   } else {
     memcpy(c->comment, comments->comment, comments->comment_length);
@@ -115,46 +304,47 @@ OggOpusComments *ope_comments_copy(OggOpusComments *comments) {
 
 /* Destroys a comments object. */
 void ope_comments_destroy(OggOpusComments *comments){
-  free(comments->comment);
-  free(comments);
+  OpeAllocator allocator = comments->allocator;
+  opeint_free(&allocator, comments->comment);
+  opeint_free(&allocator, comments);
 }
 
 /* Add a comment. */
 int ope_comments_add(OggOpusComments *comments, const char *tag, const char *val) {
   if (tag == NULL || val == NULL) return OPE_BAD_ARG;
   if (strchr(tag, '=')) return OPE_BAD_ARG;
-  if (opeint_comment_add(&comments->comment, &comments->comment_length, tag, val)) return OPE_ALLOC_FAIL;
+  if (opeint_comment_add(&comments->allocator, &comments->comment, &comments->comment_length, tag, val)) return OPE_ALLOC_FAIL;
   return OPE_OK;
 }
 
 /* Add a comment. */
 int ope_comments_add_string(OggOpusComments *comments, const char *tag_and_val) {
   if (!strchr(tag_and_val, '=')) return OPE_BAD_ARG;
-  if (opeint_comment_add(&comments->comment, &comments->comment_length, NULL, tag_and_val)) return OPE_ALLOC_FAIL;
+  if (opeint_comment_add(&comments->allocator, &comments->comment, &comments->comment_length, NULL, tag_and_val)) return OPE_ALLOC_FAIL;
   return OPE_OK;
 }
 
 int ope_comments_add_picture(OggOpusComments *comments, const char *filename, int picture_type, const char *description) {
   char *picture_data;
   int err;
-  picture_data = opeint_parse_picture_specification(filename, picture_type, description, &err, &comments->seen_file_icons);
+  picture_data = opeint_parse_picture_specification(&comments->allocator, filename, picture_type, description, &err, &comments->seen_file_icons);
   if (picture_data == NULL || err != OPE_OK){
     return err;
   }
-  opeint_comment_add(&comments->comment, &comments->comment_length, "METADATA_BLOCK_PICTURE", picture_data);
-  free(picture_data);
+  opeint_comment_add(&comments->allocator, &comments->comment, &comments->comment_length, "METADATA_BLOCK_PICTURE", picture_data);
+  opeint_free(&comments->allocator, picture_data);
   return OPE_OK;
 }
 
 int ope_comments_add_picture_from_memory(OggOpusComments *comments, const char *ptr, size_t size, int picture_type, const char *description) {
   char *picture_data;
   int err;
-  picture_data = opeint_parse_picture_specification_from_memory(ptr, size, picture_type, description, &err, &comments->seen_file_icons);
+  picture_data = opeint_parse_picture_specification_from_memory(&comments->allocator, ptr, size, picture_type, description, &err, &comments->seen_file_icons);
   if (picture_data == NULL || err != OPE_OK){
     return err;
   }
-  opeint_comment_add(&comments->comment, &comments->comment_length, "METADATA_BLOCK_PICTURE", picture_data);
-  free(picture_data);
+  opeint_comment_add(&comments->allocator, &comments->comment, &comments->comment_length, "METADATA_BLOCK_PICTURE", picture_data);
+  opeint_free(&comments->allocator, picture_data);
   return OPE_OK;
 }
 
@@ -169,9 +359,12 @@ struct EncStream {
   int packetno;
   char *comment;
   int comment_length;
+  /* Size of the comment buffer, kept by the spare stream for the next one. */
+  int comment_alloc;
   int seen_file_icons;
   int close_at_end;
   int header_is_frozen;
+  /* At 48 kHz, not counting the pre-skip. */
   opus_int64 end_granule;
   opus_int64 granule_offset;
   EncStream *next;
@@ -184,48 +377,89 @@ int opeint_use_projection(int channel_mapping) {
   return 0;
 }
 
+/* The libopus states are allocated here rather than by libopus, so that they
+   come from the allocator of the encoder. */
 int opeint_encoder_surround_init(
-    OpusGenericEncoder *st, int Fs, int channels, int channel_mapping,
+    OpusGenericEncoder *st, const OpeAllocator *allocator, int Fs, int channels, int channel_mapping,
     int *nb_streams, int *nb_coupled, unsigned char *stream_map, int application) {
   int ret;
+  st->ms=NULL;
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
+  st->pr=NULL;
   if(opeint_use_projection(channel_mapping)){
     int ci;
-    st->pr=opus_projection_ambisonics_encoder_create(Fs, channels,
-        channel_mapping, nb_streams, nb_coupled, application, &ret);
+    st->size=opus_projection_ambisonics_encoder_get_size(channels, channel_mapping);
+    if (st->size == 0) return OPUS_BAD_ARG;
+    if ( (st->pr = opeint_malloc(allocator, st->size)) == NULL) return OPUS_ALLOC_FAIL;
+    ret=opus_projection_ambisonics_encoder_init(st->pr, Fs, channels,
+        channel_mapping, nb_streams, nb_coupled, application);
     for (ci = 0; ci < channels; ci++) {
       stream_map[ci] = ci;
     }
-    st->ms=NULL;
   }
   else
 #endif
   {
-#ifdef OPUS_HAVE_OPUS_PROJECTION_H
-    st->pr=NULL;
-#endif
-    st->ms=opus_multistream_surround_encoder_create(Fs, channels,
-        channel_mapping, nb_streams, nb_coupled, stream_map, application, &ret);
+    st->size=opus_multistream_surround_encoder_get_size(channels, channel_mapping);
+    if (st->size == 0) return OPUS_BAD_ARG;
+    if ( (st->ms = opeint_malloc(allocator, st->size)) == NULL) return OPUS_ALLOC_FAIL;
+    ret=opus_multistream_surround_encoder_init(st->ms, Fs, channels,
+        channel_mapping, nb_streams, nb_coupled, stream_map, application);
   }
+  if (ret != OPUS_OK) opeint_encoder_cleanup(st, allocator);
   return ret;
 }
 
-void opeint_encoder_cleanup(OpusGenericEncoder *st) {
+void opeint_encoder_cleanup(OpusGenericEncoder *st, const OpeAllocator *allocator) {
+#ifdef OPUS_HAVE_OPUS_PROJECTION_H
+  opeint_free(allocator, st->pr);
+  st->pr = NULL;
+#endif
+  opeint_free(allocator, st->ms);
+  st->ms = NULL;
+}
+
+/* Copies the whole state of src, settings included, to dst. This relies on the
+   libopus encoders being flat: each lives in the single block its _get_size()
+   function gives, and finds what is inside (the elementary streams, their SILK
+   and CELT states, the projection matrices) by offsets from its start, not by
+   pointers. The only pointer is to the CELT mode, which is static and can be
+   shared. With that, memcpy() is enough. dst is allocated if it has no state
+   yet, and then released with opeint_encoder_cleanup(). */
+int opeint_encoder_copy(OpusGenericEncoder *dst, const OpusGenericEncoder *src, const OpeAllocator *allocator) {
+  void *mem;
+#ifdef OPUS_HAVE_OPUS_PROJECTION_H
+  mem = src->pr ? (void *)dst->pr : (void *)dst->ms;
+#else
+  mem = dst->ms;
+#endif
+  if (mem == NULL && (mem = opeint_malloc(allocator, src->size)) == NULL) return OPE_ALLOC_FAIL;
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
-    if (st->pr) opus_projection_encoder_destroy(st->pr);
+  memcpy(mem, src->pr ? (void *)src->pr : (void *)src->ms, src->size);
+  dst->pr = src->pr ? (OpusProjectionEncoder *)mem : NULL;
+  dst->ms = src->pr ? NULL : (OpusMSEncoder *)mem;
+#else
+  memcpy(mem, src->ms, src->size);
+  dst->ms = (OpusMSEncoder *)mem;
 #endif
-    if (st->ms) opus_multistream_encoder_destroy(st->ms);
+  dst->size = src->size;
+  return OPE_OK;
 }
 
 int opeint_encoder_init(
-    OpusGenericEncoder *st, opus_int32 Fs, int channels, int streams,
+    OpusGenericEncoder *st, const OpeAllocator *allocator, opus_int32 Fs, int channels, int streams,
     int coupled_streams, const unsigned char *mapping, int application) {
   int ret;
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
   st->pr=NULL;
 #endif
-  st->ms=opus_multistream_encoder_create(Fs, channels, streams,
-      coupled_streams, mapping, application, &ret);
+  st->ms=NULL;
+  st->size=opus_multistream_encoder_get_size(streams, coupled_streams);
+  if (st->size == 0) return OPUS_BAD_ARG;
+  if ( (st->ms = opeint_malloc(allocator, st->size)) == NULL) return OPUS_ALLOC_FAIL;
+  ret=opus_multistream_encoder_init(st->ms, Fs, channels, streams,
+      coupled_streams, mapping, application);
+  if (ret != OPUS_OK) opeint_encoder_cleanup(st, allocator);
   return ret;
 }
 
@@ -244,29 +478,169 @@ int opeint_encode_float(
   return ret;
 }
 
+#ifdef OPE_ASYNC
+/* How long the worker (or a thread of a pool) sleeps when it missed a
+   wake-up, in ms. */
+#define ASYNC_WAIT_MS 20
+
+/* Ring between the thread calling the write functions and the worker thread.
+   Positions only ever grow (modulo 2^32) and each is written by one side only.
+   The size is a power of two, so that positions still map to the same place in
+   the ring when they wrap. */
+typedef struct {
+  float *ring;
+  opus_uint32 size;
+  opus_uint32 write_pos;
+  opus_uint32 read_pos;
+  /* 1 to finish what is in the ring and exit, 2 to exit right away. */
+  int stop;
+  int error;
+  opus_int32 overruns;
+  opus_int32 underruns;
+  /* When the encoding side last ran out of samples (CLOCK_MONOTONIC, in
+     microseconds, or -1), and the write position then. Only that side uses
+     them. */
+  opus_int64 idle_time;
+  opus_uint32 idle_pos;
+  /* Without a pool, the encoder has a thread of its own. */
+  pthread_t thread;
+  OggOpusEncPool *pool;
+  /* Home queue in the pool. */
+  int queue;
+  /* Set while the encoder is queued or being encoded by the pool. */
+  int scheduled;
+  /* Write position from which the encoder has a frame to encode (or the ring
+     is half full). Writes don't queue it before. */
+  opus_uint32 ready_pos;
+  OggOpusEnc *next;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+} AsyncState;
+
+typedef struct {
+  pthread_mutex_t mutex;
+  OggOpusEnc *head;
+  OggOpusEnc *tail;
+} PoolQueue;
+
+typedef struct {
+  OggOpusEncPool *pool;
+  int index;
+  pthread_t thread;
+} PoolThread;
+
+struct OggOpusEncPool {
+  int nb_threads;
+  PoolThread *threads;
+  /* One queue per thread. */
+  PoolQueue *queues;
+  /* Encoders queued since the threads last looked, most recent first. Pushed
+     without a lock so that writes never block, and moved to the home queues
+     by the threads. */
+  OggOpusEnc *incoming;
+  /* Number of encoders in the queues. */
+  int pending;
+  int stop;
+  int next_queue;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+};
+#endif
+
+#ifdef HAVE_PTHREAD
+typedef struct ThreadTeam ThreadTeam;
+typedef struct StreamThreads StreamThreads;
+#endif
+
 struct OggOpusEnc {
   OpusGenericEncoder st;
+  /* Used for everything the encoder allocates. */
+  OpeAllocator allocator;
+  /* Initialized in memory given by the caller, with an arena as allocator. */
+  int in_place;
   oggpacker *oggp;
   int unrecoverable;
   int pull_api;
   int rate;
+  /* Rate libopus runs at: the input rate if Opus supports it natively and
+     native_rate is set, 48 kHz otherwise. Buffer positions and frame_size are at
+     this rate, granule positions are always at 48 kHz. */
+  opus_int32 opus_rate;
+  int native_rate;
+  /* The libopus state has settings that setting it up again would lose. */
+  int opus_configured;
   int channels;
+  /* The buffer is circular. It's followed by room for mirroring its beginning, so
+     that libopus gets the frame and the lookahead it analyzes contiguous. */
   float *buffer;
+  int buffer_samples;
+  /* Size of that room, see buffer_alloc_samples(). */
+  int mirror_samples;
+  /* buffer_start is always in [0,buffer_samples) and buffer_end-buffer_start is the
+     number of samples in the buffer, so buffer_end may go past buffer_samples. */
   int buffer_start;
   int buffer_end;
+  /* The first mirrored samples of the buffer are also after its end. */
+  int mirrored;
   SpeexResamplerState *re;
+  int resampler_quality;
+  /* Clock correction in parts per billion. The resampler runs from rate_num/rate_den
+     Hz, which is rate adjusted by the correction. */
+  opus_int32 rate_correction;
+  opus_uint32 rate_num;
+  opus_uint32 rate_den;
+  /* Built-in drift controller, disabled when drift_target is -1. */
+  opus_int32 drift_target;
+  double drift_integral;
+  opus_int64 drift_last_report;
   int frame_size;
   int decision_delay;
+  int max_decision_delay;
   int max_ogg_delay;
   int global_granule_offset;
   opus_int64 curr_granule;
+  /* Samples written at the current input rate, on top of write_granule_base
+     (at 48 kHz, with write_granule_frac in Q32) accumulated before the last
+     rate change. */
   opus_int64 write_granule;
+  opus_int64 write_granule_base;
+  opus_uint32 write_granule_frac;
   opus_int64 last_page_granule;
   int draining;
+  /* The settings draining overrides, restored by ope_encoder_reset(). */
+  int drain_decision_delay;
+  int drain_frame_size_request;
+  /* Writes only fill the buffer, ope_encoder_step() does the encoding. */
+  int deferred;
+  /* Limit of what deferred mode buffers on top of the decision delay. */
+  int max_backlog;
+  int encode_threads;
+  int stream_threads;
+  /* The elementary streams have the settings the multistream encoder would
+     give them, so they can be encoded separately. */
+  int streams_synced;
+  int resampler_threads;
+#ifdef HAVE_PTHREAD
+  StreamThreads *stream_team;
+  ThreadTeam *resampler_team;
+#endif
   int frame_size_request;
+  /* Only there when resampling: the last LPC_INPUT input samples as a ring whose
+     oldest sample is at lpc_pos, room for LPC_PADDING more, then the
+     pending_samples of small writes waiting to be resampled. */
   float *lpc_buffer;
+  int lpc_pos;
+  int pending_samples;
+#ifdef OPE_ASYNC
+  AsyncState *async;
+  OggOpusEncPool *pool;
+#endif
+  /* The last packet if it was a keyframe (-1 length otherwise), and where the
+     next one is copied. Both hold a packet of the largest size and are swapped
+     rather than reallocated. */
   unsigned char *chaining_keyframe;
   int chaining_keyframe_length;
+  unsigned char *packet_copy;
   OpusEncCallbacks callbacks;
   ope_packet_func packet_callback;
   void *packet_callback_data;
@@ -274,6 +648,8 @@ struct OggOpusEnc {
   int comment_padding;
   EncStream *streams;
   EncStream *last_stream;
+  /* A stream that ended, reused by the next one instead of allocating. */
+  EncStream *spare_stream;
 };
 
 static int output_pages(OggOpusEnc *enc) {
@@ -291,6 +667,12 @@ static int oe_flush_page(OggOpusEnc *enc) {
   return 0;
 }
 
+/* The packer only fails to give a packet buffer when it can't grow: a
+   fixed packer is out of room and a regular one is out of memory. */
+static int packet_buffer_error(const OggOpusEnc *enc) {
+  return enc->in_place ? OPE_BUFFER_FULL : OPE_ALLOC_FAIL;
+}
+
 static int stdio_write(void *user_data, const unsigned char *ptr, opus_int32 len) {
   int ret;
   struct StdioObject *obj = (struct StdioObject*)user_data;
@@ -334,25 +716,32 @@ OggOpusEnc *ope_encoder_create_file(const char *path, OggOpusComments *comments,
   return enc;
 }
 
-EncStream *stream_create(OggOpusComments *comments) {
-  EncStream *stream;
-  stream = malloc(sizeof(*stream));
-  if (!stream) return NULL;
+/* Sets up a stream whose comment buffer has room for the comments. */
+static void stream_init(EncStream *stream, OggOpusComments *comments) {
   stream->next = NULL;
   stream->close_at_end = 1;
   stream->serialno_is_set = 0;
   stream->stream_is_init = 0;
   stream->header_is_frozen = 0;
   stream->granule_offset = 0;
-  stream->comment = malloc(comments->comment_length);
-  if (stream->comment == NULL) goto fail;
   memcpy(stream->comment, comments->comment, comments->comment_length);
   stream->comment_length = comments->comment_length;
   stream->seen_file_icons = comments->seen_file_icons;
+}
+
+/* The comment buffer gets comment_alloc bytes if that's more than the
+   comments need. */
+EncStream *stream_create(const OpeAllocator *allocator, OggOpusComments *comments, int comment_alloc) {
+  EncStream *stream;
+  stream = opeint_malloc(allocator, sizeof(*stream));
+  if (!stream) return NULL;
+  stream->comment_alloc = MAX(comment_alloc, comments->comment_length);
+  stream->comment = opeint_malloc(allocator, stream->comment_alloc);
+  if (stream->comment == NULL) goto fail;
+  stream_init(stream, comments);
   return stream;
 fail:
-  if (stream->comment) free(stream->comment);
-  free(stream);
+  opeint_free(allocator, stream);
   return NULL;
 }
 
@@ -361,14 +750,234 @@ static void stream_generate_serialno(EncStream *stream) {
   stream->serialno_is_set = 1;
 }
 
-static void stream_destroy(EncStream *stream) {
-  if (stream->comment) free(stream->comment);
-  free(stream);
+static void stream_destroy(const OpeAllocator *allocator, EncStream *stream) {
+  opeint_free(allocator, stream->comment);
+  opeint_free(allocator, stream);
+}
+
+/* Length of comments of the length given once padded. */
+static int padded_comment_length(const OggOpusEnc *enc, int length) {
+  if (enc->comment_padding <= 0) return length;
+  return (length+enc->comment_padding+255)/255*255-1;
+}
+
+/* Like stream_create(), but takes the spare stream when its comment buffer is
+   large enough, so that chaining doesn't allocate once a stream has ended.
+   New streams get room for the padding right away. */
+static EncStream *stream_get(OggOpusEnc *enc, OggOpusComments *comments) {
+  EncStream *stream = enc->spare_stream;
+  if (stream == NULL || stream->comment_alloc < comments->comment_length) {
+    return stream_create(&enc->allocator, comments, padded_comment_length(enc, comments->comment_length));
+  }
+  enc->spare_stream = NULL;
+  stream_init(stream, comments);
+  return stream;
+}
+
+/* Keeps the stream as the spare, or whichever of the two has the larger
+   comment buffer. */
+static void stream_release(OggOpusEnc *enc, EncStream *stream) {
+  if (enc->spare_stream != NULL) {
+    if (enc->spare_stream->comment_alloc >= stream->comment_alloc) {
+      stream_destroy(&enc->allocator, stream);
+      return;
+    }
+    stream_destroy(&enc->allocator, enc->spare_stream);
+  }
+  enc->spare_stream = stream;
+}
+
+/* Pads the comments as opeint_comment_pad() does, but without reallocating
+   when the buffer already has room. */
+static void stream_pad_comment(OggOpusEnc *enc, EncStream *stream) {
+  int newlen;
+  if (enc->comment_padding <= 0) return;
+  newlen = padded_comment_length(enc, stream->comment_length);
+  if (newlen > stream->comment_alloc) {
+    opeint_comment_pad(&enc->allocator, &stream->comment, &stream->comment_length, enc->comment_padding);
+    stream->comment_alloc = MAX(stream->comment_alloc, stream->comment_length);
+  } else {
+    memset(&stream->comment[stream->comment_length], 0, newlen - stream->comment_length);
+    stream->comment_length = newlen;
+  }
+}
+
+/* Makes sure there is room for a packet of the largest size in both
+   chaining_keyframe and packet_copy. */
+static int keyframe_slots_alloc(OggOpusEnc *enc, opus_int32 max_packet_size) {
+  if (enc->chaining_keyframe == NULL) enc->chaining_keyframe = opeint_malloc(&enc->allocator, max_packet_size);
+  if (enc->packet_copy == NULL) enc->packet_copy = opeint_malloc(&enc->allocator, max_packet_size);
+  return enc->chaining_keyframe != NULL && enc->packet_copy != NULL;
+}
+
+/* Allocates lpc_buffer (see OggOpusEnc) if there isn't one yet. */
+static int lpc_buffer_alloc(OggOpusEnc *enc) {
+  if (enc->lpc_buffer) return OPE_OK;
+  enc->lpc_buffer = opeint_malloc(&enc->allocator,
+      sizeof(*enc->lpc_buffer)*(LPC_INPUT+LPC_PADDING+WRITE_COALESCE)*enc->channels);
+  if (enc->lpc_buffer == NULL) return OPE_ALLOC_FAIL;
+  memset(enc->lpc_buffer, 0, sizeof(*enc->lpc_buffer)*LPC_INPUT*enc->channels);
+  enc->lpc_pos = 0;
+  enc->pending_samples = 0;
+  return OPE_OK;
+}
+
+/* Number of samples the buffer needs: the history for the LPC extension, the decision
+   delay and the frame being encoded, plus the padding added when draining. The decision
+   delay is at 48 kHz (like the ctl), frame_size is at opus_rate. */
+static int compute_buffer_samples(OggOpusEnc *enc, int decision_delay, int frame_size) {
+  int scale = 48000/enc->opus_rate;
+  int resampler_drain = 0;
+  int samples;
+  if (enc->re) resampler_drain = speex_resampler_get_output_latency(enc->re);
+  /* Never less than what is already in there. */
+  samples = MAX(decision_delay/scale + frame_size, enc->buffer_end - enc->buffer_start);
+  return LPC_INPUT + samples + ENCODER_LOOKAHEAD/scale + frame_size + resampler_drain + 1 + BUFFER_EXTRA;
+}
+
+/* Most audio deferred mode takes from the writes (at opus_rate), and the
+   largest buffer it and encode threads grow to for it. */
+static int backlog_samples(OggOpusEnc *enc) {
+  return (enc->decision_delay + enc->max_backlog)/(48000/enc->opus_rate) + enc->frame_size;
+}
+
+static int backlog_buffer_samples(OggOpusEnc *enc) {
+  return compute_buffer_samples(enc, enc->decision_delay + enc->max_backlog, enc->frame_size);
+}
+
+/* Size of the mirror for a buffer of buffer_samples. It holds the longest window
+   encode_buffer() hands to libopus (which includes the frame), so what wrapped
+   around always fits and the buffer never has to be unwrapped while encoding. */
+static int mirror_alloc_samples(OggOpusEnc *enc, int buffer_samples) {
+  return MIN(buffer_samples, MAX_ANALYSIS_MS*(enc->opus_rate/1000));
+}
+
+/* Samples to allocate for a buffer of buffer_samples: the ring and the mirror. */
+static int buffer_alloc_samples(OggOpusEnc *enc, int buffer_samples) {
+  return buffer_samples + mirror_alloc_samples(enc, buffer_samples);
+}
+
+static void reverse_samples(float *x, int len) {
+  int i;
+  for (i=0;i<len/2;i++) {
+    float tmp = x[i];
+    x[i] = x[len-1-i];
+    x[len-1-i] = tmp;
+  }
+}
+
+/* Rotates the circular buffer so that its content (including the LPC_INPUT samples
+   of history before buffer_start) starts at the beginning of the buffer. This is
+   needed when draining, so that the end of the stream can be padded in-place. */
+static void unwrap_buffer(OggOpusEnc *enc) {
+  int history;
+  int offset;
+  int len;
+  int c = enc->channels;
+  /* Leaving enough in the buffer to do LPC extension if needed. */
+  history = (int)MIN(LPC_INPUT, enc->curr_granule/(48000/enc->opus_rate));
+  offset = enc->buffer_start - history;
+  if (offset < 0) offset += enc->buffer_samples;
+  if (offset + (enc->buffer_end - enc->buffer_start) + history <= enc->buffer_samples) {
+    /* Not wrapped around. */
+    memmove(enc->buffer, &enc->buffer[c*offset], c*(enc->buffer_end - enc->buffer_start + history)*sizeof(*enc->buffer));
+  } else if (enc->buffer_samples - offset <= enc->mirror_samples) {
+    /* The part before the end goes through the mirror. */
+    int tail = enc->buffer_samples - offset;
+    memcpy(&enc->buffer[c*enc->buffer_samples], &enc->buffer[c*offset], c*tail*sizeof(*enc->buffer));
+    memmove(&enc->buffer[c*tail], enc->buffer, c*(enc->buffer_end - enc->buffer_start + history - tail)*sizeof(*enc->buffer));
+    memcpy(enc->buffer, &enc->buffer[c*enc->buffer_samples], c*tail*sizeof(*enc->buffer));
+  } else if (offset != 0) {
+    len = enc->buffer_samples*c;
+    reverse_samples(enc->buffer, offset*enc->channels);
+    reverse_samples(&enc->buffer[offset*enc->channels], len - offset*enc->channels);
+    reverse_samples(enc->buffer, len);
+  }
+  enc->buffer_end -= enc->buffer_start - history;
+  enc->buffer_start = history;
+  enc->mirrored = 0;
+}
+
+/* Makes the first len samples from buffer_start contiguous, by copying what
+   wrapped around to the mirror after the end of the buffer. len is at most the
+   analysis window, so the mirror always has room for it and each sample written
+   gets copied at most once. */
+static void mirror_buffer(OggOpusEnc *enc, int len) {
+  int wrapped = MIN(enc->buffer_end, enc->buffer_start + len) - enc->buffer_samples;
+  assert(wrapped <= enc->mirror_samples);
+  if (wrapped > enc->mirrored) {
+    memcpy(&enc->buffer[enc->channels*(enc->buffer_samples + enc->mirrored)], &enc->buffer[enc->channels*enc->mirrored],
+           enc->channels*(wrapped - enc->mirrored)*sizeof(*enc->buffer));
+    enc->mirrored = wrapped;
+  }
+}
+
+/* Changes the size of the buffer, keeping its content. */
+static int resize_buffer(OggOpusEnc *enc, int buffer_samples) {
+  float *buffer;
+  unwrap_buffer(enc);
+  assert(enc->buffer_end < buffer_samples);
+  buffer = opeint_realloc(&enc->allocator, enc->buffer, sizeof(*buffer)*buffer_alloc_samples(enc, buffer_samples)*enc->channels);
+  if (buffer == NULL) return OPE_ALLOC_FAIL;
+  enc->buffer = buffer;
+  enc->buffer_samples = buffer_samples;
+  enc->mirror_samples = mirror_alloc_samples(enc, buffer_samples);
+  return OPE_OK;
+}
+
+/* Returns the number of samples that can be written contiguously at the end of the
+   buffer, along with where to write them. LPC_INPUT samples are always kept before
+   buffer_start for the LPC extension. */
+static int buffer_write_space(OggOpusEnc *enc, float **dst) {
+  int end;
+  int space;
+  space = enc->buffer_samples - LPC_INPUT - (enc->buffer_end - enc->buffer_start);
+  /* Nothing gets encoded in deferred mode, so the buffer grows to hold
+     everything written until the next ope_encoder_step(). Same with encode
+     threads, until there is enough for all of them. Both keep within the
+     backlog limit, but what draining pushes out of the resampler may still
+     need more room. */
+  if (space == 0 && (enc->deferred || enc->encode_threads > 1)) {
+    int buffer_samples = 2*enc->buffer_samples;
+    if (backlog_buffer_samples(enc) > enc->buffer_samples) {
+      buffer_samples = MIN(buffer_samples, backlog_buffer_samples(enc));
+    }
+    if (resize_buffer(enc, buffer_samples) != OPE_OK) {
+      enc->unrecoverable = OPE_ALLOC_FAIL;
+    } else {
+      space = enc->buffer_samples - LPC_INPUT - (enc->buffer_end - enc->buffer_start);
+    }
+  }
+  end = enc->buffer_end >= enc->buffer_samples ? enc->buffer_end - enc->buffer_samples : enc->buffer_end;
+  /* What gets written there is no longer mirrored. */
+  if (end < enc->mirrored) enc->mirrored = end;
+  *dst = &enc->buffer[enc->channels*end];
+  return MIN(enc->buffer_samples - end, space);
+}
+
+/* Creates a resampler from num/den Hz (nominally rate) to opus_rate, using the
+   allocator of the encoder. */
+static SpeexResamplerState *resampler_create(OggOpusEnc *enc, opus_uint32 num, opus_uint32 den,
+    opus_int32 rate, int quality) {
+  SpeexResamplerAllocator allocator;
+  allocator.alloc = enc->allocator.alloc;
+  allocator.realloc = enc->allocator.realloc;
+  allocator.free = enc->allocator.free;
+  allocator.user_data = enc->allocator.user_data;
+  return speex_resampler_init_alloc(enc->channels, num, enc->opus_rate*den, rate, enc->opus_rate,
+      quality, &allocator, NULL);
 }
 
+/* Creates an encoder whose memory comes from allocator (the default one if
+   NULL) and whose decision delay is capped to max_decision_delay (to
+   MAX_LOOKAHEAD if it's negative). With in_place, allocator is an arena that
+   nothing can be added to later, so everything gets its largest size here. */
 static OggOpusEnc *ope_encoder_create_callbacks_impl(const OpusEncCallbacks *callbacks, void *user_data,
-    OggOpusComments *comments, opus_int32 rate, int channels, int family, int *error) {
+    OggOpusComments *comments, opus_int32 rate, int channels, int family, const OpeAllocator *allocator,
+    opus_int32 max_decision_delay, int in_place, int *error) {
+  OpeAllocator alloc;
   OggOpusEnc *enc=NULL;
+  int alloc_samples;
   int ret;
   if (family != 0 && family != 1 &&
 #ifdef OPUS_HAVE_OPUS_PROJECTION_H
@@ -389,32 +998,64 @@ static OggOpusEnc *ope_encoder_create_callbacks_impl(const OpusEncCallbacks *cal
     if (error) *error = OPE_BAD_ARG;
     return NULL;
   }
+  /* The size of the libopus state isn't known until the mapping is. */
+  if (in_place && family == -1) {
+    if (error) *error = OPE_UNIMPLEMENTED;
+    return NULL;
+  }
+  if (allocator_init(&alloc, allocator) != OPE_OK) {
+    if (error) *error = OPE_BAD_ARG;
+    return NULL;
+  }
   /* Setting the most common failure up-front. */
   if (error) *error = OPE_ALLOC_FAIL;
-  if ( (enc = malloc(sizeof(*enc))) == NULL) goto fail;
+  if ( (enc = opeint_malloc(&alloc, sizeof(*enc))) == NULL) goto fail;
+  enc->allocator = alloc;
+  enc->in_place = in_place;
+  enc->st.ms = NULL;
+#ifdef OPUS_HAVE_OPUS_PROJECTION_H
+  enc->st.pr = NULL;
+#endif
   enc->buffer = NULL;
   enc->lpc_buffer = NULL;
-  if ( (enc->streams = stream_create(comments)) == NULL) goto fail;
-  enc->last_stream = enc->streams;
+  enc->lpc_pos = 0;
+  enc->pending_samples = 0;
+  enc->re = NULL;
   enc->oggp = NULL;
+#ifdef OPE_ASYNC
+  enc->async = NULL;
+  enc->pool = NULL;
+#endif
+#ifdef HAVE_PTHREAD
+  enc->stream_team = NULL;
+  enc->resampler_team = NULL;
+#endif
+  if ( (enc->streams = stream_create(&enc->allocator, comments, 0)) == NULL) goto fail;
+  enc->last_stream = enc->streams;
   /* Not initializing anything is an unrecoverable error. */
   enc->unrecoverable = family == -1 ? OPE_TOO_LATE : 0;
   enc->packet_callback = NULL;
   enc->rate = rate;
+  enc->opus_rate = 48000;
+  enc->native_rate = 0;
+  enc->opus_configured = 0;
   enc->channels = channels;
-  enc->frame_size = 960;
+  enc->frame_size = enc->opus_rate/50;
   enc->frame_size_request = OPUS_FRAMESIZE_20_MS;
-  enc->decision_delay = 96000;
+  enc->max_decision_delay = max_decision_delay >= 0 ? MIN(max_decision_delay, MAX_LOOKAHEAD) : MAX_LOOKAHEAD;
+  enc->decision_delay = MIN(96000, enc->max_decision_delay);
   enc->max_ogg_delay = 48000;
   enc->chaining_keyframe = NULL;
   enc->chaining_keyframe_length = -1;
+  enc->packet_copy = NULL;
+  enc->spare_stream = NULL;
   enc->comment_padding = 512;
   enc->header.channels=channels;
   enc->header.channel_mapping=family;
   enc->header.input_sample_rate=rate;
   enc->header.gain=0;
   if (family != -1) {
-    ret=opeint_encoder_surround_init(&enc->st, 48000, channels,
+    ret=opeint_encoder_surround_init(&enc->st, &enc->allocator, enc->opus_rate, channels,
         enc->header.channel_mapping, &enc->header.nb_streams,
         &enc->header.nb_coupled, enc->header.stream_map,
         OPUS_APPLICATION_AUDIO);
@@ -429,8 +1070,15 @@ static OggOpusEnc *ope_encoder_create_callbacks_impl(const OpusEncCallbacks *cal
     }
     opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_20_MS));
   }
-  if (rate != 48000) {
-    enc->re = speex_resampler_init(channels, rate, 48000, 5, NULL);
+  enc->resampler_quality = 5;
+  enc->rate_correction = 0;
+  enc->rate_num = rate;
+  enc->rate_den = 1;
+  enc->drift_target = -1;
+  enc->drift_integral = 0;
+  enc->drift_last_report = -1;
+  if (rate != enc->opus_rate) {
+    enc->re = resampler_create(enc, rate, 1, rate, enc->resampler_quality);
     if (enc->re == NULL) goto fail;
     speex_resampler_skip_zeros(enc->re);
   } else {
@@ -439,15 +1087,34 @@ static OggOpusEnc *ope_encoder_create_callbacks_impl(const OpusEncCallbacks *cal
   enc->global_granule_offset = -1;
   enc->curr_granule = 0;
   enc->write_granule = 0;
+  enc->write_granule_base = 0;
+  enc->write_granule_frac = 0;
   enc->last_page_granule = 0;
   enc->draining = 0;
-  if ( (enc->buffer = malloc(sizeof(*enc->buffer)*BUFFER_SAMPLES*channels)) == NULL) goto fail;
-  if (rate != 48000) {
+  enc->deferred = 0;
+  enc->max_backlog = DEFAULT_MAX_BACKLOG;
+  enc->encode_threads = 1;
+  enc->stream_threads = 1;
+  enc->streams_synced = 0;
+  enc->resampler_threads = 1;
+  enc->buffer_start = enc->buffer_end = 0;
+  enc->mirrored = 0;
+  enc->buffer_samples = compute_buffer_samples(enc, enc->decision_delay, enc->frame_size);
+  /* Resizing the buffer within what was allocated keeps it in place, so an
+     encoder in place can take any decision delay and frame size later. */
+  alloc_samples = in_place ? compute_buffer_samples(enc, enc->max_decision_delay, MAX_FRAME_SIZE) : enc->buffer_samples;
+  if ( (enc->buffer = opeint_malloc(&enc->allocator, sizeof(*enc->buffer)*buffer_alloc_samples(enc, alloc_samples)*channels)) == NULL) goto fail;
+  enc->mirror_samples = mirror_alloc_samples(enc, enc->buffer_samples);
+  if (enc->re) {
     /* Allocate an extra LPC_PADDING samples so we can do the padding in-place. */
-    if ( (enc->lpc_buffer = malloc(sizeof(*enc->lpc_buffer)*(LPC_INPUT+LPC_PADDING)*channels)) == NULL) goto fail;
-    memset(enc->lpc_buffer, 0, sizeof(*enc->lpc_buffer)*LPC_INPUT*channels);
+    if (lpc_buffer_alloc(enc) != OPE_OK) goto fail;
+  }
+  if (in_place) {
+    /* The serial number is set when the first stream starts. */
+    enc->oggp = oggp_create_fixed(0, &enc->allocator, (1277*6+2)*enc->header.nb_streams);
+    if (enc->oggp == NULL) goto fail;
+    oggp_set_muxing_delay(enc->oggp, enc->max_ogg_delay);
   }
-  enc->buffer_start = enc->buffer_end = 0;
   if (callbacks != NULL)
   {
     enc->callbacks = *callbacks;
@@ -461,11 +1128,13 @@ static OggOpusEnc *ope_encoder_create_callbacks_impl(const OpusEncCallbacks *cal
   return enc;
 fail:
   if (enc) {
-    opeint_encoder_cleanup(&enc->st);
-    if (enc->buffer) free(enc->buffer);
-    if (enc->streams) stream_destroy(enc->streams);
-    if (enc->lpc_buffer) free(enc->lpc_buffer);
-    free(enc);
+    opeint_encoder_cleanup(&enc->st, &enc->allocator);
+    opeint_free(&enc->allocator, enc->buffer);
+    if (enc->streams) stream_destroy(&enc->allocator, enc->streams);
+    if (enc->re) speex_resampler_destroy(enc->re);
+    opeint_free(&enc->allocator, enc->lpc_buffer);
+    if (enc->oggp) oggp_destroy(enc->oggp);
+    opeint_free(&alloc, enc);
   }
   return NULL;
 }
@@ -477,12 +1146,183 @@ OggOpusEnc *ope_encoder_create_callbacks(const OpusEncCallbacks *callbacks, void
     if (error) *error = OPE_BAD_ARG;
     return NULL;
   }
-  return ope_encoder_create_callbacks_impl(callbacks, user_data, comments, rate, channels, family, error);
+  return ope_encoder_create_callbacks_impl(callbacks, user_data, comments, rate, channels, family, NULL, -1, 0, error);
 }
 
 /* Create a new OggOpus stream, pulling one page at a time. */
 OggOpusEnc *ope_encoder_create_pull(OggOpusComments *comments, opus_int32 rate, int channels, int family, int *error) {
-  return ope_encoder_create_callbacks_impl(NULL, NULL, comments, rate, channels, family, error);
+  return ope_encoder_create_callbacks_impl(NULL, NULL, comments, rate, channels, family, NULL, -1, 0, error);
+}
+
+OggOpusEnc *ope_encoder_create_with_allocator(const OpusEncCallbacks *callbacks, void *user_data,
+    OggOpusComments *comments, opus_int32 rate, int channels, int family,
+    const OpeAllocator *allocator, int *error) {
+  return ope_encoder_create_callbacks_impl(callbacks, user_data, comments, rate, channels, family, allocator,
+      -1, 0, error);
+}
+
+OggOpusEnc *ope_encoder_create_with_max_delay(const OpusEncCallbacks *callbacks, void *user_data,
+    OggOpusComments *comments, opus_int32 rate, int channels, int family,
+    opus_int32 max_decision_delay, int *error) {
+  if (max_decision_delay < 0) {
+    if (error) *error = OPE_BAD_ARG;
+    return NULL;
+  }
+  return ope_encoder_create_callbacks_impl(callbacks, user_data, comments, rate, channels, family, NULL,
+      max_decision_delay, 0, error);
+}
+
+size_t ope_encoder_get_size(opus_int32 rate, int channels, int family, opus_int32 max_decision_delay) {
+  OpeArena arena;
+  OpeAllocator allocator;
+  OggOpusComments comments;
+  char comment[IN_PLACE_COMMENT_SIZE];
+  OggOpusEnc *enc;
+  EncStream *next;
+  opus_int32 max_packet_size;
+  size_t size = 0;
+  if (max_decision_delay < 0) return 0;
+  /* Measures what creating the encoder takes, with malloc() behind the arena. */
+  arena_init(&arena, NULL, (size_t)-1);
+  allocator.alloc = arena_alloc;
+  allocator.realloc = arena_realloc;
+  allocator.free = arena_free;
+  allocator.user_data = &arena;
+  memset(comment, 0, sizeof(comment));
+  comments.comment = comment;
+  comments.comment_length = sizeof(comment);
+  comments.seen_file_icons = 0;
+  memset(&comments.allocator, 0, sizeof(comments.allocator));
+  enc = ope_encoder_create_callbacks_impl(NULL, NULL, &comments, rate, channels, family, &allocator,
+      max_decision_delay, 1, NULL);
+  if (enc == NULL) {
+    arena_clear(&arena);
+    return 0;
+  }
+  /* Then what encoding takes on top: the padding of the comments, a chained
+     stream, and the slots for the packets kept across stream boundaries. */
+  max_packet_size = (1277*6+2)*enc->header.nb_streams;
+  stream_pad_comment(enc, enc->streams);
+  next = stream_get(enc, &comments);
+  if (next) stream_pad_comment(enc, next);
+  if (next && keyframe_slots_alloc(enc, max_packet_size)) {
+    size = ARENA_ALIGN-1 + ARENA_ROUND(sizeof(OpeArena)) + arena.peak;
+  }
+  if (next) stream_destroy(&enc->allocator, next);
+  ope_encoder_destroy(enc);
+  arena_clear(&arena);
+  return size;
+}
+
+OggOpusEnc *ope_encoder_init_in_place(void *mem, size_t size, const OpusEncCallbacks *callbacks, void *user_data,
+    OggOpusComments *comments, opus_int32 rate, int channels, int family, opus_int32 max_decision_delay,
+    int *error) {
+  OpeArena *arena;
+  OpeAllocator allocator;
+  size_t offset;
+  if (mem == NULL || callbacks == NULL || max_decision_delay < 0) {
+    if (error) *error = OPE_BAD_ARG;
+    return NULL;
+  }
+  /* The arena comes first, aligned like its blocks. */
+  offset = (ARENA_ALIGN - (size_t)mem%ARENA_ALIGN)%ARENA_ALIGN;
+  if (size < offset + ARENA_ROUND(sizeof(OpeArena))) {
+    if (error) *error = OPE_ALLOC_FAIL;
+    return NULL;
+  }
+  arena = (OpeArena *)((unsigned char *)mem + offset);
+  arena_init(arena, (unsigned char *)arena + ARENA_ROUND(sizeof(OpeArena)), size - offset - ARENA_ROUND(sizeof(OpeArena)));
+  allocator.alloc = arena_alloc;
+  allocator.realloc = arena_realloc;
+  allocator.free = arena_free;
+  allocator.user_data = arena;
+  return ope_encoder_create_callbacks_impl(callbacks, user_data, comments, rate, channels, family, &allocator,
+      max_decision_delay, 1, error);
+}
+
+/* Create a new OggOpus stream with the settings of an encoder that has not
+   started encoding. */
+OggOpusEnc *ope_encoder_clone(const OggOpusEnc *proto, const OpusEncCallbacks *callbacks,
+    void *user_data, int *error) {
+  OggOpusEnc *enc=NULL;
+  OggOpusComments comments;
+  int ret;
+  if (proto->unrecoverable) {
+    if (error) *error = proto->unrecoverable;
+    return NULL;
+  }
+  /* The clone would come from the memory of proto. */
+  if (proto->in_place) {
+    if (error) *error = OPE_UNIMPLEMENTED;
+    return NULL;
+  }
+  if (
+#ifdef OPE_ASYNC
+      proto->async ||
+#endif
+      proto->streams == NULL || proto->streams->stream_is_init || proto->streams->next ||
+      proto->draining || proto->curr_granule != 0 || proto->write_granule != 0 ||
+      proto->write_granule_base != 0) {
+    if (error) *error = OPE_TOO_LATE;
+    return NULL;
+  }
+  if (error) *error = OPE_ALLOC_FAIL;
+  if ( (enc = opeint_malloc(&proto->allocator, sizeof(*enc))) == NULL) goto fail;
+  /* Everything that is not a pointer is a setting or still in its initial state. */
+  *enc = *proto;
+  enc->st.ms = NULL;
+#ifdef OPUS_HAVE_OPUS_PROJECTION_H
+  enc->st.pr = NULL;
+#endif
+  enc->buffer = NULL;
+  enc->lpc_buffer = NULL;
+  enc->re = NULL;
+  enc->oggp = NULL;
+  enc->streams = NULL;
+  enc->spare_stream = NULL;
+  /* A prototype that was reset may have its keyframe slots. */
+  enc->chaining_keyframe = NULL;
+  enc->chaining_keyframe_length = -1;
+  enc->packet_copy = NULL;
+#ifdef HAVE_PTHREAD
+  enc->stream_team = NULL;
+  enc->resampler_team = NULL;
+#endif
+  comments.comment = proto->streams->comment;
+  comments.comment_length = proto->streams->comment_length;
+  comments.seen_file_icons = proto->streams->seen_file_icons;
+  if ( (enc->streams = stream_create(&enc->allocator, &comments, 0)) == NULL) goto fail;
+  enc->last_stream = enc->streams;
+  enc->streams->user_data = user_data;
+  enc->streams->end_granule = 0;
+  ret = opeint_encoder_copy(&enc->st, &proto->st, &enc->allocator);
+  if (ret != OPE_OK) goto fail;
+  if (proto->re) {
+    if ( (enc->re = speex_resampler_copy(proto->re, NULL)) == NULL) goto fail;
+  }
+  if ( (enc->buffer = opeint_malloc(&enc->allocator, sizeof(*enc->buffer)*buffer_alloc_samples(enc, enc->buffer_samples)*enc->channels)) == NULL) goto fail;
+  if (proto->lpc_buffer) {
+    if (lpc_buffer_alloc(enc) != OPE_OK) goto fail;
+  }
+  if (callbacks != NULL)
+  {
+    enc->callbacks = *callbacks;
+    enc->pull_api = 0;
+  } else {
+    enc->pull_api = 1;
+  }
+  if (error) *error = OPE_OK;
+  return enc;
+fail:
+  if (enc) {
+    opeint_encoder_cleanup(&enc->st, &enc->allocator);
+    opeint_free(&enc->allocator, enc->buffer);
+    if (enc->streams) stream_destroy(&enc->allocator, enc->streams);
+    if (enc->re) speex_resampler_destroy(enc->re);
+    opeint_free(&enc->allocator, enc->lpc_buffer);
+    opeint_free(&proto->allocator, enc);
+  }
+  return NULL;
 }
 
 int ope_encoder_deferred_init_with_mapping(OggOpusEnc *enc, int family, int streams,
@@ -496,7 +1336,8 @@ int ope_encoder_deferred_init_with_mapping(OggOpusEnc *enc, int family, int stre
   #endif
       family != 255) return OPE_UNIMPLEMENTED;
   else if (streams <= 0 || streams>255 || coupled_streams<0 || coupled_streams >= 128 || streams+coupled_streams > 255) return OPE_BAD_ARG;
-  ret=opeint_encoder_init(&enc->st, 48000, enc->channels, streams, coupled_streams, mapping, OPUS_APPLICATION_AUDIO);
+  opeint_encoder_cleanup(&enc->st, &enc->allocator);
+  ret=opeint_encoder_init(&enc->st, &enc->allocator, enc->opus_rate, enc->channels, streams, coupled_streams, mapping, OPUS_APPLICATION_AUDIO);
   if (! (ret == OPUS_OK) ) {
     if (ret == OPUS_BAD_ARG) ret = OPE_BAD_ARG;
     else if (ret == OPUS_INTERNAL_ERROR) ret = OPE_INTERNAL_ERROR;
@@ -507,6 +1348,7 @@ int ope_encoder_deferred_init_with_mapping(OggOpusEnc *enc, int family, int stre
   }
   opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_20_MS));
   enc->unrecoverable = 0;
+  enc->opus_configured = 1;
   enc->header.channel_mapping=family;
   enc->header.nb_streams = streams;
   enc->header.nb_coupled = coupled_streams;
@@ -521,21 +1363,22 @@ static void init_stream(OggOpusEnc *enc) {
 
   if (enc->oggp != NULL) oggp_chain(enc->oggp, enc->streams->serialno);
   else {
-    enc->oggp = oggp_create(enc->streams->serialno);
+    enc->oggp = oggp_create(enc->streams->serialno, &enc->allocator);
     if (enc->oggp == NULL) {
       enc->unrecoverable = OPE_ALLOC_FAIL;
       return;
     }
     oggp_set_muxing_delay(enc->oggp, enc->max_ogg_delay);
   }
-  opeint_comment_pad(&enc->streams->comment, &enc->streams->comment_length, enc->comment_padding);
+  stream_pad_comment(enc, enc->streams);
 
   /* Get preskip at the last minute (when it can no longer change). */
   if (enc->global_granule_offset == -1) {
     opus_int32 tmp;
     int ret;
     ret=opeint_encoder_ctl(&enc->st, OPUS_GET_LOOKAHEAD(&tmp));
-    if (ret == OPUS_OK) enc->header.preskip = tmp;
+    /* The lookahead is at opus_rate, but the pre-skip is always at 48 kHz. */
+    if (ret == OPUS_OK) enc->header.preskip = tmp*(48000/enc->opus_rate);
     else enc->header.preskip = 0;
     enc->global_granule_offset = enc->header.preskip;
   }
@@ -547,6 +1390,10 @@ static void init_stream(OggOpusEnc *enc) {
     unsigned char *p;
     header_size = opeint_opus_header_get_size(&enc->header);
     p = oggp_get_packet_buffer(enc->oggp, header_size);
+    if (p == NULL) {
+      enc->unrecoverable = packet_buffer_error(enc);
+      return;
+    }
     packet_size = opeint_opus_header_to_packet(&enc->header, p, header_size, &enc->st);
     if (enc->packet_callback) enc->packet_callback(enc->packet_callback_data, p, packet_size, 0);
     oggp_commit_packet(enc->oggp, packet_size, 0, 0);
@@ -556,6 +1403,10 @@ static void init_stream(OggOpusEnc *enc) {
       return;
     }
     p = oggp_get_packet_buffer(enc->oggp, enc->streams->comment_length);
+    if (p == NULL) {
+      enc->unrecoverable = packet_buffer_error(enc);
+      return;
+    }
     memcpy(p, enc->streams->comment, enc->streams->comment_length);
     if (enc->packet_callback) enc->packet_callback(enc->packet_callback_data, p, enc->streams->comment_length, 0);
     oggp_commit_packet(enc->oggp, enc->streams->comment_length, 0, 0);
@@ -569,63 +1420,438 @@ static void init_stream(OggOpusEnc *enc) {
   enc->streams->packetno = 2;
 }
 
-static void shift_buffer(OggOpusEnc *enc) {
-  /* Leaving enough in the buffer to do LPC extension if needed. */
-  if (enc->buffer_start > LPC_INPUT) {
-    memmove(&enc->buffer[0], &enc->buffer[enc->channels*(enc->buffer_start-LPC_INPUT)],
-            enc->channels*(enc->buffer_end-enc->buffer_start+LPC_INPUT)*sizeof(*enc->buffer));
-    enc->buffer_end -= enc->buffer_start-LPC_INPUT;
-    enc->buffer_start = LPC_INPUT;
-  }
-}
-
 static int compute_frame_samples(int size_request) {
   if (size_request <= OPUS_FRAMESIZE_40_MS) return 120<<(size_request-OPUS_FRAMESIZE_2_5_MS);
   else return (size_request-OPUS_FRAMESIZE_2_5_MS-2)*960;
 }
 
-static void encode_buffer(OggOpusEnc *enc) {
-  opus_int32 max_packet_size;
+/* Position of the end of the input written so far at 48 kHz, with the fraction
+   of a sample in Q32. */
+static opus_int64 write_granule_exact(OggOpusEnc *enc, opus_uint32 *frac) {
+  opus_int64 num = enc->rate_num;
+  opus_int64 mul = 48000*(opus_int64)enc->rate_den;
+  opus_int64 rem;
+  unsigned long long f;
+  /* No resampling, or from a rate 48 kHz is a multiple of. */
+  if (mul%num == 0) {
+    *frac = enc->write_granule_frac;
+    return enc->write_granule_base + enc->write_granule*(mul/num);
+  }
+  rem = enc->write_granule%num*mul;
+  f = (unsigned long long)enc->write_granule_frac + (((unsigned long long)(rem%num)<<32)/num);
+  *frac = (opus_uint32)f;
+  return enc->write_granule_base + enc->write_granule/num*mul + rem/num + (opus_int64)(f>>32);
+}
+
+static opus_int64 write_granule48k(OggOpusEnc *enc) {
+  opus_uint32 frac;
+  opus_int64 granule = write_granule_exact(enc, &frac);
   /* Round up when converting the granule pos because the decoder will round down. */
-  opus_int64 end_granule48k = (enc->streams->end_granule*48000 + enc->rate - 1)/enc->rate + enc->global_granule_offset;
-  max_packet_size = (1277*6+2)*enc->header.nb_streams;
-  while (enc->buffer_end-enc->buffer_start > enc->frame_size + enc->decision_delay) {
-    int cont;
-    int e_o_s;
-    opus_int32 pred;
-    int nbBytes;
-    unsigned char *packet;
-    unsigned char *packet_copy = NULL;
-    int is_keyframe=0;
-    if (enc->unrecoverable) return;
-    opeint_encoder_ctl(&enc->st, OPUS_GET_PREDICTION_DISABLED(&pred));
-    /* FIXME: a frame that follows a keyframe generally doesn't need to be a keyframe
-       unless there's two consecutive stream boundaries. */
-    if (enc->curr_granule + 2*enc->frame_size>= end_granule48k && enc->streams->next) {
-      opeint_encoder_ctl(&enc->st, OPUS_SET_PREDICTION_DISABLED(1));
-      is_keyframe = 1;
+  return granule + (frac != 0);
+}
+
+#ifdef HAVE_PTHREAD
+typedef void (*team_func)(void *arg, int job, int worker);
+
+typedef struct {
+  ThreadTeam *team;
+  /* 0 is the thread calling team_run(). */
+  int index;
+  pthread_t thread;
+} TeamWorker;
+
+/* Threads sharing the jobs given to team_run() with the calling thread. */
+struct ThreadTeam {
+  /* The one of the encoder, which outlives the team. */
+  const OpeAllocator *allocator;
+  int nb_threads;
+  TeamWorker *workers;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  pthread_cond_t done;
+  team_func func;
+  void *arg;
+  int generation;
+  int nb_jobs;
+  int next_job;
+  int nb_done;
+  int stop;
+};
+
+/* Takes jobs until there are none left. Called with the mutex held. */
+static void team_work(ThreadTeam *team, int index) {
+  while (team->next_job < team->nb_jobs) {
+    int job = team->next_job++;
+    pthread_mutex_unlock(&team->mutex);
+    team->func(team->arg, job, index);
+    pthread_mutex_lock(&team->mutex);
+    if (++team->nb_done == team->nb_jobs) pthread_cond_signal(&team->done);
+  }
+}
+
+static void *team_worker(void *arg) {
+  TeamWorker *w = (TeamWorker *)arg;
+  ThreadTeam *team = w->team;
+  int generation = 0;
+  pthread_mutex_lock(&team->mutex);
+  for (;;) {
+    while (team->generation == generation && !team->stop) pthread_cond_wait(&team->cond, &team->mutex);
+    if (team->stop) break;
+    generation = team->generation;
+    team_work(team, w->index);
+  }
+  pthread_mutex_unlock(&team->mutex);
+  return NULL;
+}
+
+static void team_destroy(ThreadTeam *team) {
+  int i;
+  pthread_mutex_lock(&team->mutex);
+  team->stop = 1;
+  pthread_cond_broadcast(&team->cond);
+  pthread_mutex_unlock(&team->mutex);
+  for (i=1;i<team->nb_threads;i++) pthread_join(team->workers[i].thread, NULL);
+  pthread_mutex_destroy(&team->mutex);
+  pthread_cond_destroy(&team->cond);
+  pthread_cond_destroy(&team->done);
+  opeint_free(team->allocator, team->workers);
+  opeint_free(team->allocator, team);
+}
+
+/* Starts nb_threads-1 threads, the caller of team_run() being the last one. */
+static ThreadTeam *team_create(int nb_threads, const OpeAllocator *allocator) {
+  ThreadTeam *team;
+  if ( (team = opeint_malloc(allocator, sizeof(*team))) == NULL) return NULL;
+  memset(team, 0, sizeof(*team));
+  team->allocator = allocator;
+  pthread_mutex_init(&team->mutex, NULL);
+  pthread_cond_init(&team->cond, NULL);
+  pthread_cond_init(&team->done, NULL);
+  if ( (team->workers = opeint_malloc(allocator, sizeof(*team->workers)*nb_threads)) == NULL) {
+    team_destroy(team);
+    return NULL;
+  }
+  team->workers[0].team = team;
+  team->workers[0].index = 0;
+  for (team->nb_threads=1;team->nb_threads<nb_threads;team->nb_threads++) {
+    TeamWorker *w = &team->workers[team->nb_threads];
+    w->team = team;
+    w->index = team->nb_threads;
+    if (pthread_create(&w->thread, NULL, team_worker, w) != 0) {
+      team_destroy(team);
+      return NULL;
     }
-    /* Handle the last packet by making sure not to encode too much padding. */
-    if (enc->curr_granule+enc->frame_size >= end_granule48k && enc->draining && enc->frame_size_request > OPUS_FRAMESIZE_20_MS) {
-      int min_samples;
-      int frame_size_request = OPUS_FRAMESIZE_20_MS;
-      /* Minimum frame size required for the current frame to still meet the e_o_s condition. */
-      min_samples = end_granule48k - enc->curr_granule;
-      while (compute_frame_samples(frame_size_request) < min_samples) frame_size_request++;
-      assert(frame_size_request <= enc->frame_size_request);
+  }
+  return team;
+}
+
+/* Calls func(arg, job, worker) for each job in [0,nb_jobs), with worker the
+   index of the thread running it. Returns when they are all done. */
+static void team_run(ThreadTeam *team, int nb_jobs, team_func func, void *arg) {
+  pthread_mutex_lock(&team->mutex);
+  team->func = func;
+  team->arg = arg;
+  team->nb_jobs = nb_jobs;
+  team->next_job = 0;
+  team->nb_done = 0;
+  team->generation++;
+  pthread_cond_broadcast(&team->cond);
+  team_work(team, 0);
+  while (team->nb_done < nb_jobs) pthread_cond_wait(&team->done, &team->mutex);
+  pthread_mutex_unlock(&team->mutex);
+}
+
+/* Whether the streams of this encoder can be encoded on their own: only for
+   families 2 and 255, since it skips the surround analysis. */
+static int streams_separable(const OggOpusEnc *enc) {
+  int family = enc->header.channel_mapping;
+  return (family == 2 || family == 255) && enc->header.nb_streams > 1;
+}
+
+/* Largest packet libopus produces for one elementary stream. */
+#define STREAM_MAX_PACKET (1275*6+12)
+
+/* State for encoding the elementary streams of a frame in parallel. */
+struct StreamThreads {
+  OggOpusEnc *enc;
+  ThreadTeam *team;
+  /* Input channels of each stream, -1 for silence. */
+  int *left;
+  int *right;
+  OpusEncoder **encoders;
+  /* Per stream, its channels of the frame and of the lookahead after it,
+     from window_base. Each frame only adds what the last one didn't have, and
+     the windows are moved back to the start when they reach the end. With
+     twice the window allocated that is one move every window_size/frame_size
+     frames, about one copy per sample like a mirror would cost, and a mirror
+     would need as much memory since the window can start anywhere. */
+  float **windows;
+  int window_alloc;
+  int window_base;
+  int window_filled;
+  /* Granule position of the frame the windows start with, -1 when a frame
+     was encoded some other way since. */
+  opus_int64 window_granule;
+  unsigned char *outputs;
+  int *sizes;
+  /* The frame being encoded, and the analysis_size samples of encode_frame(). */
+  const float *pcm;
+  int window_size;
+};
+
+static void stream_encode(void *arg, int s, int worker) {
+  StreamThreads *ms = (StreamThreads *)arg;
+  OggOpusEnc *enc = ms->enc;
+  int nb_channels = s < enc->header.nb_coupled ? 2 : 1;
+  float *in = &ms->windows[s][nb_channels*ms->window_base];
+  int i;
+  (void)worker;
+  for (i=ms->window_filled;i<ms->window_size;i++) {
+    in[nb_channels*i] = ms->left[s] >= 0 ? ms->pcm[enc->channels*i + ms->left[s]] : 0;
+    if (nb_channels == 2) in[2*i+1] = ms->right[s] >= 0 ? ms->pcm[enc->channels*i + ms->right[s]] : 0;
+  }
+  /* Like opus_multistream_encode_float(), which gives each stream the whole
+     analysis window of the input. */
+  ms->sizes[s] = opus_encode_float(ms->encoders[s], in, ms->window_size,
+      &ms->outputs[s*STREAM_MAX_PACKET], STREAM_MAX_PACKET);
+}
+
+static void stream_threads_destroy(StreamThreads *ms) {
+  const OpeAllocator *allocator = &ms->enc->allocator;
+  int s;
+  if (ms->team) team_destroy(ms->team);
+  if (ms->windows) {
+    for (s=0;s<ms->enc->header.nb_streams;s++) opeint_free(allocator, ms->windows[s]);
+  }
+  opeint_free(allocator, ms->windows);
+  opeint_free(allocator, ms->left);
+  opeint_free(allocator, ms->right);
+  opeint_free(allocator, ms->encoders);
+  opeint_free(allocator, ms->outputs);
+  opeint_free(allocator, ms->sizes);
+  opeint_free(allocator, ms);
+}
+
+static StreamThreads *stream_threads_create(OggOpusEnc *enc) {
+  StreamThreads *ms;
+  int nb_streams = enc->header.nb_streams;
+  int nb_coupled = enc->header.nb_coupled;
+  int nb_threads = MIN(enc->stream_threads, nb_streams);
+  int s;
+  int c;
+  if ( (ms = opeint_malloc(&enc->allocator, sizeof(*ms))) == NULL) return NULL;
+  memset(ms, 0, sizeof(*ms));
+  ms->enc = enc;
+  ms->left = opeint_malloc(&enc->allocator, sizeof(*ms->left)*nb_streams);
+  ms->right = opeint_malloc(&enc->allocator, sizeof(*ms->right)*nb_streams);
+  ms->encoders = opeint_malloc(&enc->allocator, sizeof(*ms->encoders)*nb_streams);
+  ms->windows = opeint_malloc(&enc->allocator, sizeof(*ms->windows)*nb_streams);
+  if (ms->windows) memset(ms->windows, 0, sizeof(*ms->windows)*nb_streams);
+  ms->outputs = opeint_malloc(&enc->allocator, STREAM_MAX_PACKET*nb_streams);
+  ms->sizes = opeint_malloc(&enc->allocator, sizeof(*ms->sizes)*nb_streams);
+  ms->window_granule = -1;
+  if (!ms->left || !ms->right || !ms->encoders || !ms->windows || !ms->outputs || !ms->sizes
+      || (ms->team = team_create(nb_threads, &enc->allocator)) == NULL) {
+    stream_threads_destroy(ms);
+    return NULL;
+  }
+  /* Same as libopus: each stream takes the first channel mapped to it. */
+  for (s=0;s<nb_streams;s++) {
+    int left = s < nb_coupled ? 2*s : nb_coupled + s;
+    ms->left[s] = ms->right[s] = -1;
+    for (c=enc->channels-1;c>=0;c--) {
+      if (enc->header.stream_map[c] == left) ms->left[s] = c;
+      if (s < nb_coupled && enc->header.stream_map[c] == left + 1) ms->right[s] = c;
+    }
+  }
+  return ms;
+}
+
+static int encode_size(int size, unsigned char *data) {
+  if (size < 252) {
+    data[0] = size;
+    return 1;
+  }
+  data[0] = 252 + (size&0x3);
+  data[1] = (size - data[0]) >> 2;
+  return 2;
+}
+
+/* Appends the packet of one stream to a multistream packet, framed exactly as
+   the libopus repacketizer would, self-delimited unless it is the last one.
+   Returns the number of bytes written, or -1. */
+static int append_stream_packet(unsigned char *dst, int max, const unsigned char *packet, int len, int self_delimited) {
+  unsigned char toc;
+  const unsigned char *frames[48];
+  opus_int16 size[48];
+  unsigned char *ptr = dst;
+  int count;
+  int vbr = 0;
+  int total;
+  int i;
+  count = opus_packet_parse(packet, len, &toc, frames, size, NULL);
+  if (count <= 0) return -1;
+  for (i=1;i<count;i++) vbr |= size[i] != size[0];
+  total = 1 + (self_delimited ? 1 + (size[count-1] >= 252) : 0);
+  for (i=0;i<count;i++) total += size[i];
+  if (count == 2 && vbr) total += 1 + (size[0] >= 252);
+  if (count > 2) {
+    total++;
+    if (vbr) for (i=0;i<count-1;i++) total += 1 + (size[i] >= 252);
+  }
+  if (total > max) return -1;
+  if (count == 1) *ptr++ = toc&0xFC;
+  else if (count == 2 && !vbr) *ptr++ = (toc&0xFC) | 0x1;
+  else if (count == 2) {
+    *ptr++ = (toc&0xFC) | 0x2;
+    ptr += encode_size(size[0], ptr);
+  } else {
+    *ptr++ = toc | 0x3;
+    *ptr++ = count | (vbr ? 0x80 : 0);
+    if (vbr) for (i=0;i<count-1;i++) ptr += encode_size(size[i], ptr);
+  }
+  if (self_delimited) ptr += encode_size(size[count-1], ptr);
+  for (i=0;i<count;i++) {
+    memcpy(ptr, frames[i], size[i]);
+    ptr += size[i];
+  }
+  return (int)(ptr - dst);
+}
+
+/* Encodes one frame with the elementary streams spread over stream_threads
+   threads. This skips the per-frame work libopus does in
+   opus_multistream_encode_float(): the surround analysis (so it is only used
+   for families 2 and 255), and the bitrate allocation, which is kept from the
+   last frame encoded normally since it only changes with the settings. */
+static int encode_frame_streams(OggOpusEnc *enc, const float *pcm, int analysis_size, unsigned char *packet, opus_int32 max_packet_size) {
+  StreamThreads *ms;
+  int nb_streams = enc->header.nb_streams;
+  int window_size = MIN(analysis_size, MAX_ANALYSIS_MS*(enc->opus_rate/1000));
+  int tot_size = 0;
+  int s;
+  if (enc->stream_team == NULL && (enc->stream_team = stream_threads_create(enc)) == NULL) return OPUS_ALLOC_FAIL;
+  ms = enc->stream_team;
+  for (s=0;s<nb_streams;s++) {
+    opeint_encoder_ctl(&enc->st, OPUS_MULTISTREAM_GET_ENCODER_STATE(s, &ms->encoders[s]));
+    /* The multistream encoder keeps the frame duration to itself, the streams
+       would otherwise take the whole window for the frame. */
+    opus_encoder_ctl(ms->encoders[s], OPUS_SET_EXPERT_FRAME_DURATION(enc->frame_size_request));
+  }
+  if (ms->window_granule != enc->curr_granule) ms->window_filled = 0;
+  if (window_size > ms->window_alloc/2) {
+    for (s=0;s<nb_streams;s++) {
+      int nb_channels = s < enc->header.nb_coupled ? 2 : 1;
+      float *window = opeint_realloc(&enc->allocator, ms->windows[s], sizeof(*window)*nb_channels*2*window_size);
+      if (window == NULL) return OPUS_ALLOC_FAIL;
+      ms->windows[s] = window;
+    }
+    ms->window_alloc = 2*window_size;
+  }
+  if (ms->window_base + window_size > ms->window_alloc) {
+    for (s=0;s<nb_streams;s++) {
+      int nb_channels = s < enc->header.nb_coupled ? 2 : 1;
+      memmove(ms->windows[s], &ms->windows[s][nb_channels*ms->window_base],
+          sizeof(*ms->windows[s])*nb_channels*ms->window_filled);
+    }
+    ms->window_base = 0;
+  }
+  ms->pcm = pcm;
+  ms->window_size = window_size;
+  team_run(ms->team, nb_streams, stream_encode, ms);
+  /* The next frame starts frame_size samples further. */
+  ms->window_filled = MAX(ms->window_filled, window_size) - enc->frame_size;
+  ms->window_base += enc->frame_size;
+  ms->window_granule = enc->curr_granule + enc->frame_size*(48000/enc->opus_rate);
+  for (s=0;s<nb_streams;s++) {
+    int ret;
+    if (ms->sizes[s] < 0) return ms->sizes[s];
+    ret = append_stream_packet(&packet[tot_size], max_packet_size - tot_size,
+        &ms->outputs[s*STREAM_MAX_PACKET], ms->sizes[s], s != nb_streams-1);
+    if (ret < 0) return OPUS_INTERNAL_ERROR;
+    tot_size += ret;
+  }
+  return tot_size;
+}
+#endif
+
+/* Encodes the frame at pcm, with the elementary streams in parallel when
+   possible. The analysis_size samples at pcm are the frame followed by the
+   lookahead libopus analyses for its decisions. */
+static int encode_frame(OggOpusEnc *enc, const float *pcm, int analysis_size, unsigned char *packet, opus_int32 max_packet_size) {
+  int ret;
+#ifdef HAVE_PTHREAD
+  if (enc->stream_threads > 1 && enc->streams_synced) {
+    return encode_frame_streams(enc, pcm, analysis_size, packet, max_packet_size);
+  }
+  if (enc->stream_team) enc->stream_team->window_granule = -1;
+#endif
+  ret = opeint_encode_float(&enc->st, pcm, analysis_size, packet, max_packet_size);
+#ifdef HAVE_PTHREAD
+  if (ret >= 0 && enc->stream_threads > 1) {
+    opus_int32 vbr = 0;
+    opeint_encoder_ctl(&enc->st, OPUS_GET_VBR(&vbr));
+    /* The elementary streams now have the bitrates libopus gave them. Constant
+       bitrate needs the size of the other streams, so it stays sequential. */
+    enc->streams_synced = vbr && streams_separable(enc);
+  }
+#endif
+  return ret;
+}
+
+/* Encodes the frames that are ready, at most max_frames of them unless it is
+   negative. Returns the number of frames encoded. */
+static int encode_buffer(OggOpusEnc *enc, int max_frames) {
+  opus_int32 max_packet_size;
+  int nb_frames = 0;
+  /* Converts frame_size (at opus_rate) to 48 kHz granule units. */
+  int scale = 48000/enc->opus_rate;
+  opus_int64 end_granule48k = enc->streams->end_granule + enc->global_granule_offset;
+  max_packet_size = (1277*6+2)*enc->header.nb_streams;
+  while (enc->buffer_end-enc->buffer_start > enc->frame_size + enc->decision_delay/scale && nb_frames != max_frames) {
+    int cont;
+    int e_o_s;
+    opus_int32 pred;
+    int nbBytes;
+    int analysis_size;
+    unsigned char *packet;
+    unsigned char *packet_copy = NULL;
+    int is_keyframe=0;
+    if (enc->unrecoverable) return nb_frames;
+    opeint_encoder_ctl(&enc->st, OPUS_GET_PREDICTION_DISABLED(&pred));
+    /* FIXME: a frame that follows a keyframe generally doesn't need to be a keyframe
+       unless there's two consecutive stream boundaries. */
+    if (enc->curr_granule + 2*enc->frame_size*scale >= end_granule48k && enc->streams->next) {
+      opeint_encoder_ctl(&enc->st, OPUS_SET_PREDICTION_DISABLED(1));
+      is_keyframe = 1;
+    }
+    /* Handle the last packet by making sure not to encode too much padding. */
+    if (enc->curr_granule+enc->frame_size*scale >= end_granule48k && enc->draining && enc->frame_size_request > OPUS_FRAMESIZE_20_MS) {
+      int min_samples;
+      int frame_size_request = OPUS_FRAMESIZE_20_MS;
+      /* Minimum frame size required for the current frame to still meet the e_o_s condition. */
+      min_samples = end_granule48k - enc->curr_granule;
+      while (compute_frame_samples(frame_size_request) < min_samples) frame_size_request++;
+      assert(frame_size_request <= enc->frame_size_request);
       ope_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(frame_size_request));
     }
+    /* Passing more than libopus looks at would only need a bigger mirror. */
+    analysis_size = MIN(enc->buffer_end - enc->buffer_start, MAX_ANALYSIS_MS*(enc->opus_rate/1000));
+    mirror_buffer(enc, analysis_size);
     packet = oggp_get_packet_buffer(enc->oggp, max_packet_size);
-    nbBytes = opeint_encode_float(&enc->st, &enc->buffer[enc->channels*enc->buffer_start],
-        enc->buffer_end-enc->buffer_start, packet, max_packet_size);
+    if (packet == NULL) {
+      enc->unrecoverable = packet_buffer_error(enc);
+      return nb_frames;
+    }
+    nbBytes = encode_frame(enc, &enc->buffer[enc->channels*enc->buffer_start], analysis_size,
+        packet, max_packet_size);
     if (nbBytes < 0) {
       /* Anything better we can do here? */
       enc->unrecoverable = OPE_INTERNAL_ERROR;
-      return;
+      return nb_frames;
     }
     opeint_encoder_ctl(&enc->st, OPUS_SET_PREDICTION_DISABLED(pred));
     assert(nbBytes > 0);
-    enc->curr_granule += enc->frame_size;
+    enc->curr_granule += enc->frame_size*scale;
     do {
       int ret;
       opus_int64 granulepos;
@@ -635,16 +1861,20 @@ static void encode_buffer(OggOpusEnc *enc) {
       if (e_o_s) granulepos=end_granule48k-enc->streams->granule_offset;
       if (packet_copy != NULL) {
         packet = oggp_get_packet_buffer(enc->oggp, max_packet_size);
+        if (packet == NULL) {
+          enc->unrecoverable = packet_buffer_error(enc);
+          return nb_frames;
+        }
         memcpy(packet, packet_copy, nbBytes);
       }
       if (enc->packet_callback) enc->packet_callback(enc->packet_callback_data, packet, nbBytes, 0);
       if ((e_o_s || is_keyframe) && packet_copy == NULL) {
-        packet_copy = malloc(nbBytes);
-        if (packet_copy == NULL) {
+        if (!keyframe_slots_alloc(enc, max_packet_size)) {
           /* Can't recover from allocation failing here. */
           enc->unrecoverable = OPE_ALLOC_FAIL;
-          return;
+          return nb_frames;
         }
+        packet_copy = enc->packet_copy;
         memcpy(packet_copy, packet, nbBytes);
       }
       oggp_commit_packet(enc->oggp, nbBytes, granulepos, e_o_s);
@@ -653,8 +1883,7 @@ static void encode_buffer(OggOpusEnc *enc) {
       else ret = 0;
       if (ret) {
         enc->unrecoverable = OPE_WRITE_FAIL;
-        if (packet_copy) free(packet_copy);
-        return;
+        return nb_frames;
       }
       if (e_o_s) {
         EncStream *tmp;
@@ -663,147 +1892,1132 @@ static void encode_buffer(OggOpusEnc *enc) {
           ret = enc->callbacks.close(enc->streams->user_data);
           if (ret) {
             enc->unrecoverable = OPE_CLOSE_FAIL;
-            free(packet_copy);
-            return;
+            return nb_frames;
           }
         }
-        stream_destroy(enc->streams);
+        stream_release(enc, enc->streams);
         enc->streams = tmp;
         if (!tmp) enc->last_stream = NULL;
-        if (enc->last_stream == NULL) {
-          free(packet_copy);
-          return;
-        }
+        if (enc->last_stream == NULL) return nb_frames;
         /* We're done with this stream, start the next one. */
-        enc->header.preskip = end_granule48k + enc->frame_size - enc->curr_granule;
-        enc->streams->granule_offset = enc->curr_granule - enc->frame_size;
-        if (enc->chaining_keyframe) {
-          enc->header.preskip += enc->frame_size;
-          enc->streams->granule_offset -= enc->frame_size;
+        enc->header.preskip = end_granule48k + enc->frame_size*scale - enc->curr_granule;
+        enc->streams->granule_offset = enc->curr_granule - enc->frame_size*scale;
+        if (enc->chaining_keyframe_length >= 0) {
+          enc->header.preskip += enc->frame_size*scale;
+          enc->streams->granule_offset -= enc->frame_size*scale;
         }
         init_stream(enc);
-        if (enc->chaining_keyframe) {
+        if (enc->unrecoverable) return nb_frames;
+        if (enc->chaining_keyframe_length >= 0) {
           unsigned char *p;
-          opus_int64 granulepos2=enc->curr_granule - enc->streams->granule_offset - enc->frame_size;
+          opus_int64 granulepos2=enc->curr_granule - enc->streams->granule_offset - enc->frame_size*scale;
           p = oggp_get_packet_buffer(enc->oggp, enc->chaining_keyframe_length);
+          if (p == NULL) {
+            enc->unrecoverable = packet_buffer_error(enc);
+            return nb_frames;
+          }
           memcpy(p, enc->chaining_keyframe, enc->chaining_keyframe_length);
           if (enc->packet_callback) enc->packet_callback(enc->packet_callback_data, enc->chaining_keyframe, enc->chaining_keyframe_length, 0);
           oggp_commit_packet(enc->oggp, enc->chaining_keyframe_length, granulepos2, 0);
         }
-        end_granule48k = (enc->streams->end_granule*48000 + enc->rate - 1)/enc->rate + enc->global_granule_offset;
+        end_granule48k = enc->streams->end_granule + enc->global_granule_offset;
         cont = 1;
       }
     } while (cont);
-    if (enc->chaining_keyframe) free(enc->chaining_keyframe);
     if (is_keyframe) {
-      enc->chaining_keyframe_length = nbBytes;
+      enc->packet_copy = enc->chaining_keyframe;
       enc->chaining_keyframe = packet_copy;
-      packet_copy = NULL;
+      enc->chaining_keyframe_length = nbBytes;
     } else {
-      enc->chaining_keyframe = NULL;
       enc->chaining_keyframe_length = -1;
     }
-    if (packet_copy) free(packet_copy);
+    nb_frames++;
     enc->buffer_start += enc->frame_size;
-  }
-  /* If we've reached the end of the buffer, move everything back to the front. */
-  if (enc->buffer_end == BUFFER_SAMPLES) {
-    shift_buffer(enc);
+    if (enc->buffer_start >= enc->buffer_samples) {
+      enc->buffer_start -= enc->buffer_samples;
+      enc->buffer_end -= enc->buffer_samples;
+    }
   }
   /* This function must never leave the buffer full. */
-  assert(enc->buffer_end < BUFFER_SAMPLES);
+  assert(max_frames >= 0 || enc->buffer_end - enc->buffer_start < enc->buffer_samples - LPC_INPUT);
+  return nb_frames;
 }
 
-/* Add/encode any number of float samples to the file. */
-int ope_encoder_write_float(OggOpusEnc *enc, const float *pcm, int samples_per_channel) {
-  int channels = enc->channels;
-  if (enc->unrecoverable) return enc->unrecoverable;
-  enc->last_stream->header_is_frozen = 1;
-  if (!enc->streams->stream_is_init) init_stream(enc);
-  if (samples_per_channel < 0) return OPE_BAD_ARG;
-  enc->write_granule += samples_per_channel;
-  enc->last_stream->end_granule = enc->write_granule;
-  if (enc->lpc_buffer) {
-    int i;
-    if (samples_per_channel < LPC_INPUT) {
-      for (i=0;i<(LPC_INPUT-samples_per_channel)*channels;i++) enc->lpc_buffer[i] = enc->lpc_buffer[samples_per_channel*channels + i];
-      for (i=0;i<samples_per_channel*channels;i++) enc->lpc_buffer[(LPC_INPUT-samples_per_channel)*channels + i] = pcm[i];
-    } else {
-      for (i=0;i<LPC_INPUT*channels;i++) enc->lpc_buffer[i] = pcm[(samples_per_channel-LPC_INPUT)*channels + i];
+#ifdef HAVE_PTHREAD
+/* A run of frames encoded by its own copy of the encoder, starting with a
+   keyframe that follows warm-up frames whose packets are thrown away. The
+   first frame follows the mode (SILK, hybrid or CELT) the warm-up ended in,
+   which can differ from the last frame of the previous segment. Across a
+   switch between SILK and CELT, the redundant frame libopus adds when it
+   switches itself is then missing, and decoders do the crossfade they do for
+   a switch without redundancy instead. */
+typedef struct {
+  OggOpusEnc *enc;
+  OpusGenericEncoder st;
+  /* First frame, counting from buffer_start. */
+  int first;
+  int nb_frames;
+  int warmup;
+  unsigned char *data;
+  opus_int32 data_size;
+  opus_int32 data_alloc;
+  int *sizes;
+  int error;
+  int started;
+  pthread_t thread;
+} Segment;
+
+static void *encode_segment(void *arg) {
+  Segment *seg = (Segment *)arg;
+  OggOpusEnc *enc = seg->enc;
+  opus_int32 max_packet_size = (1277*6+2)*enc->header.nb_streams;
+  unsigned char *packet;
+  opus_int32 pred;
+  int i;
+  /* Like encode_buffer(), libopus gets everything up to buffer_end for its
+     analysis, not just the frame. */
+  if ( (packet = opeint_malloc(&enc->allocator, max_packet_size)) == NULL) {
+    seg->error = OPE_ALLOC_FAIL;
+    return NULL;
+  }
+  opeint_encoder_ctl(&seg->st, OPUS_GET_PREDICTION_DISABLED(&pred));
+  for (i=-seg->warmup;i<seg->nb_frames;i++) {
+    int start = enc->buffer_start + (seg->first + i)*enc->frame_size;
+    int nbBytes;
+    if (i == 0 && seg->warmup) opeint_encoder_ctl(&seg->st, OPUS_SET_PREDICTION_DISABLED(1));
+    nbBytes = opeint_encode_float(&seg->st, &enc->buffer[enc->channels*start], enc->buffer_end - start,
+        packet, max_packet_size);
+    if (i == 0 && seg->warmup) opeint_encoder_ctl(&seg->st, OPUS_SET_PREDICTION_DISABLED(pred));
+    if (nbBytes < 0) {
+      seg->error = OPE_INTERNAL_ERROR;
+      break;
+    }
+    if (i < 0) continue;
+    if (seg->data_size + nbBytes > seg->data_alloc) {
+      opus_int32 alloc = MAX(2*seg->data_alloc, seg->data_size + nbBytes);
+      unsigned char *data = opeint_realloc(&enc->allocator, seg->data, alloc);
+      if (data == NULL) {
+        seg->error = OPE_ALLOC_FAIL;
+        break;
+      }
+      seg->data = data;
+      seg->data_alloc = alloc;
+    }
+    memcpy(&seg->data[seg->data_size], packet, nbBytes);
+    seg->data_size += nbBytes;
+    seg->sizes[i] = nbBytes;
+  }
+  opeint_free(&enc->allocator, packet);
+  return NULL;
+}
+
+/* Splits the frames that are ready into segments and encodes them on
+   encode_threads threads, the first one with the encoder itself. Only frames
+   well before the end of the stream are taken, the last ones need the special
+   cases of encode_buffer(). Unless flush is set, waits for a full batch of
+   SEGMENT_MS segments, or of what the backlog limit allows (in segments no
+   shorter than 4 warm-ups). */
+static void encode_parallel(OggOpusEnc *enc, int flush) {
+  int scale = 48000/enc->opus_rate;
+  opus_int64 end_granule48k = enc->streams->end_granule + enc->global_granule_offset;
+  int segment_frames = MAX(1, SEGMENT_MS*(enc->opus_rate/1000)/enc->frame_size);
+  int warmup = (WARMUP_MS*(enc->opus_rate/1000) + enc->frame_size - 1)/enc->frame_size;
+  opus_int64 ready;
+  int nb_frames;
+  int nb_segments;
+  Segment *segs;
+  int s;
+  int i;
+  if (enc->unrecoverable || !enc->streams->stream_is_init) return;
+  ready = (enc->buffer_end - enc->buffer_start - enc->decision_delay/scale - 1)/enc->frame_size;
+  /* Stay clear of the keyframe and frame size changes near the end. */
+  ready = MIN(ready, (end_granule48k - enc->curr_granule)/(enc->frame_size*scale) - 3);
+  if (flush) {
+    nb_segments = (int)MIN(enc->encode_threads, ready/(4*warmup));
+    if (nb_segments < 2) return;
+    nb_frames = (int)ready;
+  } else {
+    nb_frames = (int)MIN((opus_int64)enc->encode_threads*segment_frames, enc->max_backlog/scale/enc->frame_size);
+    if (ready < nb_frames) return;
+    nb_segments = MIN(enc->encode_threads, nb_frames/(4*warmup));
+    if (nb_segments < 2) return;
+  }
+  /* Segments read straight from the buffer, so it must not wrap. */
+  unwrap_buffer(enc);
+  if ( (segs = opeint_malloc(&enc->allocator, sizeof(*segs)*nb_segments)) == NULL) {
+    enc->unrecoverable = OPE_ALLOC_FAIL;
+    return;
+  }
+  memset(segs, 0, sizeof(*segs)*nb_segments);
+  for (s=0;s<nb_segments;s++) {
+    segs[s].enc = enc;
+    segs[s].first = (int)((opus_int64)nb_frames*s/nb_segments);
+    segs[s].nb_frames = (int)((opus_int64)nb_frames*(s+1)/nb_segments) - segs[s].first;
+    segs[s].warmup = s ? warmup : 0;
+    if ( (segs[s].sizes = opeint_malloc(&enc->allocator, sizeof(*segs[s].sizes)*segs[s].nb_frames)) == NULL) segs[s].error = OPE_ALLOC_FAIL;
+    if (s == 0) segs[s].st = enc->st;
+    else if (segs[s].error == OPE_OK) {
+      segs[s].error = opeint_encoder_copy(&segs[s].st, &enc->st, &enc->allocator);
+      if (segs[s].error == OPE_OK) opeint_encoder_ctl(&segs[s].st, OPUS_RESET_STATE);
+    }
+  }
+  for (s=1;s<nb_segments;s++) {
+    if (segs[s].error != OPE_OK) continue;
+    if (pthread_create(&segs[s].thread, NULL, encode_segment, &segs[s]) == 0) segs[s].started = 1;
+    else segs[s].error = OPE_INTERNAL_ERROR;
+  }
+  if (segs[0].error == OPE_OK) encode_segment(&segs[0]);
+  for (s=1;s<nb_segments;s++) {
+    if (segs[s].started) pthread_join(segs[s].thread, NULL);
+  }
+  for (s=0;s<nb_segments && !enc->unrecoverable;s++) {
+    if (segs[s].error != OPE_OK) enc->unrecoverable = segs[s].error;
+  }
+  if (!enc->unrecoverable) {
+    /* Carry on from where the last segment left off. */
+    if (opeint_encoder_copy(&enc->st, &segs[nb_segments-1].st, &enc->allocator) != OPE_OK) {
+      enc->unrecoverable = OPE_ALLOC_FAIL;
+    }
+    enc->chaining_keyframe_length = -1;
+    for (s=0;s<nb_segments && !enc->unrecoverable;s++) {
+      opus_int32 offset = 0;
+      for (i=0;i<segs[s].nb_frames;i++) {
+        unsigned char *packet;
+        int nbBytes = segs[s].sizes[i];
+        packet = oggp_get_packet_buffer(enc->oggp, nbBytes);
+        if (packet == NULL) {
+          enc->unrecoverable = packet_buffer_error(enc);
+          break;
+        }
+        enc->curr_granule += enc->frame_size*scale;
+        memcpy(packet, &segs[s].data[offset], nbBytes);
+        offset += nbBytes;
+        if (enc->packet_callback) enc->packet_callback(enc->packet_callback_data, packet, nbBytes, 0);
+        oggp_commit_packet(enc->oggp, nbBytes, enc->curr_granule - enc->streams->granule_offset, 0);
+        if (!enc->pull_api && output_pages(enc)) {
+          enc->unrecoverable = OPE_WRITE_FAIL;
+          break;
+        }
+        enc->buffer_start += enc->frame_size;
+      }
     }
   }
+  for (s=0;s<nb_segments;s++) {
+    if (s) opeint_encoder_cleanup(&segs[s].st, &enc->allocator);
+    opeint_free(&enc->allocator, segs[s].sizes);
+    opeint_free(&enc->allocator, segs[s].data);
+  }
+  opeint_free(&enc->allocator, segs);
+}
+#endif
+
+/* Encodes what the last write made ready, depending on the mode. */
+static void encode_written(OggOpusEnc *enc) {
+  if (enc->deferred) return;
+#ifdef HAVE_PTHREAD
+  if (enc->encode_threads > 1) {
+    encode_parallel(enc, 0);
+    /* When the batch cannot be encoded in parallel (too close to the end of
+       the stream, or too small a backlog limit), the buffer must not fill. */
+    if (enc->buffer_end - enc->buffer_start < backlog_samples(enc)) return;
+  }
+#endif
+  encode_buffer(enc, -1);
+}
+
+#define CONVERT_BUFFER 4096
+
+/* Largest clock correction, in parts per billion (1%). */
+#define MAX_RATE_CORRECTION 10000000
+/* Time constants of the drift controller, in seconds. */
+#define DRIFT_P_TIME 20.
+#define DRIFT_I_TIME 160.
+/* Resolution of the corrections applied by the drift controller, in parts per
+   billion. Each new ratio costs the resampler a new filter table. */
+#define DRIFT_STEP 10000
+
+/* Converts n samples from src to float, storing them every dst_stride floats. */
+typedef void (*ope_convert_func)(float *dst, int dst_stride, const void *src, int n);
+
+typedef struct {
+  int bytes;
+  ope_convert_func convert;
+} SampleFormat;
+
+/* Stores value (an expression of i) for the n samples. Interleaved input has
+   dst_stride 1, which is done in blocks of CONVERT_BLOCK: a loop with a known
+   count is what GCC vectorizes at -O2 without having to check for aliasing. */
+#define CONVERT_BLOCK 8
+#define CONVERT_LOOP(value) do { \
+  if (dst_stride == 1) { \
+    int block; \
+    int j; \
+    for (block=0;block+CONVERT_BLOCK<=n;block+=CONVERT_BLOCK) { \
+      for (j=0;j<CONVERT_BLOCK;j++) { \
+        i = block + j; \
+        dst[i] = (value); \
+      } \
+    } \
+    for (i=block;i<n;i++) dst[i] = (value); \
+  } else { \
+    for (i=0;i<n;i++) dst[i*dst_stride] = (value); \
+  } \
+} while (0)
+
+static void convert_float(float *dst, int dst_stride, const void *src, int n) {
+  const float *x = (const float *)src;
+  int i;
+  if (dst_stride == 1) {
+    memcpy(dst, x, n*sizeof(*dst));
+    return;
+  }
+  for (i=0;i<n;i++) dst[i*dst_stride] = x[i];
+}
+
+static void convert_s16(float *dst, int dst_stride, const void *src, int n) {
+  const opus_int16 *x = (const opus_int16 *)src;
+  int i;
+  CONVERT_LOOP((1.f/32768)*x[i]);
+}
+
+static void convert_s32(float *dst, int dst_stride, const void *src, int n) {
+  const opus_int32 *x = (const opus_int32 *)src;
+  int i;
+  CONVERT_LOOP((1.f/2147483648.f)*x[i]);
+}
+
+static void convert_f64(float *dst, int dst_stride, const void *src, int n) {
+  const double *x = (const double *)src;
+  int i;
+  CONVERT_LOOP((float)x[i]);
+}
+
+/* The byte-order specific formats are read one byte at a time so that the input
+   needs no particular alignment. Integers are assembled MSB-aligned in 32 bits
+   so that a single scale factor works for all widths. */
+#define READ_S16LE(p) ((opus_int32)((opus_uint32)(p)[0]<<16 | (opus_uint32)(p)[1]<<24))
+#define READ_S16BE(p) ((opus_int32)((opus_uint32)(p)[1]<<16 | (opus_uint32)(p)[0]<<24))
+#define READ_S24LE(p) ((opus_int32)((opus_uint32)(p)[0]<<8 | (opus_uint32)(p)[1]<<16 | (opus_uint32)(p)[2]<<24))
+#define READ_S24BE(p) ((opus_int32)((opus_uint32)(p)[2]<<8 | (opus_uint32)(p)[1]<<16 | (opus_uint32)(p)[0]<<24))
+#define READ_U32LE(p) ((opus_uint32)(p)[0] | (opus_uint32)(p)[1]<<8 | (opus_uint32)(p)[2]<<16 | (opus_uint32)(p)[3]<<24)
+#define READ_U32BE(p) ((opus_uint32)(p)[3] | (opus_uint32)(p)[2]<<8 | (opus_uint32)(p)[1]<<16 | (opus_uint32)(p)[0]<<24)
+
+#define DEFINE_INT_CONVERT(name, bytes, read) \
+static void name(float *dst, int dst_stride, const void *src, int n) { \
+  const unsigned char *x = (const unsigned char *)src; \
+  int i; \
+  CONVERT_LOOP((1.f/2147483648.f)*read(&x[i*(bytes)])); \
+}
+
+DEFINE_INT_CONVERT(convert_s16le, 2, READ_S16LE)
+DEFINE_INT_CONVERT(convert_s16be, 2, READ_S16BE)
+DEFINE_INT_CONVERT(convert_s24le, 3, READ_S24LE)
+DEFINE_INT_CONVERT(convert_s24be, 3, READ_S24BE)
+DEFINE_INT_CONVERT(convert_s32le, 4, (opus_int32)READ_U32LE)
+DEFINE_INT_CONVERT(convert_s32be, 4, (opus_int32)READ_U32BE)
+
+/* Assumes the host stores floats with the same byte order as integers. */
+static float float_from_bits(opus_uint32 u) {
+  float f;
+  memcpy(&f, &u, 4);
+  return f;
+}
+
+static float double_from_bits(unsigned long long u) {
+  double d;
+  memcpy(&d, &u, 8);
+  return (float)d;
+}
+
+#define READ_F32LE(p) float_from_bits(READ_U32LE(p))
+#define READ_F32BE(p) float_from_bits(READ_U32BE(p))
+#define READ_F64LE(p) double_from_bits((unsigned long long)READ_U32LE(&(p)[4])<<32 | READ_U32LE(p))
+#define READ_F64BE(p) double_from_bits((unsigned long long)READ_U32BE(p)<<32 | READ_U32BE(&(p)[4]))
+
+#define DEFINE_FLOAT_CONVERT(name, bytes, read) \
+static void name(float *dst, int dst_stride, const void *src, int n) { \
+  const unsigned char *x = (const unsigned char *)src; \
+  int i; \
+  CONVERT_LOOP(read(&x[i*(bytes)])); \
+}
+
+DEFINE_FLOAT_CONVERT(convert_f32le, 4, READ_F32LE)
+DEFINE_FLOAT_CONVERT(convert_f32be, 4, READ_F32BE)
+DEFINE_FLOAT_CONVERT(convert_f64le, 8, READ_F64LE)
+DEFINE_FLOAT_CONVERT(convert_f64be, 8, READ_F64BE)
+
+/* Indexed by OPE_FORMAT_*. */
+static const SampleFormat sample_formats[] = {
+  {2, convert_s16},
+  {4, convert_s32},
+  {4, convert_float},
+  {8, convert_f64},
+  {2, convert_s16le},
+  {2, convert_s16be},
+  {3, convert_s24le},
+  {3, convert_s24be},
+  {4, convert_s32le},
+  {4, convert_s32be},
+  {4, convert_f32le},
+  {4, convert_f32be},
+  {8, convert_f64le},
+  {8, convert_f64be}
+};
+
+#ifdef HAVE_PTHREAD
+/* A write resampled by groups of consecutive channels, one group per job. */
+typedef struct {
+  OggOpusEnc *enc;
+  /* Interleaved float input, or NULL to take one channel from each pointer in pcm. */
+  const float *in;
+  const void *const *pcm;
+  const SampleFormat *fmt;
+  int offset;
+  int group;
+  spx_uint32_t in_len;
+  spx_uint32_t out_len;
+  float *dst;
+  /* Samples consumed and produced, which are the same for every group. */
+  spx_uint32_t in_done;
+  spx_uint32_t out_done;
+} ResampleJob;
+
+static void resample_group(void *arg, int job, int worker) {
+  ResampleJob *rs = (ResampleJob *)arg;
+  OggOpusEnc *enc = rs->enc;
+  int first = job*rs->group;
+  int nb = MIN(rs->group, enc->channels - first);
+  spx_uint32_t in_len = rs->in_len;
+  spx_uint32_t out_len = rs->out_len;
+  (void)worker;
+  if (rs->in != NULL) {
+    speex_resampler_process_channels_float(enc->re, first, nb, rs->in + first, &in_len, rs->dst + first, &out_len);
+  } else {
+    int c;
+    for (c=first;c<first+nb;c++) {
+      const unsigned char *src = (const unsigned char *)rs->pcm[c] + rs->offset*rs->fmt->bytes;
+      const float *in;
+      float buf[CONVERT_BUFFER];
+      in_len = rs->in_len;
+      out_len = rs->out_len;
+      if (rs->fmt->convert == convert_float) {
+        in = (const float *)src;
+      } else {
+        rs->fmt->convert(buf, 1, src, in_len);
+        in = buf;
+      }
+      speex_resampler_process_channels_float(enc->re, c, 1, in, &in_len, &rs->dst[c], &out_len);
+    }
+  }
+  if (first + nb == enc->channels) {
+    rs->in_done = in_len;
+    rs->out_done = out_len;
+  }
+}
+
+/* Same as the resampling in encoder_write_sync(), with the channels split
+   over resampler_threads threads. Returns 0 if it could not be done, in which
+   case nothing was consumed. */
+static int resample_parallel(OggOpusEnc *enc, const void *const *pcm, int planar, const SampleFormat *fmt, int offset,
+    spx_uint32_t *in_len, float *dst, spx_uint32_t *out_len) {
+  ResampleJob rs;
+  float buf[CONVERT_BUFFER];
+  int channels = enc->channels;
+  int nb_threads = MIN(enc->resampler_threads, channels);
+  if (nb_threads < 2) return 0;
+  if (enc->resampler_team == NULL && (enc->resampler_team = team_create(nb_threads, &enc->allocator)) == NULL) return 0;
+  rs.enc = enc;
+  rs.pcm = pcm;
+  rs.fmt = fmt;
+  rs.offset = offset;
+  rs.group = (channels + nb_threads - 1)/nb_threads;
+  rs.in_len = *in_len;
+  rs.out_len = *out_len;
+  rs.dst = dst;
+  rs.in_done = rs.out_done = 0;
+  if (planar) {
+    rs.in = NULL;
+  } else if (fmt->convert == convert_float) {
+    rs.in = (const float *)pcm[0] + offset*channels;
+  } else {
+    fmt->convert(buf, 1, (const unsigned char *)pcm[0] + offset*channels*fmt->bytes, *in_len*channels);
+    rs.in = buf;
+  }
+  speex_resampler_set_input_stride(enc->re, planar ? 1 : channels);
+  speex_resampler_set_output_stride(enc->re, channels);
+  team_run(enc->resampler_team, (channels + rs.group - 1)/rs.group, resample_group, &rs);
+  speex_resampler_set_input_stride(enc->re, 1);
+  speex_resampler_set_output_stride(enc->re, 1);
+  *in_len = rs.in_done;
+  *out_len = rs.out_done;
+  return 1;
+}
+#endif
+
+/* Resamples (or converts) the samples into the buffer and encodes what that
+   makes ready. */
+static int buffer_input(OggOpusEnc *enc, const void *const *pcm, int planar, const SampleFormat *fmt, int samples_per_channel) {
+  int channels = enc->channels;
+  int nb_ptrs = planar ? channels : 1;
+  int ptr_channels = planar ? 1 : channels;
+  int offset = 0;
+  int p;
   do {
-    int i;
     spx_uint32_t in_samples, out_samples;
-    out_samples = BUFFER_SAMPLES-enc->buffer_end;
+    float *dst;
+    out_samples = buffer_write_space(enc, &dst);
     if (enc->re != NULL) {
-      in_samples = samples_per_channel;
-      speex_resampler_process_interleaved_float(enc->re, pcm, &in_samples, &enc->buffer[channels*enc->buffer_end], &out_samples);
+      spx_uint32_t max_in, max_out;
+      int resampled;
+      /* Float input goes straight to the resampler, anything else is converted
+         in chunks on the stack. */
+      max_in = fmt->convert == convert_float ? (spx_uint32_t)samples_per_channel : MIN(CONVERT_BUFFER/ptr_channels, samples_per_channel);
+      max_out = out_samples;
+      resampled = 0;
+#ifdef HAVE_PTHREAD
+      if (enc->resampler_threads > 1) {
+        in_samples = max_in;
+        out_samples = max_out;
+        resampled = resample_parallel(enc, pcm, planar, fmt, offset, &in_samples, dst, &out_samples);
+      }
+#endif
+      if (!resampled) {
+        /* For planar input, the resampler interleaves its output directly into the buffer. */
+        if (planar) speex_resampler_set_output_stride(enc->re, channels);
+        for (p=0;p<nb_ptrs;p++) {
+          const unsigned char *src = (const unsigned char *)pcm[p] + offset*ptr_channels*fmt->bytes;
+          const float *in;
+          float buf[CONVERT_BUFFER];
+          in_samples = max_in;
+          out_samples = max_out;
+          if (fmt->convert == convert_float) {
+            in = (const float *)src;
+          } else {
+            fmt->convert(buf, 1, src, in_samples*ptr_channels);
+            in = buf;
+          }
+          if (planar) speex_resampler_process_float(enc->re, p, in, &in_samples, &dst[p], &out_samples);
+          else speex_resampler_process_interleaved_float(enc->re, in, &in_samples, dst, &out_samples);
+        }
+        if (planar) speex_resampler_set_output_stride(enc->re, 1);
+      }
     } else {
       int curr;
       curr = MIN((spx_uint32_t)samples_per_channel, out_samples);
-      for (i=0;i<channels*curr;i++) {
-      enc->buffer[channels*enc->buffer_end+i] = pcm[i];
+      for (p=0;p<nb_ptrs;p++) {
+        const unsigned char *src = (const unsigned char *)pcm[p] + offset*ptr_channels*fmt->bytes;
+        fmt->convert(&dst[p], nb_ptrs, src, curr*ptr_channels);
       }
       in_samples = out_samples = curr;
     }
     enc->buffer_end += out_samples;
-    pcm += in_samples*channels;
+    offset += in_samples;
     samples_per_channel -= in_samples;
-    encode_buffer(enc);
+    encode_written(enc);
     if (enc->unrecoverable) return enc->unrecoverable;
   } while (samples_per_channel > 0);
   return OPE_OK;
 }
 
-#define CONVERT_BUFFER 4096
+/* Resamples the small writes gathered so far. Until then, the end of the last
+   stream doesn't include them (nothing past it can get encoded). */
+static int write_pending(OggOpusEnc *enc) {
+  const void *ptr;
+  int n = enc->pending_samples;
+  if (n == 0) return OPE_OK;
+  ptr = &enc->lpc_buffer[(LPC_INPUT+LPC_PADDING)*enc->channels];
+  enc->pending_samples = 0;
+  enc->last_stream->end_granule = write_granule48k(enc);
+  return buffer_input(enc, &ptr, 0, &sample_formats[OPE_FORMAT_FLOAT], n);
+}
 
-/* Add/encode any number of int16 samples to the file. */
-int ope_encoder_write(OggOpusEnc *enc, const opus_int16 *pcm, int samples_per_channel) {
+/* Add/encode any number of samples to the file. With planar set, pcm holds one
+   pointer per channel, otherwise a single pointer to interleaved samples. */
+static int encoder_write_sync(OggOpusEnc *enc, const void *const *pcm, int planar, int format, int samples_per_channel) {
+  const SampleFormat *fmt;
   int channels = enc->channels;
+  /* Number of input pointers and number of channels behind each of them. */
+  int nb_ptrs = planar ? channels : 1;
+  int ptr_channels = planar ? 1 : channels;
+  int ret;
+  int p;
   if (enc->unrecoverable) return enc->unrecoverable;
+  if (format < 0 || format >= (int)(sizeof(sample_formats)/sizeof(sample_formats[0]))) return OPE_BAD_ARG;
+  fmt = &sample_formats[format];
   enc->last_stream->header_is_frozen = 1;
   if (!enc->streams->stream_is_init) init_stream(enc);
   if (samples_per_channel < 0) return OPE_BAD_ARG;
+  if (enc->deferred) {
+    /* Nothing gets encoded until ope_encoder_step(), so the write must fit
+       within the backlog limit, or not be taken at all. */
+    opus_int64 need = samples_per_channel;
+    if (enc->re) need = need*enc->opus_rate*enc->rate_den/enc->rate_num + 2;
+    if (need > backlog_samples(enc) - (enc->buffer_end - enc->buffer_start)) return OPE_BUFFER_FULL;
+  }
   enc->write_granule += samples_per_channel;
-  enc->last_stream->end_granule = enc->write_granule;
   if (enc->lpc_buffer) {
-    int i;
-    if (samples_per_channel < LPC_INPUT) {
-      for (i=0;i<(LPC_INPUT-samples_per_channel)*channels;i++) enc->lpc_buffer[i] = enc->lpc_buffer[samples_per_channel*channels + i];
-      for (i=0;i<samples_per_channel*channels;i++) enc->lpc_buffer[(LPC_INPUT-samples_per_channel)*channels + i] = (1.f/32768)*pcm[i];
+    /* Only the last LPC_INPUT samples go into the history, overwriting the oldest. */
+    int skip = MAX(samples_per_channel - LPC_INPUT, 0);
+    while (skip < samples_per_channel) {
+      int n = MIN(samples_per_channel - skip, LPC_INPUT - enc->lpc_pos);
+      for (p=0;p<nb_ptrs;p++) {
+        const unsigned char *src = (const unsigned char *)pcm[p] + skip*ptr_channels*fmt->bytes;
+        fmt->convert(&enc->lpc_buffer[enc->lpc_pos*channels + p], nb_ptrs, src, n*ptr_channels);
+      }
+      skip += n;
+      enc->lpc_pos += n;
+      if (enc->lpc_pos == LPC_INPUT) enc->lpc_pos = 0;
+    }
+  }
+  if (enc->re != NULL && !enc->deferred && samples_per_channel < WRITE_COALESCE) {
+    /* Resampling has a cost per call, so small writes are gathered first. */
+    float *dst;
+    if (enc->pending_samples + samples_per_channel > WRITE_COALESCE) {
+      ret = write_pending(enc);
+      if (ret != OPE_OK) return ret;
+    }
+    dst = &enc->lpc_buffer[(LPC_INPUT+LPC_PADDING+enc->pending_samples)*channels];
+    for (p=0;p<nb_ptrs;p++) fmt->convert(&dst[p], nb_ptrs, pcm[p], samples_per_channel*ptr_channels);
+    enc->pending_samples += samples_per_channel;
+    if (enc->pending_samples < WRITE_COALESCE) return OPE_OK;
+    return write_pending(enc);
+  }
+  ret = write_pending(enc);
+  if (ret != OPE_OK) return ret;
+  enc->last_stream->end_granule = write_granule48k(enc);
+  return buffer_input(enc, pcm, planar, fmt, samples_per_channel);
+}
+
+#ifdef OPE_ASYNC
+/* Encodes the first contiguous chunk of the ring, up to write_pos. Returns the
+   number of samples consumed, or an error (also left in as->error). */
+static int async_process(OggOpusEnc *enc, opus_uint32 write_pos) {
+  AsyncState *as = enc->async;
+  opus_uint32 read_pos = as->read_pos;
+  opus_uint32 offset = read_pos&(as->size - 1);
+  int n = (int)MIN(write_pos - read_pos, as->size - offset);
+  const void *ptr;
+  int ret;
+  ptr = &as->ring[offset*enc->channels];
+  ret = encoder_write_sync(enc, &ptr, 0, OPE_FORMAT_FLOAT, n);
+  __atomic_store_n(&as->read_pos, read_pos + n, __ATOMIC_RELEASE);
+  if (ret != OPE_OK) {
+    __atomic_store_n(&as->error, ret, __ATOMIC_RELEASE);
+    return ret;
+  }
+  return n;
+}
+
+/* Deadline for the condition waits, ASYNC_WAIT_MS from now. */
+static void async_deadline(struct timespec *ts) {
+  clock_gettime(CLOCK_REALTIME, ts);
+  ts->tv_nsec += ASYNC_WAIT_MS*1000000L;
+  if (ts->tv_nsec >= 1000000000L) {
+    ts->tv_sec++;
+    ts->tv_nsec -= 1000000000L;
+  }
+}
+
+static opus_int64 async_now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (opus_int64)ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+/* Called by the encoding side when it runs out of samples to encode. */
+static void async_idle(AsyncState *as, opus_uint32 write_pos) {
+  as->idle_time = async_now_us();
+  as->idle_pos = write_pos;
+}
+
+/* Called by the encoding side when it gets samples again. An empty ring is
+   normal when the writes keep up, so this only counts an underrun when the
+   samples written since async_idle() are more than ASYNC_WAIT_MS short of the
+   time that passed, once per gap however long it lasts. */
+static void async_resume(OggOpusEnc *enc, opus_uint32 write_pos) {
+  AsyncState *as = enc->async;
+  opus_int64 elapsed;
+  opus_int64 written;
+  if (as->idle_time < 0) return;
+  elapsed = async_now_us() - as->idle_time;
+  written = (opus_int64)(write_pos - as->idle_pos)*1000000/enc->rate;
+  if (elapsed - written > ASYNC_WAIT_MS*1000) {
+    __atomic_store_n(&as->underruns, as->underruns + 1, __ATOMIC_RELAXED);
+  }
+  as->idle_time = -1;
+}
+
+static void *async_worker(void *arg) {
+  OggOpusEnc *enc = (OggOpusEnc *)arg;
+  AsyncState *as = enc->async;
+  for (;;) {
+    opus_uint32 read_pos = as->read_pos;
+    opus_uint32 write_pos = __atomic_load_n(&as->write_pos, __ATOMIC_ACQUIRE);
+    int stop = __atomic_load_n(&as->stop, __ATOMIC_ACQUIRE);
+    if (stop == 2) break;
+    if (write_pos != read_pos) {
+      async_resume(enc, write_pos);
+      if (async_process(enc, write_pos) < 0) break;
+    } else if (stop) {
+      break;
     } else {
-      for (i=0;i<LPC_INPUT*channels;i++) enc->lpc_buffer[i] = (1.f/32768)*pcm[(samples_per_channel-LPC_INPUT)*channels + i];
+      struct timespec ts;
+      int ret = 0;
+      if (as->idle_time < 0) async_idle(as, write_pos);
+      async_deadline(&ts);
+      pthread_mutex_lock(&as->mutex);
+      while (__atomic_load_n(&as->write_pos, __ATOMIC_ACQUIRE) == read_pos
+          && !__atomic_load_n(&as->stop, __ATOMIC_ACQUIRE) && ret != ETIMEDOUT) {
+        ret = pthread_cond_timedwait(&as->cond, &as->mutex, &ts);
+      }
+      pthread_mutex_unlock(&as->mutex);
     }
   }
+  return NULL;
+}
+
+static void async_wake(AsyncState *as) {
+  /* Never blocks: if the worker holds the mutex, it is about to look at the
+     ring anyway, and otherwise wakes up after ASYNC_WAIT_MS at worst. */
+  if (pthread_mutex_trylock(&as->mutex) == 0) {
+    pthread_cond_signal(&as->cond);
+    pthread_mutex_unlock(&as->mutex);
+  }
+}
+
+/* Queues an encoder. The caller must have set as->scheduled, which keeps it
+   from being queued twice. Lock-free: the encoder goes on pool->incoming and
+   the wake-up is skipped when a thread holds the mutex, like in async_wake(). */
+static void pool_push(OggOpusEnc *enc) {
+  OggOpusEncPool *pool = enc->async->pool;
+  OggOpusEnc *head = __atomic_load_n(&pool->incoming, __ATOMIC_RELAXED);
   do {
-    int i;
-    spx_uint32_t in_samples, out_samples;
-    out_samples = BUFFER_SAMPLES-enc->buffer_end;
-    if (enc->re != NULL) {
-      float buf[CONVERT_BUFFER];
-      in_samples = MIN(CONVERT_BUFFER/channels, samples_per_channel);
-      for (i=0;i<channels*(int)in_samples;i++) {
-        buf[i] = (1.f/32768)*pcm[i];
-      }
-      speex_resampler_process_interleaved_float(enc->re, buf, &in_samples, &enc->buffer[channels*enc->buffer_end], &out_samples);
-    } else {
-      int curr;
-      curr = MIN((spx_uint32_t)samples_per_channel, out_samples);
-      for (i=0;i<channels*curr;i++) {
-        enc->buffer[channels*enc->buffer_end+i] = (1.f/32768)*pcm[i];
+    enc->async->next = head;
+  } while (!__atomic_compare_exchange_n(&pool->incoming, &head, enc, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+  __atomic_add_fetch(&pool->pending, 1, __ATOMIC_SEQ_CST);
+  if (pthread_mutex_trylock(&pool->mutex) == 0) {
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+  }
+}
+
+/* Moves the encoders on pool->incoming to their home queues, oldest first. */
+static void pool_take_incoming(OggOpusEncPool *pool) {
+  OggOpusEnc *enc;
+  OggOpusEnc *list = NULL;
+  if (__atomic_load_n(&pool->incoming, __ATOMIC_RELAXED) == NULL) return;
+  enc = __atomic_exchange_n(&pool->incoming, NULL, __ATOMIC_ACQUIRE);
+  while (enc) {
+    OggOpusEnc *next = enc->async->next;
+    enc->async->next = list;
+    list = enc;
+    enc = next;
+  }
+  while (list) {
+    OggOpusEnc *next = list->async->next;
+    PoolQueue *q = &pool->queues[list->async->queue];
+    list->async->next = NULL;
+    pthread_mutex_lock(&q->mutex);
+    if (q->tail) q->tail->async->next = list;
+    else q->head = list;
+    q->tail = list;
+    pthread_mutex_unlock(&q->mutex);
+    list = next;
+  }
+}
+
+/* Takes an encoder from the thread's own queue, or steals one from another. */
+static OggOpusEnc *pool_pop(OggOpusEncPool *pool, int index) {
+  int i;
+  pool_take_incoming(pool);
+  for (i=0;i<pool->nb_threads && __atomic_load_n(&pool->pending, __ATOMIC_SEQ_CST) > 0;i++) {
+    PoolQueue *q = &pool->queues[(index + i)%pool->nb_threads];
+    OggOpusEnc *enc;
+    pthread_mutex_lock(&q->mutex);
+    enc = q->head;
+    if (enc) {
+      q->head = enc->async->next;
+      if (q->head == NULL) q->tail = NULL;
+    }
+    pthread_mutex_unlock(&q->mutex);
+    if (enc) {
+      __atomic_sub_fetch(&pool->pending, 1, __ATOMIC_SEQ_CST);
+      return enc;
+    }
+  }
+  return NULL;
+}
+
+/* Computes ready_pos from the state of the encoder, which only the side
+   encoding may look at. Ignores the latency of the resampler, so the encoder
+   can get queued a little early. */
+static void async_update_ready(OggOpusEnc *enc) {
+  AsyncState *as = enc->async;
+  opus_int64 need;
+  need = enc->frame_size + enc->decision_delay/(48000/enc->opus_rate) + 1 - (enc->buffer_end - enc->buffer_start);
+  if (enc->re) {
+    opus_int64 den = (opus_int64)enc->opus_rate*enc->rate_den;
+    need = (need*enc->rate_num + den - 1)/den;
+  }
+  need = MAX(1, MIN(need, as->size/2));
+  __atomic_store_n(&as->ready_pos, as->read_pos + (opus_uint32)need, __ATOMIC_SEQ_CST);
+}
+
+/* Encodes what was in the ring when the encoder got picked up, then requeues
+   it if it has another frame ready (or is being stopped) by then. */
+static void pool_run(OggOpusEnc *enc) {
+  AsyncState *as = enc->async;
+  opus_uint32 write_pos = __atomic_load_n(&as->write_pos, __ATOMIC_SEQ_CST);
+  int stop;
+  async_resume(enc, write_pos);
+  while (as->read_pos != write_pos && __atomic_load_n(&as->stop, __ATOMIC_ACQUIRE) != 2) {
+    if (async_process(enc, write_pos) < 0) break;
+  }
+  async_update_ready(enc);
+  /* Waits for more samples unless it gets queued again right away, in which
+     case async_resume() finds no gap. */
+  async_idle(as, __atomic_load_n(&as->write_pos, __ATOMIC_SEQ_CST));
+  /* Once scheduled is cleared, async_stop() may free the encoder as soon as
+     the mutex is released. */
+  pthread_mutex_lock(&as->mutex);
+  __atomic_store_n(&as->scheduled, 0, __ATOMIC_SEQ_CST);
+  write_pos = __atomic_load_n(&as->write_pos, __ATOMIC_SEQ_CST);
+  stop = __atomic_load_n(&as->stop, __ATOMIC_ACQUIRE);
+  if (write_pos != as->read_pos && ((opus_int32)(write_pos - as->ready_pos) >= 0 || stop == 1)
+      && stop != 2 && as->error == OPE_OK) {
+    if (!__atomic_exchange_n(&as->scheduled, 1, __ATOMIC_SEQ_CST)) pool_push(enc);
+  } else {
+    pthread_cond_broadcast(&as->cond);
+  }
+  pthread_mutex_unlock(&as->mutex);
+}
+
+static void *pool_worker(void *arg) {
+  PoolThread *t = (PoolThread *)arg;
+  OggOpusEncPool *pool = t->pool;
+  for (;;) {
+    OggOpusEnc *enc = pool_pop(pool, t->index);
+    if (enc == NULL) {
+      struct timespec ts;
+      int ret = 0;
+      int stop;
+      /* Timed, since pool_push() may skip the wake-up. */
+      async_deadline(&ts);
+      pthread_mutex_lock(&pool->mutex);
+      while (__atomic_load_n(&pool->pending, __ATOMIC_SEQ_CST) <= 0 && !pool->stop && ret != ETIMEDOUT) {
+        ret = pthread_cond_timedwait(&pool->cond, &pool->mutex, &ts);
       }
-      in_samples = out_samples = curr;
+      stop = pool->stop && __atomic_load_n(&pool->pending, __ATOMIC_SEQ_CST) <= 0;
+      pthread_mutex_unlock(&pool->mutex);
+      if (stop) break;
+      continue;
     }
+    pool_run(enc);
+  }
+  return NULL;
+}
+
+static int async_start(OggOpusEnc *enc, int size, OggOpusEncPool *pool) {
+  AsyncState *as;
+  as = opeint_malloc(&enc->allocator, sizeof(*as));
+  if (as == NULL) return OPE_ALLOC_FAIL;
+  as->ring = opeint_malloc(&enc->allocator, sizeof(*as->ring)*size*enc->channels);
+  if (as->ring == NULL) {
+    opeint_free(&enc->allocator, as);
+    return OPE_ALLOC_FAIL;
+  }
+  as->size = size;
+  as->write_pos = as->read_pos = 0;
+  as->stop = 0;
+  as->error = OPE_OK;
+  as->overruns = as->underruns = 0;
+  as->idle_time = -1;
+  as->pool = pool;
+  as->scheduled = 0;
+  as->next = NULL;
+  pthread_mutex_init(&as->mutex, NULL);
+  pthread_cond_init(&as->cond, NULL);
+  enc->async = as;
+  async_update_ready(enc);
+  if (pool) {
+    /* Spread the encoders over the queues, the threads steal from each other
+       when theirs is empty. */
+    pthread_mutex_lock(&pool->mutex);
+    as->queue = pool->next_queue;
+    pool->next_queue = (pool->next_queue + 1)%pool->nb_threads;
+    pthread_mutex_unlock(&pool->mutex);
+  } else if (pthread_create(&as->thread, NULL, async_worker, enc) != 0) {
+    enc->async = NULL;
+    pthread_mutex_destroy(&as->mutex);
+    pthread_cond_destroy(&as->cond);
+    opeint_free(&enc->allocator, as->ring);
+    opeint_free(&enc->allocator, as);
+    return OPE_INTERNAL_ERROR;
+  }
+  return OPE_OK;
+}
+
+/* Stops the worker, after it has encoded everything in the ring if finish is
+   set, and goes back to encoding synchronously. Returns any error the worker
+   ran into. */
+static int async_stop(OggOpusEnc *enc, int finish) {
+  AsyncState *as = enc->async;
+  int ret;
+  __atomic_store_n(&as->stop, finish ? 1 : 2, __ATOMIC_SEQ_CST);
+  /* What is left in the ring may not have been enough to queue the encoder. */
+  if (as->pool && finish && !__atomic_exchange_n(&as->scheduled, 1, __ATOMIC_SEQ_CST)) pool_push(enc);
+  pthread_mutex_lock(&as->mutex);
+  if (as->pool) {
+    /* The ring stays scheduled until it is empty (or the pool gave up on it). */
+    while (__atomic_load_n(&as->scheduled, __ATOMIC_SEQ_CST)) pthread_cond_wait(&as->cond, &as->mutex);
+    pthread_mutex_unlock(&as->mutex);
+  } else {
+    pthread_cond_signal(&as->cond);
+    pthread_mutex_unlock(&as->mutex);
+    pthread_join(as->thread, NULL);
+  }
+  ret = as->error;
+  pthread_mutex_destroy(&as->mutex);
+  pthread_cond_destroy(&as->cond);
+  opeint_free(&enc->allocator, as->ring);
+  opeint_free(&enc->allocator, as);
+  enc->async = NULL;
+  return ret;
+}
+
+/* Copies the samples to the ring, dropping whatever does not fit. Never blocks,
+   so it can be called from a real-time thread: it is wait-free without a pool
+   and lock-free with one. */
+static int async_write(OggOpusEnc *enc, const void *const *pcm, int planar, int format, int samples_per_channel) {
+  AsyncState *as = enc->async;
+  const SampleFormat *fmt;
+  int channels = enc->channels;
+  int nb_ptrs = planar ? channels : 1;
+  int ptr_channels = planar ? 1 : channels;
+  opus_uint32 write_pos = as->write_pos;
+  opus_uint32 space;
+  int offset = 0;
+  int ret;
+  ret = __atomic_load_n(&as->error, __ATOMIC_ACQUIRE);
+  if (ret != OPE_OK) return ret;
+  if (format < 0 || format >= (int)(sizeof(sample_formats)/sizeof(sample_formats[0]))) return OPE_BAD_ARG;
+  if (samples_per_channel < 0) return OPE_BAD_ARG;
+  fmt = &sample_formats[format];
+  space = as->size - (write_pos - __atomic_load_n(&as->read_pos, __ATOMIC_ACQUIRE));
+  if ((opus_uint32)samples_per_channel > space) {
+    __atomic_store_n(&as->overruns, as->overruns + (opus_int32)(samples_per_channel - space), __ATOMIC_RELAXED);
+    samples_per_channel = space;
+  }
+  while (offset < samples_per_channel) {
+    opus_uint32 pos = (write_pos + offset)&(as->size - 1);
+    int n = (int)MIN((opus_uint32)(samples_per_channel - offset), as->size - pos);
+    int p;
+    for (p=0;p<nb_ptrs;p++) {
+      const unsigned char *src = (const unsigned char *)pcm[p] + offset*ptr_channels*fmt->bytes;
+      fmt->convert(&as->ring[pos*channels + p], nb_ptrs, src, n*ptr_channels);
+    }
+    offset += n;
+  }
+  if (as->pool) {
+    /* Pairs with the end of pool_run(): either it sees the new samples or we
+       see scheduled cleared (and its ready_pos). Queuing an encoder that has
+       no frame to encode yet would only cost the pool a wake-up. */
+    write_pos += samples_per_channel;
+    __atomic_store_n(&as->write_pos, write_pos, __ATOMIC_SEQ_CST);
+    if (samples_per_channel > 0 && (opus_int32)(write_pos - __atomic_load_n(&as->ready_pos, __ATOMIC_SEQ_CST)) >= 0
+        && !__atomic_exchange_n(&as->scheduled, 1, __ATOMIC_SEQ_CST)) {
+      pool_push(enc);
+    }
+  } else {
+    __atomic_store_n(&as->write_pos, write_pos + samples_per_channel, __ATOMIC_RELEASE);
+    async_wake(as);
+  }
+  return OPE_OK;
+}
+#endif
+
+static int encoder_write(OggOpusEnc *enc, const void *const *pcm, int planar, int format, int samples_per_channel) {
+#ifdef OPE_ASYNC
+  if (enc->async) return async_write(enc, pcm, planar, format, samples_per_channel);
+#endif
+  return encoder_write_sync(enc, pcm, planar, format, samples_per_channel);
+}
+
+/* Add/encode any number of float samples to the file. */
+int ope_encoder_write_float(OggOpusEnc *enc, const float *pcm, int samples_per_channel) {
+  const void *ptr = pcm;
+  return encoder_write(enc, &ptr, 0, OPE_FORMAT_FLOAT, samples_per_channel);
+}
+
+/* Add/encode any number of int16 samples to the file. */
+int ope_encoder_write(OggOpusEnc *enc, const opus_int16 *pcm, int samples_per_channel) {
+  const void *ptr = pcm;
+  return encoder_write(enc, &ptr, 0, OPE_FORMAT_S16, samples_per_channel);
+}
+
+/* Add/encode any number of samples in the given format to the file. */
+int ope_encoder_write_format(OggOpusEnc *enc, const void *pcm, int format, int samples_per_channel) {
+  return encoder_write(enc, &pcm, 0, format, samples_per_channel);
+}
+
+/* Add/encode any number of planar float samples to the file. */
+int ope_encoder_write_float_planar(OggOpusEnc *enc, const float *const *pcm, int samples_per_channel) {
+  const void *ptrs[255];
+  int c;
+  for (c=0;c<enc->channels;c++) ptrs[c] = pcm[c];
+  return encoder_write(enc, ptrs, 1, OPE_FORMAT_FLOAT, samples_per_channel);
+}
+
+/* Add/encode any number of planar int16 samples to the file. */
+int ope_encoder_write_planar(OggOpusEnc *enc, const opus_int16 *const *pcm, int samples_per_channel) {
+  const void *ptrs[255];
+  int c;
+  for (c=0;c<enc->channels;c++) ptrs[c] = pcm[c];
+  return encoder_write(enc, ptrs, 1, OPE_FORMAT_S16, samples_per_channel);
+}
+
+/* Pushes out the samples still held in the resampler by feeding it silence. */
+static int flush_resampler(OggOpusEnc *enc) {
+  float zeros[CONVERT_BUFFER];
+  int remaining = speex_resampler_get_output_latency(enc->re);
+  memset(zeros, 0, sizeof(zeros));
+  while (remaining > 0) {
+    spx_uint32_t in_samples = CONVERT_BUFFER/enc->channels;
+    spx_uint32_t out_samples;
+    float *dst;
+    out_samples = MIN(buffer_write_space(enc, &dst), remaining);
+    speex_resampler_process_interleaved_float(enc->re, zeros, &in_samples, dst, &out_samples);
     enc->buffer_end += out_samples;
-    pcm += in_samples*channels;
-    samples_per_channel -= in_samples;
-    encode_buffer(enc);
+    remaining -= out_samples;
+    encode_written(enc);
     if (enc->unrecoverable) return enc->unrecoverable;
-  } while (samples_per_channel > 0);
+  }
   return OPE_OK;
 }
 
+/* Sets libopus up again at opus_rate, before anything is written. */
+static int encoder_set_opus_rate(OggOpusEnc *enc, opus_int32 opus_rate) {
+  int ret;
+  if (enc->st.ms != NULL
+#ifdef OPUS_HAVE_OPUS_PROJECTION_H
+      || enc->st.pr != NULL
+#endif
+      ) {
+    OpusGenericEncoder st;
+    ret = opeint_encoder_surround_init(&st, &enc->allocator, opus_rate, enc->channels,
+        enc->header.channel_mapping, &enc->header.nb_streams, &enc->header.nb_coupled,
+        enc->header.stream_map, OPUS_APPLICATION_AUDIO);
+    if (ret != OPUS_OK) {
+      opeint_encoder_cleanup(&st, &enc->allocator);
+      return ret == OPUS_ALLOC_FAIL ? OPE_ALLOC_FAIL : OPE_INTERNAL_ERROR;
+    }
+    opeint_encoder_cleanup(&enc->st, &enc->allocator);
+    enc->st = st;
+    opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(enc->frame_size_request));
+  }
+  enc->opus_rate = opus_rate;
+  enc->frame_size = compute_frame_samples(enc->frame_size_request)/(48000/opus_rate);
+  if (enc->re) {
+    speex_resampler_destroy(enc->re);
+    enc->re = NULL;
+  }
+  if (enc->rate != opus_rate || enc->rate_correction != 0 || enc->drift_target != -1) {
+    if (lpc_buffer_alloc(enc) != OPE_OK) {
+      enc->unrecoverable = OPE_ALLOC_FAIL;
+      return OPE_ALLOC_FAIL;
+    }
+    enc->re = resampler_create(enc, enc->rate_num, enc->rate_den, enc->rate, enc->resampler_quality);
+    if (enc->re == NULL) {
+      enc->unrecoverable = OPE_ALLOC_FAIL;
+      return OPE_ALLOC_FAIL;
+    }
+    speex_resampler_skip_zeros(enc->re);
+  }
+  ret = resize_buffer(enc, compute_buffer_samples(enc, enc->decision_delay, enc->frame_size));
+  if (ret != OPE_OK) enc->unrecoverable = ret;
+  return ret;
+}
+
+/* Switches to a new input rate and clock correction (in parts per billion) within
+   the current stream. Libopus keeps running at opus_rate, only the resampler in
+   front of it changes. */
+static int encoder_set_input_rate(OggOpusEnc *enc, opus_int32 rate, opus_int32 correction) {
+  opus_int64 num = rate;
+  opus_int64 den = 1;
+  int buffer_samples;
+  int ret;
+  if (correction != 0) {
+    /* The corrected rate is in mHz, which is precise enough for any drift. */
+    opus_int64 adjust = (opus_int64)rate*correction;
+    num = 1000*(opus_int64)rate + (adjust + (adjust < 0 ? -500000 : 500000))/1000000;
+    den = 1000;
+    if (num <= 0 || num > 0xFFFFFFFF) return OPE_BAD_ARG;
+  }
+  /* The small writes gathered so far are at the old rate. */
+  ret = write_pending(enc);
+  if (ret != OPE_OK) return ret;
+  /* While the drift controller runs, the resampler is kept even at opus_rate. */
+  if (rate == enc->opus_rate && correction == 0 && enc->drift_target == -1) {
+    if (enc->re) {
+      /* Whatever was written is in the granule positions already. */
+      if (write_granule48k(enc) != 0) {
+        ret = flush_resampler(enc);
+        if (ret != OPE_OK) return ret;
+      }
+      speex_resampler_destroy(enc->re);
+      enc->re = NULL;
+    }
+  } else if (enc->re) {
+    if (num == enc->rate_num && den == enc->rate_den) {
+      enc->rate_correction = correction;
+      return OPE_OK;
+    }
+    /* Keeps the filter memory, so the signal stays continuous. */
+    if (speex_resampler_set_rate_frac(enc->re, (spx_uint32_t)num, (spx_uint32_t)(enc->opus_rate*den),
+          rate, enc->opus_rate) != RESAMPLER_ERR_SUCCESS) return OPE_ALLOC_FAIL;
+  } else {
+    if (lpc_buffer_alloc(enc) != OPE_OK) return OPE_ALLOC_FAIL;
+    enc->re = resampler_create(enc, (opus_uint32)num, (opus_uint32)den, rate, enc->resampler_quality);
+    if (enc->re == NULL) return OPE_ALLOC_FAIL;
+    speex_resampler_skip_zeros(enc->re);
+  }
+  enc->write_granule_base = write_granule_exact(enc, &enc->write_granule_frac);
+  enc->write_granule = 0;
+  enc->rate = rate;
+  enc->rate_correction = correction;
+  enc->rate_num = (opus_uint32)num;
+  enc->rate_den = (opus_uint32)den;
+  /* Only affects the headers of streams that have not started yet. */
+  enc->header.input_sample_rate = rate;
+  buffer_samples = compute_buffer_samples(enc, enc->decision_delay, enc->frame_size);
+  if (buffer_samples > enc->buffer_samples) return resize_buffer(enc, buffer_samples);
+  return OPE_OK;
+}
+
+/* Runs the drift controller on a new measurement of the fill level of the
+   caller's buffer, in 48 kHz samples. A PI controller: the proportional part
+   takes out a fill error in about DRIFT_P_TIME seconds, the integral part
+   converges to the actual clock offset. The correction only moves once it is
+   off by a whole DRIFT_STEP, and then to a multiple of it, so that the
+   resampler is not set up again on every report. */
+static int drift_update(OggOpusEnc *enc, opus_int32 fill) {
+  double kp = 1e9/(48000*DRIFT_P_TIME);
+  double error = fill - (double)enc->drift_target;
+  opus_int64 now = write_granule48k(enc);
+  double correction;
+  if (enc->drift_last_report >= 0) {
+    double dt = (now - enc->drift_last_report)/48000.;
+    enc->drift_integral += kp*error*dt/DRIFT_I_TIME;
+    enc->drift_integral = MAX(-MAX_RATE_CORRECTION, MIN(MAX_RATE_CORRECTION, enc->drift_integral));
+  }
+  enc->drift_last_report = now;
+  correction = kp*error + enc->drift_integral;
+  correction = MAX(-MAX_RATE_CORRECTION, MIN(MAX_RATE_CORRECTION, correction));
+  if (correction > enc->rate_correction - DRIFT_STEP && correction < enc->rate_correction + DRIFT_STEP) return OPE_OK;
+  return encoder_set_input_rate(enc, enc->rate,
+      DRIFT_STEP*(opus_int32)(correction/DRIFT_STEP + (correction < 0 ? -.5 : .5)));
+}
+
 /* Get the next page from the stream. Returns 1 if there is a page available, 0 if not. */
 int ope_encoder_get_page(OggOpusEnc *enc, unsigned char **page, opus_int32 *len, int flush) {
   if (enc->unrecoverable) return enc->unrecoverable;
@@ -814,22 +3028,70 @@ int ope_encoder_get_page(OggOpusEnc *enc, unsigned char **page, opus_int32 *len,
   }
 }
 
+/* Encodes up to max_frames of the frames buffered in deferred mode. */
+int ope_encoder_step(OggOpusEnc *enc, int max_frames) {
+  int nb_frames;
+  if (max_frames < 0) return OPE_BAD_ARG;
+#ifdef OPE_ASYNC
+  if (enc->async) return OPE_TOO_LATE;
+#endif
+  if (enc->unrecoverable) return enc->unrecoverable;
+  if (enc->streams == NULL || enc->draining) return 0;
+  nb_frames = encode_buffer(enc, max_frames);
+  if (enc->unrecoverable) return enc->unrecoverable;
+  return nb_frames;
+}
+
 static void extend_signal(float *x, int before, int after, int channels);
 
+/* Rotates the LPC history so that it starts with its oldest sample, as
+   extend_signal() expects. */
+static void lpc_unwrap(OggOpusEnc *enc) {
+  int pos = enc->lpc_pos*enc->channels;
+  int len = LPC_INPUT*enc->channels;
+  if (pos == 0) return;
+  reverse_samples(enc->lpc_buffer, pos);
+  reverse_samples(&enc->lpc_buffer[pos], len - pos);
+  reverse_samples(enc->lpc_buffer, len);
+  enc->lpc_pos = 0;
+}
+
 int ope_encoder_drain(OggOpusEnc *enc) {
+  int scale = 48000/enc->opus_rate;
+  opus_int64 shortfall;
   int pad_samples;
   int resampler_drain = 0;
+#ifdef OPE_ASYNC
+  if (enc->async) {
+    int ret = async_stop(enc, 1);
+    if (ret != OPE_OK) return ret;
+  }
+#endif
   if (enc->unrecoverable) return enc->unrecoverable;
   /* Check if it's already been drained. */
   if (enc->streams == NULL) return OPE_TOO_LATE;
   if (!enc->streams->stream_is_init) init_stream(enc);
+  if (write_pending(enc) != OPE_OK) return enc->unrecoverable;
   if (enc->re) resampler_drain = speex_resampler_get_output_latency(enc->re);
-  pad_samples = MAX(LPC_PADDING, enc->global_granule_offset + enc->frame_size + resampler_drain + 1);
-  shift_buffer(enc);
-  assert(enc->buffer_end + pad_samples <= BUFFER_SAMPLES);
+  /* The pre-skip is at 48 kHz, so round it up to opus_rate. */
+  pad_samples = (enc->global_granule_offset + scale - 1)/scale;
+  /* Changing the input rate moves the resampler delay, leaving what was
+     buffered short of the granule position that was written. */
+  shortfall = (enc->last_stream->end_granule + scale - 1)/scale
+      - (enc->curr_granule/scale + enc->buffer_end - enc->buffer_start + resampler_drain);
+  pad_samples = MAX(LPC_PADDING, pad_samples + enc->frame_size + resampler_drain + MAX(shortfall, 0) + 1);
+  unwrap_buffer(enc);
+  /* Only happens if libopus has a larger lookahead than we planned for. */
+  if (enc->buffer_end + pad_samples > enc->buffer_samples) {
+    int ret;
+    ret = resize_buffer(enc, enc->buffer_end + pad_samples);
+    if (ret != OPE_OK) return ret;
+  }
+  assert(enc->buffer_end + pad_samples <= enc->buffer_samples);
   memset(&enc->buffer[enc->channels*enc->buffer_end], 0, pad_samples*enc->channels*sizeof(enc->buffer[0]));
   if (enc->re) {
     spx_uint32_t in_samples, out_samples;
+    lpc_unwrap(enc);
     extend_signal(&enc->lpc_buffer[LPC_INPUT*enc->channels], LPC_INPUT, LPC_PADDING, enc->channels);
     do {
       in_samples = LPC_PADDING;
@@ -844,37 +3106,194 @@ int ope_encoder_drain(OggOpusEnc *enc) {
     extend_signal(&enc->buffer[enc->channels*enc->buffer_end], enc->buffer_end, LPC_PADDING, enc->channels);
     enc->buffer_end += pad_samples;
   }
+  enc->drain_decision_delay = enc->decision_delay;
+  enc->drain_frame_size_request = enc->frame_size_request;
   enc->decision_delay = 0;
   enc->draining = 1;
-  assert(enc->buffer_end <= BUFFER_SAMPLES);
-  encode_buffer(enc);
+  assert(enc->buffer_end <= enc->buffer_samples);
+#ifdef HAVE_PTHREAD
+  if (enc->encode_threads > 1) encode_parallel(enc, 1);
+#endif
+  encode_buffer(enc, -1);
   if (enc->unrecoverable) return enc->unrecoverable;
   /* Draining should have called all the streams to complete. */
   assert(enc->streams == NULL);
   return OPE_OK;
 }
 
+OggOpusEncPool *ope_pool_create(int nb_threads, int *error) {
+#ifdef OPE_ASYNC
+  OggOpusEncPool *pool;
+  int i;
+  if (nb_threads < 1 || nb_threads > 1024) {
+    if (error) *error = OPE_BAD_ARG;
+    return NULL;
+  }
+  if ( (pool = malloc(sizeof(*pool))) == NULL) goto fail;
+  pool->pending = 0;
+  pool->incoming = NULL;
+  pool->stop = 0;
+  pool->next_queue = 0;
+  pool->threads = NULL;
+  if ( (pool->queues = malloc(sizeof(*pool->queues)*nb_threads)) == NULL) goto fail;
+  if ( (pool->threads = malloc(sizeof(*pool->threads)*nb_threads)) == NULL) goto fail;
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->cond, NULL);
+  for (i=0;i<nb_threads;i++) {
+    pthread_mutex_init(&pool->queues[i].mutex, NULL);
+    pool->queues[i].head = pool->queues[i].tail = NULL;
+  }
+  pool->nb_threads = nb_threads;
+  for (i=0;i<nb_threads;i++) {
+    pool->threads[i].pool = pool;
+    pool->threads[i].index = i;
+    if (pthread_create(&pool->threads[i].thread, NULL, pool_worker, &pool->threads[i]) != 0) {
+      int j;
+      /* Stop the threads we got and give up. */
+      pthread_mutex_lock(&pool->mutex);
+      pool->stop = 1;
+      pthread_cond_broadcast(&pool->cond);
+      pthread_mutex_unlock(&pool->mutex);
+      for (j=0;j<i;j++) pthread_join(pool->threads[j].thread, NULL);
+      for (j=0;j<nb_threads;j++) pthread_mutex_destroy(&pool->queues[j].mutex);
+      pthread_mutex_destroy(&pool->mutex);
+      pthread_cond_destroy(&pool->cond);
+      free(pool->threads);
+      free(pool->queues);
+      free(pool);
+      if (error) *error = OPE_INTERNAL_ERROR;
+      return NULL;
+    }
+  }
+  if (error) *error = OPE_OK;
+  return pool;
+fail:
+  if (pool) {
+    free(pool->queues);
+    free(pool);
+  }
+  if (error) *error = OPE_ALLOC_FAIL;
+  return NULL;
+#else
+  (void)nb_threads;
+  if (error) *error = OPE_UNIMPLEMENTED;
+  return NULL;
+#endif
+}
+
+void ope_pool_destroy(OggOpusEncPool *pool) {
+#ifdef OPE_ASYNC
+  int i;
+  pthread_mutex_lock(&pool->mutex);
+  pool->stop = 1;
+  pthread_cond_broadcast(&pool->cond);
+  pthread_mutex_unlock(&pool->mutex);
+  for (i=0;i<pool->nb_threads;i++) pthread_join(pool->threads[i].thread, NULL);
+  for (i=0;i<pool->nb_threads;i++) pthread_mutex_destroy(&pool->queues[i].mutex);
+  pthread_mutex_destroy(&pool->mutex);
+  pthread_cond_destroy(&pool->cond);
+  free(pool->threads);
+  free(pool->queues);
+  free(pool);
+#else
+  (void)pool;
+#endif
+}
+
 void ope_encoder_destroy(OggOpusEnc *enc) {
+  OpeAllocator allocator;
   EncStream *stream;
+#ifdef OPE_ASYNC
+  if (enc->async) async_stop(enc, 0);
+#endif
   stream = enc->streams;
   while (stream != NULL) {
     EncStream *tmp = stream;
     stream = stream->next;
     /* Ignore any error on close. */
     if (tmp->close_at_end && !enc->pull_api) enc->callbacks.close(tmp->user_data);
-    stream_destroy(tmp);
+    stream_destroy(&enc->allocator, tmp);
   }
-  if (enc->chaining_keyframe) free(enc->chaining_keyframe);
-  free(enc->buffer);
+  if (enc->spare_stream) stream_destroy(&enc->allocator, enc->spare_stream);
+  opeint_free(&enc->allocator, enc->chaining_keyframe);
+  opeint_free(&enc->allocator, enc->packet_copy);
+  opeint_free(&enc->allocator, enc->buffer);
   if (enc->oggp) oggp_destroy(enc->oggp);
-  opeint_encoder_cleanup(&enc->st);
+  opeint_encoder_cleanup(&enc->st, &enc->allocator);
   if (enc->re) speex_resampler_destroy(enc->re);
-  if (enc->lpc_buffer) free(enc->lpc_buffer);
-  free(enc);
+  opeint_free(&enc->allocator, enc->lpc_buffer);
+#ifdef HAVE_PTHREAD
+  if (enc->stream_team) stream_threads_destroy(enc->stream_team);
+  if (enc->resampler_team) team_destroy(enc->resampler_team);
+#endif
+  allocator = enc->allocator;
+  opeint_free(&allocator, enc);
+}
+
+int ope_encoder_reset(OggOpusEnc *enc, void *user_data, OggOpusComments *comments) {
+  EncStream *new_stream;
+  EncStream *stream;
+#ifdef OPE_ASYNC
+  if (enc->async) return OPE_TOO_LATE;
+#endif
+  /* Allocate first, so that failing leaves the encoder untouched. */
+  new_stream = stream_get(enc, comments);
+  if (!new_stream) return OPE_ALLOC_FAIL;
+  new_stream->user_data = user_data;
+  new_stream->end_granule = 0;
+  stream = enc->streams;
+  while (stream != NULL) {
+    EncStream *tmp = stream;
+    stream = stream->next;
+    /* Ignore any error on close, the stream is abandoned anyway. */
+    if (tmp->close_at_end && !enc->pull_api) enc->callbacks.close(tmp->user_data);
+    stream_release(enc, tmp);
+  }
+  enc->streams = enc->last_stream = new_stream;
+  if (enc->draining) {
+    enc->decision_delay = enc->drain_decision_delay;
+    if (enc->frame_size_request != enc->drain_frame_size_request) {
+      /* Draining never shrinks the buffer, so it is still large enough. */
+      opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(enc->drain_frame_size_request));
+      enc->frame_size_request = enc->drain_frame_size_request;
+      enc->frame_size = compute_frame_samples(enc->frame_size_request)/(48000/enc->opus_rate);
+    }
+  }
+  /* Only an encoder still waiting for ope_encoder_deferred_init_with_mapping()
+     has no libopus state. */
+  if (enc->header.channel_mapping != -1) {
+    opeint_encoder_ctl(&enc->st, OPUS_RESET_STATE);
+    enc->unrecoverable = 0;
+  }
+  enc->streams_synced = 0;
+  if (enc->re) {
+    speex_resampler_reset_mem(enc->re);
+    speex_resampler_skip_zeros(enc->re);
+    memset(enc->lpc_buffer, 0, sizeof(*enc->lpc_buffer)*LPC_INPUT*enc->channels);
+    enc->lpc_pos = 0;
+    enc->pending_samples = 0;
+  }
+  /* The rate correction is a setting, but the drift controller needs a new
+     first report. Its integral (the clock offset) is kept. */
+  enc->drift_last_report = -1;
+  if (enc->oggp) oggp_reset(enc->oggp);
+  enc->chaining_keyframe_length = -1;
+  enc->global_granule_offset = -1;
+  enc->curr_granule = 0;
+  enc->write_granule = 0;
+  enc->write_granule_base = 0;
+  enc->write_granule_frac = 0;
+  enc->last_page_granule = 0;
+  enc->draining = 0;
+  enc->buffer_start = enc->buffer_end = 0;
+  return OPE_OK;
 }
 
 /* Ends the stream and create a new stream within the same file. */
 int ope_encoder_chain_current(OggOpusEnc *enc, OggOpusComments *comments) {
+#ifdef OPE_ASYNC
+  if (enc->async) return OPE_TOO_LATE;
+#endif
   enc->last_stream->close_at_end = 0;
   return ope_encoder_continue_new_callbacks(enc, enc->last_stream->user_data, comments);
 }
@@ -900,19 +3319,27 @@ int ope_encoder_continue_new_file(OggOpusEnc *enc, const char *path, OggOpusComm
 /* Ends the stream and create a new file (callback-based). */
 int ope_encoder_continue_new_callbacks(OggOpusEnc *enc, void *user_data, OggOpusComments *comments) {
   EncStream *new_stream;
+#ifdef OPE_ASYNC
+  if (enc->async) return OPE_TOO_LATE;
+#endif
   if (enc->unrecoverable) return enc->unrecoverable;
   assert(enc->streams);
   assert(enc->last_stream);
-  new_stream = stream_create(comments);
+  new_stream = stream_get(enc, comments);
   if (!new_stream) return OPE_ALLOC_FAIL;
   new_stream->user_data = user_data;
-  new_stream->end_granule = enc->write_granule;
+  new_stream->end_granule = write_granule48k(enc);
+  /* Small writes still waiting to be resampled end the current stream too. */
+  enc->last_stream->end_granule = new_stream->end_granule;
   enc->last_stream->next = new_stream;
   enc->last_stream = new_stream;
   return OPE_OK;
 }
 
 int ope_encoder_flush_header(OggOpusEnc *enc) {
+#ifdef OPE_ASYNC
+  if (enc->async) return OPE_TOO_LATE;
+#endif
   if (enc->unrecoverable) return enc->unrecoverable;
   if (enc->last_stream->header_is_frozen) return OPE_TOO_LATE;
   if (enc->last_stream->stream_is_init) return OPE_TOO_LATE;
@@ -925,6 +3352,15 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
   int ret;
   int translate;
   va_list ap;
+#ifdef OPE_ASYNC
+  /* Until the asynchronous mode is stopped, the worker owns everything but the ring. */
+  if (enc->async) {
+    if (request != OPE_SET_ASYNC_BUFFER_REQUEST && request != OPE_GET_ASYNC_BUFFER_REQUEST
+        && request != OPE_GET_ASYNC_OVERRUNS_REQUEST && request != OPE_GET_ASYNC_UNDERRUNS_REQUEST) {
+      return OPE_TOO_LATE;
+    }
+  } else
+#endif
   if (enc->unrecoverable) return enc->unrecoverable;
   va_start(ap, request);
   ret = OPE_OK;
@@ -952,12 +3388,16 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
     {
       opus_int32 value = va_arg(ap, opus_int32);
       ret = opeint_encoder_ctl2(&enc->st, request, value);
+      enc->opus_configured = 1;
+      enc->streams_synced = 0;
     }
     break;
     case OPUS_GET_LOOKAHEAD_REQUEST:
     {
       opus_int32 *value = va_arg(ap, opus_int32*);
       ret = opeint_encoder_ctl(&enc->st, OPUS_GET_LOOKAHEAD(value));
+      /* Report it at 48 kHz like the pre-skip. */
+      if (ret == OPUS_OK) *value *= 48000/enc->opus_rate;
     }
     break;
     case OPUS_SET_EXPERT_FRAME_DURATION_REQUEST:
@@ -972,9 +3412,21 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
         break;
       }
       ret = opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(value));
+      /* Draining only ever makes the frames smaller, so there's no need to resize then. */
+      if (ret == OPUS_OK && !enc->draining) {
+        int frame_size = compute_frame_samples(value)/(48000/enc->opus_rate);
+        if (resize_buffer(enc, compute_buffer_samples(enc, enc->decision_delay, frame_size)) != OPE_OK) {
+          /* Back to the frame size the buffer has room for. */
+          opeint_encoder_ctl(&enc->st, OPUS_SET_EXPERT_FRAME_DURATION(enc->frame_size_request));
+          ret = OPUS_ALLOC_FAIL;
+          break;
+        }
+      }
       if (ret == OPUS_OK) {
-        enc->frame_size = compute_frame_samples(value);
+        enc->frame_size = compute_frame_samples(value)/(48000/enc->opus_rate);
         enc->frame_size_request = value;
+        /* The bitrate of each stream depends on the frame size. */
+        enc->streams_synced = 0;
       }
     }
     break;
@@ -1010,6 +3462,9 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
       stream_id = va_arg(ap, opus_int32);
       value = va_arg(ap, OpusEncoder**);
       opeint_encoder_ctl(&enc->st, OPUS_MULTISTREAM_GET_ENCODER_STATE(stream_id, value));
+      /* The caller may change the settings of the stream. */
+      enc->opus_configured = 1;
+      enc->streams_synced = 0;
     }
     break;
 
@@ -1021,7 +3476,11 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
         ret = OPE_BAD_ARG;
         break;
       }
-      value = MIN(value, MAX_LOOKAHEAD);
+      value = MIN(value, enc->max_decision_delay);
+      if (!enc->draining) {
+        ret = resize_buffer(enc, compute_buffer_samples(enc, value, enc->frame_size));
+        if (ret != OPE_OK) break;
+      }
       enc->decision_delay = value;
     }
     break;
@@ -1031,6 +3490,359 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
       *value = enc->decision_delay;
     }
     break;
+    case OPE_SET_MAX_DECISION_DELAY_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      value = MIN(value, MAX_LOOKAHEAD);
+      if (!enc->draining) {
+        ret = resize_buffer(enc, compute_buffer_samples(enc, MIN(enc->decision_delay, value), enc->frame_size));
+        if (ret != OPE_OK) break;
+      }
+      enc->max_decision_delay = value;
+      enc->decision_delay = MIN(enc->decision_delay, value);
+    }
+    break;
+    case OPE_GET_MAX_DECISION_DELAY_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->max_decision_delay;
+    }
+    break;
+    case OPE_SET_RESAMPLER_QUALITY_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0 || value > 10) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* The resampler delay goes into the pre-skip, so it's fixed once the stream starts. */
+      if (!enc->streams || enc->streams->stream_is_init) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      if (enc->re && value != enc->resampler_quality) {
+        SpeexResamplerState *re;
+        SpeexResamplerState *old_re;
+        re = resampler_create(enc, enc->rate_num, enc->rate_den, enc->rate, value);
+        if (re == NULL) {
+          ret = OPE_ALLOC_FAIL;
+          break;
+        }
+        speex_resampler_skip_zeros(re);
+        old_re = enc->re;
+        enc->re = re;
+        ret = resize_buffer(enc, compute_buffer_samples(enc, enc->decision_delay, enc->frame_size));
+        if (ret != OPE_OK) {
+          enc->re = old_re;
+          speex_resampler_destroy(re);
+          break;
+        }
+        speex_resampler_destroy(old_re);
+      }
+      enc->resampler_quality = value;
+    }
+    break;
+    case OPE_GET_RESAMPLER_QUALITY_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->resampler_quality;
+    }
+    break;
+    case OPE_SET_INPUT_RATE_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value <= 0) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      if (!enc->streams) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      ret = encoder_set_input_rate(enc, value, enc->rate_correction);
+    }
+    break;
+    case OPE_GET_INPUT_RATE_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->rate;
+    }
+    break;
+    case OPE_SET_RATE_CORRECTION_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < -MAX_RATE_CORRECTION || value > MAX_RATE_CORRECTION) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      if (!enc->streams) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      ret = encoder_set_input_rate(enc, enc->rate, value);
+      /* The controller carries on from the new value. */
+      if (ret == OPE_OK) enc->drift_integral = value;
+    }
+    break;
+    case OPE_GET_RATE_CORRECTION_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->rate_correction;
+    }
+    break;
+    case OPE_SET_DRIFT_TARGET_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < -1) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      if (!enc->streams) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      if (value != -1 && enc->drift_target == -1) {
+        enc->drift_integral = enc->rate_correction;
+        enc->drift_last_report = -1;
+      }
+      enc->drift_target = value;
+      /* Creates the resampler if the input is at opus_rate, or drops it when
+         it is no longer needed. */
+      ret = encoder_set_input_rate(enc, enc->rate, enc->rate_correction);
+    }
+    break;
+    case OPE_GET_DRIFT_TARGET_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->drift_target;
+    }
+    break;
+    case OPE_SET_DRIFT_FILL_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0 || enc->drift_target == -1) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      if (!enc->streams) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      ret = drift_update(enc, value);
+    }
+    break;
+    case OPE_SET_ASYNC_BUFFER_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0 || value > 0x10000000/enc->channels || (value != 0 && enc->deferred)) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      if (value != 0 && enc->in_place) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+#ifdef OPE_ASYNC
+      if (value != 0) {
+        opus_int32 size = 1;
+        while (size < value) size <<= 1;
+        value = size;
+      }
+      if (enc->async) {
+        if ((opus_uint32)value == enc->async->size) break;
+        ret = async_stop(enc, 1);
+        if (ret != OPE_OK) break;
+      }
+      if (value == 0) break;
+      if (!enc->streams) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      if (enc->pull_api) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+      ret = async_start(enc, value, enc->pool);
+#else
+      if (value != 0) ret = OPE_UNIMPLEMENTED;
+#endif
+    }
+    break;
+    case OPE_GET_ASYNC_BUFFER_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+#ifdef OPE_ASYNC
+      *value = enc->async ? (opus_int32)enc->async->size : 0;
+#else
+      *value = 0;
+#endif
+    }
+    break;
+    case OPE_GET_ASYNC_OVERRUNS_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+#ifdef OPE_ASYNC
+      *value = enc->async ? enc->async->overruns : 0;
+#else
+      *value = 0;
+#endif
+    }
+    break;
+    case OPE_GET_ASYNC_UNDERRUNS_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+#ifdef OPE_ASYNC
+      *value = enc->async ? __atomic_load_n(&enc->async->underruns, __ATOMIC_RELAXED) : 0;
+#else
+      *value = 0;
+#endif
+    }
+    break;
+    case OPE_SET_DEFERRED_ENCODING_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0 || value > 1) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* The buffer can't grow for the backlog. */
+      if (value && enc->in_place) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+      /* Deferred writes aren't gathered, and ope_encoder_step() should see
+         what was. */
+      if (value && write_pending(enc) != OPE_OK) {
+        ret = enc->unrecoverable;
+        break;
+      }
+      enc->deferred = value;
+    }
+    break;
+    case OPE_GET_DEFERRED_ENCODING_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->deferred;
+    }
+    break;
+    case OPE_SET_MAX_BACKLOG_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 0 || value > 0x10000000/enc->channels) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      enc->max_backlog = value;
+    }
+    break;
+    case OPE_GET_MAX_BACKLOG_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->max_backlog;
+    }
+    break;
+    case OPE_SET_ENCODE_THREADS_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 1 || value > 256) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* The threads would need memory of their own. */
+      if (value != 1 && enc->in_place) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+#ifdef HAVE_PTHREAD
+      enc->encode_threads = value;
+#else
+      if (value != 1) ret = OPE_UNIMPLEMENTED;
+#endif
+    }
+    break;
+    case OPE_GET_ENCODE_THREADS_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->encode_threads;
+    }
+    break;
+    case OPE_SET_STREAM_THREADS_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 1 || value > 256) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* The threads would need memory of their own. */
+      if (value != 1 && enc->in_place) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+#ifdef HAVE_PTHREAD
+      /* Unless the family is still to come with ope_encoder_deferred_init_with_mapping(). */
+      if (value != 1 && enc->header.channel_mapping != -1 && !streams_separable(enc)) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+      if (enc->stream_team && value != enc->stream_threads) {
+        stream_threads_destroy(enc->stream_team);
+        enc->stream_team = NULL;
+      }
+      enc->stream_threads = value;
+#else
+      if (value != 1) ret = OPE_UNIMPLEMENTED;
+#endif
+    }
+    break;
+    case OPE_GET_STREAM_THREADS_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->stream_threads;
+    }
+    break;
+    case OPE_SET_RESAMPLER_THREADS_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      if (value < 1 || value > 256) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* The threads would need memory of their own. */
+      if (value != 1 && enc->in_place) {
+        ret = OPE_UNIMPLEMENTED;
+        break;
+      }
+#ifdef HAVE_PTHREAD
+      if (enc->resampler_team && value != enc->resampler_threads) {
+        team_destroy(enc->resampler_team);
+        enc->resampler_team = NULL;
+      }
+      enc->resampler_threads = value;
+#else
+      if (value != 1) ret = OPE_UNIMPLEMENTED;
+#endif
+    }
+    break;
+    case OPE_GET_RESAMPLER_THREADS_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->resampler_threads;
+    }
+    break;
+    case OPE_SET_ENCODER_POOL_REQUEST:
+    {
+      OggOpusEncPool *value = va_arg(ap, OggOpusEncPool*);
+#ifdef OPE_ASYNC
+      enc->pool = value;
+#else
+      if (value != NULL) ret = OPE_UNIMPLEMENTED;
+#endif
+    }
+    break;
     case OPE_SET_MUXING_DELAY_REQUEST:
     {
       opus_int32 value = va_arg(ap, opus_int32);
@@ -1126,6 +3938,32 @@ int ope_encoder_ctl(OggOpusEnc *enc, int request, ...) {
       *value = enc->header.nb_coupled;
     }
     break;
+    case OPE_SET_NATIVE_RATE_REQUEST:
+    {
+      opus_int32 value = va_arg(ap, opus_int32);
+      opus_int32 opus_rate = 48000;
+      if (value < 0 || value > 1) {
+        ret = OPE_BAD_ARG;
+        break;
+      }
+      /* Setting libopus up again would lose its settings. */
+      if (!enc->streams || enc->streams->stream_is_init || enc->opus_configured) {
+        ret = OPE_TOO_LATE;
+        break;
+      }
+      if (value && (enc->rate == 8000 || enc->rate == 12000 || enc->rate == 16000 || enc->rate == 24000)) {
+        opus_rate = enc->rate;
+      }
+      if (opus_rate != enc->opus_rate) ret = encoder_set_opus_rate(enc, opus_rate);
+      if (ret == OPE_OK) enc->native_rate = value;
+    }
+    break;
+    case OPE_GET_NATIVE_RATE_REQUEST:
+    {
+      opus_int32 *value = va_arg(ap, opus_int32*);
+      *value = enc->native_rate;
+    }
+    break;
     default:
       ret = OPUS_UNIMPLEMENTED;
   }
@@ -1149,12 +3987,13 @@ const char *ope_strerror(int error) {
     "invalid picture file",
     "invalid icon file (pictures of type 1 MUST be 32x32 PNGs)",
     "write failed",
-    "close failed"
+    "close failed",
+    "buffer full"
   };
   if (error == 0) return "success";
   else if (error >= -10) return "unknown error";
   else if (error > -30) return opus_strerror(error+10);
-  else if (error >= OPE_CLOSE_FAIL) return ope_error_strings[-error-30];
+  else if (error >= OPE_BUFFER_FULL) return ope_error_strings[-error-30];
   else return "unknown error";
 }
 
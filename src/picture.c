@@ -33,6 +33,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "picture.h"
+#include "opus_header.h"
 #include "unicode_support.h"
 
 static const char BASE64_TABLE[64]={
@@ -228,7 +229,7 @@ static void extract_jpeg_params(const unsigned char *data, size_t data_length,
 
 #define IMAX(a,b) ((a) > (b) ? (a) : (b))
 
-static unsigned char *opeint_read_picture_file(const char *filename, const char *description, int *error, size_t *size, size_t *offset) {
+static unsigned char *opeint_read_picture_file(const OpeAllocator *allocator, const char *filename, const char *description, int *error, size_t *size, size_t *offset) {
   FILE          *picture_file;
   size_t         cbuf;
   size_t         nbuf;
@@ -254,10 +255,10 @@ static unsigned char *opeint_read_picture_file(const char *filename, const char
   for(;;){
     unsigned char *new_buf;
     size_t         nread;
-    new_buf=realloc(buf,cbuf);
+    new_buf=opeint_realloc(allocator,buf,cbuf);
     if(new_buf==NULL){
       fclose(picture_file);
-      free(buf);
+      opeint_free(allocator,buf);
       *error = OPE_ALLOC_FAIL;
       return NULL;
     }
@@ -269,7 +270,7 @@ static unsigned char *opeint_read_picture_file(const char *filename, const char
       file_error=ferror(picture_file);
       fclose(picture_file);
       if(file_error){
-        free(buf);
+        opeint_free(allocator,buf);
         *error = OPE_INVALID_PICTURE;
         return NULL;
       }
@@ -277,7 +278,7 @@ static unsigned char *opeint_read_picture_file(const char *filename, const char
     }
     if(cbuf==0xFFFFFFFF){
       fclose(picture_file);
-      free(buf);
+      opeint_free(allocator,buf);
       *error = OPE_INVALID_PICTURE;
       return NULL;
     }
@@ -302,7 +303,7 @@ static int validate_picture_type(int picture_type, int seen_file_icons) {
    have already been added, to ensure only one is allowed.
   Return: A Base64-encoded string suitable for use in a METADATA_BLOCK_PICTURE
    tag.*/
-static char *opeint_parse_picture_specification_impl(unsigned char *buf, size_t nbuf, size_t data_offset, int picture_type, const char *description,
+static char *opeint_parse_picture_specification_impl(const OpeAllocator *allocator, unsigned char *buf, size_t nbuf, size_t data_offset, int picture_type, const char *description,
                                   int *error, int *seen_file_icons){
   opus_uint32  width;
   opus_uint32  height;
@@ -380,7 +381,7 @@ static char *opeint_parse_picture_specification_impl(unsigned char *buf, size_t
   WRITE_U32_BE(buf+data_offset,picture_type);
   data_length=nbuf-data_offset;
   b64_length=BASE64_LENGTH(data_length);
-  out=(char *)malloc(b64_length+1);
+  out=(char *)opeint_malloc(allocator, b64_length+1);
   if(out!=NULL){
     base64_encode(out,(char *)buf+data_offset,data_length);
     if(picture_type>=1&&picture_type<=2)*seen_file_icons|=picture_type;
@@ -390,7 +391,7 @@ static char *opeint_parse_picture_specification_impl(unsigned char *buf, size_t
   return out;
 }
 
-char *opeint_parse_picture_specification(const char *filename, int picture_type, const char *description,
+char *opeint_parse_picture_specification(const OpeAllocator *allocator, const char *filename, int picture_type, const char *description,
                                   int *error, int *seen_file_icons){
   size_t nbuf;
   size_t data_offset;
@@ -402,14 +403,14 @@ char *opeint_parse_picture_specification(const char *filename, int picture_type,
     return NULL;
   }
   if (description == NULL) description = "";
-  buf = opeint_read_picture_file(filename, description, error, &nbuf, &data_offset);
+  buf = opeint_read_picture_file(allocator, filename, description, error, &nbuf, &data_offset);
   if (buf == NULL) return NULL;
-  ret = opeint_parse_picture_specification_impl(buf, nbuf, data_offset, picture_type, description, error, seen_file_icons);
-  free(buf);
+  ret = opeint_parse_picture_specification_impl(allocator, buf, nbuf, data_offset, picture_type, description, error, seen_file_icons);
+  opeint_free(allocator, buf);
   return ret;
 }
 
-char *opeint_parse_picture_specification_from_memory(const char *mem, size_t size, int picture_type, const char *description,
+char *opeint_parse_picture_specification_from_memory(const OpeAllocator *allocator, const char *mem, size_t size, int picture_type, const char *description,
                                   int *error, int *seen_file_icons){
   size_t nbuf;
   size_t data_offset;
@@ -423,13 +424,13 @@ char *opeint_parse_picture_specification_from_memory(const char *mem, size_t siz
   if (description == NULL) description = "";
   data_offset=32+strlen(description)+10;
   nbuf = data_offset + size;
-  buf = (unsigned char *)malloc(nbuf);
+  buf = (unsigned char *)opeint_malloc(allocator, nbuf);
   if (buf == NULL) {
     *error = OPE_ALLOC_FAIL;
     return NULL;
   }
   memcpy(buf+data_offset, mem, size);
-  ret = opeint_parse_picture_specification_impl(buf, nbuf, data_offset, picture_type, description, error, seen_file_icons);
-  free(buf);
+  ret = opeint_parse_picture_specification_impl(allocator, buf, nbuf, data_offset, picture_type, description, error, seen_file_icons);
+  opeint_free(allocator, buf);
   return ret;
 }
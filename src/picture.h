@@ -39,10 +39,10 @@ typedef enum{
 
 #define BASE64_LENGTH(len) (((len)+2)/3*4)
 
-char *opeint_parse_picture_specification(const char *filename, int picture_type, const char *description,
+char *opeint_parse_picture_specification(const OpeAllocator *allocator, const char *filename, int picture_type, const char *description,
                                   int *error, int *seen_file_icons);
 
-char *opeint_parse_picture_specification_from_memory(const char *mem, size_t size, int picture_type, const char *description,
+char *opeint_parse_picture_specification_from_memory(const OpeAllocator *allocator, const char *mem, size_t size, int picture_type, const char *description,
                                   int *error, int *seen_file_icons);
 
 #define WRITE_U32_BE(buf, val) \
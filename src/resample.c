@@ -80,6 +80,7 @@ static void speex_free(void *ptr) {free(ptr);}
 
 #include <math.h>
 #include <limits.h>
+#include <string.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -104,6 +105,10 @@ static void speex_free(void *ptr) {free(ptr);}
 #include "resample_neon.h"
 #endif
 
+#if defined(RESAMPLE_AVX2) && !defined(FIXED_POINT)
+#include "resample_avx2.h"
+#endif
+
 /* Numer of elements to allocate on the stack */
 #ifdef VAR_ARRAYS
 #define FIXED_STACK_ALLOC 8192
@@ -111,7 +116,31 @@ static void speex_free(void *ptr) {free(ptr);}
 #define FIXED_STACK_ALLOC 1024
 #endif
 
+/* Largest direct sinc table (in elements) used with RESAMPLE_FULL_SINC_TABLE.
+   Ratios that would need more use the interpolating resampler. */
+#define FULL_SINC_TABLE_MAX 262144
+
+typedef struct sinc_table_entry sinc_table_entry;
+
 typedef int (*resampler_basic_func)(SpeexResamplerState *, spx_uint32_t , const spx_word16_t *, spx_uint32_t *, spx_word16_t *, spx_uint32_t *);
+/* Processes a range of channels at once, writing interleaved output. */
+typedef int (*resampler_multi_func)(SpeexResamplerState *, spx_uint32_t, spx_uint32_t, spx_uint32_t *, spx_word16_t *, spx_uint32_t *);
+
+#ifndef FIXED_POINT
+#define MAX_HALFBAND_STAGES 3
+#define HALFBAND_CHUNK 256
+
+typedef void (*halfband_func)(const float *, spx_uint32_t, const float *, const float *, spx_uint32_t, float *, int);
+
+typedef struct {
+   spx_uint32_t taps;       /* Non-zero taps on each side of the centre */
+   int          quality;
+   spx_uint32_t half_size;  /* Size of the even and odd sample memories */
+   float        *coef;
+   float        *mem;       /* Per channel: even samples, then odd samples */
+   spx_uint32_t *fill;      /* Per channel: samples in mem */
+} HalfbandStage;
+#endif
 
 struct SpeexResamplerState_ {
    spx_uint32_t in_rate;
@@ -137,12 +166,23 @@ struct SpeexResamplerState_ {
    spx_uint32_t *magic_samples;
 
    spx_word16_t *mem;
-   spx_word16_t *sinc_table;
-   spx_uint32_t sinc_table_length;
+   const spx_word16_t *sinc_table;
+   sinc_table_entry *sinc_entry;
    resampler_basic_func resampler_ptr;
+   resampler_multi_func resampler_multi_ptr;
 
    int    in_stride;
    int    out_stride;
+
+   SpeexResamplerAllocator allocator;
+
+#ifndef FIXED_POINT
+   /* Decimate by 2^nb_halfband before the filter above, which then only
+      handles what is left of the ratio. */
+   int    nb_halfband;
+   HalfbandStage halfband[MAX_HALFBAND_STAGES];
+   halfband_func halfband_filter;
+#endif
 } ;
 
 static const double kaiser12_table[68] = {
@@ -558,6 +598,184 @@ static int resampler_basic_interpolate_double(SpeexResamplerState *st, spx_uint3
 }
 #endif
 
+#if defined(RESAMPLE_AVX2) && !defined(FIXED_POINT)
+/* Same as resampler_basic_direct_single(), using AVX2/FMA. */
+static AVX2_TARGET int resampler_basic_direct_single_avx2(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_word16_t *in, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   int out_sample = 0;
+   int last_sample = st->last_sample[channel_index];
+   spx_uint32_t samp_frac_num = st->samp_frac_num[channel_index];
+   const spx_word16_t *sinc_table = st->sinc_table;
+   const int out_stride = st->out_stride;
+   const int int_advance = st->int_advance;
+   const int frac_advance = st->frac_advance;
+   const spx_uint32_t den_rate = st->den_rate;
+
+   while (!(last_sample >= (spx_int32_t)*in_len || out_sample >= (spx_int32_t)*out_len))
+   {
+      const spx_word16_t *sinct = & sinc_table[samp_frac_num*N];
+      const spx_word16_t *iptr = & in[last_sample];
+
+      out[out_stride * out_sample++] = inner_product_single_avx2(sinct, iptr, N);
+      last_sample += int_advance;
+      samp_frac_num += frac_advance;
+      if (samp_frac_num >= den_rate)
+      {
+         samp_frac_num -= den_rate;
+         last_sample++;
+      }
+   }
+
+   st->last_sample[channel_index] = last_sample;
+   st->samp_frac_num[channel_index] = samp_frac_num;
+   return out_sample;
+}
+
+/* Same as resampler_basic_interpolate_single(), using AVX2/FMA. */
+static AVX2_TARGET int resampler_basic_interpolate_single_avx2(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_word16_t *in, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   int out_sample = 0;
+   int last_sample = st->last_sample[channel_index];
+   spx_uint32_t samp_frac_num = st->samp_frac_num[channel_index];
+   const int out_stride = st->out_stride;
+   const int int_advance = st->int_advance;
+   const int frac_advance = st->frac_advance;
+   const spx_uint32_t den_rate = st->den_rate;
+
+   while (!(last_sample >= (spx_int32_t)*in_len || out_sample >= (spx_int32_t)*out_len))
+   {
+      const spx_word16_t *iptr = & in[last_sample];
+
+      const int offset = samp_frac_num*st->oversample/st->den_rate;
+      const spx_word16_t frac = ((float)((samp_frac_num*st->oversample) % st->den_rate))/st->den_rate;
+      spx_word16_t interp[4];
+
+      cubic_coef(frac, interp);
+      out[out_stride * out_sample++] = interpolate_product_single_avx2(iptr, st->sinc_table + st->oversample + 4 - offset - 2, N, st->oversample, interp);
+      last_sample += int_advance;
+      samp_frac_num += frac_advance;
+      if (samp_frac_num >= den_rate)
+      {
+         samp_frac_num -= den_rate;
+         last_sample++;
+      }
+   }
+
+   st->last_sample[channel_index] = last_sample;
+   st->samp_frac_num[channel_index] = samp_frac_num;
+   return out_sample;
+}
+#endif
+
+#ifndef FIXED_POINT
+#ifndef OVERRIDE_INNER_PRODUCT_SINGLE
+static inline float inner_product_single(const float *a, const float *b, unsigned int len)
+{
+   unsigned int j;
+   float sum = 0;
+   for(j=0;j<len;j++) sum += a[j]*b[j];
+   return sum;
+}
+#endif
+
+#ifndef OVERRIDE_INNER_PRODUCT_SINGLE_X4
+static inline void inner_product_single_x4(const float *a, const float *b, unsigned int stride, unsigned int len, float *out)
+{
+   int c;
+   for (c=0;c<4;c++)
+      out[c] = inner_product_single(a, b + c*stride, len);
+}
+#endif
+
+/* Same as resampler_basic_direct_single(), but computes every channel for each
+   output sample so that the filter phase is only computed once and the output is
+   written contiguously. The channels must all be at the same position. */
+static int resampler_multi_direct_single(SpeexResamplerState *st, spx_uint32_t first_channel, spx_uint32_t nb_channels, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   const int out_stride = st->out_stride;
+   const spx_uint32_t mem_stride = st->mem_alloc_size;
+   const spx_word16_t *mem = st->mem + first_channel*mem_stride;
+   int out_sample = 0;
+   int last_sample = st->last_sample[first_channel];
+   spx_uint32_t samp_frac_num = st->samp_frac_num[first_channel];
+   const spx_word16_t *sinc_table = st->sinc_table;
+   const int int_advance = st->int_advance;
+   const int frac_advance = st->frac_advance;
+   const spx_uint32_t den_rate = st->den_rate;
+
+   while (!(last_sample >= (spx_int32_t)*in_len || out_sample >= (spx_int32_t)*out_len))
+   {
+      const spx_word16_t *sinct = & sinc_table[samp_frac_num*N];
+      const spx_word16_t *iptr = & mem[last_sample];
+      spx_uint32_t c;
+
+      for (c=0;c+4<=nb_channels;c+=4)
+         inner_product_single_x4(sinct, iptr + c*mem_stride, mem_stride, N, out + c);
+      for (;c<nb_channels;c++)
+         out[c] = inner_product_single(sinct, iptr + c*mem_stride, N);
+      out += out_stride;
+      out_sample++;
+      last_sample += int_advance;
+      samp_frac_num += frac_advance;
+      if (samp_frac_num >= den_rate)
+      {
+         samp_frac_num -= den_rate;
+         last_sample++;
+      }
+   }
+
+   st->last_sample[first_channel] = last_sample;
+   st->samp_frac_num[first_channel] = samp_frac_num;
+   return out_sample;
+}
+
+#ifdef RESAMPLE_AVX2
+/* Same as resampler_multi_direct_single(), using AVX2/FMA. */
+static AVX2_TARGET int resampler_multi_direct_single_avx2(SpeexResamplerState *st, spx_uint32_t first_channel, spx_uint32_t nb_channels, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
+{
+   const int N = st->filt_len;
+   const int out_stride = st->out_stride;
+   const spx_uint32_t mem_stride = st->mem_alloc_size;
+   const spx_word16_t *mem = st->mem + first_channel*mem_stride;
+   int out_sample = 0;
+   int last_sample = st->last_sample[first_channel];
+   spx_uint32_t samp_frac_num = st->samp_frac_num[first_channel];
+   const spx_word16_t *sinc_table = st->sinc_table;
+   const int int_advance = st->int_advance;
+   const int frac_advance = st->frac_advance;
+   const spx_uint32_t den_rate = st->den_rate;
+
+   while (!(last_sample >= (spx_int32_t)*in_len || out_sample >= (spx_int32_t)*out_len))
+   {
+      const spx_word16_t *sinct = & sinc_table[samp_frac_num*N];
+      const spx_word16_t *iptr = & mem[last_sample];
+      spx_uint32_t c;
+
+      for (c=0;c+4<=nb_channels;c+=4)
+         inner_product_single_x4_avx2(sinct, iptr + c*mem_stride, mem_stride, N, out + c);
+      for (;c<nb_channels;c++)
+         out[c] = inner_product_single_avx2(sinct, iptr + c*mem_stride, N);
+      out += out_stride;
+      out_sample++;
+      last_sample += int_advance;
+      samp_frac_num += frac_advance;
+      if (samp_frac_num >= den_rate)
+      {
+         samp_frac_num -= den_rate;
+         last_sample++;
+      }
+   }
+
+   st->last_sample[first_channel] = last_sample;
+   st->samp_frac_num[first_channel] = samp_frac_num;
+   return out_sample;
+}
+#endif
+#endif
+
 /* This resampler is used to produce zero output in situations where memory
    for the filter could not be allocated.  The expected numbers of input and
    output samples are still processed so that callers failing to check error
@@ -594,14 +812,597 @@ static int multiply_frac(spx_uint32_t *result, spx_uint32_t value, spx_uint32_t
 {
    spx_uint32_t major = value / den;
    spx_uint32_t remain = value % den;
+   spx_uint32_t frac;
    /* TODO: Could use 64 bits operation to check for overflow. But only guaranteed in C99+ */
-   if (remain > UINT32_MAX / num || major > UINT32_MAX / num
-       || major * num > UINT32_MAX - remain * num / den)
+   if (major > UINT32_MAX / num)
       return RESAMPLER_ERR_OVERFLOW;
-   *result = remain * num / den + major * num;
+   /* remain*num/den is below num, so it always fits, but the product may not.
+      Large ratios (fractional rates) then lose a little precision. */
+   if (remain > UINT32_MAX / num)
+      frac = IMIN(num - 1, (spx_uint32_t)((double)remain * num / den));
+   else
+      frac = remain * num / den;
+   if (major * num > UINT32_MAX - frac)
+      return RESAMPLER_ERR_OVERFLOW;
+   *result = frac + major * num;
    return RESAMPLER_ERR_SUCCESS;
 }
 
+/* Filter tables depend only on the reduced rate ratio and the quality, so
+   resamplers with the same parameters share a single read-only copy. */
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+static pthread_mutex_t sinc_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define SINC_CACHE_LOCK() pthread_mutex_lock(&sinc_cache_mutex)
+#define SINC_CACHE_UNLOCK() pthread_mutex_unlock(&sinc_cache_mutex)
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+static SRWLOCK sinc_cache_lock = SRWLOCK_INIT;
+#define SINC_CACHE_LOCK() AcquireSRWLockExclusive(&sinc_cache_lock)
+#define SINC_CACHE_UNLOCK() ReleaseSRWLockExclusive(&sinc_cache_lock)
+#endif
+
+#ifdef SINC_CACHE_LOCK
+#define SINC_TABLE_CACHE
+/* Number of tables no longer in use that are kept around for reuse. */
+#define SINC_CACHE_MAX_UNUSED 8
+#endif
+
+/* The memory of each state comes from its allocator. The filter tables are
+   shared between states, so they always use speex_alloc(). */
+static void *state_alloc(const SpeexResamplerAllocator *a, size_t size)
+{
+   void *ptr;
+   if (!a->alloc)
+      return speex_alloc(size);
+   ptr = a->alloc(a->user_data, size);
+   if (ptr)
+      memset(ptr, 0, size);
+   return ptr;
+}
+
+static void *state_realloc(const SpeexResamplerAllocator *a, void *ptr, size_t size)
+{
+   if (!a->alloc)
+      return speex_realloc(ptr, size);
+   return a->realloc(a->user_data, ptr, size);
+}
+
+static void state_free(const SpeexResamplerAllocator *a, void *ptr)
+{
+   if (!a->alloc)
+      speex_free(ptr);
+   else if (ptr)
+      a->free(a->user_data, ptr);
+}
+
+struct sinc_table_entry {
+   spx_uint32_t num_rate;
+   spx_uint32_t den_rate;
+   int          quality;
+   int          refs;
+   spx_word16_t *table;
+   sinc_table_entry *next;
+};
+
+#ifdef SINC_TABLE_CACHE
+/* Most recently used first. */
+static sinc_table_entry *sinc_cache = NULL;
+
+static sinc_table_entry *sinc_cache_find(const SpeexResamplerState *st)
+{
+   sinc_table_entry **prev;
+   for (prev=&sinc_cache;*prev;prev=&(*prev)->next)
+   {
+      sinc_table_entry *e = *prev;
+      if (e->num_rate == st->num_rate && e->den_rate == st->den_rate && e->quality == st->quality)
+      {
+         *prev = e->next;
+         e->next = sinc_cache;
+         sinc_cache = e;
+         e->refs++;
+         return e;
+      }
+   }
+   return NULL;
+}
+#endif
+
+static void sinc_table_free(sinc_table_entry *e)
+{
+   speex_free(e->table);
+   speex_free(e);
+}
+
+static void sinc_table_fill(const SpeexResamplerState *st, spx_word16_t *table, int use_direct)
+{
+   if (use_direct)
+   {
+      spx_uint32_t i;
+      for (i=0;i<st->den_rate;i++)
+      {
+         spx_int32_t j;
+         for (j=0;j<st->filt_len;j++)
+         {
+            table[i*st->filt_len+j] = sinc(st->cutoff,((j-(spx_int32_t)st->filt_len/2+1)-((float)i)/st->den_rate), st->filt_len, quality_map[st->quality].window_func);
+         }
+      }
+   } else {
+      spx_int32_t i;
+      for (i=-4;i<(spx_int32_t)(st->oversample*st->filt_len+4);i++)
+         table[i+4] = sinc(st->cutoff,(i/(float)st->oversample - st->filt_len/2), st->filt_len, quality_map[st->quality].window_func);
+   }
+}
+
+/* Returns a referenced table for the current filter parameters of st,
+   computing it only if no other resampler holds one. */
+static sinc_table_entry *sinc_table_acquire(const SpeexResamplerState *st, spx_uint32_t length, int use_direct)
+{
+   sinc_table_entry *e;
+#ifdef SINC_TABLE_CACHE
+   sinc_table_entry *found;
+   SINC_CACHE_LOCK();
+   e = sinc_cache_find(st);
+   SINC_CACHE_UNLOCK();
+   if (e)
+      return e;
+#endif
+   e = (sinc_table_entry *)speex_alloc(sizeof(*e));
+   if (!e)
+      return NULL;
+   e->table = (spx_word16_t *)speex_alloc(length*sizeof(spx_word16_t));
+   if (!e->table)
+   {
+      speex_free(e);
+      return NULL;
+   }
+   e->num_rate = st->num_rate;
+   e->den_rate = st->den_rate;
+   e->quality = st->quality;
+   e->refs = 1;
+   e->next = NULL;
+   /* The table is computed without holding the lock, so another thread may
+      have added the same one in the meantime. */
+   sinc_table_fill(st, e->table, use_direct);
+#ifdef SINC_TABLE_CACHE
+   SINC_CACHE_LOCK();
+   found = sinc_cache_find(st);
+   if (!found)
+   {
+      e->next = sinc_cache;
+      sinc_cache = e;
+   }
+   SINC_CACHE_UNLOCK();
+   if (found)
+   {
+      sinc_table_free(e);
+      e = found;
+   }
+#endif
+   return e;
+}
+
+/* Adds a reference to a table returned by sinc_table_acquire(). */
+static void sinc_table_ref(sinc_table_entry *e)
+{
+#ifdef SINC_TABLE_CACHE
+   SINC_CACHE_LOCK();
+   e->refs++;
+   SINC_CACHE_UNLOCK();
+#else
+   /* Without a lock there are no threads either. */
+   e->refs++;
+#endif
+}
+
+static void sinc_table_release(sinc_table_entry *e)
+{
+#ifdef SINC_TABLE_CACHE
+   sinc_table_entry *evicted = NULL;
+   if (!e)
+      return;
+   SINC_CACHE_LOCK();
+   if (--e->refs == 0)
+   {
+      sinc_table_entry **prev;
+      int unused = 0;
+      prev = &sinc_cache;
+      while (*prev)
+      {
+         sinc_table_entry *curr = *prev;
+         if (curr->refs == 0 && ++unused > SINC_CACHE_MAX_UNUSED)
+         {
+            *prev = curr->next;
+            curr->next = evicted;
+            evicted = curr;
+         } else {
+            prev = &curr->next;
+         }
+      }
+   }
+   SINC_CACHE_UNLOCK();
+   while (evicted)
+   {
+      sinc_table_entry *next = evicted->next;
+      sinc_table_free(evicted);
+      evicted = next;
+   }
+#else
+   if (e && --e->refs == 0)
+      sinc_table_free(e);
+#endif
+}
+
+#if !defined(FIXED_POINT) && !defined(RESAMPLE_NO_STATIC_TABLES)
+/* Direct filter tables for the most common input rates, generated by
+   gen_resample_tables.c so that they cost nothing to set up. */
+struct StaticSincTable {
+   spx_uint32_t num_rate;
+   spx_uint32_t den_rate;
+   int          quality;
+   spx_uint32_t filt_len;
+   const float *table;
+};
+
+#include "resample_tables.h"
+
+static const spx_word16_t *static_sinc_table(const SpeexResamplerState *st)
+{
+   int i;
+   for (i=0;i<(int)(sizeof(static_sinc_tables)/sizeof(static_sinc_tables[0]));i++)
+   {
+      const struct StaticSincTable *t = &static_sinc_tables[i];
+      if (t->num_rate == st->num_rate && t->den_rate == st->den_rate
+          && t->quality == st->quality && t->filt_len == st->filt_len)
+         return t->table;
+   }
+   return NULL;
+}
+#else
+#define static_sinc_table(st) NULL
+#endif
+
+#ifndef FIXED_POINT
+/* Half-band decimators for input at 2, 4 or 8 times the output rate (or more).
+   Every other tap of a half-band filter is zero except the centre one, which is
+   0.5, so keeping even and odd input samples apart turns each output into one
+   contiguous inner product over the odd samples. Each stage is centred on its
+   output (no delay) and only holds back the future samples it still needs. */
+
+/* Computes nout outputs, the first centred on even[taps]. */
+static void halfband_filter_single(const float *coef, spx_uint32_t taps, const float *even, const float *odd,
+      spx_uint32_t nout, float *out, int out_stride)
+{
+   spx_uint32_t i;
+   float y[4];
+   for (i=0;i+4<=nout;i+=4)
+   {
+      int k;
+      inner_product_single_x4(coef, odd+i, 1, 2*taps, y);
+      for (k=0;k<4;k++)
+         out[(i+k)*out_stride] = .5f*even[taps+i+k] + y[k];
+   }
+   for (;i<nout;i++)
+      out[i*out_stride] = .5f*even[taps+i] + inner_product_single(coef, odd+i, 2*taps);
+}
+
+#ifdef RESAMPLE_AVX2
+static AVX2_TARGET void halfband_filter_single_avx2(const float *coef, spx_uint32_t taps, const float *even, const float *odd,
+      spx_uint32_t nout, float *out, int out_stride)
+{
+   spx_uint32_t i;
+   float y[4];
+   for (i=0;i+4<=nout;i+=4)
+   {
+      int k;
+      inner_product_single_x4_avx2(coef, odd+i, 1, 2*taps, y);
+      for (k=0;k<4;k++)
+         out[(i+k)*out_stride] = .5f*even[taps+i+k] + y[k];
+   }
+   for (;i<nout;i++)
+      out[i*out_stride] = .5f*even[taps+i] + inner_product_single_avx2(coef, odd+i, 2*taps);
+}
+#endif
+
+/* Stopband attenuation in dB for each quality, a little above what the
+   polyphase filter reaches with the same quality so that the stages never
+   let more aliasing through than it would. */
+static double halfband_attenuation(int quality)
+{
+   static const double attenuation[11] = {60, 70, 74, 92, 95, 116, 116, 117, 118, 134, 138};
+   return attenuation[quality];
+}
+
+/* Number of taps on each side of the centre needed to keep [0, passband] free
+   of aliasing when going from rate to rate/2. Rounded up to a multiple of 4 so
+   that the 2*taps long inner products work with the SIMD kernels. */
+static spx_uint32_t halfband_taps(int quality, double rate, double passband)
+{
+   double width = 2*M_PI*(rate/2 - 2*passband)/rate;
+   double len = (halfband_attenuation(quality) - 7.95)/(2.285*width) + 1;
+   spx_uint32_t taps = (spx_uint32_t)ceil((len + 1)/4);
+   return (taps + 3) & ~3U;
+}
+
+/* Kaiser window at x in [-1, 1], with the beta giving att dB of stopband
+   attenuation. The fixed windows of quality_map would cap the attenuation
+   however many taps are used. */
+static double halfband_window(double x, double att)
+{
+   double beta = 0.1102*(att - 8.7);
+   double y = beta*sqrt(1 - x*x);
+   double num = 1, den = 1;
+   double num_term = 1, den_term = 1;
+   int k;
+   /* I0(y)/I0(beta), from the power series of I0. */
+   for (k=1;k<50;k++)
+   {
+      num_term *= (y/(2*k))*(y/(2*k));
+      den_term *= (beta/(2*k))*(beta/(2*k));
+      num += num_term;
+      den += den_term;
+   }
+   return num/den;
+}
+
+/* Sets up a stage with room for at least min_fill samples, on top of what it
+   needs for itself. */
+static int halfband_init(HalfbandStage *hb, const SpeexResamplerAllocator *a, spx_uint32_t nb_channels, int quality,
+      double rate, double passband, spx_uint32_t min_fill)
+{
+   spx_uint32_t i;
+   double sum = 0;
+   hb->taps = halfband_taps(quality, rate, passband);
+   hb->quality = quality;
+   hb->half_size = (IMAX(4*hb->taps, min_fill + 1) + HALFBAND_CHUNK)/2 + 1;
+   hb->coef = (float *)state_alloc(a, 2*hb->taps*sizeof(float));
+   hb->mem = (float *)state_alloc(a, 2*hb->half_size*nb_channels*sizeof(float));
+   hb->fill = (spx_uint32_t *)state_alloc(a, nb_channels*sizeof(spx_uint32_t));
+   if (!hb->coef || !hb->mem || !hb->fill)
+      return RESAMPLER_ERR_ALLOC_FAILED;
+   /* coef[taps-1-i] and coef[taps+i] both apply to the odd samples at
+      distance 2*i+1 from the centre. */
+   for (i=0;i<hb->taps;i++)
+   {
+      double d = 2*i + 1;
+      double h = sin(M_PI*d/2)/(M_PI*d) * halfband_window(d/(2*hb->taps), halfband_attenuation(quality));
+      hb->coef[hb->taps-1-i] = hb->coef[hb->taps+i] = (float)h;
+      sum += 2*h;
+   }
+   /* Unity gain at DC, the centre tap providing the other half. */
+   for (i=0;i<2*hb->taps;i++)
+      hb->coef[i] = (float)(hb->coef[i]*0.5/sum);
+   for (i=0;i<nb_channels;i++)
+      hb->fill[i] = 2*hb->taps;
+   return RESAMPLER_ERR_SUCCESS;
+}
+
+static void halfband_destroy(HalfbandStage *hb, const SpeexResamplerAllocator *a)
+{
+   state_free(a, hb->coef);
+   state_free(a, hb->mem);
+   state_free(a, hb->fill);
+}
+
+static void halfband_reset(HalfbandStage *hb, spx_uint32_t nb_channels)
+{
+   spx_uint32_t i;
+   for (i=0;i<2*hb->half_size*nb_channels;i++)
+      hb->mem[i] = 0;
+   for (i=0;i<nb_channels;i++)
+      hb->fill[i] = 2*hb->taps;
+}
+
+/* Samples of channel c of a stage, in the order they came in. */
+#define HALFBAND_SAMPLE(hb, c, k) ((hb)->mem[2*(hb)->half_size*(c) + ((k)&1)*(hb)->half_size + ((k)>>1)])
+
+/* Number of samples from moves the other stage would hold for channel c: the
+   same samples from the centre of the next output on, with the history its own
+   filter needs before it. */
+static spx_uint32_t halfband_moved_fill(const HalfbandStage *from, spx_uint32_t c, spx_uint32_t taps)
+{
+   return from->fill[c] - 2*from->taps + 2*taps;
+}
+
+/* Moves the samples held by a stage into one with a different filter, keeping
+   the centre of the next output where it was. History the old stage did not
+   have is zeros, as at the start. */
+static void halfband_move(HalfbandStage *to, const HalfbandStage *from, spx_uint32_t nb_channels)
+{
+   spx_uint32_t c;
+   for (c=0;c<nb_channels;c++)
+   {
+      spx_uint32_t fill = halfband_moved_fill(from, c, to->taps);
+      spx_uint32_t k;
+      /* The shift is even, so even and odd samples stay apart. */
+      for (k=0;k<fill;k++)
+      {
+         spx_int32_t src = (spx_int32_t)k - 2*(spx_int32_t)to->taps + 2*(spx_int32_t)from->taps;
+         HALFBAND_SAMPLE(to, c, k) = src >= 0 ? HALFBAND_SAMPLE(from, c, src) : 0;
+      }
+      to->fill[c] = fill;
+   }
+}
+
+/* Sets up the stages for the overall ratio ratio_num/ratio_den. Stages whose
+   filter does not change keep their memory, so small rate adjustments do not
+   disturb the signal. A stage whose filter changes hands its samples over to
+   the new one. When stages are removed, which takes the ratio dropping by half
+   or more, the samples they held back (2*taps or fewer at their input rate,
+   about a millisecond at the default quality) are dropped, so the signal after
+   the change comes that much early. Entering or leaving the bypass (see
+   halfband_bypass()) does the same with the samples of the filter that
+   follows. libopusenc's granule positions are not affected, since it derives
+   them from the number of input samples, so the stream keeps its length and
+   the drain makes up for the missing output. On failure the previous stages
+   are left untouched. */
+static int halfband_configure(SpeexResamplerState *st, spx_uint32_t ratio_num, spx_uint32_t ratio_den, int quality)
+{
+   HalfbandStage stages[MAX_HALFBAND_STAGES];
+   int nb = 0;
+   int i;
+   /* Halve the rate for as long as it stays at or above the output rate. A
+      little below is fine too, so that adjusting the ratio slightly around an
+      exact power of two (clock drift) does not add and remove stages.
+      RESAMPLE_NO_HALFBAND leaves it all to the polyphase filter, for
+      comparing the two. */
+#ifndef RESAMPLE_NO_HALFBAND
+   while (nb < MAX_HALFBAND_STAGES && ratio_den <= (UINT32_MAX>>(nb+1))
+          && ratio_num >= (ratio_den<<(nb+1)) - (ratio_den<<(nb+1))/64)
+      nb++;
+#endif
+   for (i=0;i<nb;i++)
+   {
+      double rate = (double)ratio_num/(1<<i);
+      double passband = quality_map[quality].downsample_bandwidth*ratio_den/2.;
+      spx_uint32_t taps = halfband_taps(quality, rate, passband);
+      spx_uint32_t min_fill = 0;
+      spx_uint32_t c;
+      if (i < st->nb_halfband && st->halfband[i].quality == quality && st->halfband[i].taps == taps)
+      {
+         stages[i] = st->halfband[i];
+         st->halfband[i].coef = NULL;
+         st->halfband[i].mem = NULL;
+         st->halfband[i].fill = NULL;
+         continue;
+      }
+      if (i < st->nb_halfband)
+      {
+         for (c=0;c<st->nb_channels;c++)
+            min_fill = IMAX(min_fill, halfband_moved_fill(&st->halfband[i], c, taps));
+      }
+      if (halfband_init(&stages[i], &st->allocator, st->nb_channels, quality, rate, passband, min_fill) != RESAMPLER_ERR_SUCCESS)
+      {
+         int j;
+         for (j=0;j<=i;j++)
+         {
+            if (j < st->nb_halfband && !st->halfband[j].coef)
+               st->halfband[j] = stages[j];
+            else
+               halfband_destroy(&stages[j], &st->allocator);
+         }
+         return RESAMPLER_ERR_ALLOC_FAILED;
+      }
+      if (i < st->nb_halfband)
+         halfband_move(&stages[i], &st->halfband[i], st->nb_channels);
+   }
+   for (i=0;i<st->nb_halfband;i++)
+      halfband_destroy(&st->halfband[i], &st->allocator);
+   for (i=0;i<nb;i++)
+      st->halfband[i] = stages[i];
+   st->nb_halfband = nb;
+   return RESAMPLER_ERR_SUCCESS;
+}
+
+/* Feeds n (at most HALFBAND_CHUNK) samples to one stage and returns the number
+   of outputs written. */
+static spx_uint32_t halfband_stage_process(HalfbandStage *hb, halfband_func filter, spx_uint32_t channel_index,
+      const float *in, int in_stride, spx_uint32_t n, float *out, int out_stride)
+{
+   const spx_uint32_t taps = hb->taps;
+   float *even = hb->mem + 2*hb->half_size*channel_index;
+   float *odd = even + hb->half_size;
+   spx_uint32_t fill = hb->fill[channel_index];
+   spx_uint32_t nout;
+   spx_uint32_t i = 0;
+
+   if ((fill&1) && n)
+   {
+      odd[fill>>1] = in ? in[0] : 0;
+      fill++;
+      i++;
+   }
+   for (;i+1<n;i+=2,fill+=2)
+   {
+      even[fill>>1] = in ? in[i*in_stride] : 0;
+      odd[fill>>1] = in ? in[(i+1)*in_stride] : 0;
+   }
+   if (i<n)
+   {
+      even[fill>>1] = in ? in[i*in_stride] : 0;
+      fill++;
+   }
+   /* The output centred on even[taps+j] needs odd[j] to odd[j+2*taps-1]. */
+   nout = fill >= 4*taps ? (fill - 4*taps)/2 + 1 : 0;
+   if (nout)
+   {
+      filter(hb->coef, taps, even, odd, nout, out, out_stride);
+      for (i=0;i<(fill+1)/2-nout;i++)
+         even[i] = even[i+nout];
+      for (i=0;i<fill/2-nout;i++)
+         odd[i] = odd[i+nout];
+      fill -= 2*nout;
+   }
+   hb->fill[channel_index] = fill;
+   return nout;
+}
+
+/* Runs the input through all stages, taking no more input than can be
+   processed without writing more than *out_len samples. */
+static void halfband_process(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, int in_stride,
+      spx_uint32_t *in_len, float *out, int out_stride, spx_uint32_t *out_len)
+{
+   spx_uint32_t max_in = *out_len;
+   spx_uint32_t ilen, olen = 0;
+   int s;
+
+   for (s=st->nb_halfband-1;s>=0;s--)
+   {
+      const HalfbandStage *hb = &st->halfband[s];
+      /* A stage outputs at most m samples until it holds 4*taps + 2*m.
+         Huge output sizes are clamped, which only limits the input more. A
+         stage that was handed more than that by halfband_configure() takes
+         no input until the output has room. */
+      if (max_in > (UINT32_MAX>>2))
+         max_in = UINT32_MAX>>1;
+      else if (4*hb->taps - 1 + 2*max_in > hb->fill[channel_index])
+         max_in = 4*hb->taps - 1 + 2*max_in - hb->fill[channel_index];
+      else
+         max_in = 0;
+   }
+   ilen = IMIN(*in_len, max_in);
+   *in_len = ilen;
+   while (ilen)
+   {
+      float tmp[2][HALFBAND_CHUNK/2 + 1];
+      spx_uint32_t n = IMIN(ilen, HALFBAND_CHUNK);
+      const float *x = in;
+      int x_stride = in_stride;
+      spx_uint32_t xlen = n;
+      for (s=0;s<st->nb_halfband;s++)
+      {
+         float *y = s == st->nb_halfband-1 ? out + olen*out_stride : tmp[s&1];
+         int y_stride = s == st->nb_halfband-1 ? out_stride : 1;
+         xlen = halfband_stage_process(&st->halfband[s], st->halfband_filter, channel_index,
+               x, x_stride, xlen, y, y_stride);
+         x = y;
+         x_stride = y_stride;
+      }
+      olen += xlen;
+      ilen -= n;
+      if (in)
+         in += n*in_stride;
+   }
+   *out_len = olen;
+}
+
+/* Samples held back by the stages, in units of the input of the filter that follows. */
+static spx_uint32_t halfband_latency(const SpeexResamplerState *st)
+{
+   spx_uint32_t latency = 0;
+   int s;
+   for (s=0;s<st->nb_halfband;s++)
+      latency = (latency + 2*st->halfband[s].taps + 1)/2;
+   return latency;
+}
+
+static int halfband_bypass(const SpeexResamplerState *st)
+{
+   return st->nb_halfband && st->num_rate == st->den_rate;
+}
+#endif
+
 static int update_filter(SpeexResamplerState *st)
 {
    spx_uint32_t old_length = st->filt_len;
@@ -609,6 +1410,7 @@ static int update_filter(SpeexResamplerState *st)
    int use_direct;
    spx_uint32_t min_sinc_table_length;
    spx_uint32_t min_alloc_size;
+   const spx_word16_t *static_table;
 
    st->int_advance = st->num_rate/st->den_rate;
    st->frac_advance = st->num_rate%st->den_rate;
@@ -639,14 +1441,16 @@ static int update_filter(SpeexResamplerState *st)
    }
 
 #ifdef RESAMPLE_FULL_SINC_TABLE
-   use_direct = 1;
-   if (INT_MAX/sizeof(spx_word16_t)/st->den_rate < st->filt_len)
-      goto fail;
+   /* Fractional ratios (e.g. clock drift correction) can have a huge den_rate,
+      and would need a new multi-megabyte table on every adjustment. */
+   use_direct = st->den_rate <= FULL_SINC_TABLE_MAX/st->filt_len
+                || st->filt_len*st->den_rate <= st->filt_len*st->oversample+8;
 #else
    /* Choose the resampling type that requires the least amount of memory */
    use_direct = st->filt_len*st->den_rate <= st->filt_len*st->oversample+8
                 && INT_MAX/sizeof(spx_word16_t)/st->den_rate >= st->filt_len;
 #endif
+   st->resampler_multi_ptr = NULL;
    if (use_direct)
    {
       min_sinc_table_length = st->filt_len*st->den_rate;
@@ -656,44 +1460,53 @@ static int update_filter(SpeexResamplerState *st)
 
       min_sinc_table_length = st->filt_len*st->oversample+8;
    }
-   if (st->sinc_table_length < min_sinc_table_length)
+   static_table = use_direct ? static_sinc_table(st) : NULL;
+   if (static_table)
    {
-      spx_word16_t *sinc_table = (spx_word16_t *)speex_realloc(st->sinc_table,min_sinc_table_length*sizeof(spx_word16_t));
-      if (!sinc_table)
+      sinc_table_release(st->sinc_entry);
+      st->sinc_entry = NULL;
+      st->sinc_table = static_table;
+   } else if (!st->sinc_entry || st->sinc_entry->num_rate != st->num_rate
+       || st->sinc_entry->den_rate != st->den_rate || st->sinc_entry->quality != st->quality)
+   {
+      sinc_table_entry *entry = sinc_table_acquire(st, min_sinc_table_length, use_direct);
+      if (!entry)
          goto fail;
-
-      st->sinc_table = sinc_table;
-      st->sinc_table_length = min_sinc_table_length;
+      sinc_table_release(st->sinc_entry);
+      st->sinc_entry = entry;
+      st->sinc_table = entry->table;
    }
    if (use_direct)
    {
-      spx_uint32_t i;
-      for (i=0;i<st->den_rate;i++)
-      {
-         spx_int32_t j;
-         for (j=0;j<st->filt_len;j++)
-         {
-            st->sinc_table[i*st->filt_len+j] = sinc(st->cutoff,((j-(spx_int32_t)st->filt_len/2+1)-((float)i)/st->den_rate), st->filt_len, quality_map[st->quality].window_func);
-         }
-      }
 #ifdef FIXED_POINT
       st->resampler_ptr = resampler_basic_direct_single;
 #else
       if (st->quality>8)
          st->resampler_ptr = resampler_basic_direct_double;
+#ifdef RESAMPLE_AVX2
+      else if (resampler_cpu_has_avx2())
+      {
+         st->resampler_ptr = resampler_basic_direct_single_avx2;
+         st->resampler_multi_ptr = resampler_multi_direct_single_avx2;
+      }
+#endif
       else
+      {
          st->resampler_ptr = resampler_basic_direct_single;
+         st->resampler_multi_ptr = resampler_multi_direct_single;
+      }
 #endif
       /*fprintf (stderr, "resampler uses direct sinc table and normalised cutoff %f\n", cutoff);*/
    } else {
-      spx_int32_t i;
-      for (i=-4;i<(spx_int32_t)(st->oversample*st->filt_len+4);i++)
-         st->sinc_table[i+4] = sinc(st->cutoff,(i/(float)st->oversample - st->filt_len/2), st->filt_len, quality_map[st->quality].window_func);
 #ifdef FIXED_POINT
       st->resampler_ptr = resampler_basic_interpolate_single;
 #else
       if (st->quality>8)
          st->resampler_ptr = resampler_basic_interpolate_double;
+#ifdef RESAMPLE_AVX2
+      else if (resampler_cpu_has_avx2())
+         st->resampler_ptr = resampler_basic_interpolate_single_avx2;
+#endif
       else
          st->resampler_ptr = resampler_basic_interpolate_single;
 #endif
@@ -712,7 +1525,7 @@ static int update_filter(SpeexResamplerState *st)
       spx_word16_t *mem;
       if (INT_MAX/sizeof(spx_word16_t)/st->nb_channels < min_alloc_size)
           goto fail;
-      else if (!(mem = (spx_word16_t*)speex_realloc(st->mem, st->nb_channels*min_alloc_size * sizeof(*mem))))
+      else if (!(mem = (spx_word16_t*)state_realloc(&st->allocator, st->mem, st->nb_channels*min_alloc_size * sizeof(*mem))))
           goto fail;
 
       st->mem = mem;
@@ -784,6 +1597,7 @@ static int update_filter(SpeexResamplerState *st)
 
 fail:
    st->resampler_ptr = resampler_basic_zero;
+   st->resampler_multi_ptr = NULL;
    /* st->mem may still contain consumed input samples for the filter.
       Restore filt_len so that filt_len - 1 still points to the position after
       the last of these samples. */
@@ -798,22 +1612,32 @@ EXPORT SpeexResamplerState *speex_resampler_init(spx_uint32_t nb_channels, spx_u
 
 EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels, spx_uint32_t ratio_num, spx_uint32_t ratio_den, spx_uint32_t in_rate, spx_uint32_t out_rate, int quality, int *err)
 {
+   return speex_resampler_init_alloc(nb_channels, ratio_num, ratio_den, in_rate, out_rate, quality, NULL, err);
+}
+
+EXPORT SpeexResamplerState *speex_resampler_init_alloc(spx_uint32_t nb_channels, spx_uint32_t ratio_num, spx_uint32_t ratio_den, spx_uint32_t in_rate, spx_uint32_t out_rate, int quality, const SpeexResamplerAllocator *allocator, int *err)
+{
+   static const SpeexResamplerAllocator default_allocator = {NULL, NULL, NULL, NULL};
    SpeexResamplerState *st;
    int filter_err;
 
+   if (!allocator)
+      allocator = &default_allocator;
+
    if (nb_channels == 0 || ratio_num == 0 || ratio_den == 0 || quality > 10 || quality < 0)
    {
       if (err)
          *err = RESAMPLER_ERR_INVALID_ARG;
       return NULL;
    }
-   st = (SpeexResamplerState *)speex_alloc(sizeof(SpeexResamplerState));
+   st = (SpeexResamplerState *)state_alloc(allocator, sizeof(SpeexResamplerState));
    if (!st)
    {
       if (err)
          *err = RESAMPLER_ERR_ALLOC_FAILED;
       return NULL;
    }
+   st->allocator = *allocator;
    st->initialised = 0;
    st->started = 0;
    st->in_rate = 0;
@@ -821,11 +1645,16 @@ EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
    st->num_rate = 0;
    st->den_rate = 0;
    st->quality = -1;
-   st->sinc_table_length = 0;
+   st->sinc_table = 0;
+   st->sinc_entry = 0;
    st->mem_alloc_size = 0;
    st->filt_len = 0;
    st->mem = 0;
    st->resampler_ptr = 0;
+   st->resampler_multi_ptr = 0;
+#ifndef FIXED_POINT
+   st->nb_halfband = 0;
+#endif
 
    st->cutoff = 1.f;
    st->nb_channels = nb_channels;
@@ -835,15 +1664,24 @@ EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
    st->buffer_size = 160;
 
    /* Per channel data */
-   if (!(st->last_sample = (spx_int32_t*)speex_alloc(nb_channels*sizeof(spx_int32_t))))
+   if (!(st->last_sample = (spx_int32_t*)state_alloc(allocator, nb_channels*sizeof(spx_int32_t))))
       goto fail;
-   if (!(st->magic_samples = (spx_uint32_t*)speex_alloc(nb_channels*sizeof(spx_uint32_t))))
+   if (!(st->magic_samples = (spx_uint32_t*)state_alloc(allocator, nb_channels*sizeof(spx_uint32_t))))
       goto fail;
-   if (!(st->samp_frac_num = (spx_uint32_t*)speex_alloc(nb_channels*sizeof(spx_uint32_t))))
+   if (!(st->samp_frac_num = (spx_uint32_t*)state_alloc(allocator, nb_channels*sizeof(spx_uint32_t))))
       goto fail;
 
+#ifndef FIXED_POINT
+   st->halfband_filter = halfband_filter_single;
+#ifdef RESAMPLE_AVX2
+   if (resampler_cpu_has_avx2())
+      st->halfband_filter = halfband_filter_single_avx2;
+#endif
+#endif
+
    speex_resampler_set_quality(st, quality);
-   speex_resampler_set_rate_frac(st, ratio_num, ratio_den, in_rate, out_rate);
+   if (speex_resampler_set_rate_frac(st, ratio_num, ratio_den, in_rate, out_rate) != RESAMPLER_ERR_SUCCESS)
+      goto fail;
 
    filter_err = update_filter(st);
    if (filter_err == RESAMPLER_ERR_SUCCESS)
@@ -867,12 +1705,85 @@ fail:
 
 EXPORT void speex_resampler_destroy(SpeexResamplerState *st)
 {
-   speex_free(st->mem);
-   speex_free(st->sinc_table);
-   speex_free(st->last_sample);
-   speex_free(st->magic_samples);
-   speex_free(st->samp_frac_num);
-   speex_free(st);
+#ifndef FIXED_POINT
+   int i;
+   for (i=0;i<st->nb_halfband;i++)
+      halfband_destroy(&st->halfband[i], &st->allocator);
+#endif
+   state_free(&st->allocator, st->mem);
+   sinc_table_release(st->sinc_entry);
+   state_free(&st->allocator, st->last_sample);
+   state_free(&st->allocator, st->magic_samples);
+   state_free(&st->allocator, st->samp_frac_num);
+   state_free(&st->allocator, st);
+}
+
+EXPORT SpeexResamplerState *speex_resampler_copy(const SpeexResamplerState *src, int *err)
+{
+   SpeexResamplerState *st;
+   spx_uint32_t n = src->nb_channels;
+   spx_uint32_t j;
+#ifndef FIXED_POINT
+   int i;
+#endif
+
+   st = (SpeexResamplerState *)state_alloc(&src->allocator, sizeof(SpeexResamplerState));
+   if (!st)
+   {
+      if (err)
+         *err = RESAMPLER_ERR_ALLOC_FAILED;
+      return NULL;
+   }
+   *st = *src;
+   st->last_sample = (spx_int32_t*)state_alloc(&st->allocator, n*sizeof(spx_int32_t));
+   st->magic_samples = (spx_uint32_t*)state_alloc(&st->allocator, n*sizeof(spx_uint32_t));
+   st->samp_frac_num = (spx_uint32_t*)state_alloc(&st->allocator, n*sizeof(spx_uint32_t));
+   st->mem = (spx_word16_t*)state_alloc(&st->allocator, n*src->mem_alloc_size*sizeof(spx_word16_t));
+   /* The table is read-only, so both states can use it. */
+   if (st->sinc_entry)
+      sinc_table_ref(st->sinc_entry);
+#ifndef FIXED_POINT
+   for (i=0;i<src->nb_halfband;i++)
+   {
+      const HalfbandStage *hb = &src->halfband[i];
+      st->halfband[i].coef = (float *)state_alloc(&st->allocator, 2*hb->taps*sizeof(float));
+      st->halfband[i].mem = (float *)state_alloc(&st->allocator, 2*hb->half_size*n*sizeof(float));
+      st->halfband[i].fill = (spx_uint32_t *)state_alloc(&st->allocator, n*sizeof(spx_uint32_t));
+   }
+#endif
+   if (!st->last_sample || !st->magic_samples || !st->samp_frac_num || !st->mem)
+      goto fail;
+   for (j=0;j<n;j++)
+   {
+      st->last_sample[j] = src->last_sample[j];
+      st->magic_samples[j] = src->magic_samples[j];
+      st->samp_frac_num[j] = src->samp_frac_num[j];
+   }
+   for (j=0;j<n*src->mem_alloc_size;j++)
+      st->mem[j] = src->mem[j];
+#ifndef FIXED_POINT
+   for (i=0;i<src->nb_halfband;i++)
+   {
+      const HalfbandStage *hb = &src->halfband[i];
+      if (!st->halfband[i].coef || !st->halfband[i].mem || !st->halfband[i].fill)
+         goto fail;
+      for (j=0;j<2*hb->taps;j++)
+         st->halfband[i].coef[j] = hb->coef[j];
+      for (j=0;j<2*hb->half_size*n;j++)
+         st->halfband[i].mem[j] = hb->mem[j];
+      for (j=0;j<n;j++)
+         st->halfband[i].fill[j] = hb->fill[j];
+   }
+#endif
+   if (err)
+      *err = RESAMPLER_ERR_SUCCESS;
+   return st;
+
+fail:
+   speex_resampler_destroy(st);
+   if (err)
+      *err = RESAMPLER_ERR_ALLOC_FAILED;
+   return NULL;
 }
 
 static int speex_resampler_process_native(SpeexResamplerState *st, spx_uint32_t channel_index, spx_uint32_t *in_len, spx_word16_t *out, spx_uint32_t *out_len)
@@ -883,8 +1794,6 @@ static int speex_resampler_process_native(SpeexResamplerState *st, spx_uint32_t
    spx_word16_t *mem = st->mem + channel_index * st->mem_alloc_size;
    spx_uint32_t ilen;
 
-   st->started = 1;
-
    /* Call the right resampler through the function ptr */
    out_sample = st->resampler_ptr(st, channel_index, mem, in_len, out, out_len);
 
@@ -921,10 +1830,63 @@ static int speex_resampler_magic(SpeexResamplerState *st, spx_uint32_t channel_i
    return out_len;
 }
 
+#ifndef FIXED_POINT
+static int speex_resampler_process_halfband(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+{
+   spx_uint32_t ilen = *in_len;
+   spx_uint32_t olen = *out_len;
+   spx_word16_t *x = st->mem + channel_index * st->mem_alloc_size;
+   const int filt_offs = st->filt_len - 1;
+   const spx_uint32_t xlen = st->mem_alloc_size - filt_offs;
+   const int istride = st->in_stride;
+
+   while (ilen && olen)
+   {
+      spx_uint32_t ichunk = ilen;
+      spx_uint32_t ochunk = olen;
+      if (halfband_bypass(st))
+      {
+         /* Nothing is left for the filter, the stages write the output directly. */
+         halfband_process(st, channel_index, in, istride, &ichunk, out, st->out_stride, &ochunk);
+      } else {
+         spx_uint32_t dchunk = xlen;
+         spx_uint32_t consumed;
+         spx_uint32_t j;
+         if (st->magic_samples[channel_index])
+         {
+            olen -= speex_resampler_magic(st, channel_index, &out, olen);
+            if (st->magic_samples[channel_index])
+               break;
+            continue;
+         }
+         halfband_process(st, channel_index, in, istride, &ichunk, x + filt_offs, 1, &dchunk);
+         consumed = dchunk;
+         speex_resampler_process_native(st, channel_index, &consumed, out, &ochunk);
+         /* Whatever the filter could not take is kept as "magic" samples, since
+            the stages cannot give it back. */
+         for (j=0;j<dchunk-consumed;j++)
+            x[filt_offs+j] = x[filt_offs+consumed+j];
+         st->magic_samples[channel_index] = dchunk-consumed;
+      }
+      if (!ichunk && !ochunk)
+         break;
+      ilen -= ichunk;
+      olen -= ochunk;
+      out += ochunk * st->out_stride;
+      if (in)
+         in += ichunk * istride;
+   }
+   *in_len -= ilen;
+   *out_len -= olen;
+   return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
+}
+#endif
+
+/* Same as the public function below, without marking the resampler as started. */
 #ifdef FIXED_POINT
-EXPORT int speex_resampler_process_int(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_int16_t *in, spx_uint32_t *in_len, spx_int16_t *out, spx_uint32_t *out_len)
+static int speex_resampler_process_channel(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_int16_t *in, spx_uint32_t *in_len, spx_int16_t *out, spx_uint32_t *out_len)
 #else
-EXPORT int speex_resampler_process_float(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+static int speex_resampler_process_channel(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
 #endif
 {
    int j;
@@ -935,6 +1897,10 @@ EXPORT int speex_resampler_process_float(SpeexResamplerState *st, spx_uint32_t c
    const spx_uint32_t xlen = st->mem_alloc_size - filt_offs;
    const int istride = st->in_stride;
 
+#ifndef FIXED_POINT
+   if (st->nb_halfband)
+      return speex_resampler_process_halfband(st, channel_index, in, in_len, out, out_len);
+#endif
    if (st->magic_samples[channel_index])
       olen -= speex_resampler_magic(st, channel_index, &out, olen);
    if (! st->magic_samples[channel_index]) {
@@ -962,6 +1928,16 @@ EXPORT int speex_resampler_process_float(SpeexResamplerState *st, spx_uint32_t c
    return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
 }
 
+#ifdef FIXED_POINT
+EXPORT int speex_resampler_process_int(SpeexResamplerState *st, spx_uint32_t channel_index, const spx_int16_t *in, spx_uint32_t *in_len, spx_int16_t *out, spx_uint32_t *out_len)
+#else
+EXPORT int speex_resampler_process_float(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+#endif
+{
+   st->started = 1;
+   return speex_resampler_process_channel(st, channel_index, in, in_len, out, out_len);
+}
+
 #ifdef FIXED_POINT
 EXPORT int speex_resampler_process_float(SpeexResamplerState *st, spx_uint32_t channel_index, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
 #else
@@ -983,8 +1959,38 @@ EXPORT int speex_resampler_process_int(SpeexResamplerState *st, spx_uint32_t cha
    spx_word16_t ystack[FIXED_STACK_ALLOC];
 #endif
 
+   st->started = 1;
    st->out_stride = 1;
 
+#ifndef FIXED_POINT
+   if (st->nb_halfband)
+   {
+      /* Only the float path knows about the half-band stages. */
+      st->in_stride = 1;
+      while (ilen && olen) {
+         spx_word16_t xstack[HALFBAND_CHUNK];
+         spx_uint32_t ichunk = (ilen > HALFBAND_CHUNK) ? HALFBAND_CHUNK : ilen;
+         spx_uint32_t ochunk = (olen > ylen) ? ylen : olen;
+         for (j=0;j<ichunk;++j)
+            xstack[j] = in ? in[j*istride_save] : 0;
+         speex_resampler_process_halfband(st, channel_index, xstack, &ichunk, ystack, &ochunk);
+         for (j=0;j<ochunk;++j)
+            out[j*ostride_save] = WORD2INT(ystack[j]);
+         if (!ichunk && !ochunk)
+            break;
+         ilen -= ichunk;
+         olen -= ochunk;
+         out += ochunk * ostride_save;
+         if (in)
+            in += ichunk * istride_save;
+      }
+      st->in_stride = istride_save;
+      st->out_stride = ostride_save;
+      *in_len -= ilen;
+      *out_len -= olen;
+      return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
+   }
+#endif
    while (ilen && olen) {
      spx_word16_t *y = ystack;
      spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
@@ -1035,15 +2041,119 @@ EXPORT int speex_resampler_process_int(SpeexResamplerState *st, spx_uint32_t cha
    return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
 }
 
-EXPORT int speex_resampler_process_interleaved_float(SpeexResamplerState *st, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+#ifndef FIXED_POINT
+/* The multichannel kernels can only be used when all channels are at the same
+   position, which is the case unless channels were processed separately with
+   different lengths or the filter length changed. */
+static int channels_in_lockstep(SpeexResamplerState *st, spx_uint32_t first_channel, spx_uint32_t nb_channels)
+{
+   spx_uint32_t i;
+   const spx_uint32_t c0 = first_channel;
+   if (st->magic_samples[c0])
+      return 0;
+   for (i=c0+1;i<c0+nb_channels;i++)
+   {
+      if (st->last_sample[i] != st->last_sample[c0] || st->samp_frac_num[i] != st->samp_frac_num[c0]
+            || st->magic_samples[i])
+         return 0;
+   }
+   return 1;
+}
+
+static void speex_resampler_process_interleaved_multi(SpeexResamplerState *st, spx_uint32_t first_channel, spx_uint32_t nb_channels,
+      const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+{
+   spx_uint32_t i, j;
+   spx_uint32_t ilen = *in_len;
+   spx_uint32_t olen = *out_len;
+   const int istride = st->in_stride;
+   const int ostride = st->out_stride;
+   const int filt_offs = st->filt_len - 1;
+   const spx_uint32_t xlen = st->mem_alloc_size - filt_offs;
+   spx_word16_t *mem0 = st->mem + first_channel*st->mem_alloc_size;
+
+   while (ilen && olen) {
+      spx_uint32_t ichunk = (ilen > xlen) ? xlen : ilen;
+      spx_uint32_t ochunk = olen;
+      int last_sample;
+
+      /* Read the input sequentially, de-interleaving it into the per-channel memories. */
+      for (j=0;j<ichunk;j++)
+      {
+         for (i=0;i<nb_channels;i++)
+            mem0[i*st->mem_alloc_size + filt_offs + j] = in ? in[j*istride + i] : 0;
+      }
+      ochunk = st->resampler_multi_ptr(st, first_channel, nb_channels, &ichunk, out, &ochunk);
+
+      /* Same bookkeeping as speex_resampler_process_native(), for all channels. */
+      last_sample = st->last_sample[first_channel];
+      if (last_sample < (spx_int32_t)ichunk)
+         ichunk = last_sample;
+      last_sample -= ichunk;
+      for (i=first_channel;i<first_channel+nb_channels;i++)
+      {
+         spx_word16_t *mem = st->mem + i*st->mem_alloc_size;
+         st->last_sample[i] = last_sample;
+         st->samp_frac_num[i] = st->samp_frac_num[first_channel];
+         for (j=0;j<(spx_uint32_t)filt_offs;j++)
+            mem[j] = mem[j+ichunk];
+      }
+
+      ilen -= ichunk;
+      olen -= ochunk;
+      out += ochunk * ostride;
+      if (in)
+         in += ichunk * istride;
+   }
+   *in_len -= ilen;
+   *out_len -= olen;
+}
+
+EXPORT int speex_resampler_process_channels_float(SpeexResamplerState *st, spx_uint32_t first_channel, spx_uint32_t nb_channels,
+      const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
 {
    spx_uint32_t i;
+   spx_uint32_t bak_out_len = *out_len;
+   spx_uint32_t bak_in_len = *in_len;
+   /* Concurrent calls must not write the same fields, so only the one with
+      the first channel marks the resampler as started. */
+   if (first_channel == 0)
+      st->started = 1;
+   /* Below four channels, nothing is gained over processing them one by one. */
+   if (st->resampler_multi_ptr && nb_channels >= 4 && !st->nb_halfband && channels_in_lockstep(st, first_channel, nb_channels))
+   {
+      speex_resampler_process_interleaved_multi(st, first_channel, nb_channels, in, in_len, out, out_len);
+      return RESAMPLER_ERR_SUCCESS;
+   }
+   for (i=0;i<nb_channels;i++)
+   {
+      *out_len = bak_out_len;
+      *in_len = bak_in_len;
+      speex_resampler_process_channel(st, first_channel+i, in != NULL ? in+i : NULL, in_len, out+i, out_len);
+   }
+   return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
+}
+#endif
+
+EXPORT int speex_resampler_process_interleaved_float(SpeexResamplerState *st, const float *in, spx_uint32_t *in_len, float *out, spx_uint32_t *out_len)
+{
    int istride_save, ostride_save;
+#ifdef FIXED_POINT
+   spx_uint32_t i;
    spx_uint32_t bak_out_len = *out_len;
    spx_uint32_t bak_in_len = *in_len;
+#else
+   int ret;
+#endif
    istride_save = st->in_stride;
    ostride_save = st->out_stride;
    st->in_stride = st->out_stride = st->nb_channels;
+#ifndef FIXED_POINT
+   ret = speex_resampler_process_channels_float(st, 0, st->nb_channels, in, in_len, out, out_len);
+   st->in_stride = istride_save;
+   st->out_stride = ostride_save;
+   return ret;
+#else
    for (i=0;i<st->nb_channels;i++)
    {
       *out_len = bak_out_len;
@@ -1056,6 +2166,7 @@ EXPORT int speex_resampler_process_interleaved_float(SpeexResamplerState *st, co
    st->in_stride = istride_save;
    st->out_stride = ostride_save;
    return st->resampler_ptr == resampler_basic_zero ? RESAMPLER_ERR_ALLOC_FAILED : RESAMPLER_ERR_SUCCESS;
+#endif
 }
 
 EXPORT int speex_resampler_process_interleaved_int(SpeexResamplerState *st, const spx_int16_t *in, spx_uint32_t *in_len, spx_int16_t *out, spx_uint32_t *out_len)
@@ -1116,11 +2227,27 @@ EXPORT int speex_resampler_set_rate_frac(SpeexResamplerState *st, spx_uint32_t r
    if (st->in_rate == in_rate && st->out_rate == out_rate && st->num_rate == ratio_num && st->den_rate == ratio_den)
       return RESAMPLER_ERR_SUCCESS;
 
+#ifndef FIXED_POINT
+   if (halfband_configure(st, ratio_num, ratio_den, st->quality) != RESAMPLER_ERR_SUCCESS)
+      return RESAMPLER_ERR_ALLOC_FAILED;
+#endif
    old_den = st->den_rate;
    st->in_rate = in_rate;
    st->out_rate = out_rate;
    st->num_rate = ratio_num;
    st->den_rate = ratio_den;
+#ifndef FIXED_POINT
+   /* The half-band stages take care of a factor of 2^nb_halfband. */
+   if (st->nb_halfband)
+   {
+      if (st->num_rate % (1U<<st->nb_halfband) == 0)
+         st->num_rate >>= st->nb_halfband;
+      else if (st->den_rate <= (UINT32_MAX>>st->nb_halfband))
+         st->den_rate <<= st->nb_halfband;
+      else
+         return RESAMPLER_ERR_OVERFLOW;
+   }
+#endif
 
    fact = compute_gcd(st->num_rate, st->den_rate);
 
@@ -1148,6 +2275,17 @@ EXPORT void speex_resampler_get_ratio(SpeexResamplerState *st, spx_uint32_t *rat
 {
    *ratio_num = st->num_rate;
    *ratio_den = st->den_rate;
+#ifndef FIXED_POINT
+   {
+      int k = st->nb_halfband;
+      while (k && (*ratio_den&1) == 0)
+      {
+         *ratio_den >>= 1;
+         k--;
+      }
+      *ratio_num <<= k;
+   }
+#endif
 }
 
 EXPORT int speex_resampler_set_quality(SpeexResamplerState *st, int quality)
@@ -1156,6 +2294,15 @@ EXPORT int speex_resampler_set_quality(SpeexResamplerState *st, int quality)
       return RESAMPLER_ERR_INVALID_ARG;
    if (st->quality == quality)
       return RESAMPLER_ERR_SUCCESS;
+#ifndef FIXED_POINT
+   if (st->den_rate)
+   {
+      spx_uint32_t ratio_num, ratio_den;
+      speex_resampler_get_ratio(st, &ratio_num, &ratio_den);
+      if (halfband_configure(st, ratio_num, ratio_den, quality) != RESAMPLER_ERR_SUCCESS)
+         return RESAMPLER_ERR_ALLOC_FAILED;
+   }
+#endif
    st->quality = quality;
    if (st->initialised)
       return update_filter(st);
@@ -1189,12 +2336,21 @@ EXPORT void speex_resampler_get_output_stride(SpeexResamplerState *st, spx_uint3
 
 EXPORT int speex_resampler_get_input_latency(SpeexResamplerState *st)
 {
+#ifndef FIXED_POINT
+  if (st->nb_halfband)
+    return ((halfband_bypass(st) ? 0 : st->filt_len / 2) + halfband_latency(st)) << st->nb_halfband;
+#endif
   return st->filt_len / 2;
 }
 
 EXPORT int speex_resampler_get_output_latency(SpeexResamplerState *st)
 {
-  return ((st->filt_len / 2) * st->den_rate + (st->num_rate >> 1)) / st->num_rate;
+  spx_uint32_t latency = st->filt_len / 2;
+#ifndef FIXED_POINT
+  if (st->nb_halfband)
+    latency = (halfband_bypass(st) ? 0 : latency) + halfband_latency(st);
+#endif
+  return (latency * st->den_rate + (st->num_rate >> 1)) / st->num_rate;
 }
 
 EXPORT int speex_resampler_skip_zeros(SpeexResamplerState *st)
@@ -1214,8 +2370,12 @@ EXPORT int speex_resampler_reset_mem(SpeexResamplerState *st)
       st->magic_samples[i] = 0;
       st->samp_frac_num[i] = 0;
    }
-   for (i=0;i<st->nb_channels*(st->filt_len-1);i++)
+   for (i=0;i<st->nb_channels*st->mem_alloc_size;i++)
       st->mem[i] = 0;
+#ifndef FIXED_POINT
+   for (i=0;i<(spx_uint32_t)st->nb_halfband;i++)
+      halfband_reset(&st->halfband[i], st->nb_channels);
+#endif
    return RESAMPLER_ERR_SUCCESS;
 }
 
@@ -0,0 +1,138 @@
+/* Copyright (C) 2026 Xiph.Org Foundation
+ */
+/**
+   @file resample_avx2.h
+   @brief Resampler functions (AVX2/FMA version, selected at run time)
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <immintrin.h>
+
+/* These are compiled for AVX2/FMA regardless of the build flags, so they must
+   only be called when resampler_cpu_has_avx2() says so. */
+#define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+static int resampler_cpu_has_avx2(void)
+{
+   return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+static AVX2_TARGET float inner_product_single_avx2(const float *a, const float *b, unsigned int len)
+{
+   unsigned int i;
+   float ret;
+   __m256 sum0 = _mm256_setzero_ps();
+   __m256 sum1 = _mm256_setzero_ps();
+   __m128 sum;
+   /* len is a multiple of 8. */
+   for (i=0;i+16<=len;i+=16)
+   {
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i), sum0);
+      sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a+i+8), _mm256_loadu_ps(b+i+8), sum1);
+   }
+   if (i<len)
+      sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(a+i), _mm256_loadu_ps(b+i), sum0);
+   sum0 = _mm256_add_ps(sum0, sum1);
+   sum = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+   sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+   sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+   _mm_store_ss(&ret, sum);
+   return ret;
+}
+
+/* Inner products of a with b, b+stride, b+2*stride and b+3*stride, rounded exactly
+   like inner_product_single_avx2(). */
+static AVX2_TARGET void inner_product_single_x4_avx2(const float *a, const float *b, unsigned int stride, unsigned int len, float *out)
+{
+   unsigned int i;
+   const float *b0 = b;
+   const float *b1 = b+stride;
+   const float *b2 = b+2*stride;
+   const float *b3 = b+3*stride;
+   __m256 s0 = _mm256_setzero_ps(), t0 = _mm256_setzero_ps();
+   __m256 s1 = _mm256_setzero_ps(), t1 = _mm256_setzero_ps();
+   __m256 s2 = _mm256_setzero_ps(), t2 = _mm256_setzero_ps();
+   __m256 s3 = _mm256_setzero_ps(), t3 = _mm256_setzero_ps();
+   __m128 r0, r1, r2, r3;
+   for (i=0;i+16<=len;i+=16)
+   {
+      __m256 f0 = _mm256_loadu_ps(a+i);
+      __m256 f1 = _mm256_loadu_ps(a+i+8);
+      s0 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b0+i), s0);
+      t0 = _mm256_fmadd_ps(f1, _mm256_loadu_ps(b0+i+8), t0);
+      s1 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b1+i), s1);
+      t1 = _mm256_fmadd_ps(f1, _mm256_loadu_ps(b1+i+8), t1);
+      s2 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b2+i), s2);
+      t2 = _mm256_fmadd_ps(f1, _mm256_loadu_ps(b2+i+8), t2);
+      s3 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b3+i), s3);
+      t3 = _mm256_fmadd_ps(f1, _mm256_loadu_ps(b3+i+8), t3);
+   }
+   if (i<len)
+   {
+      __m256 f0 = _mm256_loadu_ps(a+i);
+      s0 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b0+i), s0);
+      s1 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b1+i), s1);
+      s2 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b2+i), s2);
+      s3 = _mm256_fmadd_ps(f0, _mm256_loadu_ps(b3+i), s3);
+   }
+   s0 = _mm256_add_ps(s0, t0);
+   s1 = _mm256_add_ps(s1, t1);
+   s2 = _mm256_add_ps(s2, t2);
+   s3 = _mm256_add_ps(s3, t3);
+   r0 = _mm_add_ps(_mm256_castps256_ps128(s0), _mm256_extractf128_ps(s0, 1));
+   r1 = _mm_add_ps(_mm256_castps256_ps128(s1), _mm256_extractf128_ps(s1, 1));
+   r2 = _mm_add_ps(_mm256_castps256_ps128(s2), _mm256_extractf128_ps(s2, 1));
+   r3 = _mm_add_ps(_mm256_castps256_ps128(s3), _mm256_extractf128_ps(s3, 1));
+   _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+   _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(r0, r2), _mm_add_ps(r1, r3)));
+}
+
+static AVX2_TARGET float interpolate_product_single_avx2(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+   unsigned int i;
+   float ret;
+   __m256 sum0 = _mm256_setzero_ps();
+   __m128 sum;
+   /* Two taps per iteration, one in each 128-bit lane. */
+   for (i=0;i<len;i+=2)
+   {
+      __m256 x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load1_ps(a+i)), _mm_load1_ps(a+i+1), 1);
+      __m256 y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(b+i*oversample)), _mm_loadu_ps(b+(i+1)*oversample), 1);
+      sum0 = _mm256_fmadd_ps(x, y, sum0);
+   }
+   sum = _mm_add_ps(_mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1));
+   /* The caller runs (non-VEX) cubic_coef() next, avoid the SSE/AVX transition penalty. */
+   _mm256_zeroupper();
+   sum = _mm_mul_ps(_mm_loadu_ps(frac), sum);
+   sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+   sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+   _mm_store_ss(&ret, sum);
+   return ret;
+}
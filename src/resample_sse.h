@@ -53,6 +53,33 @@ static inline float inner_product_single(const float *a, const float *b, unsigne
    return ret;
 }
 
+#define OVERRIDE_INNER_PRODUCT_SINGLE_X4
+/* Inner products of a with b, b+stride, b+2*stride and b+3*stride, rounded exactly
+   like inner_product_single(). */
+static inline void inner_product_single_x4(const float *a, const float *b, unsigned int stride, unsigned int len, float *out)
+{
+   int i;
+   __m128 s0 = _mm_setzero_ps();
+   __m128 s1 = _mm_setzero_ps();
+   __m128 s2 = _mm_setzero_ps();
+   __m128 s3 = _mm_setzero_ps();
+   for (i=0;i<len;i+=8)
+   {
+      __m128 f0 = _mm_loadu_ps(a+i);
+      __m128 f1 = _mm_loadu_ps(a+i+4);
+      s0 = _mm_add_ps(s0, _mm_mul_ps(f0, _mm_loadu_ps(b+i)));
+      s0 = _mm_add_ps(s0, _mm_mul_ps(f1, _mm_loadu_ps(b+i+4)));
+      s1 = _mm_add_ps(s1, _mm_mul_ps(f0, _mm_loadu_ps(b+stride+i)));
+      s1 = _mm_add_ps(s1, _mm_mul_ps(f1, _mm_loadu_ps(b+stride+i+4)));
+      s2 = _mm_add_ps(s2, _mm_mul_ps(f0, _mm_loadu_ps(b+2*stride+i)));
+      s2 = _mm_add_ps(s2, _mm_mul_ps(f1, _mm_loadu_ps(b+2*stride+i+4)));
+      s3 = _mm_add_ps(s3, _mm_mul_ps(f0, _mm_loadu_ps(b+3*stride+i)));
+      s3 = _mm_add_ps(s3, _mm_mul_ps(f1, _mm_loadu_ps(b+3*stride+i+4)));
+   }
+   _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+   _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(s0, s2), _mm_add_ps(s1, s3)));
+}
+
 #define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
 static inline float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac) {
   int i;
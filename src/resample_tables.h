@@ -0,0 +1,3210 @@
+/* Precomputed resampler filter tables.
+   Generated by gen_resample_tables.c, do not edit. */
+
+/* 44100 Hz -> 48000 Hz, quality 5 */
+static const float sinc_table_147_160_q5[12800] = {
+   6.77687831e-06f, -1.23543869e-05f, 1.85235822e-05f, -2.33608480e-05f,
+   2.35994758e-05f, -1.44313817e-05f, -1.05318086e-05f, 5.90686504e-05f,
+   -1.39845521e-04f, 2.61562411e-04f, -4.31742228e-04f, 6.55177573e-04f,
+   -9.32115770e-04f, 1.25633040e-03f, -1.61323010e-03f, 1.97831145e-03f,
+   -2.31586234e-03f, 2.57872208e-03f, -2.70878663e-03f, 2.63864640e-03f,
+   -2.29438581e-03f, 1.59944769e-03f, -4.79555980e-04f, -1.13165763e-03f,
+   3.28663224e-03f, -6.01805327e-03f, 9.33353789e-03f, -1.32112531e-02f,
+   1.75974835e-02f, -2.24056095e-02f, 2.75176652e-02f, -3.27879190e-02f,
+   3.80488709e-02f, -4.31189202e-02f, 4.78115790e-02f, -5.19451313e-02f,
+   5.53540327e-02f, -5.78975342e-02f, 5.94685562e-02f, 9.39999998e-01f,
+   5.94685562e-02f, -5.78975342e-02f, 5.53540327e-02f, -5.19451313e-02f,
+   4.78115790e-02f, -4.31189202e-02f, 3.80488709e-02f, -3.27879190e-02f,
+   2.75176652e-02f, -2.24056095e-02f, 1.75974835e-02f, -1.32112531e-02f,
+   9.33353789e-03f, -6.01805327e-03f, 3.28663224e-03f, -1.13165763e-03f,
+   -4.79555980e-04f, 1.59944769e-03f, -2.29438581e-03f, 2.63864640e-03f,
+   -2.70878663e-03f, 2.57872208e-03f, -2.31586234e-03f, 1.97831145e-03f,
+   -1.61323010e-03f, 1.25633040e-03f, -9.32115770e-04f, 6.55177573e-04f,
+   -4.31742228e-04f, 2.61562411e-04f, -1.39845521e-04f, 5.90686504e-05f,
+   -1.05318086e-05f, -1.44313817e-05f, 2.35994758e-05f, -2.33608480e-05f,
+   1.85235822e-05f, -1.23543869e-05f, 6.77687831e-06f, -2.68787448e-06f,
+   6.67209997e-06f, -1.21144731e-05f, 1.80453335e-05f, -2.25050881e-05f,
+   2.21960581e-05f, -1.22906185e-05f, -1.35875107e-05f, 6.31703006e-05f,
+   -1.45023499e-04f, 2.67668569e-04f, -4.38389310e-04f, 6.61653234e-04f,
+   -9.37306206e-04f, 1.25866709e-03f, -1.61066989e-03f, 1.96833652e-03f,
+   -2.29555881e-03f, 2.54490017e-03f, -2.65818113e-03f, 2.56816857e-03f,
+   -2.20153970e-03f, 1.48259732e-03f, -3.38428508e-04f, -1.29546784e-03f,
+   3.46922665e-03f, -6.21287571e-03f, 9.53073241e-03f, -1.33975185e-02f,
+   1.77554432e-02f, -2.25134827e-02f, 2.75485814e-02f, -3.27088051e-02f,
+   3.78183499e-02f, -4.26830277e-02f, 4.70946431e-02f, -5.08283973e-02f,
+   5.36171570e-02f, -5.50128818e-02f, 5.33693135e-02f, 9.39946413e-01f,
+   6.56245425e-02f, -6.07809350e-02f, 5.70796169e-02f, -5.30479327e-02f,
+   4.85141687e-02f, -4.35411446e-02f, 3.82669009e-02f, -3.28559913e-02f,
+   2.74772774e-02f, -2.22898778e-02f, 1.74331944e-02f, -1.30201029e-02f,
+   9.13272612e-03f, -5.82078239e-03f, 3.10251326e-03f, -9.67120926e-04f,
+   -6.20795880e-04f, 1.71600515e-03f, -2.38668406e-03f, 2.70836242e-03f,
+   -2.75858468e-03f, 2.61175516e-03f, -2.33542873e-03f, 1.98763283e-03f,
+   -1.61524466e-03f, 1.25355273e-03f, -9.26590932e-04f, 6.48456917e-04f,
+   -4.24920931e-04f, 2.55341351e-04f, -1.34600516e-04f, 5.49279684e-05f,
+   -7.45761690e-06f, -1.65769579e-05f, 2.50029825e-05f, -2.42134847e-05f,
+   1.89982420e-05f, -1.25918932e-05f, 6.88019509e-06f, -2.72469492e-06f,
+   6.56586417e-06f, -1.18718654e-05f, 1.75636596e-05f, -2.16465069e-05f,
+   2.07906796e-05f, -1.01553514e-05f, -1.66267200e-05f, 6.72370079e-05f,
+   -1.50129476e-04f, 2.73660378e-04f, -4.44864738e-04f, 6.67878485e-04f,
+   -9.42156359e-04f, 1.26056548e-03f, -1.60756533e-03f, 1.95771619e-03f,
+   -2.27452326e-03f, 2.51028081e-03f, -2.60677212e-03f, 2.49699946e-03f,
+   -2.10814923e-03f, 1.36545708e-03f, -1.97484173e-04f, -1.45849690e-03f,
+   3.65026691e-03f, -6.40515704e-03f, 9.72428732e-03f, -1.35788154e-02f,
+   1.79069787e-02f, -2.26134397e-02f, 2.75700297e-02f, -3.26187238e-02f,
+   3.75754833e-02f, -4.22337204e-02f, 4.63637039e-02f, -4.96981554e-02f,
+   5.18694669e-02f, -5.21276817e-02f, 4.73277792e-02f, 9.39785898e-01f,
+   7.18362480e-02f, -6.36621416e-02f, 5.87933473e-02f, -5.41364253e-02f,
+   4.92022559e-02f, -4.39495891e-02f, 3.84723730e-02f, -3.29129770e-02f,
+   2.74274182e-02f, -2.21662931e-02f, 1.72626451e-02f, -1.28241861e-02f,
+   8.92842747e-03f, -5.62119158e-03f, 2.91698962e-03f, -8.01939401e-04f,
+   -7.62145675e-04f, 1.83226645e-03f, -2.47834297e-03f, 2.77731242e-03f,
+   -2.80757295e-03f, 2.64396425e-03f, -2.35424004e-03f, 1.99629925e-03f,
+   -1.61670917e-03f, 1.25033781e-03f, -9.20729479e-04f, 6.41488587e-04f,
+   -4.17931820e-04f, 2.49011151e-04f, -1.29288455e-04f, 5.07494224e-05f,
+   -4.36592563e-06f, -1.87286987e-05f, 2.64061819e-05f, -2.50627818e-05f,
+   1.94699460e-05f, -1.28268957e-05f, 6.98200802e-06f, -2.76094488e-06f,
+   6.45829050e-06f, -1.16270867e-05f, 1.70796284e-05f, -2.07855428e-05f,
+   1.93865017e-05f, -8.02771683e-06f, -1.96454912e-05f, 7.12594629e-05f,
+   -1.55162226e-04f, 2.79536005e-04f, -4.51160537e-04f, 6.73851755e-04f,
+   -9.46668733e-04f, 1.26202730e-03f, -1.60392001e-03f, 1.94645813e-03f,
+   -2.25276407e-03f, 2.47491105e-03f, -2.55462946e-03f, 2.42514163e-03f,
+   -2.01424886e-03f, 1.24818110e-03f, -5.68164724e-05f, -1.62061176e-03f,
+   3.82972346e-03f, -6.59486838e-03f, 9.91417095e-03f, -1.37551501e-02f,
+   1.80521533e-02f, -2.27054954e-02f, 2.75820289e-02f, -3.25176902e-02f,
+   3.73203233e-02f, -4.17710729e-02f, 4.56190556e-02f, -4.85547334e-02f,
+   5.01118787e-02f, -4.92432080e-02f, 4.13448252e-02f, 9.39518511e-01f,
+   7.81029910e-02f, -6.65400401e-02f, 6.04944639e-02f, -5.52101023e-02f,
+   4.98755053e-02f, -4.43440489e-02f, 3.86651829e-02f, -3.29588428e-02f,
+   2.73680836e-02f, -2.20348593e-02f, 1.70858279e-02f, -1.26234321e-02f,
+   8.72063637e-03f, -5.41921426e-03f, 2.73006107e-03f, -6.36141573e-04f,
+   -9.03488311e-04f, 1.94807909e-03f, -2.56935856e-03f, 2.84547103e-03f,
+   -2.85568624e-03f, 2.67533818e-03f, -2.37229187e-03f, 2.00429792e-03f,
+   -1.61762291e-03f, 1.24668295e-03f, -9.14532982e-04f, 6.34281256e-04f,
+   -4.10776411e-04f, 2.42571652e-04f, -1.23910766e-04f, 4.65385456e-05f,
+   -1.26075849e-06f, -2.08837373e-05f, 2.78067873e-05f, -2.59082826e-05f,
+   1.99376464e-05f, -1.30588915e-05f, 7.08219477e-06f, -2.79655296e-06f,
+   6.34934713e-06f, -1.13800661e-05f, 1.65922775e-05f, -1.99218539e-05f,
+   1.79831022e-05f, -5.90703075e-06f, -2.26447992e-05f, 7.52444321e-05f,
+   -1.60125041e-04f, 2.85293674e-04f, -4.57281742e-04f, 6.79578166e-04f,
+   -9.50842281e-04f, 1.26305106e-03f, -1.59973348e-03f, 1.93455827e-03f,
+   -2.23028986e-03f, 2.43877270e-03f, -2.50170450e-03f, 2.35262094e-03f,
+   -1.91987050e-03f, 1.13065797e-03f, 8.36183244e-05f, -1.78191718e-03f,
+   4.00748011e-03f, -6.78195059e-03f, 1.01002641e-02f, -1.39263850e-02f,
+   1.81908607e-02f, -2.27896068e-02f, 2.75845975e-02f, -3.24058086e-02f,
+   3.70530672e-02f, -4.12953869e-02f, 4.48609851e-02f, -4.73987050e-02f,
+   4.83448096e-02f, -4.63600978e-02f, 3.54211926e-02f, 9.39144194e-01f,
+   8.44235793e-02f, -6.94138482e-02f, 6.21824749e-02f, -5.62686808e-02f,
+   5.05336411e-02f, -4.47243527e-02f, 3.88451964e-02f, -3.29935364e-02f,
+   2.72992700e-02f, -2.18956489e-02f, 1.69028770e-02f, -1.24180000e-02f,
+   8.50952230e-03f, -5.21501200e-03f, 2.54184939e-03f, -4.69782855e-04f,
+   -1.04486756e-03f, 2.06355168e-03f, -2.65969918e-03f, 2.91281333e-03f,
+   -2.90295156e-03f, 2.70589232e-03f, -2.38957675e-03f, 2.01163418e-03f,
+   -1.61798345e-03f, 1.24258862e-03f, -9.08002956e-04f, 6.26829220e-04f,
+   -4.03449842e-04f, 2.36024833e-04f, -1.18469114e-04f, 4.22910925e-05f,
+   1.86191915e-06f, -2.30428068e-05f, 2.92052137e-05f, -2.67502419e-05f,
+   2.04014923e-05f, -1.32882815e-05f, 7.18082083e-06f, -2.83151962e-06f,
+   6.23926462e-06f, -1.11309992e-05f, 1.61026837e-05f, -1.90574447e-05f,
+   1.65810088e-05f, -3.79605785e-06f, -2.56217991e-05f, 7.91827842e-05f,
+   -1.65011515e-04f, 2.90934142e-04f, -4.63226432e-04f, 6.85050618e-04f,
+   -9.54676245e-04f, 1.26363954e-03f, -1.59501226e-03f, 1.92203058e-03f,
+   -2.20711157e-03f, 2.40187813e-03f, -2.44806753e-03f, 2.27946509e-03f,
+   -1.82501716e-03f, 1.01304229e-03f, 2.23704337e-04f, -1.94228045e-03f,
+   4.18350799e-03f, -6.96637388e-03f, 1.02825733e-02f, -1.40925869e-02f,
+   1.83231048e-02f, -2.28657722e-02f, 2.75777504e-02f, -3.22830863e-02f,
+   3.67737673e-02f, -4.08068597e-02f, 4.40898500e-02f, -4.62305024e-02f,
+   4.65690233e-02f, -4.34795022e-02f, 2.95577291e-02f, 9.38663185e-01f,
+   9.07973051e-02f, -7.22825527e-02f, 6.38566315e-02f, -5.73115833e-02f,
+   5.11763543e-02f, -4.50903289e-02f, 3.90123613e-02f, -3.30170281e-02f,
+   2.72209700e-02f, -2.17486508e-02f, 1.67137235e-02f, -1.22078815e-02f,
+   8.29500984e-03f, -5.00858435e-03f, 2.35238695e-03f, -3.02892062e-04f,
+   -1.18616573e-03f, 2.17853207e-03f, -2.74933176e-03f, 2.97933491e-03f,
+   -2.94935075e-03f, 2.73558497e-03f, -2.40608747e-03f, 2.01830105e-03f,
+   -1.61778892e-03f, 1.23805564e-03f, -9.01137013e-04f, 6.19134225e-04f,
+   -3.95961280e-04f, 2.29372250e-04f, -1.12963382e-04f, 3.80125457e-05f,
+   4.99500311e-06f, -2.52037044e-05f, 3.06009024e-05f, -2.75872826e-05f,
+   2.08611636e-05f, -1.35145683e-05f, 7.27764291e-06f, -2.86580416e-06f,
+   6.12793656e-06f, -1.08799259e-05f, 1.56110254e-05f, -1.81910345e-05f,
+   1.51806862e-05f, -1.69344105e-06f, -2.85754995e-05f, 8.30773133e-05f,
+   -1.69823747e-04f, 2.96451588e-04f, -4.68989398e-04f, 6.90269517e-04f,
+   -9.58172197e-04f, 1.26379286e-03f, -1.58975739e-03f, 1.90887600e-03f,
+   -2.18323059e-03f, 2.36426527e-03f, -2.39372370e-03f, 2.20567570e-03f,
+   -1.72978360e-03f, 8.95336736e-04f, 3.63462575e-04f, -2.10164860e-03f,
+   4.35777940e-03f, -7.14805163e-03f, 1.04609821e-02f, -1.42536517e-02f,
+   1.84488147e-02f, -2.29339954e-02f, 2.75615063e-02f, -3.21496315e-02f,
+   3.64825688e-02f, -4.03056107e-02f, 4.33058254e-02f, -4.50505093e-02f,
+   4.47850823e-02f, -4.06021588e-02f, 2.37553827e-02f, 9.38075423e-01f,
+   9.72230136e-02f, -7.51452595e-02f, 6.55164421e-02f, -5.83384857e-02f,
+   5.18034771e-02f, -4.54418026e-02f, 3.91665697e-02f, -3.30292881e-02f,
+   2.71331985e-02f, -2.15939451e-02f, 1.65184792e-02f, -1.19932089e-02f,
+   8.07723589e-03f, -4.80003143e-03f, 2.16170424e-03f, -1.35552167e-04f,
+   -1.32738031e-03f, 2.29301723e-03f, -2.83825211e-03f, 3.04496964e-03f,
+   -2.99483538e-03f, 2.76442314e-03f, -2.42182007e-03f, 2.02429085e-03f,
+   -1.61703897e-03f, 1.23308075e-03f, -8.93942604e-04f, 6.11203548e-04f,
+   -3.88309971e-04f, 2.22613802e-04f, -1.07398788e-04f, 3.37029160e-05f,
+   8.14151099e-06f, -2.73656970e-05f, 3.19933679e-05f, -2.84191192e-05f,
+   2.13165658e-05f, -1.37377810e-05f, 7.37273922e-06f, -2.89938907e-06f,
+   6.01540250e-06f, -1.06268026e-05f, 1.51166159e-05f, -1.73228527e-05f,
+   1.37826064e-05f, 4.00124122e-07f, -3.15078651e-05f, 8.69306677e-05f,
+   -1.74556830e-04f, 3.01846914e-04f, -4.74572938e-04f, 6.95236202e-04f,
+   -9.61327518e-04f, 1.26351207e-03f, -1.58397225e-03f, 1.89510628e-03f,
+   -2.15867138e-03f, 2.32592691e-03f, -2.33867369e-03f, 2.13132775e-03f,
+   -1.63417286e-03f, 7.77543581e-04f, 5.02755167e-04f, -2.25994317e-03f,
+   4.53018164e-03f, -7.32689677e-03f, 1.06354691e-02f, -1.44095076e-02f,
+   1.85679812e-02f, -2.29942463e-02f, 2.75359023e-02f, -3.20055075e-02f,
+   3.61796245e-02f, -3.97919230e-02f, 4.25093397e-02f, -4.38591652e-02f,
+   4.29935418e-02f, -3.77289727e-02f, 1.80148482e-02f, 9.37381148e-01f,
+   1.03699781e-01f, -7.80008808e-02f, 6.71612248e-02f, -5.93490265e-02f,
+   5.24147078e-02f, -4.57786582e-02f, 3.93077582e-02f, -3.30302790e-02f,
+   2.70359851e-02f, -2.14315448e-02f, 1.63172297e-02f, -1.17740110e-02f,
+   7.85630383e-03f, -4.58948873e-03f, 1.96992606e-03f, 3.21258631e-05f,
+   -1.46843959e-03f, 2.40700296e-03f, -2.92637222e-03f, 3.10971308e-03f,
+   -3.03941732e-03f, 2.79237679e-03f, -2.43675732e-03f, 2.02960288e-03f,
+   -1.61572942e-03f, 1.22766988e-03f, -8.86418158e-04f, 6.03032939e-04f,
+   -3.80495680e-04f, 2.15755790e-04f, -1.01775324e-04f, 2.93621142e-05f,
+   1.13004126e-05f, -2.95301797e-05f, 3.33821372e-05f, -2.92469213e-05f,
+   2.17677807e-05f, -1.39578333e-05f, 7.46610658e-06f, -2.93225776e-06f,
+   5.90184891e-06f, -1.03722314e-05f, 1.46205475e-05f, -1.64543762e-05f,
+   1.23872769e-05f, 2.48259380e-06f, -3.44151777e-05f, 9.07340145e-05f,
+   -1.79209703e-04f, 3.07118520e-04f, -4.79970244e-04f, 6.99944852e-04f,
+   -9.64143255e-04f, 1.26279960e-03f, -1.57766358e-03f, 1.88073004e-03f,
+   -2.13343906e-03f, 2.28691217e-03f, -2.28299224e-03f, 2.05642381e-03f,
+   -1.53821870e-03f, 6.59817539e-04f, 6.41535793e-04f, -2.41711363e-03f,
+   4.70071565e-03f, -7.50288367e-03f, 1.08060073e-02f, -1.45601640e-02f,
+   1.86805949e-02f, -2.30465401e-02f, 2.75009479e-02f, -3.18507552e-02f,
+   3.58649902e-02f, -3.92658785e-02f, 4.17005047e-02f, -4.26568091e-02f,
+   4.11951765e-02f, -3.48610133e-02f, 1.23371519e-02f, 9.36580420e-01f,
+   1.10226601e-01f, -8.08484629e-02f, 6.87902942e-02f, -6.03427328e-02f,
+   5.30097857e-02f, -4.61007282e-02f, 3.94358374e-02f, -3.30199860e-02f,
+   2.69293301e-02f, -2.12614629e-02f, 1.61100049e-02f, -1.15503194e-02f,
+   7.63221178e-03f, -4.37688688e-03f, 1.77705381e-03f, 2.00194292e-04f,
+   -1.60924951e-03f, 2.52033980e-03f, -3.01368651e-03f, 3.17354058e-03f,
+   -3.08303675e-03f, 2.81943288e-03f, -2.45089736e-03f, 2.03423179e-03f,
+   -1.61386351e-03f, 1.22182281e-03f, -8.78564431e-04f, 5.94633806e-04f,
+   -3.72528390e-04f, 2.08798054e-04f, -9.60945763e-05f, 2.49957848e-05f,
+   1.44675814e-05f, -3.16942278e-05f, 3.47666355e-05f, -3.00688371e-05f,
+   2.22137423e-05f, -1.41745759e-05f, 7.55754672e-06f, -2.96436838e-06f,
+   5.78725439e-06f, -1.01156702e-05f, 1.41223927e-05f, -1.55853286e-05f,
+   1.09942530e-05f, 4.55396776e-06f, -3.72983050e-05f, 9.44925705e-05f,
+   -1.83785771e-04f, 3.12264805e-04f, -4.85185854e-04f, 7.04400591e-04f,
+   -9.66618943e-04f, 1.26165641e-03f, -1.57082861e-03f, 1.86574063e-03f,
+   -2.10754061e-03f, 2.24720035e-03f, -2.22662906e-03f, 1.98099017e-03f,
+   -1.44195417e-03f, 5.42084512e-04f, 7.79893249e-04f, -2.57318444e-03f,
+   4.86927107e-03f, -7.67595880e-03f, 1.09724952e-02f, -1.47055071e-02f,
+   1.87865924e-02f, -2.30908487e-02f, 2.74566915e-02f, -3.16855125e-02f,
+   3.55388969e-02f, -3.87278497e-02f, 4.08798866e-02f, -4.14440855e-02f,
+   3.93904671e-02f, -3.19989435e-02f, 6.72272546e-03f, 9.35673475e-01f,
+   1.16802454e-01f, -8.36871341e-02f, 7.04031736e-02f, -6.13192879e-02f,
+   5.35884649e-02f, -4.64078560e-02f, 3.95507365e-02f, -3.29983830e-02f,
+   2.68132482e-02f, -2.10837964e-02f, 1.58968624e-02f, -1.13222720e-02f,
+   7.40514044e-03f, -4.16239724e-03f, 1.58321415e-03f, 3.68514564e-04f,
+   -1.74985256e-03f, 2.63313320e-03f, -3.10016563e-03f, 3.23643046e-03f,
+   -3.12571810e-03f, 2.84560747e-03f, -2.46423436e-03f, 2.03817501e-03f,
+   -1.61143614e-03f, 1.21553335e-03f, -8.70384800e-04f, 5.85999689e-04f,
+   -3.64399399e-04f, 2.01742776e-04f, -9.03583641e-05f, 2.05996712e-05f,
+   1.76470785e-05f, -3.38585232e-05f, 3.61472885e-05f, -3.08850977e-05f,
+   2.26553966e-05f, -1.43880461e-05f, 7.64708511e-06f, -2.99572662e-06f,
+   5.67169855e-06f, -9.85772476e-06f, 1.36232620e-05f, -1.47160608e-05f,
+   9.60583111e-06f, 6.61358263e-06f, -4.01545803e-05f, 9.82015044e-05f,
+   -1.88278835e-04f, 3.17284925e-04f, -4.90218168e-04f, 7.08598061e-04f,
+   -9.68755863e-04f, 1.26008352e-03f, -1.56347733e-03f, 1.85015658e-03f,
+   -2.08098837e-03f, 2.20680726e-03f, -2.16965703e-03f, 1.90505525e-03f,
+   -1.34538219e-03f, 4.24384838e-04f, 9.17646044e-04f, -2.72805314e-03f,
+   5.03582228e-03f, -7.84609560e-03f, 1.11349346e-02f, -1.48455938e-02f,
+   1.88859850e-02f, -2.31272057e-02f, 2.74031535e-02f, -3.15097757e-02f,
+   3.52014080e-02f, -3.81779298e-02f, 4.00476046e-02f, -4.02213335e-02f,
+   3.75801139e-02f, -2.91438233e-02f, 1.17256027e-03f, 9.34660435e-01f,
+   1.23426318e-01f, -8.65159333e-02f, 7.19991177e-02f, -6.22782186e-02f,
+   5.41504584e-02f, -4.66998853e-02f, 3.96523774e-02f, -3.29654515e-02f,
+   2.66877394e-02f, -2.08985675e-02f, 1.56778228e-02f, -1.10898660e-02f,
+   7.17501249e-03f, -3.94602166e-03f, 1.38843979e-03f, 5.37084125e-04f,
+   -1.89013185e-03f, 2.74523441e-03f, -3.18577769e-03f, 3.29837576e-03f,
+   -3.16744414e-03f, 2.87086377e-03f, -2.47675972e-03f, 2.04143021e-03f,
+   -1.60844880e-03f, 1.20881048e-03f, -8.61877052e-04f, 5.77131868e-04f,
+   -3.56119650e-04f, 1.94591790e-04f, -8.45665927e-05f, 1.61794633e-05f,
+   2.08316815e-05f, -3.60202102e-05f, 3.75209020e-05f, -3.16953083e-05f,
+   2.30916885e-05f, -1.45977911e-05f, 7.73463853e-06f, -3.02625358e-06f,
+   5.55522411e-06f, -9.59849058e-06f, 1.31224451e-05f, -1.38468622e-05f,
+   8.22243692e-06f, 8.66077244e-06f, -4.29831198e-05f, 1.01859710e-04f,
+   -1.92691034e-04f, 3.22178879e-04f, -4.95062617e-04f, 7.12538778e-04f,
+   -9.70554247e-04f, 1.25808385e-03f, -1.55561056e-03f, 1.83397683e-03f,
+   -2.05378584e-03f, 2.16577202e-03f, -2.11208104e-03f, 1.82862068e-03f,
+   -1.24859845e-03f, 3.06834700e-04f, 1.05483783e-03f, -2.88166967e-03f,
+   5.20034367e-03f, -8.01321492e-03f, 1.12932250e-02f, -1.49803348e-02f,
+   1.89787224e-02f, -2.31555998e-02f, 2.73403749e-02f, -3.13236862e-02f,
+   3.48527208e-02f, -3.76163684e-02f, 3.92040350e-02f, -3.89889479e-02f,
+   3.57648209e-02f, -2.62965299e-02f, -4.31265775e-03f, 9.33541536e-01f,
+   1.30097210e-01f, -8.93337578e-02f, 7.35775903e-02f, -6.32192269e-02f,
+   5.46956174e-02f, -4.69767153e-02f, 3.97407003e-02f, -3.29211839e-02f,
+   2.65528448e-02f, -2.07057856e-02f, 1.54529894e-02f, -1.08532477e-02f,
+   6.94197556e-03f, -3.72789893e-03f, 1.19276380e-03f, 7.05818471e-04f,
+   -2.03008368e-03f, 2.85664015e-03f, -3.27051664e-03f, 3.35931568e-03f,
+   -3.20817204e-03f, 2.89519760e-03f, -2.48847157e-03f, 2.04399228e-03f,
+   -1.60490139e-03f, 1.20164931e-03f, -8.53048870e-04f, 5.68039657e-04f,
+   -3.47688183e-04f, 1.87344995e-04f, -7.87248500e-05f, 1.17351474e-05f,
+   2.40244099e-05f, -3.81805839e-05f, 3.88896042e-05f, -3.24991779e-05f,
+   2.35224616e-05f, -1.48040299e-05f, 7.82016741e-06f, -3.05595950e-06f,
+   5.43787610e-06f, -9.33758383e-06f, 1.26201112e-05f, -1.29780283e-05f,
+   6.84187989e-06f, 1.06962061e-05f, -4.57857568e-05f, 1.05471008e-04f,
+   -1.97017827e-04f, 3.26942158e-04f, -4.99722082e-04f, 7.16223032e-04f,
+   -9.72013513e-04f, 1.25565834e-03f, -1.54723111e-03f, 1.81721826e-03f,
+   -2.02595862e-03f, 2.12409929e-03f, -2.05390248e-03f, 1.75176293e-03f,
+   -1.15160551e-03f, 1.89397935e-04f, 1.19133387e-03f, -3.03395907e-03f,
+   5.36272954e-03f, -8.17723665e-03f, 1.14473486e-02f, -1.51096778e-02f,
+   1.90648008e-02f, -2.31760312e-02f, 2.72684190e-02f, -3.11273281e-02f,
+   3.44929174e-02f, -3.70434411e-02f, 3.83495651e-02f, -3.77474800e-02f,
+   3.39450613e-02f, -2.34577581e-02f, -9.73231159e-03f, 9.32317078e-01f,
+   1.36813939e-01f, -9.21396911e-02f, 7.51380399e-02f, -6.41418844e-02f,
+   5.52236177e-02f, -4.72381935e-02f, 3.98156457e-02f, -3.28655615e-02f,
+   2.64086388e-02f, -2.05055699e-02f, 1.52224619e-02f, -1.06124524e-02f,
+   6.70614140e-03f, -3.50806559e-03f, 9.96314804e-04f, 8.74605495e-04f,
+   -2.16963701e-03f, 2.96734506e-03f, -3.35429888e-03f, 3.41924583e-03f,
+   -3.24790902e-03f, 2.91860709e-03f, -2.49935617e-03f, 2.04586028e-03f,
+   -1.60079054e-03f, 1.19405589e-03f, -8.43900198e-04f, 5.58718340e-04f,
+   -3.39104881e-04f, 1.80009345e-04f, -7.28329978e-05f, 7.26673488e-06f,
+   2.72242014e-05f, -4.03389058e-05f, 4.02529076e-05f, -3.32964191e-05f,
+   2.39483306e-05f, -1.50066726e-05f, 7.90363356e-06f, -3.08484209e-06f,
+   5.31973092e-06f, -9.07561844e-06f, 1.21173798e-05f, -1.21098929e-05f,
+   5.46730689e-06f, 1.27152553e-05f, -4.85589771e-05f, 1.09027096e-04f,
+   -2.01258386e-04f, 3.31575749e-04f, -5.04190160e-04f, 7.19646632e-04f,
+   -9.73134825e-04f, 1.25281035e-03f, -1.53835118e-03f, 1.79988821e-03f,
+   -1.99751137e-03f, 2.08180444e-03f, -1.99519936e-03f, 1.67451077e-03f,
+   -1.05443737e-03f, 7.22285986e-05f, 1.32708950e-03f, -3.18487291e-03f,
+   5.52298035e-03f, -8.33813939e-03f, 1.15972860e-02f, -1.52336098e-02f,
+   1.91442166e-02f, -2.31885146e-02f, 2.71872878e-02f, -3.09207626e-02f,
+   3.41221765e-02f, -3.64592262e-02f, 3.74843106e-02f, -3.64972241e-02f,
+   3.21216099e-02f, -2.06285454e-02f, -1.50853638e-02f, 9.30987179e-01f,
+   1.43575490e-01f, -9.49327573e-02f, 7.66798109e-02f, -6.50457889e-02f,
+   5.57343587e-02f, -4.74841930e-02f, 3.98771577e-02f, -3.27985846e-02f,
+   2.62550600e-02f, -2.02979036e-02f, 1.49862738e-02f, -1.03675118e-02f,
+   6.46754773e-03f, -3.28655750e-03f, 7.99094967e-04f, 1.04349677e-03f,
+   -2.30869791e-03f, 3.07720387e-03f, -3.43709392e-03f, 3.47814313e-03f,
+   -3.28660477e-03f, 2.94106011e-03f, -2.50941142e-03f, 2.04703049e-03f,
+   -1.59612077e-03f, 1.18603278e-03f, -8.34432256e-04f, 5.49180724e-04f,
+   -3.30380688e-04f, 1.72584390e-04f, -6.68929497e-05f, 2.78004813e-06f,
+   3.04268615e-05f, -4.24929895e-05f, 4.16076546e-05f, -3.40866354e-05f,
+   2.43682734e-05f, -1.52052899e-05f, 7.98495330e-06f, -3.11281997e-06f,
+   5.20076219e-06f, -8.81251344e-06f, 1.16131914e-05f, -1.12421922e-05f,
+   4.09825543e-06f, 1.47225774e-05f, -5.13037048e-05f, 1.12532834e-04f,
+   -2.05415854e-04f, 3.36077763e-04f, -5.08470810e-04f, 7.22814759e-04f,
+   -9.73918359e-04f, 1.24954130e-03f, -1.52896601e-03f, 1.78197818e-03f,
+   -1.96845457e-03f, 2.03890260e-03f, -1.93591835e-03f, 1.59681553e-03f,
+   -9.57127253e-04f, -4.47478851e-05f, 1.46219193e-03f, -3.33443563e-03f,
+   5.68099506e-03f, -8.49587657e-03f, 1.17429448e-02f, -1.53520983e-02f,
+   1.92169305e-02f, -2.31930595e-02f, 2.70970650e-02f, -3.07041109e-02f,
+   3.37406509e-02f, -3.58641408e-02f, 3.66088673e-02f, -3.52388322e-02f,
+   3.02949399e-02f, -1.78096313e-02f, -2.03714520e-02f, 9.29552197e-01f,
+   1.50380805e-01f, -9.77119654e-02f, 7.82022998e-02f, -6.59306347e-02f,
+   5.62274903e-02f, -4.77145910e-02f, 3.99251841e-02f, -3.27202529e-02f,
+   2.60922089e-02f, -2.00829152e-02f, 1.47444922e-02f, -1.01185832e-02f,
+   6.22627046e-03f, -3.06351949e-03f, 6.01266336e-04f, 1.21235265e-03f,
+   -2.44730781e-03f, 3.18631902e-03f, -3.51894973e-03f, 3.53598595e-03f,
+   -3.32427979e-03f, 2.96257320e-03f, -2.51863291e-03f, 2.04750104e-03f,
+   -1.59088662e-03f, 1.17757241e-03f, -8.24647781e-04f, 5.39419707e-04f,
+   -3.21506348e-04f, 1.65072837e-04f, -6.09066046e-05f, -1.72780437e-06f,
+   3.36364647e-05f, -4.46434751e-05f, 4.29568208e-05f, -3.48700232e-05f,
+   2.47824155e-05f, -1.54002119e-05f, 8.06412845e-06f, -3.13992473e-06f,
+   5.08122548e-06f, -8.54840255e-06f, 1.11087120e-05f, -1.03768789e-05f,
+   2.73520209e-06f, 1.67135859e-05f, -5.40173423e-05f, 1.15984003e-04f,
+   -2.09484584e-04f, 3.40447528e-04f, -5.12563682e-04f, 7.25722464e-04f,
+   -9.74365801e-04f, 1.24585244e-03f, -1.51908107e-03f, 1.76351261e-03f,
+   -1.93879928e-03f, 1.99539796e-03f, -1.87613629e-03f, 1.51877967e-03f,
+   -8.59677501e-04f, -1.61491786e-04f, 1.59646419e-03f, -3.48254992e-03f,
+   5.83674945e-03f, -8.65042303e-03f, 1.18843056e-02f, -1.54651348e-02f,
+   1.92829538e-02f, -2.31896862e-02f, 2.69977674e-02f, -3.04774195e-02f,
+   3.33484933e-02f, -3.52582671e-02f, 3.57233584e-02f, -3.39726582e-02f,
+   2.84658223e-02f, -1.50020337e-02f, -2.55899001e-02f, 9.28012371e-01f,
+   1.57228753e-01f, -1.00476325e-01f, 7.97048435e-02f, -6.67959973e-02f,
+   5.67027964e-02f, -4.79292497e-02f, 3.99596691e-02f, -3.26305628e-02f,
+   2.59200744e-02f, -1.98606271e-02f, 1.44971497e-02f, -9.86566301e-03f,
+   5.98234683e-03f, -2.83895177e-03f, 4.02766687e-04f, 1.38117000e-03f,
+   -2.58535170e-03f, 3.29454546e-03f, -3.59975779e-03f, 3.59276845e-03f,
+   -3.36091570e-03f, 2.98311887e-03f, -2.52701342e-03f, 2.04727007e-03f,
+   -1.58509344e-03f, 1.16868468e-03f, -8.14549567e-04f, 5.29437151e-04f,
+   -3.12493677e-04f, 1.57476723e-04f, -5.48737953e-05f, -6.25534858e-06f,
+   3.68456604e-05f, -4.67875143e-05f, 4.42972560e-05f, -3.56452874e-05f,
+   2.51905076e-05f, -1.55909529e-05f, 8.14100167e-06f, -3.16608862e-06f,
+   4.96098392e-06f, -8.28337852e-06f, 1.06040707e-05f, -9.51261336e-06f,
+   1.37858558e-06f, 1.86876696e-05f, -5.66990711e-05f, 1.19379343e-04f,
+   -2.13466512e-04f, 3.44685715e-04f, -5.16464235e-04f, 7.28371844e-04f,
+   -9.74477560e-04f, 1.24174810e-03f, -1.50870706e-03f, 1.74448697e-03f,
+   -1.90854934e-03f, 1.95133244e-03f, -1.81585678e-03f, 1.44038175e-03f,
+   -7.62184383e-04f, -2.77887943e-04f, 1.72990630e-03f, -3.62916780e-03f,
+   5.99022023e-03f, -8.80170614e-03f, 1.20213553e-02f, -1.55726690e-02f,
+   1.93422548e-02f, -2.31784042e-02f, 2.68894807e-02f, -3.02408356e-02f,
+   3.29458937e-02f, -3.46419401e-02f, 3.48282456e-02f, -3.26991491e-02f,
+   2.66348049e-02f, -1.22064753e-02f, -3.07398401e-02f, 9.26368058e-01f,
+   1.64118305e-01f, -1.03224851e-01f, 8.11869279e-02f, -6.76415414e-02f,
+   5.71601428e-02f, -4.81280908e-02f, 3.99805792e-02f, -3.25295292e-02f,
+   2.57387161e-02f, -1.96310636e-02f, 1.42443590e-02f, -9.60891135e-03f,
+   5.73589420e-03f, -2.61300150e-03f, 2.03727031e-04f, 1.54986372e-03f,
+   -2.72282446e-03f, 3.40187922e-03f, -3.67953931e-03f, 3.64843430e-03f,
+   -3.39647778e-03f, 3.00269178e-03f, -2.53455108e-03f, 2.04633642e-03f,
+   -1.57873868e-03f, 1.15936599e-03f, -8.04135459e-04f, 5.19243302e-04f,
+   -3.03342065e-04f, 1.49795698e-04f, -4.88004989e-05f, -1.07981441e-05f,
+   4.00575154e-05f, -4.89263621e-05f, 4.56292910e-05f, -3.64121697e-05f,
+   2.55923933e-05f, -1.57775903e-05f, 8.21561116e-06f, -3.19129572e-06f,
+   4.84008069e-06f, -8.01753504e-06f, 1.00985271e-05f, -8.64968388e-06f,
+   2.88444522e-08f, 2.06481091e-05f, -5.93507575e-05f, 1.22722471e-04f,
+   -2.17357927e-04f, 3.48787871e-04f, -5.20174042e-04f, 7.30763073e-04f,
+   -9.74254159e-04f, 1.23723084e-03f, -1.49784202e-03f, 1.72492221e-03f,
+   -1.87773351e-03f, 1.90670975e-03f, -1.75508321e-03f, 1.36169815e-03f,
+   -6.64650346e-04f, -3.93972907e-04f, 1.86251779e-03f, -3.77421849e-03f,
+   6.14130916e-03f, -8.94963462e-03f, 1.21540083e-02f, -1.56746600e-02f,
+   1.93948392e-02f, -2.31592394e-02f, 2.67722458e-02f, -2.99944673e-02f,
+   3.25329490e-02f, -3.40152942e-02f, 3.39237228e-02f, -3.14187668e-02f,
+   2.48023551e-02f, -9.42361820e-03f, -3.58207412e-02f, 9.24619615e-01f,
+   1.71048120e-01f, -1.05956614e-01f, 8.26480165e-02f, -6.84669465e-02f,
+   5.75992502e-02f, -4.83109765e-02f, 3.99878696e-02f, -3.24171521e-02f,
+   2.55482476e-02f, -1.93943623e-02f, 1.39862355e-02f, -9.34836641e-03f,
+   5.48703317e-03f, -2.38570664e-03f, 4.24683503e-06f, 1.71832077e-03f,
+   -2.85965577e-03f, 3.50831519e-03f, -3.75821418e-03f, 3.70297977e-03f,
+   -3.43096978e-03f, 3.02129006e-03f, -2.54123705e-03f, 2.04469706e-03f,
+   -1.57182151e-03f, 1.14962400e-03f, -7.93416461e-04f, 5.08833560e-04f,
+   -2.94050900e-04f, 1.42037461e-04f, -4.26866063e-05f, -1.53576275e-05f,
+   4.32709567e-05f, -5.10592690e-05f, 4.69525912e-05f, -3.71716742e-05f,
+   2.59881162e-05f, -1.59600477e-05f, 8.28791508e-06f, -3.21555694e-06f,
+   4.71871181e-06f, -7.75100034e-06f, 9.59324643e-06f, -7.79003312e-06f,
+   -1.31357774e-06f, 2.25904205e-05f, -6.19690036e-05f, 1.26005936e-04f,
+   -2.21157767e-04f, 3.52755073e-04f, -5.23692113e-04f, 7.32893765e-04f,
+   -9.73698101e-04f, 1.23230310e-03f, -1.48650154e-03f, 1.70482602e-03f,
+   -1.84635608e-03f, 1.86154805e-03f, -1.69389462e-03f, 1.28275808e-03f,
+   -5.67108858e-04f, -5.09594625e-04f, 1.99412531e-03f, -3.91765684e-03f,
+   6.29001949e-03f, -9.09426063e-03f, 1.22822719e-02f, -1.57710984e-02f,
+   1.94407105e-02f, -2.31322106e-02f, 2.66461000e-02f, -2.97383778e-02f,
+   3.21098529e-02f, -3.33786160e-02f, 3.30101140e-02f, -3.01318504e-02f,
+   2.29693837e-02f, -6.65462110e-03f, -4.08318825e-02f, 9.22767341e-01f,
+   1.78017348e-01f, -1.08670458e-01f, 8.40874165e-02f, -6.92718029e-02f,
+   5.80200180e-02f, -4.84778434e-02f, 3.99815105e-02f, -3.22934426e-02f,
+   2.53485851e-02f, -1.91505142e-02f, 1.37228202e-02f, -9.08406824e-03f,
+   5.23580424e-03f, -2.15710513e-03f, -1.95671324e-04f, 1.88659248e-03f,
+   -2.99575366e-03f, 3.61371390e-03f, -3.83575354e-03f, 3.75638111e-03f,
+   -3.46434885e-03f, 3.03888763e-03f, -2.54706643e-03f, 2.04235129e-03f,
+   -1.56434998e-03f, 1.13946188e-03f, -7.82390765e-04f, 4.98221314e-04f,
+   -2.84632581e-04f, 1.34201691e-04f, -3.65341184e-05f, -1.99278402e-05f,
+   4.64816512e-05f, -5.31840597e-05f, 4.82664182e-05f, -3.79221128e-05f,
+   2.63768270e-05f, -1.61381049e-05f, 8.35778883e-06f, -3.23880408e-06f,
+   4.59684179e-06f, -7.48370167e-06f, 9.08802849e-06f, -6.93176389e-06f,
+   -2.64911637e-06f, 2.45152496e-05f, -6.45547334e-05f, 1.29234046e-04f,
+   -2.24868971e-04f, 3.56586184e-04f, -5.27017633e-04f, 7.34767818e-04f,
+   -9.72809095e-04f, 1.22696708e-03f, -1.47468108e-03f, 1.68418814e-03f,
+   -1.81442883e-03f, 1.81586156e-03f, -1.63223513e-03f, 1.20351266e-03f,
+   -4.69592895e-04f, -6.24827459e-04f, 2.12485809e-03f, -4.05950705e-03f,
+   6.43623201e-03f, -9.23546962e-03f, 1.24060679e-02f, -1.58619694e-02f,
+   1.94798503e-02f, -2.30973475e-02f, 2.65111458e-02f, -2.94727180e-02f,
+   3.16767767e-02f, -3.27321477e-02f, 3.20879780e-02f, -2.88390163e-02f,
+   2.11362839e-02f, -3.90001480e-03f, -4.57729660e-02f, 9.20811713e-01f,
+   1.85024559e-01f, -1.11365549e-01f, 8.55046511e-02f, -7.00558573e-02f,
+   5.84221110e-02f, -4.86285500e-02f, 3.99614684e-02f, -3.21584307e-02f,
+   2.51398720e-02f, -1.88996643e-02f, 1.34541895e-02f, -8.81618634e-03f,
+   4.98228706e-03f, -1.92734657e-03f, -3.95862444e-04f, 2.05453904e-03f,
+   -3.13113653e-03f, 3.71817150e-03f, -3.91220162e-03f, 3.80862039e-03f,
+   -3.49663175e-03f, 3.05549614e-03f, -2.55203946e-03f, 2.03929888e-03f,
+   -1.55631721e-03f, 1.12887088e-03f, -7.71061634e-04f, 4.87399695e-04f,
+   -2.75077327e-04f, 1.26290877e-04f, -3.03450433e-05f, -2.45116680e-05f,
+   4.96937428e-05f, -5.53013415e-05f, 4.95711574e-05f, -3.86637184e-05f,
+   2.67591968e-05f, -1.63118766e-05f, 8.42523605e-06f, -3.26103873e-06f,
+   4.47456932e-06f, -7.21607375e-06f, 8.58311796e-06f, -6.07681159e-06f,
+   -3.97474196e-06f, 2.64221180e-05f, -6.71055313e-05f, 1.32402958e-04f,
+   -2.28486853e-04f, 3.60280217e-04f, -5.30152000e-04f, 7.36381975e-04f,
+   -9.71589063e-04f, 1.22122548e-03f, -1.46238506e-03f, 1.66303653e-03f,
+   -1.78196328e-03f, 1.76965387e-03f, -1.57018634e-03f, 1.12406514e-03f,
+   -3.72136128e-04f, -7.39632640e-04f, 2.25454452e-03f, -4.19967668e-03f,
+   6.57999748e-03f, -9.37326625e-03f, 1.25253852e-02f, -1.59472600e-02f,
+   1.95122659e-02f, -2.30546668e-02f, 2.63674017e-02f, -2.91975569e-02f,
+   3.12339254e-02f, -3.20761353e-02f, 3.11574321e-02f, -2.75407191e-02f,
+   1.93038154e-02f, -1.16082653e-03f, -5.06431088e-02f, 9.18753028e-01f,
+   1.92068875e-01f, -1.14040837e-01f, 8.68990496e-02f, -7.08186477e-02f,
+   5.88054433e-02f, -4.87630144e-02f, 3.99277247e-02f, -3.20121385e-02f,
+   2.49220990e-02f, -1.86418500e-02f, 1.31803807e-02f, -8.54476169e-03f,
+   4.72652353e-03f, -1.69643294e-03f, -5.96388709e-04f, 2.22215638e-03f,
+   -3.26575548e-03f, 3.82154970e-03f, -3.98745714e-03f, 3.85967642e-03f,
+   -3.52780125e-03f, 3.07109510e-03f, -2.55614961e-03f, 2.03553564e-03f,
+   -1.54772424e-03f, 1.11786381e-03f, -7.59432442e-04f, 4.76370973e-04f,
+   -2.65397306e-04f, 1.18307580e-04f, -2.41193047e-05f, -2.91075921e-05f,
+   5.28998571e-05f, -5.74083060e-05f, 5.08639132e-05f, -3.93959745e-05f,
+   2.71343924e-05f, -1.64809298e-05f, 8.49017488e-06f, -3.28222086e-06f,
+   4.35191032e-06f, -6.94821028e-06f, 8.07867855e-06f, -5.22491155e-06f,
+   -5.29263571e-06f, 2.83103600e-05f, -6.96206480e-05f, 1.35511800e-04f,
+   -2.32012841e-04f, 3.63838160e-04f, -5.33091603e-04f, 7.37738039e-04f,
+   -9.70039866e-04f, 1.21508318e-03f, -1.44962699e-03f, 1.64137245e-03f,
+   -1.74896244e-03f, 1.72297179e-03f, -1.50774990e-03f, 1.04439328e-03f,
+   -2.74740130e-04f, -8.53896956e-04f, 2.38318555e-03f, -4.33809776e-03f,
+   6.72122464e-03f, -9.50758811e-03f, 1.26402117e-02f, -1.60269402e-02f,
+   1.95379630e-02f, -2.30042040e-02f, 2.62149815e-02f, -2.89130025e-02f,
+   3.07813976e-02f, -3.14108729e-02f, 3.02189607e-02f, -2.62373630e-02f,
+   1.74725093e-02f, 1.56226242e-03f, -5.54418489e-02f, 9.16591704e-01f,
+   1.99148893e-01f, -1.16695397e-01f, 8.82701427e-02f, -7.15599060e-02f,
+   5.91697916e-02f, -4.88811657e-02f, 3.98802496e-02f, -3.18545736e-02f,
+   2.46953480e-02f, -1.83770973e-02f, 1.29015194e-02f, -8.26983340e-03f,
+   4.46863752e-03f, -1.46451627e-03f, -7.97116896e-04f, 2.38933228e-03f,
+   -3.39954090e-03f, 3.92384408e-03f, -4.06153919e-03f, 3.90954269e-03f,
+   -3.55782849e-03f, 3.08567961e-03f, -2.55939271e-03f, 2.03106599e-03f,
+   -1.53857807e-03f, 1.10643625e-03f, -7.47501617e-04f, 4.65145655e-04f,
+   -2.55592488e-04f, 1.10251465e-04f, -1.78630398e-05f, -3.37110905e-05f,
+   5.61029301e-05f, -5.95061465e-05f, 5.21465081e-05f, -4.01187244e-05f,
+   2.75022776e-05f, -1.66454065e-05f, 8.55257076e-06f, -3.30233797e-06f,
+   4.22890980e-06f, -6.67973609e-06f, 7.57453927e-06f, -4.37634299e-06f,
+   -6.60236310e-06f, 3.01806285e-05f, -7.21018660e-05f, 1.38563671e-04f,
+   -2.35443833e-04f, 3.67256143e-04f, -5.35837724e-04f, 7.38837349e-04f,
+   -9.68162378e-04f, 1.20854331e-03f, -1.43640419e-03f, 1.61919883e-03f,
+   -1.71545998e-03f, 1.67581672e-03f, -1.44492916e-03f, 9.64574981e-04f,
+   -1.77501090e-04f, -9.67657077e-04f, 2.51078093e-03f, -4.47477354e-03f,
+   6.85984781e-03f, -9.63835139e-03f, 1.27504766e-02f, -1.61009785e-02f,
+   1.95569396e-02f, -2.29460020e-02f, 2.60539353e-02f, -2.86192466e-02f,
+   3.03194076e-02f, -3.07365097e-02f, 2.92727556e-02f, -2.49294024e-02f,
+   1.56428982e-02f, 4.26857732e-03f, -6.01686388e-02f, 9.14328277e-01f,
+   2.06263512e-01f, -1.19328111e-01f, 8.96173194e-02f, -7.22793415e-02f,
+   5.95149547e-02f, -4.89828996e-02f, 3.98190357e-02f, -3.16857770e-02f,
+   2.44597606e-02f, -1.81055684e-02f, 1.26177864e-02f, -7.99158029e-03f,
+   4.20875568e-03f, -1.23163580e-03f, -9.97946132e-04f, 2.55603576e-03f,
+   -3.53244529e-03f, 4.02504997e-03f, -4.13437234e-03f, 3.95816984e-03f,
+   -3.58671672e-03f, 3.09924479e-03f, -2.56176689e-03f, 2.02588621e-03f,
+   -1.52887451e-03f, 1.09459867e-03f, -7.35280395e-04f, 4.53723740e-04f,
+   -2.45662231e-04f, 1.02130558e-04f, -1.15762405e-05f, -3.83235165e-05f,
+   5.93019904e-05f, -6.15941244e-05f, 5.34184583e-05f, -4.08317028e-05f,
+   2.78632451e-05f, -1.68052920e-05f, 8.61239005e-06f, -3.32136801e-06f,
+   4.10566236e-06f, -6.41124143e-06f, 7.07185973e-06f, -3.53139785e-06f,
+   -7.90180366e-06f, 3.20287400e-05f, -7.45460420e-05f, 1.41551776e-04f,
+   -2.38778943e-04f, 3.70535301e-04f, -5.38390712e-04f, 7.39678100e-04f,
+   -9.65959451e-04f, 1.20160868e-03f, -1.42273528e-03f, 1.59654592e-03f,
+   -1.68145797e-03f, 1.62820739e-03f, -1.38180610e-03f, 8.84639041e-04f,
+   -8.04204901e-05f, -1.08076422e-03f, 2.63716490e-03f, -4.60959459e-03f,
+   6.99586887e-03f, -9.76560637e-03f, 1.28561892e-02f, -1.61693785e-02f,
+   1.95692070e-02f, -2.28800885e-02f, 2.58843061e-02f, -2.83163339e-02f,
+   2.98481341e-02f, -3.00533455e-02f, 2.83192303e-02f, -2.36171875e-02f,
+   1.38157308e-02f, 6.95723202e-03f, -6.48229495e-02f, 9.11963165e-01f,
+   2.13411540e-01f, -1.21937998e-01f, 9.09399614e-02f, -7.29765669e-02f,
+   5.98408394e-02f, -4.90681678e-02f, 3.97440568e-02f, -3.15057784e-02f,
+   2.42152419e-02f, -1.78272575e-02f, 1.23290839e-02f, -7.71000003e-03f,
+   3.94692039e-03f, -9.97831696e-04f, -1.19884068e-03f, 2.72223586e-03f,
+   -3.66437901e-03f, 4.12503257e-03f, -4.20592912e-03f, 4.00555274e-03f,
+   -3.61442589e-03f, 3.11177457e-03f, -2.56326725e-03f, 2.01999722e-03f,
+   -1.51862542e-03f, 1.08235318e-03f, -7.22768251e-04f, 4.42107994e-04f,
+   -2.35619736e-04f, 9.39473466e-05f, -5.26096755e-06f, -4.29388965e-05f,
+   6.24926761e-05f, -6.36700788e-05f, 5.46769406e-05f, -4.15343784e-05f,
+   2.82165111e-05f, -1.69601899e-05f, 8.66955270e-06f, -3.33927755e-06f,
+   3.98210295e-06f, -6.14265173e-06f, 6.56954307e-06f, -2.68980375e-06f,
+   -9.19139893e-06f, 3.38589671e-05f, -7.69540420e-05f, 1.44480378e-04f,
+   -2.42020833e-04f, 3.73674819e-04f, -5.40749112e-04f, 7.40262796e-04f,
+   -9.63431376e-04f, 1.19428232e-03f, -1.40861422e-03f, 1.57339312e-03f,
+   -1.64696877e-03f, 1.58016069e-03f, -1.31832238e-03f, 8.04535463e-04f,
+   1.64688590e-05f, -1.19329186e-03f, 2.76246201e-03f, -4.74260421e-03f,
+   7.12918071e-03f, -9.88925248e-03f, 1.29572889e-02f, -1.62321273e-02f,
+   1.95747707e-02f, -2.28065010e-02f, 2.57062241e-02f, -2.80044414e-02f,
+   2.93677561e-02f, -2.93616354e-02f, 2.73587313e-02f, -2.23013852e-02f,
+   1.19914608e-02f, 9.62746236e-03f, -6.94042742e-02f, 9.09496844e-01f,
+   2.20591754e-01f, -1.24524221e-01f, 9.22376290e-02f, -7.36513287e-02f,
+   6.01471700e-02f, -4.91368696e-02f, 3.96553278e-02f, -3.13146189e-02f,
+   2.39619780e-02f, -1.75423827e-02f, 1.20356372e-02f, -7.42527284e-03f,
+   3.68321780e-03f, -7.63257907e-04f, -1.39973173e-03f, 2.88782013e-03f,
+   -3.79535905e-03f, 4.22385242e-03f, -4.27625189e-03f, 4.05167369e-03f,
+   -3.64097347e-03f, 3.12327524e-03f, -2.56389217e-03f, 2.01339973e-03f,
+   -1.50782196e-03f, 1.06969161e-03f, -7.09969027e-04f, 4.30302083e-04f,
+   -2.25454714e-04f, 8.56963452e-05f, 1.08067513e-06f, -4.75601009e-05f,
+   6.56789634e-05f, -6.57346463e-05f, 5.59244763e-05f, -4.22270787e-05f,
+   2.85621427e-05f, -1.71103129e-05f, 8.72406599e-06f, -3.35605910e-06f,
+   3.85852309e-06f, -5.87408613e-06f, 6.06871436e-06f, -1.85347051e-06f,
+   -1.04707642e-05f, 3.56671844e-05f, -7.93236613e-05f, 1.47345767e-04f,
+   -2.45165487e-04f, 3.76673881e-04f, -5.42914378e-04f, 7.40591262e-04f,
+   -9.60580655e-04f, 1.18656899e-03f, -1.39404589e-03f, 1.54977152e-03f,
+   -1.61200669e-03f, 1.53167802e-03f, -1.25456182e-03f, 7.24369078e-04f,
+   1.13134207e-04f, -1.30520249e-03f, 2.88650766e-03f, -4.87371907e-03f,
+   7.25983223e-03f, -1.00092962e-02f, 1.30537646e-02f, -1.62892193e-02f,
+   1.95736438e-02f, -2.27252692e-02f, 2.55197100e-02f, -2.76836380e-02f,
+   2.88784988e-02f, -2.86616944e-02f, 2.63916031e-02f, -2.09823474e-02f,
+   1.01707550e-02f, 1.22784050e-02f, -7.39121288e-02f, 9.06929791e-01f,
+   2.27803022e-01f, -1.27085626e-01f, 9.35096666e-02f, -7.43032694e-02f,
+   6.04338646e-02f, -4.91889566e-02f, 3.95528302e-02f, -3.11123505e-02f,
+   2.36999504e-02f, -1.72508396e-02f, 1.17374454e-02f, -7.13744573e-03f,
+   3.41769145e-03f, -5.27955301e-04f, -1.60058297e-03f, 3.05278483e-03f,
+   -3.92533746e-03f, 4.32147225e-03f, -4.34524426e-03f, 4.09651315e-03f,
+   -3.66634387e-03f, 3.13372980e-03f, -2.56364024e-03f, 2.00608955e-03f,
+   -1.49646634e-03f, 1.05662947e-03f, -6.96885516e-04f, 4.18305543e-04f,
+   -2.15180189e-04f, 7.73883876e-05f, 7.44866838e-06f, -5.21854708e-05f,
+   6.88536529e-05f, -6.77849093e-05f, 5.71582787e-05f, -4.29081592e-05f,
+   2.88998981e-05f, -1.72553464e-05f, 8.77578168e-06f, -3.37167216e-06f,
+   3.73476519e-06f, -5.60563467e-06f, 5.56953864e-06f, -1.02103854e-06f,
+   -1.17394966e-05f, 3.74528718e-05f, -8.16542088e-05f, 1.50147156e-04f,
+   -2.48213037e-04f, 3.79533274e-04f, -5.44884766e-04f, 7.40663963e-04f,
+   -9.57409153e-04f, 1.17846928e-03f, -1.37904566e-03f, 1.52568449e-03f,
+   -1.57657277e-03f, 1.48280896e-03f, -1.19052595e-03f, 6.44116022e-04f,
+   2.09574282e-04f, -1.41638576e-03f, 3.00930394e-03f, -5.00287581e-03f,
+   7.38773867e-03f, -1.01256622e-02f, 1.31456088e-02f, -1.63406413e-02f,
+   1.95658393e-02f, -2.26364452e-02f, 2.53249016e-02f, -2.73540560e-02f,
+   2.83804704e-02f, -2.79536638e-02f, 2.54182685e-02f, -1.96604729e-02f,
+   8.35428108e-03f, 1.49094258e-02f, -7.83461183e-02f, 9.04262602e-01f,
+   2.35043958e-01f, -1.29621282e-01f, 9.47555825e-02f, -7.49321356e-02f,
+   6.07007220e-02f, -4.92243618e-02f, 3.94365713e-02f, -3.08989901e-02f,
+   2.34293193e-02f, -1.69528089e-02f, 1.14346463e-02f, -6.84656296e-03f,
+   3.15047079e-03f, -2.91964534e-04f, -1.80129311e-03f, 3.21701891e-03f,
+   -4.05424694e-03f, 4.41779289e-03f, -4.41292394e-03f, 4.14006598e-03f,
+   -3.69050982e-03f, 3.14313709e-03f, -2.56250589e-03f, 1.99807459e-03f,
+   -1.48456905e-03f, 1.04316510e-03f, -6.83517312e-04f, 4.06129664e-04f,
+   -2.04796204e-04f, 6.90206070e-05f, 1.38367568e-05f, -5.68105352e-05f,
+   7.20196040e-05f, -6.98221629e-05f, 5.83786132e-05f, -4.35784677e-05f,
+   2.92296372e-05f, -1.73952321e-05f, 8.82473705e-06f, -3.38610334e-06f,
+   3.61084858e-06f, -5.33738830e-06f, 5.07124378e-06f, -1.92783673e-07f,
+   -1.29971950e-05f, 3.92190086e-05f, -8.39474014e-05f, 1.52887704e-04f,
+   -2.51164078e-04f, 3.82250582e-04f, -5.46660682e-04f, 7.40482821e-04f,
+   -9.53919254e-04f, 1.16999180e-03f, -1.36361190e-03f, 1.50113262e-03f,
+   -1.54070335e-03f, 1.43355492e-03f, -1.12621731e-03f, 5.63855981e-04f,
+   3.05693946e-04f, -1.52684213e-03f, 3.13085131e-03f, -5.13007725e-03f,
+   7.51284137e-03f, -1.02383392e-02f, 1.32327713e-02f, -1.63863692e-02f,
+   1.95513777e-02f, -2.25400887e-02f, 2.51218583e-02f, -2.70159319e-02f,
+   2.78739408e-02f, -2.72378642e-02f, 2.44389195e-02f, -1.83363222e-02f,
+   6.54247822e-03f, 1.75198931e-02f, -8.27056244e-02f, 9.01495755e-01f,
+   2.42313400e-01f, -1.32130206e-01f, 9.59748924e-02f, -7.55376071e-02f,
+   6.09476343e-02f, -4.92430329e-02f, 3.93065698e-02f, -3.06746177e-02f,
+   2.31501143e-02f, -1.66484285e-02f, 1.11274365e-02f, -6.55281125e-03f,
+   2.88173161e-03f, -5.54416583e-05f, -2.00176076e-03f, 3.38049093e-03f,
+   -4.18204023e-03f, 4.51283995e-03f, -4.47922293e-03f, 4.18228749e-03f,
+   -3.71346995e-03f, 3.15149035e-03f, -2.56049167e-03f, 1.98935228e-03f,
+   -1.47212285e-03f, 1.02929783e-03f, -6.69876870e-04f, 3.93774419e-04f,
+   -1.94302309e-04f, 6.06011490e-05f, 2.02448846e-05f, -6.14365490e-05f,
+   7.51757107e-05f, -7.18456795e-05f, 5.95850433e-05f, -4.42378587e-05f,
+   2.95512218e-05f, -1.75300447e-05f, 8.87089845e-06f, -3.39933968e-06f,
+   3.48699564e-06f, -5.06946071e-06f, 4.57494934e-06f, 6.29419901e-07f,
+   -1.42434992e-05f, 4.09616187e-05f, -8.62003290e-05f, 1.55561022e-04f,
+   -2.54015089e-04f, 3.84826242e-04f, -5.48242824e-04f, 7.40047486e-04f,
+   -9.50114452e-04f, 1.16113981e-03f, -1.34776416e-03f, 1.47614942e-03f,
+   -1.50440051e-03f, 1.38393475e-03f, -1.06172101e-03f, 4.83616226e-04f,
+   4.01492522e-04f, -1.63653598e-03f, 3.25099146e-03f, -5.25522185e-03f,
+   7.63514545e-03f, -1.03473142e-02f, 1.33152585e-02f, -1.64264292e-02f,
+   1.95302665e-02f, -2.24362370e-02f, 2.49106288e-02f, -2.66692359e-02f,
+   2.73589771e-02f, -2.65145544e-02f, 2.34539807e-02f, -1.70101915e-02f,
+   4.73607797e-03f, 2.01088730e-02f, -8.69902149e-02f, 8.98629844e-01f,
+   2.49610111e-01f, -1.34611383e-01f, 9.71670151e-02f, -7.61193782e-02f,
+   6.11744523e-02f, -4.92449179e-02f, 3.91628072e-02f, -3.04392315e-02f,
+   2.28623655e-02f, -1.63376890e-02f, 1.08157108e-02f, -6.25619106e-03f,
+   2.61138822e-03f, 1.81610274e-04f, -2.20194925e-03f, 3.54316947e-03f,
+   -4.30863071e-03f, 4.60648816e-03f, -4.54411563e-03f, 4.22317348e-03f,
+   -3.73521121e-03f, 3.15878051e-03f, -2.55759479e-03f, 1.97992194e-03f,
+   -1.45914534e-03f, 1.01504533e-03f, -6.55963668e-04f, 3.81243037e-04f,
+   -1.83712109e-04f, 5.21328329e-05f, 2.66708794e-05f, -6.60575388e-05f,
+   7.83177966e-05f, -7.38531526e-05f, 6.07769543e-05f, -4.48851060e-05f,
+   2.98644118e-05f, -1.76595040e-05f, 8.91413401e-06f, -3.41134091e-06f,
+   3.36316680e-06f, -4.80176504e-06f, 4.08049755e-06f, 1.44744672e-06f,
+   -1.54788304e-05f, 4.26813131e-05f, -8.84137626e-05f, 1.58171097e-04f,
+   -2.56769010e-04f, 3.87259672e-04f, -5.49631019e-04f, 7.39359413e-04f,
+   -9.45993932e-04f, 1.15191517e-03f, -1.33149477e-03f, 1.45071372e-03f,
+   -1.46767730e-03f, 1.33396580e-03f, -9.96996299e-04f, 4.03346407e-04f,
+   4.96937719e-04f, -1.74543005e-03f, 3.36984452e-03f, -5.37835248e-03f,
+   7.75455497e-03f, -1.04525220e-02f, 1.33930091e-02f, -1.64607987e-02f,
+   1.95025392e-02f, -2.23249402e-02f, 2.46913712e-02f, -2.63142418e-02f,
+   2.68358979e-02f, -2.57839989e-02f, 2.24638041e-02f, -1.56827457e-02f,
+   2.93551409e-03f, 2.26758625e-02f, -9.11996514e-02f, 8.95665407e-01f,
+   2.56932795e-01f, -1.37063846e-01f, 9.83314365e-02f, -7.66772106e-02f,
+   6.13809936e-02f, -4.92299758e-02f, 3.90053429e-02f, -3.01929638e-02f,
+   2.25662496e-02f, -1.60208400e-02f, 1.04997177e-02f, -5.95689518e-03f,
+   2.33966159e-03f, 4.19034157e-04f, -2.40178918e-03f, 3.70494486e-03f,
+   -4.43403563e-03f, 4.69879294e-03f, -4.60763695e-03f, 4.26270766e-03f,
+   -3.75572429e-03f, 3.16500966e-03f, -2.55380897e-03f, 1.96978846e-03f,
+   -1.44562603e-03f, 1.00039167e-03f, -6.41782011e-04f, 3.68539564e-04f,
+   -1.73015243e-04f, 4.36100745e-05f, 3.31125884e-05f, -7.06763385e-05f,
+   8.14496598e-05f, -7.58453898e-05f, 6.19546263e-05f, -4.55203990e-05f,
+   3.01692799e-05f, -1.77836519e-05f, 8.95449921e-06f, -3.42209523e-06f,
+   3.23942459e-06f, -4.53475650e-06f, 3.58806619e-06f, 2.25944109e-06f,
+   -1.67003764e-05f, 4.43776698e-05f, -9.05851484e-05f, 1.60714641e-04f,
+   -2.59422493e-04f, 3.89551045e-04f, -5.50825731e-04f, 7.38420058e-04f,
+   -9.41562233e-04f, 1.14232325e-03f, -1.31481141e-03f, 1.42485776e-03f,
+   -1.43054849e-03f, 1.28364982e-03f, -9.32066527e-04f, 3.23151966e-04f,
+   5.91997697e-04f, -1.85352529e-03f, 3.48725426e-03f, -5.49939089e-03f,
+   7.87111279e-03f, -1.05539663e-02f, 1.34660620e-02f, -1.64894871e-02f,
+   1.94682106e-02f, -2.22062301e-02f, 2.44641397e-02f, -2.59510055e-02f,
+   2.63049006e-02f, -2.50465255e-02f, 2.14688163e-02f, -1.43543305e-02f,
+   1.14150788e-03f, 2.52200514e-02f, -9.53335315e-02f, 8.92603159e-01f,
+   2.64280230e-01f, -1.39486596e-01f, 9.94675830e-02f, -7.72107840e-02f,
+   6.15671761e-02f, -4.91981618e-02f, 3.88341621e-02f, -2.99358144e-02f,
+   2.22617500e-02f, -1.56977680e-02f, 1.01794554e-02f, -5.65497205e-03f,
+   2.06655310e-03f, 6.56788121e-04f, -2.60124402e-03f, 3.86581267e-03f,
+   -4.55820700e-03f, 4.78971703e-03f, -4.66970308e-03f, 4.30087326e-03f,
+   -3.77500569e-03f, 3.17016640e-03f, -2.54914048e-03f, 1.95894693e-03f,
+   -1.43156631e-03f, 9.85356513e-04f, -6.27335336e-04f, 3.55663564e-04f,
+   -1.62225449e-04f, 3.50439404e-05f, 3.95678617e-05f, -7.52912019e-05f,
+   8.45642426e-05f, -7.78195244e-05f, 6.31154617e-05f, -4.61433483e-05f,
+   3.04652040e-05f, -1.79022463e-05f, 8.99187035e-06f, -3.43157990e-06f,
+   3.11581039e-06f, -4.26850102e-06f, 3.09781240e-06f, 3.06568336e-06f,
+   -1.79102281e-05f, 4.60501797e-05f, -9.27159490e-05f, 1.63191027e-04f,
+   -2.61976238e-04f, 3.91700480e-04f, -5.51826553e-04f, 7.37229828e-04f,
+   -9.36820346e-04f, 1.13236625e-03f, -1.29772932e-03f, 1.39858515e-03f,
+   -1.39301491e-03f, 1.23303698e-03f, -8.66996183e-04f, 2.43008195e-04f,
+   6.86671759e-04f, -1.96071528e-03f, 3.60322325e-03f, -5.61827980e-03f,
+   7.98474532e-03f, -1.06515884e-02f, 1.35343736e-02f, -1.65124908e-02f,
+   1.94273014e-02f, -2.20801793e-02f, 2.42289957e-02f, -2.55796649e-02f,
+   2.57660989e-02f, -2.43022833e-02f, 2.04692092e-02f, -1.30253956e-02f,
+   -6.45442517e-04f, 2.77406480e-02f, -9.93913114e-02f, 8.89443636e-01f,
+   2.71651179e-01f, -1.41878664e-01f, 1.00575000e-01f, -7.77198598e-02f,
+   6.17328510e-02f, -4.91494536e-02f, 3.86493206e-02f, -2.96678692e-02f,
+   2.19490565e-02f, -1.53686749e-02f, 9.85512882e-03f, -5.35046915e-03f,
+   1.79219781e-03f, 8.94829980e-04f, -2.80021271e-03f, 4.02566325e-03f,
+   -4.68108011e-03f, 4.87917056e-03f, -4.73030889e-03f, 4.33766469e-03f,
+   -3.79303284e-03f, 3.17425048e-03f, -2.54358258e-03f, 1.94740726e-03f,
+   -1.41698099e-03f, 9.69937886e-04f, -6.12623408e-04f, 3.42627493e-04f,
+   -1.51342523e-04f, 2.64316841e-05f, 4.60365372e-05f, -7.98977053e-05f,
+   8.76633640e-05f, -7.97766043e-05f, 6.42610103e-05f, -4.67537102e-05f,
+   3.07521841e-05f, -1.80153311e-05f, 9.02621923e-06f, -3.43978581e-06f,
+   2.99236581e-06f, -4.00260251e-06f, 2.60958495e-06f, 3.86590727e-06f,
+   -1.91079889e-05f, 4.76983332e-05f, -9.48054876e-05f, 1.65603080e-04f,
+   -2.64430331e-04f, 3.93706461e-04f, -5.52633894e-04f, 7.35790236e-04f,
+   -9.31773509e-04f, 1.12205301e-03f, -1.28025224e-03f, 1.37189671e-03f,
+   -1.35511451e-03f, 1.18213007e-03f, -8.01765651e-04f, 1.62994373e-04f,
+   7.80866540e-04f, -2.06700084e-03f, 3.71775241e-03f, -5.73502202e-03f,
+   8.09540227e-03f, -1.07453810e-02f, 1.35979187e-02f, -1.65298041e-02f,
+   1.93798486e-02f, -2.19468903e-02f, 2.39861067e-02f, -2.52004880e-02f,
+   2.52197813e-02f, -2.35516578e-02f, 1.94654148e-02f, -1.16963917e-02f,
+   -2.42491462e-03f, 3.02371755e-02f, -1.03372723e-01f, 8.86187553e-01f,
+   2.79044151e-01f, -1.44239128e-01f, 1.01653218e-01f, -7.82041997e-02f,
+   6.18779212e-02f, -4.90838140e-02f, 3.84508185e-02f, -2.93892194e-02f,
+   2.16282066e-02f, -1.50337154e-02f, 9.52678733e-03f, -5.04358532e-03f,
+   1.51677697e-03f, 1.13300164e-03f, -2.99859303e-03f, 4.18446539e-03f,
+   -4.80260979e-03f, 4.96717449e-03f, -4.78944834e-03f, 4.37304284e-03f,
+   -3.80980433e-03f, 3.17725586e-03f, -2.53713923e-03f, 1.93516898e-03f,
+   -1.40186178e-03f, 9.54135263e-04f, -5.97660197e-04f, 3.29430768e-04f,
+   -1.40366436e-04f, 1.77817165e-05f, 5.25123178e-05f, -8.44970564e-05f,
+   9.07487483e-05f, -8.17161126e-05f, 6.53908064e-05f, -4.73512373e-05f,
+   3.10304604e-05f, -1.81228370e-05f, 9.05757042e-06f, -3.44667023e-06f,
+   2.86915110e-06f, -3.73767102e-06f, 2.12448185e-06f, 4.65988251e-06f,
+   -2.02917308e-05f, 4.93217594e-05f, -9.68521344e-05f, 1.67945196e-04f,
+   -2.66781863e-04f, 3.95569456e-04f, -5.53248799e-04f, 7.34103960e-04f,
+   -9.26424284e-04f, 1.11138658e-03f, -1.26238633e-03f, 1.34482852e-03f,
+   -1.31686276e-03f, 1.13094691e-03f, -7.36461021e-04f, 8.31375146e-05f,
+   8.74582038e-04f, -2.17234786e-03f, 3.83069320e-03f, -5.84952720e-03f,
+   8.20307061e-03f, -1.08353319e-02f, 1.36567056e-02f, -1.65414512e-02f,
+   1.93258710e-02f, -2.18063388e-02f, 2.37354934e-02f, -2.48134341e-02f,
+   2.46660151e-02f, -2.27947403e-02f, 1.84577815e-02f, -1.03676571e-02f,
+   -4.19605756e-03f, 3.27087604e-02f, -1.07277341e-01f, 8.82835507e-01f,
+   2.86458164e-01f, -1.46566838e-01f, 1.02701671e-01f, -7.86635056e-02f,
+   6.20022677e-02f, -4.90012281e-02f, 3.82386856e-02f, -2.90998630e-02f,
+   2.12992392e-02f, -1.46929389e-02f, 9.19448119e-03f, -4.73432150e-03f,
+   1.24020327e-03f, 1.37129915e-03f, -3.19634913e-03f, 4.34218859e-03f,
+   -4.92269453e-03f, 5.05361333e-03f, -4.84704180e-03f, 4.40700399e-03f,
+   -3.82530899e-03f, 3.17917764e-03f, -2.52981228e-03f, 1.92223256e-03f,
+   -1.38622953e-03f, 9.37968842e-04f, -5.82444482e-04f, 3.16077640e-04f,
+   -1.29311447e-04f, 9.09693154e-06f, 5.89949996e-05f, -8.90831798e-05f,
+   9.38134544e-05f, -8.36357940e-05f, 6.65023763e-05f, -4.79355476e-05f,
+   3.12993216e-05f, -1.82245567e-05f, 9.08580114e-06f, -3.45222566e-06f,
+   2.74613035e-06f, -3.47360015e-06f, 1.64141511e-06f, 5.44787144e-06f,
+   -2.14618594e-05f, 5.09210258e-05f, -9.88563552e-05f, 1.70220956e-04f,
+   -2.69033917e-04f, 3.97289172e-04f, -5.53671329e-04f, 7.32170243e-04f,
+   -9.20770864e-04f, 1.10037113e-03f, -1.24413858e-03f, 1.31735706e-03f,
+   -1.27823546e-03f, 1.07950519e-03f, -6.71041838e-04f, 3.38697282e-06f,
+   9.67786880e-04f, -2.27672188e-03f, 3.94215900e-03f, -5.96183352e-03f,
+   8.30771867e-03f, -1.09213889e-02f, 1.37106972e-02f, -1.65474284e-02f,
+   1.92654226e-02f, -2.16586497e-02f, 2.34773401e-02f, -2.44188402e-02f,
+   2.41051875e-02f, -2.20319852e-02f, 1.74466632e-02f, -9.03980061e-03f,
+   -5.95853059e-03f, 3.51549461e-02f, -1.11105092e-01f, 8.79388154e-01f,
+   2.93891639e-01f, -1.48860976e-01f, 1.03719942e-01f, -7.90975988e-02f,
+   6.21057823e-02f, -4.89016697e-02f, 3.80130224e-02f, -2.87999753e-02f,
+   2.09623575e-02f, -1.43464496e-02f, 8.85842647e-03f, -4.42292914e-03f,
+   9.62703722e-04f, 1.60956371e-03f, -3.39341187e-03f, 4.49872576e-03f,
+   -5.04140556e-03f, 5.13853785e-03f, -4.90314048e-03f, 4.43953555e-03f,
+   -3.83953983e-03f, 3.18001513e-03f, -2.52159289e-03f, 1.90860173e-03f,
+   -1.37007236e-03f, 9.21421044e-04f, -5.66981907e-04f, 3.02572385e-04f,
+   -1.18170232e-04f, 3.71712247e-07f, 6.54823889e-05f, -9.36589931e-05f,
+   9.68620880e-05f, -8.55362232e-05f, 6.75978881e-05f, -4.85067321e-05f,
+   3.15589568e-05f, -1.83205484e-05f, 9.11090501e-06f, -3.45644980e-06f,
+   2.62357185e-06f, -3.21050993e-06f, 1.16147464e-06f, 6.22808648e-06f,
+   -2.26181382e-05f, 5.24935640e-05f, -1.00815909e-04f, 1.72427535e-04f,
+   -2.71183235e-04f, 3.98866017e-04f, -5.53902122e-04f, 7.29991123e-04f,
+   -9.14821227e-04f, 1.08901097e-03f, -1.22551166e-03f, 1.28951739e-03f,
+   -1.23928406e-03f, 1.02780759e-03f, -6.05530280e-04f, -7.61526244e-05f,
+   1.06045057e-03f, -2.38012359e-03f, 4.05200431e-03f, -6.07185112e-03f,
+   8.40933528e-03f, -1.10035595e-02f, 1.37599204e-02f, -1.65477470e-02f,
+   1.91984996e-02f, -2.15038434e-02f, 2.32117083e-02f, -2.40166653e-02f,
+   2.35373676e-02f, -2.12636683e-02f, 1.64324939e-02f, -7.71326711e-03f,
+   -7.71163916e-03f, 3.75748873e-02f, -1.14855438e-01f, 8.75846326e-01f,
+   3.01343352e-01f, -1.51120573e-01f, 1.04707509e-01f, -7.95061588e-02f,
+   6.21883720e-02f, -4.87851389e-02f, 3.77738141e-02f, -2.84895580e-02f,
+   2.06175484e-02f, -1.39942970e-02f, 8.51861760e-03f, -4.10930812e-03f,
+   6.84281287e-04f, 1.84775307e-03f, -3.58974352e-03f, 4.65404661e-03f,
+   -5.15864091e-03f, 5.22191264e-03f, -4.95766848e-03f, 4.47062030e-03f,
+   -3.85249290e-03f, 3.17976507e-03f, -2.51248968e-03f, 1.89427985e-03f,
+   -1.35339249e-03f, 9.04513930e-04f, -5.51276549e-04f, 2.88914220e-04f,
+   -1.06946354e-04f, -8.38255892e-06f, 7.19722957e-05f, -9.82227211e-05f,
+   9.98877877e-05f, -8.74148318e-05f, 6.86747298e-05f, -4.90635721e-05f,
+   3.18090206e-05f, -1.84106193e-05f, 9.13285021e-06f, -3.45927742e-06f,
+   2.50130506e-06f, -2.94848314e-06f, 6.84808981e-07f, 7.00184364e-06f,
+   -2.37601544e-05f, 5.40389519e-05f, -1.02732367e-04f, 1.74564411e-04f,
+   -2.73230748e-04f, 4.00300109e-04f, -5.53941354e-04f, 7.27569335e-04f,
+   -9.08574322e-04f, 1.07730867e-03f, -1.20652316e-03f, 1.26131251e-03f,
+   -1.19999866e-03f, 9.75904521e-04f, -5.39991655e-04f, -1.55480346e-04f,
+   1.15257257e-03f, -2.48245150e-03f, 4.16023098e-03f, -6.17958512e-03f,
+   8.50787293e-03f, -1.10817952e-02f, 1.38043482e-02f, -1.65424142e-02f,
+   1.91251580e-02f, -2.13420093e-02f, 2.29386613e-02f, -2.36071907e-02f,
+   2.29628123e-02f, -2.04899367e-02f, 1.54154617e-02f, -6.38844538e-03f,
+   -9.45490785e-03f, 3.99680510e-02f, -1.18528180e-01f, 8.72210622e-01f,
+   3.08812112e-01f, -1.53344572e-01f, 1.05663873e-01f, -7.98889995e-02f,
+   6.22499436e-02f, -4.86516431e-02f, 3.75211500e-02f, -2.81687472e-02f,
+   2.02650297e-02f, -1.36366449e-02f, 8.17527715e-03f, -3.79366218e-03f,
+   4.05074563e-04f, 2.08582333e-03f, -3.78524372e-03f, 4.80811950e-03f,
+   -5.27435727e-03f, 5.30365529e-03f, -5.01061976e-03f, 4.50025406e-03f,
+   -3.86415352e-03f, 3.17842304e-03f, -2.50249798e-03f, 1.87926274e-03f,
+   -1.33620738e-03f, 8.87246104e-04f, -5.35327184e-04f, 2.75116879e-04f,
+   -9.56507065e-05f, -1.71686461e-05f, 7.84645090e-05f, -1.02769794e-04f,
+   1.02892278e-04f, -8.92725948e-05f, 6.97332725e-05f, -4.96066787e-05f,
+   3.20494000e-05f, -1.84947294e-05f, 9.15157489e-06f, -3.46072602e-06f,
+   2.37936956e-06f, -2.68759050e-06f, 2.10647855e-07f, 7.76889283e-06f,
+   -2.48875549e-05f, 5.55599581e-05f, -1.04604900e-04f, 1.76633359e-04f,
+   -2.75176542e-04f, 4.01590398e-04f, -5.53790305e-04f, 7.24904763e-04f,
+   -9.02037486e-04f, 1.06527505e-03f, -1.18717563e-03f, 1.23274443e-03f,
+   -1.16041733e-03f, 9.23798711e-04f, -4.74405882e-04f, -2.34595223e-04f,
+   1.24406244e-03f, -2.58370675e-03f, 4.26684180e-03f, -6.28498476e-03f,
+   8.60328972e-03f, -1.11560915e-02f, 1.38439685e-02f, -1.65314507e-02f,
+   1.90454479e-02f, -2.11732704e-02f, 2.26583928e-02f, -2.31905747e-02f,
+   2.23817751e-02f, -1.97111946e-02f, 1.43960835e-02f, -5.06577594e-03f,
+   -1.11878663e-02f, 4.23340052e-02f, -1.22123122e-01f, 8.68481815e-01f,
+   3.16296309e-01f, -1.55532062e-01f, 1.06588632e-01f, -8.02459121e-02f,
+   6.22904189e-02f, -4.85011525e-02f, 3.72550450e-02f, -2.78375763e-02f,
+   1.99048445e-02f, -1.32736648e-02f, 7.82845914e-03f, -3.47614801e-03f,
+   1.25268343e-04f, 2.32361583e-03f, -3.97978118e-03f, 4.96084010e-03f,
+   -5.38851321e-03f, 5.38378302e-03f, -5.06198872e-03f, 4.52840514e-03f,
+   -3.87451611e-03f, 3.17598716e-03f, -2.49162479e-03f, 1.86356658e-03f,
+   -1.31850864e-03f, 8.69615935e-04f, -5.19150111e-04f, 2.61179754e-04f,
+   -8.42796217e-05f, -2.59779208e-05f, 8.49525750e-05f, -1.07300133e-04f,
+   1.05877174e-04f, -9.11088064e-05f, 7.07731233e-05f, -5.01357972e-05f,
+   3.22800988e-05f, -1.85728513e-05f, 9.16705176e-06f, -3.46078559e-06f,
+   2.25803137e-06f, -2.42794226e-06f, -2.59936428e-07f, 8.52749054e-06f,
+   -2.60001434e-05f, 5.70530465e-05f, -1.06432111e-04f, 1.78631846e-04f,
+   -2.77018407e-04f, 4.02737613e-04f, -5.53449499e-04f, 7.22001714e-04f,
+   -8.95213685e-04f, 1.05291267e-03f, -1.16747781e-03f, 1.20385026e-03f,
+   -1.12055580e-03f, 8.71508091e-04f, -4.08859283e-04f, -3.13393830e-04f,
+   1.33492064e-03f, -2.68385862e-03f, 4.37169941e-03f, -6.38798531e-03f,
+   8.69557355e-03f, -1.12264426e-02f, 1.38787851e-02f, -1.65148638e-02f,
+   1.89593825e-02f, -2.09975913e-02f, 2.23709252e-02f, -2.27668714e-02f,
+   2.17943322e-02f, -1.89275276e-02f, 1.33744618e-02f, -3.74559034e-03f,
+   -1.29098380e-02f, 4.46717478e-02f, -1.25639811e-01f, 8.64660680e-01f,
+   3.23794931e-01f, -1.57682016e-01f, 1.07481256e-01f, -8.05766582e-02f,
+   6.23097159e-02f, -4.83336933e-02f, 3.69755737e-02f, -2.74961349e-02f,
+   1.95370428e-02f, -1.29054124e-02f, 7.47821666e-03f, -3.15676606e-03f,
+   -1.55224698e-04f, 2.56112590e-03f, -4.17341385e-03f, 5.11220191e-03f,
+   -5.50100999e-03f, 5.46219060e-03f, -5.11170784e-03f, 4.55506984e-03f,
+   -3.88357579e-03f, 3.17245885e-03f, -2.47987383e-03f, 1.84718776e-03f,
+   -1.30031887e-03f, 8.51647288e-04f, -5.02744224e-04f, 2.47107411e-04f,
+   -7.28478990e-05f, -3.48073736e-05f, 9.14363554e-05f, -1.11811954e-04f,
+   1.08835782e-04f, -9.29209855e-05f, 7.17934890e-05f, -5.06500437e-05f,
+   3.25007750e-05f, -1.86448360e-05f, 9.17926900e-06f, -3.45939338e-06f,
+   2.13704220e-06f, -2.16945068e-06f, -7.27102815e-07f, 9.27942801e-06f,
+   -2.70982109e-05f, 5.85188100e-05f, -1.08214641e-04f, 1.80560601e-04f,
+   -2.78758933e-04f, 4.03742568e-04f, -5.52919286e-04f, 7.18859781e-04f,
+   -8.88100069e-04f, 1.04022655e-03f, -1.14743528e-03f, 1.17460452e-03f,
+   -1.08039007e-03f, 8.19050765e-04f, -3.43310676e-04f, -3.91952140e-04f,
+   1.42511702e-03f, -2.78287358e-03f, 4.47490765e-03f, -6.48862356e-03f,
+   8.78470205e-03f, -1.12928096e-02f, 1.39087969e-02f, -1.64926741e-02f,
+   1.88670438e-02f, -2.08151285e-02f, 2.20764633e-02f, -2.23364122e-02f,
+   2.12008823e-02f, -1.81394704e-02f, 1.23511972e-02f, -2.42853933e-03f,
+   -1.46205025e-02f, 4.69809733e-02f, -1.29078239e-01f, 8.60747993e-01f,
+   3.31306338e-01f, -1.59793615e-01f, 1.08341374e-01f, -8.08810592e-02f,
+   6.23077676e-02f, -4.81492728e-02f, 3.66828069e-02f, -2.71445997e-02f,
+   1.91618521e-02f, -1.25320023e-02f, 7.12477788e-03f, -2.83577852e-03f,
+   -4.36173374e-04f, 2.79815681e-03f, -4.36597783e-03f, 5.26210153e-03f,
+   -5.61191561e-03f, 5.53892460e-03f, -5.15981717e-03f, 4.58023604e-03f,
+   -3.89132765e-03f, 3.16783227e-03f, -2.46723322e-03f, 1.83013082e-03f,
+   -1.28162617e-03f, 8.33320955e-04f, -4.86114732e-04f, 2.32904393e-04f,
+   -6.13480952e-05f, -4.36626578e-05f, 9.79136530e-05f, -1.16303672e-04f,
+   1.11772555e-04f, -9.47111330e-05f, 7.27948354e-05f, -5.11495164e-05f,
+   3.27114649e-05f, -1.87106943e-05f, 9.18814203e-06f, -3.45656781e-06f,
+   2.01666626e-06f, -1.91269260e-06f, -1.19071046e-06f, 1.00229836e-05f,
+   -2.81793273e-05f, 5.99569685e-05f, -1.09950321e-04f, 1.82418429e-04f,
+   -2.80395529e-04f, 4.04604245e-04f, -5.52201236e-04f, 7.15480302e-04f,
+   -8.80706531e-04f, 1.02722144e-03f, -1.12705096e-03f, 1.14504609e-03f,
+   -1.03997218e-03f, 7.66445766e-04f, -2.77782354e-04f, -4.70167171e-04f,
+   1.51462248e-03f, -2.88075232e-03f, 4.57633380e-03f, -6.58681989e-03f,
+   8.87066405e-03f, -1.13551887e-02f, 1.39340051e-02f, -1.64648984e-02f,
+   1.87684223e-02f, -2.06259005e-02f, 2.17750724e-02f, -2.18991507e-02f,
+   2.06014998e-02f, -1.73471048e-02f, 1.13266418e-02f, -1.11494935e-03f,
+   -1.63190570e-02f, 4.92609031e-02f, -1.32438138e-01f, 8.56744528e-01f,
+   3.38829488e-01f, -1.61865801e-01f, 1.09168477e-01f, -8.11588764e-02f,
+   6.22845143e-02f, -4.79479320e-02f, 3.63768078e-02f, -2.67829839e-02f,
+   1.87793281e-02f, -1.21534895e-02f, 6.76814234e-03f, -2.51308340e-03f,
+   -7.17573741e-04f, 3.03477910e-03f, -4.55746893e-03f, 5.41051012e-03f,
+   -5.72113460e-03f, 5.61395055e-03f, -5.20625198e-03f, 4.60389070e-03f,
+   -3.89776356e-03f, 3.16210627e-03f, -2.45371764e-03f, 1.81240076e-03f,
+   -1.26243394e-03f, 8.14660161e-04f, -4.69266903e-04f, 2.18570131e-04f,
+   -4.97839537e-05f, -5.25321884e-05f, 1.04382059e-04f, -1.20775097e-04f,
+   1.14680646e-04f, -9.64752762e-05f, 7.37747832e-05f, -5.16338441e-05f,
+   3.29118120e-05f, -1.87702226e-05f, 9.19366721e-06f, -3.45229932e-06f,
+   1.89687080e-06f, -1.65726385e-06f, -1.65061329e-06f, 1.07578608e-05f,
+   -2.92454297e-05f, 6.13671073e-05f, -1.11640598e-04f, 1.84204531e-04f,
+   -2.81928980e-04f, 4.05324157e-04f, -5.51295525e-04f, 7.11867528e-04f,
+   -8.73033772e-04f, 1.01390004e-03f, -1.10634544e-03f, 1.11517613e-03f,
+   -9.99292010e-04f, 7.13693968e-04f, -2.12339262e-04f, -5.48038690e-04f,
+   1.60343689e-03f, -2.97740055e-03f, 4.67598066e-03f, -6.68258080e-03f,
+   8.95342138e-03f, -1.14135742e-02f, 1.39544075e-02f, -1.64315589e-02f,
+   1.86635889e-02f, -2.04300415e-02f, 2.14668252e-02f, -2.14553848e-02f,
+   1.99964996e-02f, -1.65507775e-02f, 1.03009790e-02f, 1.94801207e-04f,
+   -1.80051252e-02f, 5.15110567e-02f, -1.35719359e-01f, 8.52651179e-01f,
+   3.46362770e-01f, -1.63897663e-01f, 1.09962165e-01f, -8.14099535e-02f,
+   6.22398965e-02f, -4.77296561e-02f, 3.60576808e-02f, -2.64114458e-02f,
+   1.83895174e-02f, -1.17700528e-02f, 6.40854193e-03f, -2.18889117e-03f,
+   -9.99239157e-04f, 3.27083538e-03f, -4.74778702e-03f, 5.55739645e-03f,
+   -5.82862459e-03f, 5.68719395e-03f, -5.25100995e-03f, 4.62602917e-03f,
+   -3.90287931e-03f, 3.15528340e-03f, -2.43932055e-03f, 1.79399550e-03f,
+   -1.24276045e-03f, 7.95664906e-04f, -4.52199660e-04f, 2.04118915e-04f,
+   -3.81668033e-05f, -6.14157689e-05f, 1.10841458e-04f, -1.25221675e-04f,
+   1.17561925e-04f, -9.82146230e-05f, 7.47345257e-05f, -5.21028196e-05f,
+   3.31017327e-05f, -1.88234590e-05f, 9.19534614e-06f, -3.44652767e-06f,
+   1.77769368e-06f, -1.40324585e-06f, -2.10696612e-06f, 1.14853910e-05f,
+   -3.02960871e-05f, 6.27488116e-05f, -1.13284965e-04f, 1.85920493e-04f,
+   -2.83359957e-04f, 4.05901141e-04f, -5.50203782e-04f, 7.08020933e-04f,
+   -8.65083421e-04f, 1.00027537e-03f, -1.08531967e-03f, 1.08499709e-03f,
+   -9.58388962e-04f, 6.60847872e-04f, -1.46961189e-04f, -6.25565823e-04f,
+   1.69147342e-03f, -3.07281944e-03f, 4.77385055e-03f, -6.77585974e-03f,
+   9.03293956e-03f, -1.14679402e-02f, 1.39700035e-02f, -1.63926817e-02f,
+   1.85526125e-02f, -2.02276055e-02f, 2.11519375e-02f, -2.10052896e-02f,
+   1.93860028e-02f, -1.57508329e-02f, 9.27472580e-03f, 1.50012446e-03f,
+   -1.96782593e-02f, 5.37309609e-02f, -1.38921618e-01f, 8.48468661e-01f,
+   3.53904933e-01f, -1.65888250e-01f, 1.10722043e-01f, -8.16340894e-02f,
+   6.21738620e-02f, -4.74944934e-02f, 3.57254446e-02f, -2.60300338e-02f,
+   1.79926679e-02f, -1.13818776e-02f, 6.04603393e-03f, -1.86336332e-03f,
+   -1.28111918e-03f, 3.50620481e-03f, -4.93680499e-03f, 5.70265949e-03f,
+   -5.93432924e-03f, 5.75867062e-03f, -5.29408175e-03f, 4.64662816e-03f,
+   -3.90666863e-03f, 3.14735924e-03f, -2.42405524e-03f, 1.77493074e-03f,
+   -1.22260535e-03f, 7.76333327e-04f, -4.34930174e-04f, 1.89550497e-04f,
+   -2.64928385e-05f, -7.03133046e-05f, 1.17285352e-04f, -1.29643304e-04f,
+   1.20417899e-04f, -9.99286640e-05f, 7.56738591e-05f, -5.25562427e-05f,
+   3.32812888e-05f, -1.88703434e-05f, 9.19362537e-06f, -3.43926877e-06f,
+   1.65918391e-06f, -1.15104649e-06f, -2.55874556e-06f, 1.22039055e-05f,
+   -3.13297023e-05f, 6.41018632e-05f, -1.14882023e-04f, 1.87564670e-04f,
+   -2.84686335e-04f, 4.06336214e-04f, -5.48926764e-04f, 7.03946338e-04f,
+   -8.56866827e-04f, 9.86348721e-04f, -1.06398284e-03f, 1.05454819e-03f,
+   -9.17278870e-04f, 6.07909402e-04f, -8.17337132e-05f, -7.02647434e-04f,
+   1.77873333e-03f, -3.16697988e-03f, 4.86981729e-03f, -6.86660083e-03f,
+   9.10921115e-03f, -1.15182893e-02f, 1.39807994e-02f, -1.63482763e-02f,
+   1.84355062e-02f, -2.00186409e-02f, 2.08304282e-02f, -2.05489509e-02f,
+   1.87702272e-02f, -1.49473576e-02f, 8.24798178e-03f, 2.80091190e-03f,
+   -2.13378202e-02f, 5.59198856e-02f, -1.42044798e-01f, 8.44197869e-01f,
+   3.61454636e-01f, -1.67836636e-01f, 1.11447670e-01f, -8.18311200e-02f,
+   6.20863736e-02f, -4.72424813e-02f, 3.53802145e-02f, -2.56388839e-02f,
+   1.75887719e-02f, -1.09890252e-02f, 5.68067841e-03f, -1.53655570e-03f,
+   -1.56316417e-03f, 3.74088180e-03f, -5.12457639e-03f, 5.84629318e-03f,
+   -6.03820896e-03f, 5.82828652e-03f, -5.33541152e-03f, 4.66568070e-03f,
+   -3.90912779e-03f, 3.13834287e-03f, -2.40792334e-03f, 1.75520568e-03f,
+   -1.20197330e-03f, 7.56691385e-04f, -4.17463481e-04f, 1.74869332e-04f,
+   -1.47773671e-05f, -7.92130959e-05f, 1.23713573e-04f, -1.34038157e-04f,
+   1.23241887e-04f, -1.01615078e-04f, 7.65905352e-05f, -5.29937497e-05f,
+   3.34501128e-05f, -1.89107268e-05f, 9.18844398e-06f, -3.43050260e-06f,
+   1.54130055e-06f, -9.00581028e-07f, -3.00699207e-06f, 1.29141526e-05f,
+   -3.23466411e-05f, 6.54266914e-05f, -1.16432435e-04f, 1.89137238e-04f,
+   -2.85910239e-04f, 4.06630483e-04f, -5.47465228e-04f, 6.99642638e-04f,
+   -8.48376600e-04f, 9.72125330e-04f, -1.04234274e-03f, 1.02380209e-03f,
+   -8.75936646e-04f, 5.54896076e-04f, -1.66154223e-05f, -7.79358787e-04f,
+   1.86518708e-03f, -3.25985113e-03f, 4.96394746e-03f, -6.95483806e-03f,
+   9.18221939e-03f, -1.15645966e-02f, 1.39868017e-02f, -1.62983891e-02f,
+   1.83123779e-02f, -1.98032986e-02f, 2.05025766e-02f, -2.00866163e-02f,
+   1.81495436e-02f, -1.41408937e-02f, 7.22142821e-03f, 4.09631804e-03f,
+   -2.29834449e-02f, 5.80774732e-02f, -1.45088881e-01f, 8.39839697e-01f,
+   3.69010448e-01f, -1.69741884e-01f, 1.12138636e-01f, -8.20008814e-02f,
+   6.19773977e-02f, -4.69736606e-02f, 3.50220725e-02f, -2.52381079e-02f,
+   1.71780810e-02f, -1.05916196e-02f, 5.31271286e-03f, -1.20857765e-03f,
+   -1.84518576e-03f, 3.97467101e-03f, -5.31094335e-03f, 5.98819973e-03f,
+   -6.14027353e-03f, 5.89607982e-03f, -5.37503045e-03f, 4.68317978e-03f,
+   -3.91025469e-03f, 3.12822429e-03f, -2.39091320e-03f, 1.73482578e-03f,
+   -1.18087057e-03f, 7.36718590e-04f, -3.99787532e-04f, 1.60080512e-04f,
+   -3.01285036e-06f, -8.81235464e-05f, 1.30123895e-04f, -1.38404706e-04f,
+   1.26037543e-04f, -1.03275670e-04f, 7.74862419e-05f, -5.34154387e-05f,
+   3.36082048e-05f, -1.89446309e-05f, 9.17976740e-06f, -3.42022054e-06f,
+   1.42431202e-06f, -6.51931487e-07f, -3.45069679e-06f, 1.36145127e-05f,
+   -3.33467033e-05f, 6.67213681e-05f, -1.17934345e-04f, 1.90637409e-04f,
+   -2.87030358e-04f, 4.06783074e-04f, -5.45820978e-04f, 6.95111463e-04f,
+   -8.39624554e-04f, 9.57611890e-04f, -1.02040032e-03f, 9.92799760e-04f,
+   -8.34416016e-04f, 5.01826697e-04f, 4.83715849e-05f, -8.55598715e-04f,
+   1.95080810e-03f, -3.35143553e-03f, 5.05621219e-03f, -7.04050157e-03f,
+   9.25195310e-03f, -1.16068628e-02f, 1.39880199e-02f, -1.62430275e-02f,
+   1.81832053e-02f, -1.95815936e-02f, 2.01682970e-02f, -1.96183417e-02f,
+   1.75240263e-02f, -1.33315260e-02f, 6.19516382e-03f, 5.38623985e-03f,
+   -2.46145036e-02f, 6.02031052e-02f, -1.48053750e-01f, 8.35395038e-01f,
+   3.76571029e-01f, -1.71603084e-01f, 1.12794518e-01f, -8.21432173e-02f,
+   6.18469119e-02f, -4.66881059e-02f, 3.46511416e-02f, -2.48278212e-02f,
+   1.67606603e-02f, -1.01897204e-02f, 4.94219922e-03f, -8.79485102e-04f,
+   -2.12717941e-03f, 4.20764182e-03f, -5.49590029e-03f, 6.12834934e-03f,
+   -6.24045124e-03f, 5.96202165e-03f, -5.41288499e-03f, 4.69911611e-03f,
+   -3.91004141e-03f, 3.11700441e-03f, -2.37304554e-03f, 1.71379512e-03f,
+   -1.15929602e-03f, 7.16440321e-04f, -3.81925696e-04f, 1.45183687e-04f,
+   8.79683375e-06f, -9.70330875e-05f, 1.36513860e-04f, -1.42742705e-04f,
+   1.28800792e-04f, -1.04906765e-04f, 7.83589858e-05f, -5.38202585e-05f,
+   3.37553538e-05f, -1.89719231e-05f, 9.16763929e-06f, -3.40839006e-06f,
+   1.30803176e-06f, -4.05173722e-07f, -3.88973240e-06f, 1.43062252e-05f,
+   -3.43296015e-05f, 6.79853983e-05f, -1.19389064e-04f, 1.92064908e-04f,
+   -2.88046867e-04f, 4.06795560e-04f, -5.43994247e-04f, 6.90357760e-04f,
+   -8.30612495e-04f, 9.42808867e-04f, -9.98178264e-04f, 9.61542013e-04f,
+   -7.92705629e-04f, 4.48702718e-04f, 1.13163209e-04f, -9.31368035e-04f,
+   2.03559664e-03f, -3.44164344e-03f, 5.14652207e-03f, -7.12359603e-03f,
+   9.31838714e-03f, -1.16450908e-02f, 1.39844604e-02f, -1.61822401e-02f,
+   1.80480815e-02f, -1.93536878e-02f, 1.98278222e-02f, -1.91444103e-02f,
+   1.68939959e-02f, -1.25196669e-02f, 5.16961701e-03f, 6.67015463e-03f,
+   -2.62306463e-02f, 6.22961856e-02f, -1.50939211e-01f, 8.30864727e-01f,
+   3.84135038e-01f, -1.73419327e-01f, 1.13414966e-01f, -8.22579786e-02f,
+   6.16948828e-02f, -4.63858172e-02f, 3.42674553e-02f, -2.44081784e-02f,
+   1.63365658e-02f, -9.78352223e-03f, 4.56919707e-03f, -5.49441960e-04f,
+   -2.40895711e-03f, 4.43963800e-03f, -5.67932054e-03f, 6.26671268e-03f,
+   -6.33870391e-03f, 6.02604449e-03f, -5.44897141e-03f, 4.71348176e-03f,
+   -3.90848983e-03f, 3.10469256e-03f, -2.35431688e-03f, 1.69211277e-03f,
+   -1.13726978e-03f, 6.95856579e-04f, -3.63871397e-04f, 1.30193381e-04f,
+   2.06400837e-05f, -1.05941377e-04f, 1.42883335e-04f, -1.47047802e-04f,
+   1.31530644e-04f, -1.06509593e-04f, 7.92084757e-05f, -5.42087218e-05f,
+   3.38914797e-05f, -1.89925831e-05f, 9.15194323e-06f, -3.39500593e-06f,
+   1.19249682e-06f, -1.60383635e-07f, -4.32482739e-06f, 1.49890702e-05f,
+   -3.52950410e-05f, 6.92211615e-05f, -1.20796183e-04f, 1.93420696e-04f,
+   -2.88960669e-04f, 4.06667503e-04f, -5.41987247e-04f, 6.85381936e-04f,
+   -8.21340887e-04f, 9.27731977e-04f, -9.75677627e-04f, 9.30030888e-04f,
+   -7.50847103e-04f, 3.95576179e-04f, 1.77758848e-04f, -1.00666576e-03f,
+   2.11946922e-03f, -3.53047741e-03f, 5.23491064e-03f, -7.20408512e-03f,
+   9.38148145e-03f, -1.16792591e-02f, 1.39761334e-02f, -1.61160510e-02f,
+   1.79070886e-02f, -1.91196352e-02f, 1.94813367e-02f, -1.86649989e-02f,
+   1.62595790e-02f, -1.17054684e-02f, 4.14521666e-03f, 7.94754550e-03f,
+   -2.78313253e-02f, 6.43563867e-02f, -1.53745249e-01f, 8.26249719e-01f,
+   3.91701013e-01f, -1.75189719e-01f, 1.13999628e-01f, -8.23450387e-02f,
+   6.15213141e-02f, -4.60669063e-02f, 3.38711478e-02f, -2.39792317e-02f,
+   1.59060657e-02f, -9.37328860e-03f, 4.19395091e-03f, -2.18612913e-04f,
+   -2.69046798e-03f, 4.67053941e-03f, -5.86116826e-03f, 6.40319334e-03f,
+   -6.43497799e-03f, 6.08814368e-03f, -5.48328087e-03f, 4.72626230e-03f,
+   -3.90559528e-03f, 3.09127918e-03f, -2.33472604e-03f, 1.66979828e-03f,
+   -1.11479161e-03f, 6.74966199e-04f, -3.45642155e-04f, 1.15109746e-04f,
+   3.25205838e-05f, -1.14848284e-04f, 1.49225962e-04f, -1.51319575e-04f,
+   1.34229573e-04f, -1.08083506e-04f, 8.00356138e-05f, -5.45806106e-05f,
+   3.40165025e-05f, -1.90065548e-05f, 9.13266376e-06f, -3.38006271e-06f,
+   1.07796870e-06f, 8.23630444e-08f, -4.75500428e-06f, 1.56614879e-05f,
+   -3.62428509e-05f, 7.04259510e-05f, -1.22154524e-04f, 1.94703593e-04f,
+   -2.89770338e-04f, 4.06400068e-04f, -5.39801607e-04f, 6.80189929e-04f,
+   -8.11822596e-04f, 9.12382384e-04f, -9.52907722e-04f, 8.98308412e-04f,
+   -7.08855048e-04f, 3.42448591e-04f, 2.42136855e-04f, -1.08139426e-03f,
+   2.20240070e-03f, -3.61791067e-03f, 5.32126520e-03f, -7.28192134e-03f,
+   9.44126584e-03f, -1.17093762e-02f, 1.39630539e-02f, -1.60444807e-02f,
+   1.77602638e-02f, -1.88794900e-02f, 1.91288590e-02f, -1.81802046e-02f,
+   1.56210512e-02f, -1.08892769e-02f, 3.12205777e-03f, 9.21831373e-03f,
+   -2.94160042e-02f, 6.63830563e-02f, -1.56471804e-01f, 8.21550906e-01f,
+   3.99267584e-01f, -1.76913247e-01f, 1.14548072e-01f, -8.24042484e-02f,
+   6.13261573e-02f, -4.57313582e-02f, 3.34623232e-02f, -2.35411432e-02f,
+   1.54691543e-02f, -8.95888358e-03f, 3.81646282e-03f, 1.12944130e-04f,
+   -2.97166011e-03f, 4.90030367e-03f, -6.04140665e-03f, 6.53778668e-03f,
+   -6.52923761e-03f, 6.14829035e-03f, -5.51576866e-03f, 4.73744981e-03f,
+   -3.90135287e-03f, 3.07678385e-03f, -2.31429772e-03f, 1.64685084e-03f,
+   -1.09186710e-03f, 6.53796073e-04f, -3.27244023e-04f, 9.99375334e-05f,
+   4.44228135e-05f, -1.23742080e-04f, 1.55541231e-04f, -1.55556510e-04f,
+   1.36891264e-04f, -1.09626359e-04f, 8.08385957e-05f, -5.49350043e-05f,
+   3.41302184e-05f, -1.90137525e-05f, 9.10986546e-06f, -3.36352969e-06f,
+   9.64188530e-07f, 3.23149408e-07f, -5.18041634e-06f, 1.63251098e-05f,
+   -3.71733840e-05f, 7.16000213e-05f, -1.23464721e-04f, 1.95914108e-04f,
+   -2.90477474e-04f, 4.05994011e-04f, -5.37437503e-04f, 6.74780051e-04f,
+   -8.02050345e-04f, 8.96765792e-04f, -9.29876696e-04f, 8.66354734e-04f,
+   -6.66703796e-04f, 2.89338030e-04f, 3.06275557e-04f, -1.15562684e-03f,
+   2.28444603e-03f, -3.70391551e-03f, 5.40564628e-03f, -7.35711958e-03f,
+   9.49769374e-03f, -1.17354328e-02f, 1.39452349e-02f, -1.59675870e-02f,
+   1.76076684e-02f, -1.86334215e-02f, 1.87706929e-02f, -1.76902842e-02f,
+   1.49786379e-02f, -1.00713745e-02f, 2.10081483e-03f, 1.04816388e-02f,
+   -3.09843477e-02f, 6.83758780e-02f, -1.59118861e-01f, 8.16769302e-01f,
+   4.06833351e-01f, -1.78589150e-01f, 1.15060009e-01f, -8.24354887e-02f,
+   6.11094795e-02f, -4.53793220e-02f, 3.30410860e-02f, -2.30940394e-02f,
+   1.50261102e-02f, -8.54064245e-03f, 3.43697914e-03f, 4.45117243e-04f,
+   -3.25234584e-03f, 5.12884930e-03f, -6.21991418e-03f, 6.67037629e-03f,
+   -6.62149070e-03f, 6.20646402e-03f, -5.54646039e-03f, 4.74704569e-03f,
+   -3.89576587e-03f, 3.06119327e-03f, -2.29300791e-03f, 1.62327732e-03f,
+   -1.06850348e-03f, 6.32325420e-04f, -3.08664545e-04f, 8.46817711e-05f,
+   5.63543181e-05f, -1.32631016e-04f, 1.61827236e-04f, -1.59757095e-04f,
+   1.39518845e-04f, -1.11139838e-04f, 8.16179381e-05f, -5.52725432e-05f,
+   3.42325911e-05f, -1.90141691e-05f, 9.08340280e-06f, -3.34538481e-06f,
+   8.51414313e-07f, 5.61434774e-07f, -5.60095577e-06f, 1.69784580e-05f,
+   -3.80844976e-05f, 7.27434453e-05f, -1.24725208e-04f, 1.97051384e-04f,
+   -2.91081466e-04f, 4.05449333e-04f, -5.34896972e-04f, 6.69155270e-04f,
+   -7.92036182e-04f, 8.80889187e-04f, -9.06585541e-04f, 8.34181963e-04f,
+   -6.24448876e-04f, 2.36262567e-04f, 3.70174617e-04f, -1.22926559e-03f,
+   2.36549764e-03f, -3.78849450e-03f, 5.48802782e-03f, -7.42966263e-03f,
+   9.55077354e-03f, -1.17574297e-02f, 1.39226876e-02f, -1.58853941e-02f,
+   1.74493417e-02f, -1.83814466e-02f, 1.84067413e-02f, -1.71953309e-02f,
+   1.43325664e-02f, -9.25204344e-03f, 1.08157983e-03f, 1.17374286e-02f,
+   -3.25357690e-02f, 7.03342333e-02f, -1.61686406e-01f, 8.11905861e-01f,
+   4.14396971e-01f, -1.80216521e-01f, 1.15535051e-01f, -8.24386552e-02f,
+   6.08712398e-02f, -4.50108796e-02f, 3.26075964e-02f, -2.26380918e-02f,
+   1.45770004e-02f, -8.11856333e-03f, 3.05556506e-03f, 7.77848065e-04f,
+   -3.53251980e-03f, 5.35613252e-03f, -6.39668200e-03f, 6.80099847e-03f,
+   -6.71167113e-03f, 6.26265584e-03f, -5.57531090e-03f, 4.75503504e-03f,
+   -3.88882682e-03f, 3.04450723e-03f, -2.27088528e-03f, 1.59908272e-03f,
+   -1.04469969e-03f, 6.10581716e-04f, -2.89927761e-04f, 6.93474940e-05f,
+   6.83110120e-05f, -1.41503595e-04f, 1.68081489e-04f, -1.63920748e-04f,
+   1.42108693e-04f, -1.12620321e-04f, 8.23719893e-05f, -5.55923434e-05f,
+   3.43234351e-05f, -1.90076989e-05f, 9.05330398e-06f, -3.32567856e-06f,
+   7.39608026e-07f, 7.97617645e-07f, -6.01649845e-06f, 1.76213034e-05f,
+   -3.89779234e-05f, 7.38559029e-05f, -1.25937178e-04f, 1.98115289e-04f,
+   -2.91582488e-04f, 4.04767110e-04f, -5.32181235e-04f, 6.63320592e-04f,
+   -7.81782437e-04f, 8.64753034e-04f, -8.83057888e-04f, 8.01822287e-04f,
+   -5.82077657e-04f, 1.83223325e-04f, 4.33770823e-04f, -1.30231155e-03f,
+   2.44558346e-03f, -3.87156405e-03f, 5.56833111e-03f, -7.49951648e-03f,
+   9.60048381e-03f, -1.17753716e-02f, 1.38954306e-02f, -1.57979298e-02f,
+   1.72853712e-02f, -1.81237441e-02f, 1.80372559e-02f, -1.66955274e-02f,
+   1.36831179e-02f, -8.43163300e-03f, 6.48576097e-05f, 1.29850795e-02f,
+   -3.40698846e-02f, 7.22577572e-02f, -1.64174438e-01f, 8.06961596e-01f,
+   4.21957076e-01f, -1.81794405e-01f, 1.15972847e-01f, -8.24136436e-02f,
+   6.06114641e-02f, -4.46260534e-02f, 3.21618915e-02f, -2.21733619e-02f,
+   1.41218901e-02f, -7.69285113e-03f, 2.67228438e-03f, 1.11097016e-03f,
+   -3.81199364e-03f, 5.58203598e-03f, -6.57158997e-03f, 6.92956150e-03f,
+   -6.79974491e-03f, 6.31680759e-03f, -5.60231693e-03f, 4.76141460e-03f,
+   -3.88054037e-03f, 3.02674319e-03f, -2.24792585e-03f, 1.57426647e-03f,
+   -1.02047843e-03f, 5.88564086e-04f, -2.71027442e-04f, 5.39346220e-05f,
+   8.02811992e-05f, -1.50359454e-04f, 1.74303510e-04f, -1.68043582e-04f,
+   1.44659920e-04f, -1.14069153e-04f, 8.31015350e-05f, -5.58943757e-05f,
+   3.44027030e-05f, -1.89943185e-05f, 9.01956628e-06f, -3.30432840e-06f,
+   6.28798261e-07f, 1.03162472e-06f, -6.42692112e-06f, 1.82548029e-05f,
+   -3.98533703e-05f, 7.49369065e-05f, -1.27100284e-04f, 1.99106958e-04f,
+   -2.91981298e-04f, 4.03948390e-04f, -5.29292389e-04f, 6.57277997e-04f,
+   -7.71289458e-04f, 8.48373922e-04f, -8.59295658e-04f, 7.69266393e-04f,
+   -5.39632456e-04f, 1.30272500e-04f, 4.97064088e-04f, -1.37476530e-03f,
+   2.52462504e-03f, -3.95312905e-03f, 5.64658782e-03f, -7.56666344e-03f,
+   9.64679662e-03f, -1.17892548e-02f, 1.38634956e-02f, -1.57052614e-02f,
+   1.71158537e-02f, -1.78603753e-02f, 1.76624320e-02f, -1.61911752e-02f,
+   1.30304163e-02f, -7.61028938e-03f, -9.49179172e-04f, 1.42244007e-02f,
+   -3.55863124e-02f, 7.41461739e-02f, -1.66583031e-01f, 8.01937401e-01f,
+   4.29512024e-01f, -1.83321983e-01f, 1.16373114e-01f, -8.23603496e-02f,
+   6.03302047e-02f, -4.42249924e-02f, 3.17041725e-02f, -2.17000265e-02f,
+   1.36610717e-02f, -7.26378383e-03f, 2.28738901e-03f, 1.44431589e-03f,
+   -4.09071567e-03f, 5.80644282e-03f, -6.74460363e-03f, 7.05599785e-03f,
+   -6.88566174e-03f, 6.36891369e-03f, -5.62747056e-03f, 4.76617692e-03f,
+   -3.87090584e-03f, 3.00788949e-03f, -2.22412846e-03f, 1.54885184e-03f,
+   -9.95838549e-04f, 5.66272414e-04f, -2.51981895e-04f, 3.84583727e-05f,
+   9.22684630e-05f, -1.59198156e-04f, 1.80487375e-04f, -1.72125030e-04f,
+   1.47174462e-04f, -1.15485738e-04f, 8.38062188e-05f, -5.61786619e-05f,
+   3.44702712e-05f, -1.89739458e-05f, 8.98218605e-06f, -3.28132842e-06f,
+   5.19026401e-07f, 1.26308237e-06f, -6.83212647e-06f, 1.88775484e-05f,
+   -4.07088228e-05f, 7.59865507e-05f, -1.28213636e-04f, 2.00025301e-04f,
+   -2.92277662e-04f, 4.02993785e-04f, -5.26232063e-04f, 6.51029812e-04f,
+   -7.60571624e-04f, 8.31759127e-04f, -8.35307350e-04f, 7.36557413e-04f,
+   -4.97128000e-04f, 7.74110304e-05f, 5.60033834e-04f, -1.44653162e-03f,
+   2.60260003e-03f, -4.03316552e-03f, 5.72269689e-03f, -7.63106486e-03f,
+   9.68973897e-03f, -1.17990877e-02f, 1.38268806e-02f, -1.56073999e-02f,
+   1.69408303e-02f, -1.75913963e-02f, 1.72823519e-02f, -1.56823322e-02f,
+   1.23747429e-02f, -6.78836135e-03f, -1.96011201e-03f, 1.54549973e-02f,
+   -3.70844901e-02f, 7.59987459e-02f, -1.68912083e-01f, 7.96834290e-01f,
+   4.37060773e-01f, -1.84798345e-01f, 1.16735503e-01f, -8.22786987e-02f,
+   6.00274205e-02f, -4.38076928e-02f, 3.12344525e-02f, -2.12182272e-02f,
+   1.31945396e-02f, -6.83122175e-03f, 1.90088199e-03f, 1.77782634e-03f,
+   -4.36863489e-03f, 6.02931203e-03f, -6.91568572e-03f, 7.18029914e-03f,
+   -6.96938857e-03f, 6.41895132e-03f, -5.65073965e-03f, 4.76931687e-03f,
+   -3.85992043e-03f, 2.98797223e-03f, -2.19952362e-03f, 1.52283628e-03f,
+   -9.70787718e-04f, 5.43735572e-04f, -2.32797465e-04f, 2.29187954e-05f,
+   1.04257044e-04f, -1.68008279e-04f, 1.86632504e-04f, -1.76163609e-04f,
+   1.49646716e-04f, -1.16867828e-04f, 8.44845563e-05f, -5.64447073e-05f,
+   3.45260160e-05f, -1.89466664e-05f, 8.94106324e-06f, -3.25670953e-06f,
+   4.10252625e-07f, 1.49207312e-06f, -7.23226276e-06f, 1.94897057e-05f,
+   -4.15465038e-05f, 7.70052065e-05f, -1.29277658e-04f, 2.00870854e-04f,
+   -2.92471959e-04f, 4.01903584e-04f, -5.23001712e-04f, 6.44578657e-04f,
+   -7.49620493e-04f, 8.14898347e-04f, -8.11101403e-04f, 7.03675847e-04f,
+   -4.54537832e-04f, 2.46567306e-05f, 6.22658583e-04f, -1.51768187e-03f,
+   2.67955963e-03f, -4.11164621e-03f, 5.79671422e-03f, -7.69273657e-03f,
+   9.72927734e-03f, -1.18048703e-02f, 1.37856249e-02f, -1.55044189e-02f,
+   1.67603735e-02f, -1.73169971e-02f, 1.68971550e-02f, -1.51692657e-02f,
+   1.17163267e-02f, -5.96612925e-03f, -2.96760723e-03f, 1.66761838e-02f,
+   -3.85641754e-02f, 7.78152943e-02f, -1.71161801e-01f, 7.91653454e-01f,
+   4.44601566e-01f, -1.86222732e-01f, 1.17059730e-01f, -8.21686089e-02f,
+   5.97032420e-02f, -4.33743857e-02f, 3.07529774e-02f, -2.07281075e-02f,
+   1.27226701e-02f, -6.39551552e-03f, 1.51301804e-03f, 2.11138767e-03f,
+   -4.64556366e-03f, 6.25056121e-03f, -7.08471937e-03f, 7.30236014e-03f,
+   -7.05093425e-03f, 6.46690000e-03f, -5.67213818e-03f, 4.77082981e-03f,
+   -3.84758622e-03f, 2.96697533e-03f, -2.17408338e-03f, 1.49622967e-03f,
+   -9.45333741e-04f, 5.20938367e-04f, -2.13461404e-04f, 7.32107947e-06f,
+   1.16254596e-04f, -1.76797912e-04f, 1.92736712e-04f, -1.80157876e-04f,
+   1.52079432e-04f, -1.18217169e-04f, 8.51375517e-05f, -5.66925410e-05f,
+   3.45699482e-05f, -1.89122384e-05f, 8.89621879e-06f, -3.23044969e-06f,
+   3.02717439e-07f, 1.71854367e-06f, -7.62669015e-06f, 2.00912309e-05f,
+   -4.23644451e-05f, 7.79905095e-05f, -1.30291446e-04f, 2.01643124e-04f,
+   -2.92564830e-04f, 4.00679477e-04f, -5.19602618e-04f, 6.37926103e-04f,
+   -7.38449686e-04f, 7.97814108e-04f, -7.86679913e-04f, 6.70632930e-04f,
+   -4.11918096e-04f, -2.79725755e-05f, 6.84938335e-04f, -1.58812338e-03f,
+   2.75540282e-03f, -4.18855064e-03f, 5.86861791e-03f, -7.75166275e-03f,
+   9.76542011e-03f, -1.18066119e-02f, 1.37397377e-02f, -1.53963491e-02f,
+   1.65745225e-02f, -1.70372352e-02f, 1.65069196e-02f, -1.46520734e-02f,
+   1.10554518e-02f, -5.14393952e-03f, -3.97133315e-03f, 1.78878792e-02f,
+   -4.00247052e-02f, 7.95952752e-02f, -1.73332229e-01f, 7.86395788e-01f,
+   4.52133328e-01f, -1.87594220e-01f, 1.17345475e-01f, -8.20300058e-02f,
+   5.93576469e-02f, -4.29250747e-02f, 3.02598849e-02f, -2.02298611e-02f,
+   1.22453058e-02f, -5.95666701e-03f, 1.12386420e-03f, 2.44493969e-03f,
+   -4.92145168e-03f, 6.47014892e-03f, -7.25169806e-03f, 7.42221251e-03f,
+   -7.13023683e-03f, 6.51275227e-03f, -5.69163589e-03f, 4.77071293e-03f,
+   -3.83390533e-03f, 2.94489996e-03f, -2.14784173e-03f, 1.46903831e-03f,
+   -9.19474754e-04f, 4.97887842e-04f, -1.93998756e-04f, -8.32957994e-06f,
+   1.28256856e-04f, -1.85555400e-04f, 1.98797876e-04f, -1.84107164e-04f,
+   1.54469235e-04f, -1.19530516e-04f, 8.57638006e-05f, -5.69216863e-05f,
+   3.46017623e-05f, -1.88707636e-05f, 8.84772817e-06f, -3.20252366e-06f,
+   1.96244898e-07f, 1.94242170e-06f, -8.01530314e-06f, 2.06819532e-05f,
+   -4.31630397e-05f, 7.89444966e-05f, -1.31255743e-04f, 2.02342097e-04f,
+   -2.92556448e-04f, 3.99321551e-04f, -5.16036351e-04f, 6.31078205e-04f,
+   -7.27060949e-04f, 7.80502916e-04f, -7.62066338e-04f, 6.37461955e-04f,
+   -3.69269546e-04f, -8.04761803e-05f, 7.46812206e-04f, -1.65785616e-03f,
+   2.83015752e-03f, -4.26388020e-03f, 5.93833812e-03f, -7.80781871e-03f,
+   9.79814585e-03f, -1.18043199e-02f, 1.36892516e-02f, -1.52832214e-02f,
+   1.63833834e-02f, -1.67521760e-02f, 1.61118489e-02f, -1.41309425e-02f,
+   1.03922421e-02f, -4.32193838e-03f, -4.97087883e-03f, 1.90895088e-02f,
+   -4.14657854e-02f, 8.13383907e-02f, -1.75423488e-01f, 7.81062424e-01f,
+   4.59654391e-01f, -1.88911974e-01f, 1.17592476e-01f, -8.18628371e-02f,
+   5.89907356e-02f, -4.24599051e-02f, 2.97552329e-02f, -1.97235551e-02f,
+   1.17627513e-02f, -5.51488902e-03f, 7.33487250e-04f, 2.77831452e-03f,
+   -5.19624539e-03f, 6.68796012e-03f, -7.41650676e-03f, 7.53977057e-03f,
+   -7.20725348e-03f, 6.55645970e-03f, -5.70922811e-03f, 4.76896018e-03f,
+   -3.81887052e-03f, 2.92176940e-03f, -2.12079589e-03f, 1.44125975e-03f,
+   -8.93236778e-04f, 4.74606204e-04f, -1.74403249e-04f, -2.40330537e-05f,
+   1.40251941e-04f, -1.94280583e-04f, 2.04815282e-04f, -1.88007834e-04f,
+   1.56815295e-04f, -1.20808734e-04f, 8.63630703e-05f, -5.71321834e-05f,
+   3.46215420e-05f, -1.88222421e-05f, 8.79542040e-06f, -3.17293120e-06f,
+   9.08665356e-08f, 2.16364083e-06f, -8.39879431e-06f, 2.12620507e-05f,
+   -4.39420728e-05f, 7.98668771e-05f, -1.32170273e-04f, 2.02968702e-04f,
+   -2.92447163e-04f, 3.97831725e-04f, -5.12305822e-04f, 6.24036475e-04f,
+   -7.15455797e-04f, 7.62981188e-04f, -7.37262832e-04f, 6.04153029e-04f,
+   -3.26593290e-04f, -1.32802394e-04f, 8.08279845e-04f, -1.72688183e-03f,
+   2.90375040e-03f, -4.33756132e-03f, 6.00590464e-03f, -7.86118954e-03f,
+   9.82746202e-03f, -1.17980028e-02f, 1.36342086e-02f, -1.51651176e-02f,
+   1.61870588e-02f, -1.64620169e-02f, 1.57121569e-02f, -1.36062270e-02f,
+   9.72698070e-03f, -3.50047043e-03f, -5.96607942e-03f, 2.02808902e-02f,
+   -4.28870767e-02f, 8.30443427e-02f, -1.77435622e-01f, 7.75654376e-01f,
+   4.67163473e-01f, -1.90175176e-01f, 1.17800459e-01f, -8.16670507e-02f,
+   5.86025082e-02f, -4.19790335e-02f, 2.92392503e-02f, -1.92094296e-02f,
+   1.12752402e-02f, -5.07047214e-03f, 3.42145009e-04f, 3.11128958e-03f,
+   -5.46976086e-03f, 6.90388260e-03f, -7.57910963e-03f, 7.65497098e-03f,
+   -7.28197722e-03f, 6.59801718e-03f, -5.72490878e-03f, 4.76557016e-03f,
+   -3.80249834e-03f, 2.89757131e-03f, -2.09294260e-03f, 1.41292217e-03f,
+   -8.66618298e-04f, 4.51085682e-04f, -1.54694018e-04f, -3.97738768e-05f,
+   1.52239678e-04f, -2.02972820e-04f, 2.10783270e-04f, -1.91859363e-04f,
+   1.59119314e-04f, -1.22051584e-04f, 8.69358191e-05f, -5.73238722e-05f,
+   3.46292400e-05f, -1.87664318e-05f, 8.73933550e-06f, -3.14167187e-06f,
+   -1.31842306e-08f, 2.38215762e-06f, -8.77628190e-06f, 2.18302612e-05f,
+   -4.47014645e-05f, 8.07561883e-05f, -1.33034351e-04f, 2.03522301e-04f,
+   -2.92237441e-04f, 3.96210875e-04f, -5.08412661e-04f, 6.16804697e-04f,
+   -7.03648897e-04f, 7.45256664e-04f, -7.12278066e-04f, 5.70750330e-04f,
+   -2.83945439e-04f, -1.84950724e-04f, 8.69321695e-04f, -1.79510959e-03f,
+   2.97616026e-03f, -4.40959958e-03f, 6.07122993e-03f, -7.91174918e-03f,
+   9.85336676e-03f, -1.17876697e-02f, 1.35746030e-02f, -1.50420517e-02f,
+   1.59856007e-02f, -1.61667727e-02f, 1.53079201e-02f, -1.30778579e-02f,
+   9.05989949e-03f, -2.67981365e-03f, -6.95652841e-03f, 2.14615613e-02f,
+   -4.42880616e-02f, 8.47126245e-02f, -1.79368779e-01f, 7.70172775e-01f,
+   4.74659175e-01f, -1.91383019e-01f, 1.17969163e-01f, -8.14426169e-02f,
+   5.81930317e-02f, -4.14824598e-02f, 2.87119597e-02f, -1.86875146e-02f,
+   1.07827689e-02f, -4.62327339e-03f, -5.01577488e-05f, 3.44396685e-03f,
+   -5.74198971e-03f, 7.11787399e-03f, -7.73947360e-03f, 7.76779000e-03f,
+   -7.35434191e-03f, 6.63740467e-03f, -5.73865417e-03f, 4.76054195e-03f,
+   -3.78478295e-03f, 2.87233572e-03f, -2.06431956e-03f, 1.38402334e-03f,
+   -8.39627814e-04f, 4.27356834e-04f, -1.34877424e-04f, -5.55518345e-05f,
+   1.64215715e-04f, -2.11620951e-04f, 2.16699351e-04f, -1.95659959e-04f,
+   1.61376171e-04f, -1.23257021e-04f, 8.74808175e-05f, -5.74963997e-05f,
+   3.46245652e-05f, -1.87034802e-05f, 8.67957624e-06f, -3.10872292e-06f,
+   -1.16148378e-07f, 2.59803824e-06f, -9.14791599e-06f, 2.23880197e-05f,
+   -4.54414694e-05f, 8.16128668e-05f, -1.33849098e-04f, 2.04003343e-04f,
+   -2.91927921e-04f, 3.94458824e-04f, -5.04358497e-04f, 6.09384617e-04f,
+   -6.91630587e-04f, 7.27319159e-04f, -6.87120948e-04f, 5.37233602e-04f,
+   -2.41285161e-04f, -2.36903696e-04f, 9.29917675e-04f, -1.86260801e-03f,
+   3.04743648e-03f, -4.47997171e-03f, 6.13436382e-03f, -7.95950834e-03f,
+   9.87584982e-03f, -1.17733348e-02f, 1.35104926e-02f, -1.49141159e-02f,
+   1.57790873e-02f, -1.58666503e-02f, 1.48992902e-02f, -1.25462366e-02f,
+   8.39122944e-03f, -1.86024455e-03f, -7.94190355e-03f, 2.26311572e-02f,
+   -4.56684679e-02f, 8.63430500e-02f, -1.81223214e-01f, 7.64618695e-01f,
+   4.82139885e-01f, -1.92534670e-01f, 1.18098326e-01f, -8.11894909e-02f,
+   5.77624813e-02f, -4.09704745e-02f, 2.81736813e-02f, -1.81581415e-02f,
+   1.02857370e-02f, -4.17365786e-03f, -4.43097699e-04f, 3.77606950e-03f,
+   -6.01274846e-03f, 7.32985558e-03f, -7.89748784e-03f, 7.87818246e-03f,
+   -7.42436480e-03f, 6.67460635e-03f, -5.75047033e-03f, 4.75386716e-03f,
+   -3.76572832e-03f, 2.84604635e-03f, -2.03489559e-03f, 1.35457213e-03f,
+   -8.12273938e-04f, 4.03403857e-04f, -1.14940747e-04f, -7.13616391e-05f,
+   1.76175963e-04f, -2.20232760e-04f, 2.22566799e-04f, -1.99408634e-04f,
+   1.63588295e-04f, -1.24426253e-04f, 8.79982254e-05f, -5.76497623e-05f,
+   3.46076049e-05f, -1.86333309e-05f, 8.61591798e-06f, -3.07406481e-06f,
+   -2.17796185e-07f, 2.81080543e-06f, -9.51362563e-06f, 2.29340276e-05f,
+   -4.61605123e-05f, 8.24369199e-05f, -1.34612870e-04f, 2.04411685e-04f,
+   -2.91518809e-04f, 3.92578135e-04f, -5.00144961e-04f, 6.01777923e-04f,
+   -6.79417106e-04f, 7.09191605e-04f, -6.61801139e-04f, 5.03614137e-04f,
+   -1.98668582e-04f, -2.88644136e-04f, 9.90067492e-04f, -1.92928931e-03f,
+   3.11748520e-03f, -4.54865908e-03f, 6.19528862e-03f, -8.00445769e-03f,
+   9.89491865e-03f, -1.17550064e-02f, 1.34418868e-02f, -1.47813400e-02f,
+   1.55675597e-02f, -1.55617138e-02f, 1.44863464e-02f, -1.20114218e-02f,
+   7.72125507e-03f, -1.04210537e-03f, -8.92180577e-03f, 2.37893164e-02f,
+   -4.70278002e-02f, 8.79352093e-02f, -1.82999000e-01f, 7.58993208e-01f,
+   4.89604503e-01f, -1.93629354e-01f, 1.18187718e-01f, -8.09076577e-02f,
+   5.73108308e-02f, -4.04430889e-02f, 2.76244450e-02f, -1.76213440e-02f,
+   9.78398137e-03f, -3.72162741e-03f, -8.36797117e-04f, 4.10759076e-03f,
+   -6.28198637e-03f, 7.53978733e-03f, -8.05312023e-03f, 7.98612367e-03f,
+   -7.49199325e-03f, 6.70961244e-03f, -5.76034607e-03f, 4.74555092e-03f,
+   -3.74533935e-03f, 2.81870645e-03f, -2.00470770e-03f, 1.32457784e-03f,
+   -7.84555043e-04f, 3.79234378e-04f, -9.49098830e-05f, -8.71978700e-05f,
+   1.88120117e-04f, -2.28796780e-04f, 2.28378136e-04f, -2.03104646e-04f,
+   1.65752601e-04f, -1.25556733e-04f, 8.84872934e-05f, -5.77836618e-05f,
+   3.45783374e-05f, -1.85559038e-05f, 8.54851623e-06f, -3.03776119e-06f,
+   -3.18101542e-07f, 3.02084027e-06f, -9.87330986e-06f, 2.34681520e-05f,
+   -4.68599246e-05f, 8.32281585e-05f, -1.35326918e-04f, 2.04747441e-04f,
+   -2.91011005e-04f, 3.90569126e-04f, -4.95773274e-04f, 5.93992474e-04f,
+   -6.67008921e-04f, 6.90870278e-04f, -6.36319164e-04f, 4.69925551e-04f,
+   -1.56096517e-04f, -3.40171449e-04f, 1.04971265e-03f, -1.99515373e-03f,
+   3.18633276e-03f, -4.61566355e-03f, 6.25394471e-03f, -8.04657955e-03f,
+   9.91056580e-03f, -1.17327003e-02f, 1.33688385e-02f, -1.46437595e-02f,
+   1.53511390e-02f, -1.52520286e-02f, 1.40693039e-02f, -1.14736026e-02f,
+   7.05009932e-03f, -2.25537573e-04f, -9.89607628e-03f, 2.49355938e-02f,
+   -4.83658053e-02f, 8.94887373e-02f, -1.84696347e-01f, 7.53297567e-01f,
+   4.97051388e-01f, -1.94666281e-01f, 1.18237108e-01f, -8.05971175e-02f,
+   5.68382479e-02f, -3.99005264e-02f, 2.70644557e-02f, -1.70773324e-02f,
+   9.27782431e-03f, -3.26747866e-03f, -1.23099529e-03f, 4.43836208e-03f,
+   -6.54965127e-03f, 7.74755655e-03f, -8.20633490e-03f, 8.09155311e-03f,
+   -7.55718909e-03f, 6.74238801e-03f, -5.76826790e-03f, 4.73558577e-03f,
+   -3.72360996e-03f, 2.79034139e-03f, -1.97375542e-03f, 1.29403779e-03f,
+   -7.56498834e-04f, 3.54871881e-04f, -7.47848899e-05f, -1.03060323e-04f,
+   2.00036200e-04f, -2.37312852e-04f, 2.34134553e-04f, -2.06744211e-04f,
+   1.67868304e-04f, -1.26649145e-04f, 8.89480434e-05f, -5.78980034e-05f,
+   3.45364751e-05f, -1.84711989e-05f, 8.47738647e-06f, -2.99972976e-06f,
+   -4.17234816e-07f, 3.22806454e-06f, -1.02268677e-05f, 2.39914134e-05f,
+   -4.75394845e-05f, 8.39863860e-05f, -1.35990762e-04f, 2.05011311e-04f,
+   -2.90404627e-04f, 3.88432731e-04f, -4.91248036e-04f, 5.86028793e-04f,
+   -6.54407777e-04f, 6.72372757e-04f, -6.10700576e-04f, 4.36158211e-04f,
+   -1.13569557e-04f, -3.91435140e-04f, 1.10885326e-03f, -2.06020311e-03f,
+   3.25391139e-03f, -4.68091993e-03f, 6.31034002e-03f, -8.08586553e-03f,
+   9.92279779e-03f, -1.17064370e-02f, 1.32913720e-02f, -1.45014757e-02f,
+   1.51299778e-02f, -1.49378078e-02f, 1.36483815e-02f, -1.09331422e-02f,
+   6.37810118e-03f, 5.89052914e-04f, -1.08643221e-02f, 2.60698274e-02f,
+   -4.96820547e-02f, 9.10034552e-02f, -1.86315477e-01f, 7.47532785e-01f,
+   5.04479170e-01f, -1.95644647e-01f, 1.18246287e-01f, -8.02578330e-02f,
+   5.63447475e-02f, -3.93428430e-02f, 2.64939237e-02f, -1.65263247e-02f,
+   8.76751170e-03f, -2.81128893e-03f, -1.62549457e-03f, 4.76816250e-03f,
+   -6.81556109e-03f, 7.95302261e-03f, -8.35702568e-03f, 8.19441397e-03f,
+   -7.61994580e-03f, 6.77292561e-03f, -5.77423256e-03f, 4.72397916e-03f,
+   -3.70055973e-03f, 2.76095071e-03f, -1.94203493e-03f, 1.26298284e-03f,
+   -7.28104555e-04f, 3.30307957e-04f, -5.45659168e-05f, -1.18933283e-04f,
+   2.11924023e-04f, -2.45780335e-04f, 2.39830159e-04f, -2.10327213e-04f,
+   1.69936844e-04f, -1.27702995e-04f, 8.93803735e-05f, -5.79926964e-05f,
+   3.44820946e-05f, -1.83792163e-05f, 8.40231678e-06f, -2.95996961e-06f,
+   -5.14974033e-07f, 3.43216470e-06f, -1.05742411e-05f, 2.45025858e-05f,
+   -4.81977513e-05f, 8.47116535e-05f, -1.36604023e-04f, 2.05203134e-04f,
+   -2.89700838e-04f, 3.86172149e-04f, -4.86569916e-04f, 5.77890838e-04f,
+   -6.41629857e-04f, 6.53706724e-04f, -5.84947120e-04f, 4.02356149e-04f,
+   -7.11435132e-05f, -4.42435005e-04f, 1.16747082e-03f, -2.12435331e-03f,
+   3.32020316e-03f, -4.74443519e-03f, 6.36446103e-03f, -8.12228769e-03f,
+   9.93161742e-03f, -1.16762258e-02f, 1.32095097e-02f, -1.43544991e-02f,
+   1.49040185e-02f, -1.46190654e-02f, 1.32236639e-02f, -1.03899697e-02f,
+   5.70532866e-03f, 1.40159228e-03f, -1.18262302e-02f, 2.71915775e-02f,
+   -5.09761497e-02f, 9.24789533e-02f, -1.87856615e-01f, 7.41700053e-01f,
+   5.11886537e-01f, -1.96563691e-01f, 1.18215047e-01f, -7.98898339e-02f,
+   5.58304749e-02f, -3.87701839e-02f, 2.59128772e-02f, -1.59683526e-02f,
+   8.25312920e-03f, -2.35313550e-03f, -2.02028872e-03f, 5.09709073e-03f,
+   -7.07970839e-03f, 8.15624371e-03f, -8.50518700e-03f, 8.29468202e-03f,
+   -7.68020563e-03f, 6.80120802e-03f, -5.77823212e-03f, 4.71073296e-03f,
+   -3.67618655e-03f, 2.73054023e-03f, -1.90958916e-03f, 1.23142172e-03f,
+   -6.99380354e-04f, 3.05575057e-04f, -3.42793865e-05f, -1.34816481e-04f,
+   2.23779149e-04f, -2.54187966e-04f, 2.45462987e-04f, -2.13851861e-04f,
+   1.71953667e-04f, -1.28716783e-04f, 8.97831778e-05f, -5.80674678e-05f,
+   3.44151413e-05f, -1.82798885e-05f, 8.32349087e-06f, -2.91855690e-06f,
+   -6.11422536e-07f, 3.63321737e-06f, -1.09155499e-05f, 2.50018929e-05f,
+   -4.88363621e-05f, 8.54043028e-05f, -1.37167852e-04f, 2.05323100e-04f,
+   -2.88899959e-04f, 3.83785577e-04f, -4.81740833e-04f, 5.69581694e-04f,
+   -6.28664275e-04f, 6.34861412e-04f, -5.59067004e-04f, 3.68498499e-04f,
+   -2.87776784e-05f, -4.93154046e-04f, 1.22554635e-03f, -2.18764693e-03f,
+   3.38525325e-03f, -4.80618840e-03f, 6.41628960e-03f, -8.15588050e-03f,
+   9.93702840e-03f, -1.16420984e-02f, 1.31233148e-02f, -1.42029598e-02f,
+   1.46734556e-02f, -1.42960241e-02f, 1.27953039e-02f, -9.84453689e-03f,
+   5.03222924e-03f, 2.21161195e-03f, -1.27814924e-02f, 2.83005070e-02f,
+   -5.22478484e-02f, 9.39150900e-02f, -1.89319998e-01f, 7.35800564e-01f,
+   5.19271970e-01f, -1.97422668e-01f, 1.18143193e-01f, -7.94931352e-02f,
+   5.52955382e-02f, -3.81828472e-02f, 2.53216792e-02f, -1.54037755e-02f,
+   7.73484120e-03f, -1.89331966e-03f, -2.41505122e-03f, 5.42487251e-03f,
+   -7.34191388e-03f, 8.35704710e-03f, -8.65071267e-03f, 8.39231722e-03f,
+   -7.73798255e-03f, 6.82722637e-03f, -5.78026287e-03f, 4.69583226e-03f,
+   -3.65049695e-03f, 2.69911857e-03f, -1.87638355e-03f, 1.19933207e-03f,
+   -6.70336478e-04f, 2.80656881e-04f, -1.39056674e-05f, -1.50704524e-04f,
+   2.35597472e-04f, -2.62543646e-04f, 2.51036079e-04f, -2.17316861e-04f,
+   1.73920984e-04f, -1.29691354e-04f, 9.01571548e-05f, -5.81222339e-05f,
+   3.43355750e-05f, -1.81731557e-05f, 8.24078143e-06f, -2.87537523e-06f,
+   -7.06365483e-07f, 3.83118504e-06f, -1.12502967e-05f, 2.54892893e-05f,
+   -4.94539345e-05f, 8.60626897e-05f, -1.37680836e-04f, 2.05371762e-04f,
+   -2.88002338e-04f, 3.81276419e-04f, -4.76763555e-04f, 5.61102002e-04f,
+   -6.15528435e-04f, 6.15860918e-04f, -5.33069950e-04f, 3.34597280e-04f,
+   1.34724114e-05f, -5.43576025e-04f, 1.28307962e-03f, -2.25006440e-03f,
+   3.44897644e-03f, -4.86616325e-03f, 6.46583363e-03f, -8.18661693e-03f,
+   9.93903447e-03f, -1.16040548e-02f, 1.30327949e-02f, -1.40468255e-02f,
+   1.44383032e-02f, -1.39687499e-02f, 1.23633835e-02f, -9.29677114e-03f,
+   4.35886951e-03f, 3.01884324e-03f, -1.37297269e-02f, 2.93961931e-02f,
+   -5.34967072e-02f, 9.53114778e-02f, -1.90705881e-01f, 7.29835451e-01f,
+   5.26634097e-01f, -1.98220849e-01f, 1.18030548e-01f, -7.90677816e-02f,
+   5.47400527e-02f, -3.75808515e-02f, 2.47203615e-02f, -1.48326326e-02f,
+   7.21273245e-03f, -1.43184559e-03f, -2.80990335e-03f, 5.75150037e-03f,
+   -7.60212634e-03f, 8.55542254e-03f, -8.79357290e-03f, 8.48729722e-03f,
+   -7.79323326e-03f, 6.85096858e-03f, -5.78031689e-03f, 4.67929430e-03f,
+   -3.62349418e-03f, 2.66668363e-03f, -1.84245978e-03f, 1.16675638e-03f,
+   -6.40971528e-04f, 2.55561114e-04f, 6.52859899e-06f, -1.66591810e-04f,
+   2.47378601e-04f, -2.70836230e-04f, 2.56541854e-04f, -2.20720889e-04f,
+   1.75835623e-04f, -1.30624598e-04f, 9.05012566e-05f, -5.81569511e-05f,
+   3.42432650e-05f, -1.80591014e-05f, 8.15439307e-06f, -2.83050508e-06f,
+   -7.99971815e-07f, 4.02601472e-06f, -1.15783569e-05f, 2.59646440e-05f,
+   -5.00508213e-05f, 8.66883856e-05f, -1.38144009e-04f, 2.05349250e-04f,
+   -2.87009112e-04f, 3.78645665e-04f, -4.71638254e-04f, 5.52460784e-04f,
+   -6.02222921e-04f, 5.96700760e-04f, -5.06957236e-04f, 3.00685671e-04f,
+   5.56062769e-05f, -5.93700272e-04f, 1.34001474e-03f, -2.31154589e-03f,
+   3.51139670e-03f, -4.92436392e-03f, 6.51304564e-03f, -8.21449235e-03f,
+   9.93764214e-03f, -1.15621239e-02f, 1.29380208e-02f, -1.38862021e-02f,
+   1.41986869e-02f, -1.36373099e-02f, 1.19281281e-02f, -8.74704029e-03f,
+   3.68553400e-03f, 3.82314972e-03f, -1.46707855e-02f, 3.04784868e-02f,
+   -5.47224507e-02f, 9.66679379e-02f, -1.92014560e-01f, 7.23805964e-01f,
+   5.33971608e-01f, -1.98957458e-01f, 1.17876954e-01f, -7.86137879e-02f,
+   5.41641973e-02f, -3.69644575e-02f, 2.41092071e-02f, -1.42551987e-02f,
+   6.68705674e-03f, -9.69017507e-04f, -3.20458272e-03f, 6.07675407e-03f,
+   -7.86029454e-03f, 8.75126570e-03f, -8.93373508e-03f, 8.57956801e-03f,
+   -7.84592330e-03f, 6.87241042e-03f, -5.77839278e-03f, 4.66111535e-03f,
+   -3.59517662e-03f, 2.63326475e-03f, -1.80781784e-03f, 1.13368209e-03f,
+   -6.11314026e-04f, 2.30312653e-04f, 2.70231922e-05f, -1.82478077e-04f,
+   2.59110820e-04f, -2.79064989e-04f, 2.61981768e-04f, -2.24063187e-04f,
+   1.77697249e-04f, -1.31516819e-04f, 9.08153597e-05f, -5.81713393e-05f,
+   3.41382038e-05f, -1.79378258e-05f, 8.06410208e-06f, -2.78391258e-06f,
+   -8.92215326e-07f, 4.21765299e-06f, -1.19003525e-05f, 2.64281825e-05f,
+   -5.06267315e-05f, 8.72812088e-05f, -1.38557283e-04f, 2.05255667e-04f,
+   -2.85920920e-04f, 3.75893549e-04f, -4.66370693e-04f, 5.43658563e-04f,
+   -5.88748895e-04f, 5.77400206e-04f, -4.80754155e-04f, 2.66764779e-04f,
+   9.76233932e-05f, -6.43477833e-04f, 1.39635324e-03f, -2.37211166e-03f,
+   3.57245421e-03f, -4.98073315e-03f, 6.55793166e-03f, -8.23949836e-03f,
+   9.93285980e-03f, -1.15163382e-02f, 1.28390193e-02f, -1.37211839e-02f,
+   1.39547763e-02f, -1.33019313e-02f, 1.14898328e-02f, -8.19553621e-03f,
+   3.01250559e-03f, 4.62413486e-03f, -1.56042157e-02f, 3.15469764e-02f,
+   -5.59248105e-02f, 9.79843363e-02f, -1.93246350e-01f, 7.17713296e-01f,
+   5.41282833e-01f, -1.99631795e-01f, 1.17682233e-01f, -7.81311914e-02f,
+   5.35680056e-02f, -3.63337398e-02f, 2.34882962e-02f, -1.36715621e-02f,
+   6.15807250e-03f, -5.04915719e-04f, -3.59888910e-03f, 6.40057214e-03f,
+   -8.11624248e-03f, 8.94444436e-03f, -9.07110143e-03f, 8.66907649e-03f,
+   -7.89604615e-03f, 6.89154584e-03f, -5.77448262e-03f, 4.64129122e-03f,
+   -3.56556848e-03f, 2.59886193e-03f, -1.77245494e-03f, 1.10014109e-03f,
+   -5.81364206e-04f, 2.04902899e-04f, 4.75779016e-05f, -1.98347596e-04f,
+   2.70793476e-04f, -2.87229719e-04f, 2.67350144e-04f, -2.27340701e-04f,
+   1.79507071e-04f, -1.32368135e-04f, 9.10996896e-05f, -5.81653003e-05f,
+   3.40203878e-05f, -1.78089740e-05f, 7.96991753e-06f, -2.73562364e-06f,
+   -9.82890015e-07f, 4.40606891e-06f, -1.22155807e-05f, 2.68788299e-05f,
+   -5.11818216e-05f, 8.78402207e-05f, -1.38920295e-04f, 2.05091928e-04f,
+   -2.84738926e-04f, 3.73024057e-04f, -4.60961484e-04f, 5.34699415e-04f,
+   -5.75124694e-04f, 5.57966239e-04f, -4.54462192e-04f, 2.32846112e-04f,
+   1.39468815e-04f, -6.92893227e-04f, 1.45207671e-03f, -2.43168487e-03f,
+   3.63213290e-03f, -5.03527746e-03f, 6.60048285e-03f, -8.26163590e-03f,
+   9.92469490e-03f, -1.14667118e-02f, 1.27358157e-02f, -1.35517782e-02f,
+   1.37065072e-02f, -1.29626300e-02f, 1.10483719e-02f, -7.64231663e-03f,
+   2.33984902e-03f, 5.42172976e-03f, -1.65299494e-02f, 3.26013416e-02f,
+   -5.71034215e-02f, 9.92602631e-02f, -1.94401473e-01f, 7.11558521e-01f,
+   5.48566699e-01f, -2.00243145e-01f, 1.17446274e-01f, -7.76200667e-02f,
+   5.29516675e-02f, -3.56889255e-02f, 2.28578690e-02f, -1.30819064e-02f,
+   5.62586822e-03f, -3.96204596e-05f, -3.99275217e-03f, 6.72289357e-03f,
+   -8.36996268e-03f, 9.13500879e-03f, -9.20566265e-03f, 8.75580311e-03f,
+   -7.94355664e-03f, 6.90836227e-03f, -5.76859200e-03f, 4.61984519e-03f,
+   -3.53466836e-03f, 2.56348262e-03f, -1.73641671e-03f, 1.06614444e-03f,
+   -5.51131030e-04f, 1.79365350e-04f, 6.81657912e-05f, -2.14199696e-04f,
+   2.82422465e-04f, -2.95319507e-04f, 2.72645033e-04f, -2.30552701e-04f,
+   1.81260664e-04f, -1.33176742e-04f, 9.13534168e-05f, -5.81389286e-05f,
+   3.38896971e-05f, -1.76727863e-05f, 7.87206773e-06f, -2.68560439e-06f,
+   -1.07221831e-06f, 4.59133707e-06f, -1.25241140e-05f, 2.73178212e-05f,
+   -5.17162916e-05f, 8.83657049e-05f, -1.39233991e-04f, 2.04857613e-04f,
+   -2.83463101e-04f, 3.70035472e-04f, -4.55412694e-04f, 5.25586773e-04f,
+   -5.61341818e-04f, 5.38387278e-04f, -4.28090425e-04f, 1.98941227e-04f,
+   1.81183073e-04f, -7.41978001e-04f, 1.50716712e-03f, -2.49030651e-03f,
+   3.69047327e-03f, -5.08798100e-03f, 6.64068712e-03f, -8.28091335e-03f,
+   9.91315860e-03f, -1.14132706e-02f, 1.26284845e-02f, -1.33781368e-02f,
+   1.34540908e-02f, -1.26196928e-02f, 1.06041152e-02f, -7.08779646e-03f,
+   1.66801049e-03f, 6.21541264e-03f, -1.74474660e-02f, 3.36412750e-02f,
+   -5.82579859e-02f, 1.00495651e-01f, -1.95480362e-01f, 7.05343068e-01f,
+   5.55821598e-01f, -2.00790808e-01f, 1.17168918e-01f, -7.70804584e-02f,
+   5.23153245e-02f, -3.50301899e-02f, 2.22181156e-02f, -1.24865640e-02f,
+   5.09061804e-03f, 4.26560553e-04f, -4.38603573e-03f, 7.04350183e-03f,
+   -8.62124003e-03f, 9.32279695e-03f, -9.33732372e-03f, 8.83971248e-03f,
+   -7.98846316e-03f, 6.92285085e-03f, -5.76071069e-03f, 4.59675258e-03f,
+   -3.50248464e-03f, 2.52713729e-03f, -1.69966707e-03f, 1.03166874e-03f,
+   -5.20624337e-04f, 1.53683402e-04f, 8.88065624e-05f, -2.30029298e-04f,
+   2.93993769e-04f, -3.03338980e-04f, 2.77869229e-04f, -2.33697967e-04f,
+   1.82960328e-04f, -1.33943380e-04f, 9.15765995e-05f, -5.80918277e-05f,
+   3.37460078e-05f, -1.75292789e-05f, 7.77023706e-06f, -2.63383049e-06f,
+   -1.16000558e-06f, 4.77303547e-06f, -1.28259717e-05f, 2.77441122e-05f,
+   -5.22288901e-05f, 8.88580325e-05f, -1.39497512e-04f, 2.04553740e-04f,
+   -2.82094552e-04f, 3.66931257e-04f, -4.49727348e-04f, 5.16321103e-04f,
+   -5.47405914e-04f, 5.18689456e-04f, -4.01647965e-04f, 1.65050966e-04f,
+   2.22711344e-04f, -7.90668128e-04f, 1.56162609e-03f, -2.54795724e-03f,
+   3.74740013e-03f, -5.13882935e-03f, 6.67855050e-03f, -8.29732139e-03f,
+   9.89826024e-03f, -1.13560315e-02f, 1.25170378e-02f, -1.32002169e-02f,
+   1.31975403e-02f, -1.22730229e-02f, 1.01570738e-02f, -6.53189933e-03f,
+   9.97053110e-04f, 7.00511690e-03f, -1.83564797e-02f, 3.46663855e-02f,
+   -5.93881644e-02f, 1.01690225e-01f, -1.96483329e-01f, 6.99068069e-01f,
+   5.63046217e-01f, -2.01274112e-01f, 1.16850071e-01f, -7.65124410e-02f,
+   5.16591892e-02f, -3.43577228e-02f, 2.15692315e-02f, -1.18855806e-02f,
+   4.55241092e-03f, 8.93621356e-04f, -4.77866828e-03f, 7.36238621e-03f,
+   -8.87014531e-03f, 9.50779952e-03f, -9.46605857e-03f, 8.92078225e-03f,
+   -8.03072285e-03f, 6.93500275e-03f, -5.75083448e-03f, 4.57204133e-03f,
+   -3.46902339e-03f, 2.48982408e-03f, -1.66225294e-03f, 9.96757997e-04f,
+   -4.89854137e-04f, 1.27865249e-04f, 1.09473272e-04f, -2.45830626e-04f,
+   3.05506488e-04f, -3.11285141e-04f, 2.83015601e-04f, -2.36775290e-04f,
+   1.84603196e-04f, -1.34666436e-04f, 9.17688303e-05f, -5.80239721e-05f,
+   3.35897057e-05f, -1.73783283e-05f, 7.66466655e-06f, -2.58042473e-06f,
+   -1.24622522e-06f, 4.95151289e-06f, -1.31210763e-05f, 2.81576231e-05f,
+   -5.27207885e-05f, 8.93168908e-05f, -1.39711658e-04f, 2.04180702e-04f,
+   -2.80634325e-04f, 3.63712694e-04f, -4.43905621e-04f, 5.06912009e-04f,
+   -5.33331069e-04f, 4.98866895e-04f, -3.75136005e-04f, 1.31208610e-04f,
+   2.64053524e-04f, -8.38980312e-04f, 1.61539949e-03f, -2.60458258e-03f,
+   3.80291673e-03f, -5.18782716e-03f, 6.71403762e-03f, -8.31086002e-03f,
+   9.88001097e-03f, -1.12950299e-02f, 1.24015575e-02f, -1.30181415e-02f,
+   1.29370317e-02f, -1.19228577e-02f, 9.70748067e-03f, -5.97499590e-03f,
+   3.27311922e-04f, 7.79051986e-03f, -1.92568526e-02f, 3.56765427e-02f,
+   -6.04937188e-02f, 1.02843851e-01f, -1.97410718e-01f, 6.92734778e-01f,
+   5.70239186e-01f, -2.01692358e-01f, 1.16489619e-01f, -7.59161338e-02f,
+   5.09833135e-02f, -3.36717740e-02f, 2.09114719e-02f, -1.12792458e-02f,
+   4.01151134e-03f, 1.36125274e-03f, -5.17045008e-03f, 7.67933205e-03f,
+   -9.11650900e-03f, 9.68991872e-03f, -9.59183276e-03f, 8.99896491e-03f,
+   -8.07032920e-03f, 6.94480445e-03f, -5.73897175e-03f, 4.54570632e-03f,
+   -3.43428273e-03f, 2.45157816e-03f, -1.62417232e-03f, 9.61400743e-04f,
+   -4.58819530e-04f, 1.01936414e-04f, 1.30165528e-04f, -2.61603040e-04f,
+   3.16949503e-04f, -3.19149811e-04f, 2.88085430e-04f, -2.39783971e-04f,
+   1.86188656e-04f, -1.35346054e-04f, 9.19299709e-05f, -5.79353837e-05f,
+   3.34203105e-05f, -1.72199616e-05f, 7.55538258e-06f, -2.52526115e-06f,
+   -1.33103640e-06f, 5.12671795e-06f, -1.34092988e-05f, 2.85592068e-05f,
+   -5.31918340e-05f, 8.97421924e-05f, -1.39876443e-04f, 2.03738236e-04f,
+   -2.79083382e-04f, 3.60379927e-04f, -4.37953597e-04f, 4.97360656e-04f,
+   -5.19113441e-04f, 4.78939852e-04f, -3.48580361e-04f, 9.74148061e-05f,
+   3.05209454e-04f, -8.86866474e-04f, 1.66848954e-03f, -2.66020210e-03f,
+   3.85702564e-03f, -5.23492694e-03f, 6.74715452e-03f, -8.32153019e-03f,
+   9.85842850e-03f, -1.12303048e-02f, 1.22820735e-02f, -1.28320102e-02f,
+   1.26726255e-02f, -1.15693798e-02f, 9.25563835e-03f, -5.41727897e-03f,
+   -3.41096573e-04f, 8.57130159e-03f, -2.01481581e-02f, 3.66712883e-02f,
+   -6.15744181e-02f, 1.03956416e-01f, -1.98262930e-01f, 6.86344385e-01f,
+   5.77398956e-01f, -2.02044904e-01f, 1.16087429e-01f, -7.52915815e-02f,
+   5.02879210e-02f, -3.29724289e-02f, 2.02449318e-02f, -1.06676565e-02f,
+   3.46818636e-03f, 1.82937167e-03f, -5.56118228e-03f, 7.99427833e-03f,
+   -9.36020166e-03f, 9.86902788e-03f, -9.71455779e-03f, 9.07420367e-03f,
+   -8.10725521e-03f, 6.95225084e-03f, -5.72511088e-03f, 4.51774383e-03f,
+   -3.39829503e-03f, 2.41239695e-03f, -1.58542464e-03f, 9.25630622e-04f,
+   -4.27551393e-04f, 7.58884926e-05f, 1.50882872e-04f, -2.77331186e-04f,
+   3.28321970e-04f, -3.26935144e-04f, 2.93073506e-04f, -2.42720853e-04f,
+   1.87717596e-04f, -1.35982220e-04f, 9.20598177e-05f, -5.78260333e-05f,
+   3.32378186e-05f, -1.70542771e-05f, 7.44212321e-06f, -2.46834588e-06f,
+   -1.41425551e-06f, 5.29825002e-06f, -1.36906729e-05f, 2.89479067e-05f,
+   -5.36409170e-05f, 9.01343737e-05f, -1.39991826e-04f, 2.03227595e-04f,
+   -2.77442479e-04f, 3.56937700e-04f, -4.31874476e-04f, 4.87670652e-04f,
+   -5.04772121e-04f, 4.58915310e-04f, -3.21982196e-04f, 6.36810873e-05f,
+   3.46125220e-04f, -9.34312295e-04f, 1.72087946e-03f, -2.71474477e-03f,
+   3.90965724e-03f, -5.28013520e-03f, 6.77789841e-03f, -8.32933653e-03f,
+   9.83352028e-03f, -1.11618731e-02f, 1.21586137e-02f, -1.26418667e-02f,
+   1.24043729e-02f, -1.12126013e-02f, 8.80141463e-03f, -4.85884957e-03f,
+   -1.00794772e-03f, 9.34739783e-03f, -2.10303329e-02f, 3.76505777e-02f,
+   -6.26299158e-02f, 1.05027683e-01f, -1.99040338e-01f, 6.79898262e-01f,
+   5.84524393e-01f, -2.02331096e-01f, 1.15643494e-01f, -7.46389404e-02f,
+   4.95731831e-02f, -3.22599448e-02f, 1.95698682e-02f, -1.00510586e-02f,
+   2.92252889e-03f, 2.29789573e-03f, -5.95079409e-03f, 8.30716453e-03f,
+   -9.60121304e-03f, 1.00451736e-02f, -9.83422715e-03f, 9.14651807e-03f,
+   -8.14147294e-03f, 6.95733074e-03f, -5.70926955e-03f, 4.48819017e-03f,
+   -3.36105516e-03f, 2.37229234e-03f, -1.54605997e-03f, 8.89459625e-04f,
+   -3.96049232e-04f, 4.97555884e-05f, 1.71598265e-04f, -2.93014280e-04f,
+   3.39619815e-04f, -3.34630691e-04f, 2.97977560e-04f, -2.45585630e-04f,
+   1.89187398e-04f, -1.36573595e-04f, 9.21582032e-05f, -5.76955426e-05f,
+   3.30424991e-05f, -1.68811603e-05f, 7.32515400e-06f, -2.40981240e-06f,
+   -1.49590767e-06f, 5.46656065e-06f, -1.39652975e-05f, 2.93238845e-05f,
+   -5.40694273e-05f, 9.04933331e-05f, -1.40058415e-04f, 2.02648720e-04f,
+   -2.75712315e-04f, 3.53383715e-04f, -4.25664417e-04f, 4.77845460e-04f,
+   -4.90298960e-04f, 4.38781281e-04f, -2.95350619e-04f, 3.00187294e-05f,
+   3.86840722e-04f, -9.81349149e-04f, 1.77255215e-03f, -2.76824948e-03f,
+   3.96086788e-03f, -5.32343891e-03f, 6.80625951e-03f, -8.33428279e-03f,
+   9.80530772e-03f, -1.10897711e-02f, 1.20312702e-02f, -1.24477856e-02f,
+   1.21324593e-02f, -1.08528240e-02f, 8.34518857e-03f, -4.29998990e-03f,
+   -1.67285628e-03f, 1.01183048e-02f, -2.19028182e-02f, 3.86138819e-02f,
+   -6.36600330e-02f, 1.06057651e-01f, -1.99743390e-01f, 6.73397601e-01f,
+   5.91613829e-01f, -2.02550292e-01f, 1.15157686e-01f, -7.39582628e-02f,
+   4.88392822e-02f, -3.15345265e-02f, 1.88864917e-02f, -9.42965038e-03f,
+   2.37471960e-03f, 2.76651327e-03f, -6.33914815e-03f, 8.61777738e-03f,
+   -9.83934104e-03f, 1.02182068e-02f, -9.95073654e-03f, 9.21583734e-03f,
+   -8.17298703e-03f, 6.96004136e-03f, -5.69143472e-03f, 4.45700996e-03f,
+   -3.32257757e-03f, 2.33127689e-03f, -1.50605117e-03f, 8.52863130e-04f,
+   -3.64323438e-04f, 2.35210227e-05f, 1.92331339e-04f, -3.08646879e-04f,
+   3.50839138e-04f, -3.42240703e-04f, 3.02800501e-04f, -2.48377211e-04f,
+   1.90598425e-04f, -1.37120689e-04f, 9.22247782e-05f, -5.75439954e-05f,
+   3.28342358e-05f, -1.67005328e-05f, 7.20442858e-06f, -2.34948584e-06f,
+   -1.57599345e-06f, 5.63126014e-06f, -1.42325389e-05f, 2.96872495e-05f,
+   -5.44763061e-05f, 9.08184375e-05f, -1.40075936e-04f, 2.02002600e-04f,
+   -2.73893791e-04f, 3.49722191e-04f, -4.19331860e-04f, 4.67886450e-04f,
+   -4.75698878e-04f, 4.18564421e-04f, -2.68694712e-04f, -3.57172485e-06f,
+   4.27302846e-04f, -1.02791470e-03f, 1.82349305e-03f, -2.82069831e-03f,
+   4.01059072e-03f, -5.36482828e-03f, 6.83224341e-03f, -8.33637267e-03f,
+   9.77380481e-03f, -1.10140154e-02f, 1.19000701e-02f, -1.22498041e-02f,
+   1.18568987e-02f, -1.04899462e-02f, 7.88697135e-03f, -3.74075514e-03f,
+   -2.33576214e-03f, 1.08839609e-02f, -2.27655564e-02f, 3.95609364e-02f,
+   -6.46644458e-02f, 1.07046016e-01f, -2.00372487e-01f, 6.66843712e-01f,
+   5.98666191e-01f, -2.02701882e-01f, 1.14630006e-01f, -7.32497275e-02f,
+   4.80864719e-02f, -3.07964478e-02f, 1.81950722e-02f, -8.80363304e-03f,
+   1.82485185e-03f, 3.23514105e-03f, -6.72617322e-03f, 8.92610755e-03f,
+   -1.00746509e-02f, 1.03881154e-02f, -1.00641130e-02f, 9.28215589e-03f,
+   -8.20176490e-03f, 6.96037663e-03f, -5.67160221e-03f, 4.42424277e-03f,
+   -3.28287040e-03f, 2.28934595e-03f, -1.46541046e-03f, 8.15888226e-04f,
+   -3.32384458e-04f, -2.80656081e-06f, 2.13054795e-04f, -3.24223598e-04f,
+   3.61978775e-04f, -3.49762384e-04f, 3.07535753e-04f, -2.51093967e-04f,
+   1.91948959e-04f, -1.37622046e-04f, 9.22594554e-05f, -5.73716388e-05f,
+   3.26129484e-05f, -1.65126748e-05f, 7.07989875e-06f, -2.28750446e-06f,
+   -1.65449512e-06f, 5.79243215e-06f, -1.44929554e-05f, 3.00378215e-05f,
+   -5.48615171e-05f, 9.11107491e-05f, -1.40044940e-04f, 2.01289411e-04f,
+   -2.71988363e-04f, 3.45954148e-04f, -4.12876048e-04f, 4.57802962e-04f,
+   -4.60986950e-04f, 3.98265169e-04f, -2.42015332e-04f, -3.70571943e-05f,
+   4.67511360e-04f, -1.07402576e-03f, 1.87370193e-03f, -2.87204166e-03f,
+   4.05882951e-03f, -5.40430611e-03f, 6.85582869e-03f, -8.33560992e-03f,
+   9.73902456e-03f, -1.09346509e-02f, 1.17650470e-02f, -1.20480331e-02f,
+   1.15778791e-02f, -1.01242121e-02f, 7.42707169e-03f, -3.18147265e-03f,
+   -2.99633713e-03f, 1.16439955e-02f, -2.36182101e-02f, 4.04916257e-02f,
+   -6.56429976e-02f, 1.07992776e-01f, -2.00928077e-01f, 6.60237968e-01f,
+   6.05679929e-01f, -2.02785254e-01f, 1.14060380e-01f, -7.25134462e-02f,
+   4.73148227e-02f, -3.00458055e-02f, 1.74957123e-02f, -8.17326270e-03f,
+   1.27319782e-03f, 3.70369456e-03f, -7.11167092e-03f, 9.23194643e-03f,
+   -1.03069786e-02f, 1.05547830e-02f, -1.01742735e-02f, 9.34543461e-03f,
+   -8.22780095e-03f, 6.95832632e-03f, -5.64979110e-03f, 4.38988488e-03f,
+   -3.24192876e-03f, 2.24654214e-03f, -1.42417627e-03f, 7.78522750e-04f,
+   -3.00231943e-04f, -2.92012282e-05f, 2.33768355e-04f, -3.39743419e-04f,
+   3.73028161e-04f, -3.57188052e-04f, 3.12182587e-04f, -2.53735692e-04f,
+   1.93238477e-04f, -1.38078016e-04f, 9.22622203e-05f, -5.71778619e-05f,
+   3.23786699e-05f, -1.63176355e-05f, 6.95162726e-06f, -2.22383164e-06f,
+   -1.73143962e-06f, 5.95003758e-06f, -1.47464698e-05f, 3.03757915e-05f,
+   -5.52259989e-05f, 9.13699405e-05f, -1.39965530e-04f, 2.00509472e-04f,
+   -2.69996846e-04f, 3.42080370e-04f, -4.06302861e-04f, 4.47596452e-04f,
+   -4.46158898e-04f, 3.77884542e-04f, -2.15338878e-04f, -7.04373379e-05f,
+   5.07466611e-04f, -1.11963646e-03f, 1.92313024e-03f, -2.92229978e-03f,
+   4.10558656e-03f, -5.44183701e-03f, 6.87702186e-03f, -8.33200105e-03f,
+   9.70099401e-03f, -1.08517241e-02f, 1.16262995e-02f, -1.18425796e-02f,
+   1.12954602e-02f, -9.75581165e-03f, 6.96557714e-03f, -2.62233266e-03f,
+   -3.65446857e-03f, 1.23982858e-02f, -2.44604517e-02f, 4.14055325e-02f,
+   -6.65954128e-02f, 1.08897857e-01f, -2.01410636e-01f, 6.53581560e-01f,
+   6.12653613e-01f, -2.02799812e-01f, 1.13448769e-01f, -7.17495233e-02f,
+   4.65246662e-02f, -2.92828791e-02f, 1.67886857e-02f, -7.53864087e-03f,
+   7.20121956e-04f, 4.17186180e-03f, -7.49544473e-03f, 9.53523256e-03f,
+   -1.05362032e-02f, 1.07181706e-02f, -1.02811586e-02f, 9.40562692e-03f,
+   -8.25107377e-03f, 6.95389137e-03f, -5.62598789e-03f, 4.35393164e-03f,
+   -3.19979433e-03f, 2.20286241e-03f, -1.38233486e-03f, 7.40803021e-04f,
+   -2.67897325e-04f, -5.56626619e-05f, 2.54471233e-04f, -3.55191383e-04f,
+   3.83986422e-04f, -3.64519045e-04f, 3.16740683e-04f, -2.56299390e-04f,
+   1.94467269e-04f, -1.38488394e-04f, 9.22325198e-05f, -5.69628064e-05f,
+   3.21314401e-05f, -1.61149528e-05f, 6.81953361e-06f, -2.15847922e-06f,
+   -1.80666439e-06f, 6.10406687e-06f, -1.49926855e-05f, 3.07004702e-05f,
+   -5.55688421e-05f, 9.15958808e-05f, -1.39837983e-04f, 1.99663875e-04f,
+   -2.67920637e-04f, 3.38105630e-04f, -3.99615616e-04f, 4.37270559e-04f,
+   -4.31234628e-04f, 3.57449491e-04f, -1.88665843e-04f, -1.03701030e-04f,
+   5.47116157e-04f, -1.16473343e-03f, 1.97178149e-03f, -2.97140656e-03f,
+   4.15080413e-03f, -5.47742750e-03f, 6.89582108e-03f, -8.32555629e-03f,
+   9.65972431e-03f, -1.07652601e-02f, 1.14838341e-02f, -1.16334893e-02f,
+   1.10096969e-02f, -9.38475784e-03f, 6.50257152e-03f, -2.06343480e-03f,
+   -4.30988427e-03f, 1.31465904e-02f, -2.52922270e-02f, 4.23026197e-02f,
+   -6.75214455e-02f, 1.09761111e-01f, -2.01820627e-01f, 6.46875799e-01f,
+   6.19586110e-01f, -2.02744976e-01f, 1.12795189e-01f, -7.09581375e-02f,
+   4.57160175e-02f, -2.85078976e-02f, 1.60742179e-02f, -6.90002553e-03f,
+   1.65450285e-04f, 4.63963393e-03f, -7.87742250e-03f, 9.83590633e-03f,
+   -1.07622780e-02f, 1.08782435e-02f, -1.03847580e-02f, 9.46274213e-03f,
+   -8.27156473e-03f, 6.94706570e-03f, -5.60022332e-03f, 4.31643054e-03f,
+   -3.15646268e-03f, 2.15832028e-03f, -1.33994012e-03f, 7.02740683e-04f,
+   -2.35380896e-04f, -8.21819049e-05f, 2.75136495e-04f, -3.70561611e-04f,
+   3.94849019e-04f, -3.71746166e-04f, 3.21203872e-04f, -2.58784741e-04f,
+   1.95633475e-04f, -1.38852047e-04f, 9.21704923e-05f, -5.67268762e-05f,
+   3.18711864e-05f, -1.59051051e-05f, 6.68389657e-06f, -2.09144423e-06f,
+   -1.88036813e-06f, 6.25457778e-06f, -1.52317243e-05f, 3.10126961e-05f,
+   -5.58905667e-05f, 9.17887373e-05f, -1.39662487e-04f, 1.98752634e-04f,
+   -2.65760027e-04f, 3.34027078e-04f, -3.92810849e-04f, 4.26829036e-04f,
+   -4.16205439e-04f, 3.36940604e-04f, -1.62005323e-04f, -1.36837174e-04f,
+   5.86499111e-04f, -1.20934716e-03f, 2.01963796e-03f, -3.01939761e-03f,
+   4.19452973e-03f, -5.51106548e-03f, 6.91222399e-03f, -8.31628032e-03f,
+   9.61524621e-03f, -1.06752953e-02f, 1.13377543e-02f, -1.14208404e-02f,
+   1.07207885e-02f, -9.01136175e-03f, 6.03836635e-03f, -1.50505966e-03f,
+   -4.96236840e-03f, 1.38884857e-02f, -2.61130109e-02f, 4.31823544e-02f,
+   -6.84209615e-02f, 1.10582553e-01f, -2.02158540e-01f, 6.40122056e-01f,
+   6.26475811e-01f, -2.02620193e-01f, 1.12099610e-01f, -7.01394528e-02f,
+   4.48893532e-02f, -2.77210902e-02f, 1.53525332e-02f, -6.25762530e-03f,
+   -3.90361063e-04f, 5.10669872e-03f, -8.25747009e-03f, 1.01337628e-02f,
+   -1.09851193e-02f, 1.10348882e-02f, -1.04849804e-02f, 9.51672718e-03f,
+   -8.28927476e-03f, 6.93784840e-03f, -5.57247596e-03f, 4.27733874e-03f,
+   -3.11194663e-03f, 2.11292948e-03f, -1.29696354e-03f, 6.64311170e-04f,
+   -2.02693394e-04f, -1.08749999e-04f, 2.95783510e-04f, -3.85863241e-04f,
+   4.05612751e-04f, -3.78873257e-04f, 3.25575558e-04f, -2.61190755e-04f,
+   1.96737252e-04f, -1.39169439e-04f, 9.20760067e-05f, -5.64691982e-05f,
+   3.15977923e-05f, -1.56879905e-05f, 6.54437372e-06f, -2.02269212e-06f,
+   -1.95238158e-06f, 6.40125427e-06f, -1.54635927e-05f, 3.13118180e-05f,
+   -5.61904017e-05f, 9.19487720e-05f, -1.39439639e-04f, 1.97777146e-04f,
+   -2.63515918e-04f, 3.29850300e-04f, -3.85897001e-04f, 4.16276336e-04f,
+   -4.01076482e-04f, 3.16384976e-04f, -1.35366587e-04f, -1.69845414e-04f,
+   6.25564135e-04f, -1.25341816e-03f, 2.06668652e-03f, -3.06626013e-03f,
+   4.23670607e-03f, -5.54274721e-03f, 6.92623621e-03f, -8.30418244e-03f,
+   9.56757553e-03f, -1.05818501e-02f, 1.11880936e-02f, -1.12046795e-02f,
+   1.04287434e-02f, -8.63551535e-03f, 5.57297142e-03f, -9.47305467e-04f,
+   -5.61170420e-03f, 1.46239176e-02f, -2.69227568e-02f, 4.40446995e-02f,
+   -6.92936778e-02f, 1.11362047e-01f, -2.02424884e-01f, 6.33321643e-01f,
+   6.33321643e-01f, -2.02424884e-01f, 1.11362047e-01f, -6.92936778e-02f,
+   4.40446995e-02f, -2.69227568e-02f, 1.46239176e-02f, -5.61170420e-03f,
+   -9.47305467e-04f, 5.57297142e-03f, -8.63551535e-03f, 1.04287434e-02f,
+   -1.12046795e-02f, 1.11880936e-02f, -1.05818501e-02f, 9.56757553e-03f,
+   -8.30418244e-03f, 6.92623621e-03f, -5.54274721e-03f, 4.23670607e-03f,
+   -3.06626013e-03f, 2.06668652e-03f, -1.25341816e-03f, 6.25564135e-04f,
+   -1.69845414e-04f, -1.35366587e-04f, 3.16384976e-04f, -4.01076482e-04f,
+   4.16276336e-04f, -3.85897001e-04f, 3.29850300e-04f, -2.63515918e-04f,
+   1.97777146e-04f, -1.39439639e-04f, 9.19487720e-05f, -5.61904017e-05f,
+   3.13118180e-05f, -1.54635927e-05f, 6.40125427e-06f, -1.95238158e-06f,
+   -2.02269212e-06f, 6.54437372e-06f, -1.56879905e-05f, 3.15977923e-05f,
+   -5.64691982e-05f, 9.20760067e-05f, -1.39169439e-04f, 1.96737252e-04f,
+   -2.61190755e-04f, 3.25575558e-04f, -3.78873257e-04f, 4.05612751e-04f,
+   -3.85863241e-04f, 2.95783510e-04f, -1.08749999e-04f, -2.02693394e-04f,
+   6.64311170e-04f, -1.29696354e-03f, 2.11292948e-03f, -3.11194663e-03f,
+   4.27733874e-03f, -5.57247596e-03f, 6.93784840e-03f, -8.28927476e-03f,
+   9.51672718e-03f, -1.04849804e-02f, 1.10348882e-02f, -1.09851193e-02f,
+   1.01337628e-02f, -8.25747009e-03f, 5.10669872e-03f, -3.90361063e-04f,
+   -6.25762530e-03f, 1.53525332e-02f, -2.77210902e-02f, 4.48893532e-02f,
+   -7.01394528e-02f, 1.12099610e-01f, -2.02620193e-01f, 6.26475811e-01f,
+   6.40122056e-01f, -2.02158540e-01f, 1.10582553e-01f, -6.84209615e-02f,
+   4.31823544e-02f, -2.61130109e-02f, 1.38884857e-02f, -4.96236840e-03f,
+   -1.50505966e-03f, 6.03836635e-03f, -9.01136175e-03f, 1.07207885e-02f,
+   -1.14208404e-02f, 1.13377543e-02f, -1.06752953e-02f, 9.61524621e-03f,
+   -8.31628032e-03f, 6.91222399e-03f, -5.51106548e-03f, 4.19452973e-03f,
+   -3.01939761e-03f, 2.01963796e-03f, -1.20934716e-03f, 5.86499111e-04f,
+   -1.36837174e-04f, -1.62005323e-04f, 3.36940604e-04f, -4.16205439e-04f,
+   4.26829036e-04f, -3.92810849e-04f, 3.34027078e-04f, -2.65760027e-04f,
+   1.98752634e-04f, -1.39662487e-04f, 9.17887373e-05f, -5.58905667e-05f,
+   3.10126961e-05f, -1.52317243e-05f, 6.25457778e-06f, -1.88036813e-06f,
+   -2.09144423e-06f, 6.68389657e-06f, -1.59051051e-05f, 3.18711864e-05f,
+   -5.67268762e-05f, 9.21704923e-05f, -1.38852047e-04f, 1.95633475e-04f,
+   -2.58784741e-04f, 3.21203872e-04f, -3.71746166e-04f, 3.94849019e-04f,
+   -3.70561611e-04f, 2.75136495e-04f, -8.21819049e-05f, -2.35380896e-04f,
+   7.02740683e-04f, -1.33994012e-03f, 2.15832028e-03f, -3.15646268e-03f,
+   4.31643054e-03f, -5.60022332e-03f, 6.94706570e-03f, -8.27156473e-03f,
+   9.46274213e-03f, -1.03847580e-02f, 1.08782435e-02f, -1.07622780e-02f,
+   9.83590633e-03f, -7.87742250e-03f, 4.63963393e-03f, 1.65450285e-04f,
+   -6.90002553e-03f, 1.60742179e-02f, -2.85078976e-02f, 4.57160175e-02f,
+   -7.09581375e-02f, 1.12795189e-01f, -2.02744976e-01f, 6.19586110e-01f,
+   6.46875799e-01f, -2.01820627e-01f, 1.09761111e-01f, -6.75214455e-02f,
+   4.23026197e-02f, -2.52922270e-02f, 1.31465904e-02f, -4.30988427e-03f,
+   -2.06343480e-03f, 6.50257152e-03f, -9.38475784e-03f, 1.10096969e-02f,
+   -1.16334893e-02f, 1.14838341e-02f, -1.07652601e-02f, 9.65972431e-03f,
+   -8.32555629e-03f, 6.89582108e-03f, -5.47742750e-03f, 4.15080413e-03f,
+   -2.97140656e-03f, 1.97178149e-03f, -1.16473343e-03f, 5.47116157e-04f,
+   -1.03701030e-04f, -1.88665843e-04f, 3.57449491e-04f, -4.31234628e-04f,
+   4.37270559e-04f, -3.99615616e-04f, 3.38105630e-04f, -2.67920637e-04f,
+   1.99663875e-04f, -1.39837983e-04f, 9.15958808e-05f, -5.55688421e-05f,
+   3.07004702e-05f, -1.49926855e-05f, 6.10406687e-06f, -1.80666439e-06f,
+   -2.15847922e-06f, 6.81953361e-06f, -1.61149528e-05f, 3.21314401e-05f,
+   -5.69628064e-05f, 9.22325198e-05f, -1.38488394e-04f, 1.94467269e-04f,
+   -2.56299390e-04f, 3.16740683e-04f, -3.64519045e-04f, 3.83986422e-04f,
+   -3.55191383e-04f, 2.54471233e-04f, -5.56626619e-05f, -2.67897325e-04f,
+   7.40803021e-04f, -1.38233486e-03f, 2.20286241e-03f, -3.19979433e-03f,
+   4.35393164e-03f, -5.62598789e-03f, 6.95389137e-03f, -8.25107377e-03f,
+   9.40562692e-03f, -1.02811586e-02f, 1.07181706e-02f, -1.05362032e-02f,
+   9.53523256e-03f, -7.49544473e-03f, 4.17186180e-03f, 7.20121956e-04f,
+   -7.53864087e-03f, 1.67886857e-02f, -2.92828791e-02f, 4.65246662e-02f,
+   -7.17495233e-02f, 1.13448769e-01f, -2.02799812e-01f, 6.12653613e-01f,
+   6.53581560e-01f, -2.01410636e-01f, 1.08897857e-01f, -6.65954128e-02f,
+   4.14055325e-02f, -2.44604517e-02f, 1.23982858e-02f, -3.65446857e-03f,
+   -2.62233266e-03f, 6.96557714e-03f, -9.75581165e-03f, 1.12954602e-02f,
+   -1.18425796e-02f, 1.16262995e-02f, -1.08517241e-02f, 9.70099401e-03f,
+   -8.33200105e-03f, 6.87702186e-03f, -5.44183701e-03f, 4.10558656e-03f,
+   -2.92229978e-03f, 1.92313024e-03f, -1.11963646e-03f, 5.07466611e-04f,
+   -7.04373379e-05f, -2.15338878e-04f, 3.77884542e-04f, -4.46158898e-04f,
+   4.47596452e-04f, -4.06302861e-04f, 3.42080370e-04f, -2.69996846e-04f,
+   2.00509472e-04f, -1.39965530e-04f, 9.13699405e-05f, -5.52259989e-05f,
+   3.03757915e-05f, -1.47464698e-05f, 5.95003758e-06f, -1.73143962e-06f,
+   -2.22383164e-06f, 6.95162726e-06f, -1.63176355e-05f, 3.23786699e-05f,
+   -5.71778619e-05f, 9.22622203e-05f, -1.38078016e-04f, 1.93238477e-04f,
+   -2.53735692e-04f, 3.12182587e-04f, -3.57188052e-04f, 3.73028161e-04f,
+   -3.39743419e-04f, 2.33768355e-04f, -2.92012282e-05f, -3.00231943e-04f,
+   7.78522750e-04f, -1.42417627e-03f, 2.24654214e-03f, -3.24192876e-03f,
+   4.38988488e-03f, -5.64979110e-03f, 6.95832632e-03f, -8.22780095e-03f,
+   9.34543461e-03f, -1.01742735e-02f, 1.05547830e-02f, -1.03069786e-02f,
+   9.23194643e-03f, -7.11167092e-03f, 3.70369456e-03f, 1.27319782e-03f,
+   -8.17326270e-03f, 1.74957123e-02f, -3.00458055e-02f, 4.73148227e-02f,
+   -7.25134462e-02f, 1.14060380e-01f, -2.02785254e-01f, 6.05679929e-01f,
+   6.60237908e-01f, -2.00928077e-01f, 1.07992776e-01f, -6.56429976e-02f,
+   4.04916257e-02f, -2.36182101e-02f, 1.16439955e-02f, -2.99633713e-03f,
+   -3.18147265e-03f, 7.42707169e-03f, -1.01242121e-02f, 1.15778791e-02f,
+   -1.20480331e-02f, 1.17650470e-02f, -1.09346509e-02f, 9.73902456e-03f,
+   -8.33560992e-03f, 6.85582869e-03f, -5.40430611e-03f, 4.05882951e-03f,
+   -2.87204166e-03f, 1.87370193e-03f, -1.07402576e-03f, 4.67511360e-04f,
+   -3.70571943e-05f, -2.42015332e-04f, 3.98265169e-04f, -4.60986950e-04f,
+   4.57802962e-04f, -4.12876048e-04f, 3.45954148e-04f, -2.71988363e-04f,
+   2.01289411e-04f, -1.40044940e-04f, 9.11107491e-05f, -5.48615171e-05f,
+   3.00378215e-05f, -1.44929554e-05f, 5.79243215e-06f, -1.65449512e-06f,
+   -2.28750446e-06f, 7.07989875e-06f, -1.65126748e-05f, 3.26129484e-05f,
+   -5.73716388e-05f, 9.22594554e-05f, -1.37622046e-04f, 1.91948959e-04f,
+   -2.51093967e-04f, 3.07535753e-04f, -3.49762384e-04f, 3.61978775e-04f,
+   -3.24223598e-04f, 2.13054795e-04f, -2.80656081e-06f, -3.32384458e-04f,
+   8.15888226e-04f, -1.46541046e-03f, 2.28934595e-03f, -3.28287040e-03f,
+   4.42424277e-03f, -5.67160221e-03f, 6.96037663e-03f, -8.20176490e-03f,
+   9.28215589e-03f, -1.00641130e-02f, 1.03881154e-02f, -1.00746509e-02f,
+   8.92610755e-03f, -6.72617322e-03f, 3.23514105e-03f, 1.82485185e-03f,
+   -8.80363304e-03f, 1.81950722e-02f, -3.07964478e-02f, 4.80864719e-02f,
+   -7.32497275e-02f, 1.14630006e-01f, -2.02701882e-01f, 5.98666191e-01f,
+   6.66843712e-01f, -2.00372487e-01f, 1.07046016e-01f, -6.46644458e-02f,
+   3.95609364e-02f, -2.27655564e-02f, 1.08839609e-02f, -2.33576214e-03f,
+   -3.74075514e-03f, 7.88697135e-03f, -1.04899462e-02f, 1.18568987e-02f,
+   -1.22498041e-02f, 1.19000701e-02f, -1.10140154e-02f, 9.77380481e-03f,
+   -8.33637267e-03f, 6.83224341e-03f, -5.36482828e-03f, 4.01059072e-03f,
+   -2.82069831e-03f, 1.82349305e-03f, -1.02791470e-03f, 4.27302846e-04f,
+   -3.57172485e-06f, -2.68694712e-04f, 4.18564421e-04f, -4.75698878e-04f,
+   4.67886450e-04f, -4.19331860e-04f, 3.49722191e-04f, -2.73893791e-04f,
+   2.02002600e-04f, -1.40075936e-04f, 9.08184375e-05f, -5.44763061e-05f,
+   2.96872495e-05f, -1.42325389e-05f, 5.63126014e-06f, -1.57599345e-06f,
+   -2.34948584e-06f, 7.20442858e-06f, -1.67005328e-05f, 3.28342358e-05f,
+   -5.75439954e-05f, 9.22247782e-05f, -1.37120689e-04f, 1.90598425e-04f,
+   -2.48377211e-04f, 3.02800501e-04f, -3.42240703e-04f, 3.50839138e-04f,
+   -3.08646879e-04f, 1.92331339e-04f, 2.35210227e-05f, -3.64323438e-04f,
+   8.52863130e-04f, -1.50605117e-03f, 2.33127689e-03f, -3.32257757e-03f,
+   4.45700996e-03f, -5.69143472e-03f, 6.96004136e-03f, -8.17298703e-03f,
+   9.21583734e-03f, -9.95073654e-03f, 1.02182068e-02f, -9.83934104e-03f,
+   8.61777738e-03f, -6.33914815e-03f, 2.76651327e-03f, 2.37471960e-03f,
+   -9.42965038e-03f, 1.88864917e-02f, -3.15345265e-02f, 4.88392822e-02f,
+   -7.39582628e-02f, 1.15157686e-01f, -2.02550292e-01f, 5.91613829e-01f,
+   6.73397601e-01f, -1.99743390e-01f, 1.06057651e-01f, -6.36600330e-02f,
+   3.86138819e-02f, -2.19028182e-02f, 1.01183048e-02f, -1.67285628e-03f,
+   -4.29998990e-03f, 8.34518857e-03f, -1.08528240e-02f, 1.21324593e-02f,
+   -1.24477856e-02f, 1.20312702e-02f, -1.10897711e-02f, 9.80530772e-03f,
+   -8.33428279e-03f, 6.80625951e-03f, -5.32343891e-03f, 3.96086788e-03f,
+   -2.76824948e-03f, 1.77255215e-03f, -9.81349149e-04f, 3.86840722e-04f,
+   3.00187294e-05f, -2.95350619e-04f, 4.38781281e-04f, -4.90298960e-04f,
+   4.77845460e-04f, -4.25664417e-04f, 3.53383715e-04f, -2.75712315e-04f,
+   2.02648720e-04f, -1.40058415e-04f, 9.04933331e-05f, -5.40694273e-05f,
+   2.93238845e-05f, -1.39652975e-05f, 5.46656065e-06f, -1.49590767e-06f,
+   -2.40981240e-06f, 7.32515400e-06f, -1.68811603e-05f, 3.30424991e-05f,
+   -5.76955426e-05f, 9.21582032e-05f, -1.36573595e-04f, 1.89187398e-04f,
+   -2.45585630e-04f, 2.97977560e-04f, -3.34630691e-04f, 3.39619815e-04f,
+   -2.93014280e-04f, 1.71598265e-04f, 4.97555884e-05f, -3.96049232e-04f,
+   8.89459625e-04f, -1.54605997e-03f, 2.37229234e-03f, -3.36105516e-03f,
+   4.48819017e-03f, -5.70926955e-03f, 6.95733074e-03f, -8.14147294e-03f,
+   9.14651807e-03f, -9.83422715e-03f, 1.00451736e-02f, -9.60121304e-03f,
+   8.30716453e-03f, -5.95079409e-03f, 2.29789573e-03f, 2.92252889e-03f,
+   -1.00510586e-02f, 1.95698682e-02f, -3.22599448e-02f, 4.95731831e-02f,
+   -7.46389404e-02f, 1.15643494e-01f, -2.02331096e-01f, 5.84524393e-01f,
+   6.79898262e-01f, -1.99040338e-01f, 1.05027683e-01f, -6.26299158e-02f,
+   3.76505777e-02f, -2.10303329e-02f, 9.34739783e-03f, -1.00794772e-03f,
+   -4.85884957e-03f, 8.80141463e-03f, -1.12126013e-02f, 1.24043729e-02f,
+   -1.26418667e-02f, 1.21586137e-02f, -1.11618731e-02f, 9.83352028e-03f,
+   -8.32933653e-03f, 6.77789841e-03f, -5.28013520e-03f, 3.90965724e-03f,
+   -2.71474477e-03f, 1.72087946e-03f, -9.34312295e-04f, 3.46125220e-04f,
+   6.36810873e-05f, -3.21982196e-04f, 4.58915310e-04f, -5.04772121e-04f,
+   4.87670652e-04f, -4.31874476e-04f, 3.56937700e-04f, -2.77442479e-04f,
+   2.03227595e-04f, -1.39991826e-04f, 9.01343737e-05f, -5.36409170e-05f,
+   2.89479067e-05f, -1.36906729e-05f, 5.29825002e-06f, -1.41425551e-06f,
+   -2.46834588e-06f, 7.44212321e-06f, -1.70542771e-05f, 3.32378186e-05f,
+   -5.78260333e-05f, 9.20598177e-05f, -1.35982220e-04f, 1.87717596e-04f,
+   -2.42720853e-04f, 2.93073506e-04f, -3.26935144e-04f, 3.28321970e-04f,
+   -2.77331186e-04f, 1.50882872e-04f, 7.58884926e-05f, -4.27551393e-04f,
+   9.25630622e-04f, -1.58542464e-03f, 2.41239695e-03f, -3.39829503e-03f,
+   4.51774383e-03f, -5.72511088e-03f, 6.95225084e-03f, -8.10725521e-03f,
+   9.07420367e-03f, -9.71455779e-03f, 9.86902788e-03f, -9.36020166e-03f,
+   7.99427833e-03f, -5.56118228e-03f, 1.82937167e-03f, 3.46818636e-03f,
+   -1.06676565e-02f, 2.02449318e-02f, -3.29724289e-02f, 5.02879210e-02f,
+   -7.52915815e-02f, 1.16087429e-01f, -2.02044904e-01f, 5.77398956e-01f,
+   6.86344385e-01f, -1.98262930e-01f, 1.03956416e-01f, -6.15744181e-02f,
+   3.66712883e-02f, -2.01481581e-02f, 8.57130159e-03f, -3.41096573e-04f,
+   -5.41727897e-03f, 9.25563835e-03f, -1.15693798e-02f, 1.26726255e-02f,
+   -1.28320102e-02f, 1.22820735e-02f, -1.12303048e-02f, 9.85842850e-03f,
+   -8.32153019e-03f, 6.74715452e-03f, -5.23492694e-03f, 3.85702564e-03f,
+   -2.66020210e-03f, 1.66848954e-03f, -8.86866474e-04f, 3.05209454e-04f,
+   9.74148061e-05f, -3.48580361e-04f, 4.78939852e-04f, -5.19113441e-04f,
+   4.97360656e-04f, -4.37953597e-04f, 3.60379927e-04f, -2.79083382e-04f,
+   2.03738236e-04f, -1.39876443e-04f, 8.97421924e-05f, -5.31918340e-05f,
+   2.85592068e-05f, -1.34092988e-05f, 5.12671795e-06f, -1.33103640e-06f,
+   -2.52526115e-06f, 7.55538258e-06f, -1.72199616e-05f, 3.34203105e-05f,
+   -5.79353837e-05f, 9.19299709e-05f, -1.35346054e-04f, 1.86188656e-04f,
+   -2.39783971e-04f, 2.88085430e-04f, -3.19149811e-04f, 3.16949503e-04f,
+   -2.61603040e-04f, 1.30165528e-04f, 1.01936414e-04f, -4.58819530e-04f,
+   9.61400743e-04f, -1.62417232e-03f, 2.45157816e-03f, -3.43428273e-03f,
+   4.54570632e-03f, -5.73897175e-03f, 6.94480445e-03f, -8.07032920e-03f,
+   8.99896491e-03f, -9.59183276e-03f, 9.68991872e-03f, -9.11650900e-03f,
+   7.67933205e-03f, -5.17045008e-03f, 1.36125274e-03f, 4.01151134e-03f,
+   -1.12792458e-02f, 2.09114719e-02f, -3.36717740e-02f, 5.09833135e-02f,
+   -7.59161338e-02f, 1.16489619e-01f, -2.01692358e-01f, 5.70239186e-01f,
+   6.92734718e-01f, -1.97410718e-01f, 1.02843851e-01f, -6.04937188e-02f,
+   3.56765427e-02f, -1.92568526e-02f, 7.79051986e-03f, 3.27311922e-04f,
+   -5.97499590e-03f, 9.70748067e-03f, -1.19228577e-02f, 1.29370317e-02f,
+   -1.30181415e-02f, 1.24015575e-02f, -1.12950299e-02f, 9.88001097e-03f,
+   -8.31086002e-03f, 6.71403762e-03f, -5.18782716e-03f, 3.80291673e-03f,
+   -2.60458258e-03f, 1.61539949e-03f, -8.38980312e-04f, 2.64053524e-04f,
+   1.31208610e-04f, -3.75136005e-04f, 4.98866895e-04f, -5.33331069e-04f,
+   5.06912009e-04f, -4.43905621e-04f, 3.63712694e-04f, -2.80634325e-04f,
+   2.04180702e-04f, -1.39711658e-04f, 8.93168908e-05f, -5.27207885e-05f,
+   2.81576231e-05f, -1.31210763e-05f, 4.95151289e-06f, -1.24622522e-06f,
+   -2.58042473e-06f, 7.66466655e-06f, -1.73783283e-05f, 3.35897057e-05f,
+   -5.80239721e-05f, 9.17688303e-05f, -1.34666436e-04f, 1.84603196e-04f,
+   -2.36775290e-04f, 2.83015601e-04f, -3.11285141e-04f, 3.05506488e-04f,
+   -2.45830626e-04f, 1.09473272e-04f, 1.27865249e-04f, -4.89854137e-04f,
+   9.96757997e-04f, -1.66225294e-03f, 2.48982408e-03f, -3.46902339e-03f,
+   4.57204133e-03f, -5.75083448e-03f, 6.93500275e-03f, -8.03072285e-03f,
+   8.92078225e-03f, -9.46605857e-03f, 9.50779952e-03f, -8.87014531e-03f,
+   7.36238621e-03f, -4.77866828e-03f, 8.93621356e-04f, 4.55241092e-03f,
+   -1.18855806e-02f, 2.15692315e-02f, -3.43577228e-02f, 5.16591892e-02f,
+   -7.65124410e-02f, 1.16850071e-01f, -2.01274112e-01f, 5.63046217e-01f,
+   6.99068069e-01f, -1.96483329e-01f, 1.01690225e-01f, -5.93881644e-02f,
+   3.46663855e-02f, -1.83564797e-02f, 7.00511690e-03f, 9.97053110e-04f,
+   -6.53189933e-03f, 1.01570738e-02f, -1.22730229e-02f, 1.31975403e-02f,
+   -1.32002169e-02f, 1.25170378e-02f, -1.13560315e-02f, 9.89826024e-03f,
+   -8.29732139e-03f, 6.67855050e-03f, -5.13882935e-03f, 3.74740013e-03f,
+   -2.54795724e-03f, 1.56162609e-03f, -7.90668128e-04f, 2.22711344e-04f,
+   1.65050966e-04f, -4.01647965e-04f, 5.18689456e-04f, -5.47405914e-04f,
+   5.16321103e-04f, -4.49727348e-04f, 3.66931257e-04f, -2.82094552e-04f,
+   2.04553740e-04f, -1.39497512e-04f, 8.88580325e-05f, -5.22288901e-05f,
+   2.77441122e-05f, -1.28259717e-05f, 4.77303547e-06f, -1.16000558e-06f,
+   -2.63383049e-06f, 7.77023706e-06f, -1.75292789e-05f, 3.37460078e-05f,
+   -5.80918277e-05f, 9.15765995e-05f, -1.33943380e-04f, 1.82960328e-04f,
+   -2.33697967e-04f, 2.77869229e-04f, -3.03338980e-04f, 2.93993769e-04f,
+   -2.30029298e-04f, 8.88065624e-05f, 1.53683402e-04f, -5.20624337e-04f,
+   1.03166874e-03f, -1.69966707e-03f, 2.52713729e-03f, -3.50248464e-03f,
+   4.59675258e-03f, -5.76071069e-03f, 6.92285085e-03f, -7.98846316e-03f,
+   8.83971248e-03f, -9.33732372e-03f, 9.32279695e-03f, -8.62124003e-03f,
+   7.04350183e-03f, -4.38603573e-03f, 4.26560553e-04f, 5.09061804e-03f,
+   -1.24865640e-02f, 2.22181156e-02f, -3.50301899e-02f, 5.23153245e-02f,
+   -7.70804584e-02f, 1.17168918e-01f, -2.00790808e-01f, 5.55821598e-01f,
+   7.05343127e-01f, -1.95480362e-01f, 1.00495651e-01f, -5.82579859e-02f,
+   3.36412750e-02f, -1.74474660e-02f, 6.21541264e-03f, 1.66801049e-03f,
+   -7.08779646e-03f, 1.06041152e-02f, -1.26196928e-02f, 1.34540908e-02f,
+   -1.33781368e-02f, 1.26284845e-02f, -1.14132706e-02f, 9.91315860e-03f,
+   -8.28091335e-03f, 6.64068712e-03f, -5.08798100e-03f, 3.69047327e-03f,
+   -2.49030651e-03f, 1.50716712e-03f, -7.41978001e-04f, 1.81183073e-04f,
+   1.98941227e-04f, -4.28090425e-04f, 5.38387278e-04f, -5.61341818e-04f,
+   5.25586773e-04f, -4.55412694e-04f, 3.70035472e-04f, -2.83463101e-04f,
+   2.04857613e-04f, -1.39233991e-04f, 8.83657049e-05f, -5.17162916e-05f,
+   2.73178212e-05f, -1.25241140e-05f, 4.59133707e-06f, -1.07221831e-06f,
+   -2.68560439e-06f, 7.87206773e-06f, -1.76727863e-05f, 3.38896971e-05f,
+   -5.81389286e-05f, 9.13534168e-05f, -1.33176742e-04f, 1.81260664e-04f,
+   -2.30552701e-04f, 2.72645033e-04f, -2.95319507e-04f, 2.82422465e-04f,
+   -2.14199696e-04f, 6.81657912e-05f, 1.79365350e-04f, -5.51131030e-04f,
+   1.06614444e-03f, -1.73641671e-03f, 2.56348262e-03f, -3.53466836e-03f,
+   4.61984519e-03f, -5.76859200e-03f, 6.90836227e-03f, -7.94355664e-03f,
+   8.75580311e-03f, -9.20566265e-03f, 9.13500879e-03f, -8.36996268e-03f,
+   6.72289357e-03f, -3.99275217e-03f, -3.96204596e-05f, 5.62586822e-03f,
+   -1.30819064e-02f, 2.28578690e-02f, -3.56889255e-02f, 5.29516675e-02f,
+   -7.76200667e-02f, 1.17446274e-01f, -2.00243145e-01f, 5.48566699e-01f,
+   7.11558521e-01f, -1.94401473e-01f, 9.92602631e-02f, -5.71034215e-02f,
+   3.26013416e-02f, -1.65299494e-02f, 5.42172976e-03f, 2.33984902e-03f,
+   -7.64231663e-03f, 1.10483719e-02f, -1.29626300e-02f, 1.37065072e-02f,
+   -1.35517782e-02f, 1.27358157e-02f, -1.14667118e-02f, 9.92469490e-03f,
+   -8.26163590e-03f, 6.60048285e-03f, -5.03527746e-03f, 3.63213290e-03f,
+   -2.43168487e-03f, 1.45207671e-03f, -6.92893227e-04f, 1.39468815e-04f,
+   2.32846112e-04f, -4.54462192e-04f, 5.57966239e-04f, -5.75124694e-04f,
+   5.34699415e-04f, -4.60961484e-04f, 3.73024057e-04f, -2.84738926e-04f,
+   2.05091928e-04f, -1.38920295e-04f, 8.78402207e-05f, -5.11818216e-05f,
+   2.68788299e-05f, -1.22155807e-05f, 4.40606891e-06f, -9.82890015e-07f,
+   -2.73562364e-06f, 7.96991753e-06f, -1.78089740e-05f, 3.40203878e-05f,
+   -5.81653003e-05f, 9.10996896e-05f, -1.32368135e-04f, 1.79507071e-04f,
+   -2.27340701e-04f, 2.67350144e-04f, -2.87229719e-04f, 2.70793476e-04f,
+   -1.98347596e-04f, 4.75779016e-05f, 2.04902899e-04f, -5.81364206e-04f,
+   1.10014109e-03f, -1.77245494e-03f, 2.59886193e-03f, -3.56556848e-03f,
+   4.64129122e-03f, -5.77448262e-03f, 6.89154584e-03f, -7.89604615e-03f,
+   8.66907649e-03f, -9.07110143e-03f, 8.94444436e-03f, -8.11624248e-03f,
+   6.40057214e-03f, -3.59888910e-03f, -5.04915719e-04f, 6.15807250e-03f,
+   -1.36715621e-02f, 2.34882962e-02f, -3.63337398e-02f, 5.35680056e-02f,
+   -7.81311914e-02f, 1.17682233e-01f, -1.99631795e-01f, 5.41282833e-01f,
+   7.17713296e-01f, -1.93246350e-01f, 9.79843363e-02f, -5.59248105e-02f,
+   3.15469764e-02f, -1.56042157e-02f, 4.62413486e-03f, 3.01250559e-03f,
+   -8.19553621e-03f, 1.14898328e-02f, -1.33019313e-02f, 1.39547763e-02f,
+   -1.37211839e-02f, 1.28390193e-02f, -1.15163382e-02f, 9.93285980e-03f,
+   -8.23949836e-03f, 6.55793166e-03f, -4.98073315e-03f, 3.57245421e-03f,
+   -2.37211166e-03f, 1.39635324e-03f, -6.43477833e-04f, 9.76233932e-05f,
+   2.66764779e-04f, -4.80754155e-04f, 5.77400206e-04f, -5.88748895e-04f,
+   5.43658563e-04f, -4.66370693e-04f, 3.75893549e-04f, -2.85920920e-04f,
+   2.05255667e-04f, -1.38557283e-04f, 8.72812088e-05f, -5.06267315e-05f,
+   2.64281825e-05f, -1.19003525e-05f, 4.21765299e-06f, -8.92215326e-07f,
+   -2.78391258e-06f, 8.06410208e-06f, -1.79378258e-05f, 3.41382038e-05f,
+   -5.81713393e-05f, 9.08153597e-05f, -1.31516819e-04f, 1.77697249e-04f,
+   -2.24063187e-04f, 2.61981768e-04f, -2.79064989e-04f, 2.59110820e-04f,
+   -1.82478077e-04f, 2.70231922e-05f, 2.30312653e-04f, -6.11314026e-04f,
+   1.13368209e-03f, -1.80781784e-03f, 2.63326475e-03f, -3.59517662e-03f,
+   4.66111535e-03f, -5.77839278e-03f, 6.87241042e-03f, -7.84592330e-03f,
+   8.57956801e-03f, -8.93373508e-03f, 8.75126570e-03f, -7.86029454e-03f,
+   6.07675407e-03f, -3.20458272e-03f, -9.69017507e-04f, 6.68705674e-03f,
+   -1.42551987e-02f, 2.41092071e-02f, -3.69644575e-02f, 5.41641973e-02f,
+   -7.86137879e-02f, 1.17876954e-01f, -1.98957458e-01f, 5.33971608e-01f,
+   7.23805964e-01f, -1.92014560e-01f, 9.66679379e-02f, -5.47224507e-02f,
+   3.04784868e-02f, -1.46707855e-02f, 3.82314972e-03f, 3.68553400e-03f,
+   -8.74704029e-03f, 1.19281281e-02f, -1.36373099e-02f, 1.41986869e-02f,
+   -1.38862021e-02f, 1.29380208e-02f, -1.15621239e-02f, 9.93764214e-03f,
+   -8.21449235e-03f, 6.51304564e-03f, -4.92436392e-03f, 3.51139670e-03f,
+   -2.31154589e-03f, 1.34001474e-03f, -5.93700272e-04f, 5.56062769e-05f,
+   3.00685671e-04f, -5.06957236e-04f, 5.96700760e-04f, -6.02222921e-04f,
+   5.52460784e-04f, -4.71638254e-04f, 3.78645665e-04f, -2.87009112e-04f,
+   2.05349250e-04f, -1.38144009e-04f, 8.66883856e-05f, -5.00508213e-05f,
+   2.59646440e-05f, -1.15783569e-05f, 4.02601472e-06f, -7.99971815e-07f,
+   -2.83050508e-06f, 8.15439307e-06f, -1.80591014e-05f, 3.42432650e-05f,
+   -5.81569511e-05f, 9.05012566e-05f, -1.30624598e-04f, 1.75835623e-04f,
+   -2.20720889e-04f, 2.56541854e-04f, -2.70836230e-04f, 2.47378601e-04f,
+   -1.66591810e-04f, 6.52859899e-06f, 2.55561114e-04f, -6.40971528e-04f,
+   1.16675638e-03f, -1.84245978e-03f, 2.66668363e-03f, -3.62349418e-03f,
+   4.67929430e-03f, -5.78031689e-03f, 6.85096858e-03f, -7.79323326e-03f,
+   8.48729722e-03f, -8.79357290e-03f, 8.55542254e-03f, -7.60212634e-03f,
+   5.75150037e-03f, -2.80990335e-03f, -1.43184559e-03f, 7.21273245e-03f,
+   -1.48326326e-02f, 2.47203615e-02f, -3.75808515e-02f, 5.47400527e-02f,
+   -7.90677816e-02f, 1.18030548e-01f, -1.98220849e-01f, 5.26634097e-01f,
+   7.29835451e-01f, -1.90705881e-01f, 9.53114778e-02f, -5.34967072e-02f,
+   2.93961931e-02f, -1.37297269e-02f, 3.01884324e-03f, 4.35886951e-03f,
+   -9.29677114e-03f, 1.23633835e-02f, -1.39687499e-02f, 1.44383032e-02f,
+   -1.40468255e-02f, 1.30327949e-02f, -1.16040548e-02f, 9.93903447e-03f,
+   -8.18661693e-03f, 6.46583363e-03f, -4.86616325e-03f, 3.44897644e-03f,
+   -2.25006440e-03f, 1.28307962e-03f, -5.43576025e-04f, 1.34724114e-05f,
+   3.34597280e-04f, -5.33069950e-04f, 6.15860918e-04f, -6.15528435e-04f,
+   5.61102002e-04f, -4.76763555e-04f, 3.81276419e-04f, -2.88002338e-04f,
+   2.05371762e-04f, -1.37680836e-04f, 8.60626897e-05f, -4.94539345e-05f,
+   2.54892893e-05f, -1.12502967e-05f, 3.83118504e-06f, -7.06365483e-07f,
+   -2.87537523e-06f, 8.24078143e-06f, -1.81731557e-05f, 3.43355750e-05f,
+   -5.81222339e-05f, 9.01571548e-05f, -1.29691354e-04f, 1.73920984e-04f,
+   -2.17316861e-04f, 2.51036079e-04f, -2.62543646e-04f, 2.35597472e-04f,
+   -1.50704524e-04f, -1.39056674e-05f, 2.80656881e-04f, -6.70336478e-04f,
+   1.19933207e-03f, -1.87638355e-03f, 2.69911857e-03f, -3.65049695e-03f,
+   4.69583226e-03f, -5.78026287e-03f, 6.82722637e-03f, -7.73798255e-03f,
+   8.39231722e-03f, -8.65071267e-03f, 8.35704710e-03f, -7.34191388e-03f,
+   5.42487251e-03f, -2.41505122e-03f, -1.89331966e-03f, 7.73484120e-03f,
+   -1.54037755e-02f, 2.53216792e-02f, -3.81828472e-02f, 5.52955382e-02f,
+   -7.94931352e-02f, 1.18143193e-01f, -1.97422668e-01f, 5.19271970e-01f,
+   7.35800564e-01f, -1.89319998e-01f, 9.39150900e-02f, -5.22478484e-02f,
+   2.83005070e-02f, -1.27814924e-02f, 2.21161195e-03f, 5.03222924e-03f,
+   -9.84453689e-03f, 1.27953039e-02f, -1.42960241e-02f, 1.46734556e-02f,
+   -1.42029598e-02f, 1.31233148e-02f, -1.16420984e-02f, 9.93702840e-03f,
+   -8.15588050e-03f, 6.41628960e-03f, -4.80618840e-03f, 3.38525325e-03f,
+   -2.18764693e-03f, 1.22554635e-03f, -4.93154046e-04f, -2.87776784e-05f,
+   3.68498499e-04f, -5.59067004e-04f, 6.34861412e-04f, -6.28664275e-04f,
+   5.69581694e-04f, -4.81740833e-04f, 3.83785577e-04f, -2.88899959e-04f,
+   2.05323100e-04f, -1.37167852e-04f, 8.54043028e-05f, -4.88363621e-05f,
+   2.50018929e-05f, -1.09155499e-05f, 3.63321737e-06f, -6.11422536e-07f,
+   -2.91855690e-06f, 8.32349087e-06f, -1.82798885e-05f, 3.44151413e-05f,
+   -5.80674678e-05f, 8.97831778e-05f, -1.28716783e-04f, 1.71953667e-04f,
+   -2.13851861e-04f, 2.45462987e-04f, -2.54187966e-04f, 2.23779149e-04f,
+   -1.34816481e-04f, -3.42793865e-05f, 3.05575057e-04f, -6.99380354e-04f,
+   1.23142172e-03f, -1.90958916e-03f, 2.73054023e-03f, -3.67618655e-03f,
+   4.71073296e-03f, -5.77823212e-03f, 6.80120802e-03f, -7.68020563e-03f,
+   8.29468202e-03f, -8.50518700e-03f, 8.15624371e-03f, -7.07970839e-03f,
+   5.09709073e-03f, -2.02028872e-03f, -2.35313550e-03f, 8.25312920e-03f,
+   -1.59683526e-02f, 2.59128772e-02f, -3.87701839e-02f, 5.58304749e-02f,
+   -7.98898339e-02f, 1.18215047e-01f, -1.96563691e-01f, 5.11886537e-01f,
+   7.41700053e-01f, -1.87856615e-01f, 9.24789533e-02f, -5.09761497e-02f,
+   2.71915775e-02f, -1.18262302e-02f, 1.40159228e-03f, 5.70532866e-03f,
+   -1.03899697e-02f, 1.32236639e-02f, -1.46190654e-02f, 1.49040185e-02f,
+   -1.43544991e-02f, 1.32095097e-02f, -1.16762258e-02f, 9.93161742e-03f,
+   -8.12228769e-03f, 6.36446103e-03f, -4.74443519e-03f, 3.32020316e-03f,
+   -2.12435331e-03f, 1.16747082e-03f, -4.42435005e-04f, -7.11435132e-05f,
+   4.02356149e-04f, -5.84947120e-04f, 6.53706724e-04f, -6.41629857e-04f,
+   5.77890838e-04f, -4.86569916e-04f, 3.86172149e-04f, -2.89700838e-04f,
+   2.05203134e-04f, -1.36604023e-04f, 8.47116535e-05f, -4.81977513e-05f,
+   2.45025858e-05f, -1.05742411e-05f, 3.43216470e-06f, -5.14974033e-07f,
+   -2.95996961e-06f, 8.40231678e-06f, -1.83792163e-05f, 3.44820946e-05f,
+   -5.79926964e-05f, 8.93803735e-05f, -1.27702995e-04f, 1.69936844e-04f,
+   -2.10327213e-04f, 2.39830159e-04f, -2.45780335e-04f, 2.11924023e-04f,
+   -1.18933283e-04f, -5.45659168e-05f, 3.30307957e-04f, -7.28104555e-04f,
+   1.26298284e-03f, -1.94203493e-03f, 2.76095071e-03f, -3.70055973e-03f,
+   4.72397916e-03f, -5.77423256e-03f, 6.77292561e-03f, -7.61994580e-03f,
+   8.19441397e-03f, -8.35702568e-03f, 7.95302261e-03f, -6.81556109e-03f,
+   4.76816250e-03f, -1.62549457e-03f, -2.81128893e-03f, 8.76751170e-03f,
+   -1.65263247e-02f, 2.64939237e-02f, -3.93428430e-02f, 5.63447475e-02f,
+   -8.02578330e-02f, 1.18246287e-01f, -1.95644647e-01f, 5.04479170e-01f,
+   7.47532785e-01f, -1.86315477e-01f, 9.10034552e-02f, -4.96820547e-02f,
+   2.60698274e-02f, -1.08643221e-02f, 5.89052914e-04f, 6.37810118e-03f,
+   -1.09331422e-02f, 1.36483815e-02f, -1.49378078e-02f, 1.51299778e-02f,
+   -1.45014757e-02f, 1.32913720e-02f, -1.17064370e-02f, 9.92279779e-03f,
+   -8.08586553e-03f, 6.31034002e-03f, -4.68091993e-03f, 3.25391139e-03f,
+   -2.06020311e-03f, 1.10885326e-03f, -3.91435140e-04f, -1.13569557e-04f,
+   4.36158211e-04f, -6.10700576e-04f, 6.72372757e-04f, -6.54407777e-04f,
+   5.86028793e-04f, -4.91248036e-04f, 3.88432731e-04f, -2.90404627e-04f,
+   2.05011311e-04f, -1.35990762e-04f, 8.39863860e-05f, -4.75394845e-05f,
+   2.39914134e-05f, -1.02268677e-05f, 3.22806454e-06f, -4.17234816e-07f,
+   -2.99972976e-06f, 8.47738647e-06f, -1.84711989e-05f, 3.45364751e-05f,
+   -5.78980034e-05f, 8.89480434e-05f, -1.26649145e-04f, 1.67868304e-04f,
+   -2.06744211e-04f, 2.34134553e-04f, -2.37312852e-04f, 2.00036200e-04f,
+   -1.03060323e-04f, -7.47848899e-05f, 3.54871881e-04f, -7.56498834e-04f,
+   1.29403779e-03f, -1.97375542e-03f, 2.79034139e-03f, -3.72360996e-03f,
+   4.73558577e-03f, -5.76826790e-03f, 6.74238801e-03f, -7.55718909e-03f,
+   8.09155311e-03f, -8.20633490e-03f, 7.74755655e-03f, -6.54965127e-03f,
+   4.43836208e-03f, -1.23099529e-03f, -3.26747866e-03f, 9.27782431e-03f,
+   -1.70773324e-02f, 2.70644557e-02f, -3.99005264e-02f, 5.68382479e-02f,
+   -8.05971175e-02f, 1.18237108e-01f, -1.94666281e-01f, 4.97051388e-01f,
+   7.53297508e-01f, -1.84696347e-01f, 8.94887373e-02f, -4.83658053e-02f,
+   2.49355938e-02f, -9.89607628e-03f, -2.25537573e-04f, 7.05009932e-03f,
+   -1.14736026e-02f, 1.40693039e-02f, -1.52520286e-02f, 1.53511390e-02f,
+   -1.46437595e-02f, 1.33688385e-02f, -1.17327003e-02f, 9.91056580e-03f,
+   -8.04657955e-03f, 6.25394471e-03f, -4.61566355e-03f, 3.18633276e-03f,
+   -1.99515373e-03f, 1.04971265e-03f, -3.40171449e-04f, -1.56096517e-04f,
+   4.69925551e-04f, -6.36319164e-04f, 6.90870278e-04f, -6.67008921e-04f,
+   5.93992474e-04f, -4.95773274e-04f, 3.90569126e-04f, -2.91011005e-04f,
+   2.04747441e-04f, -1.35326918e-04f, 8.32281585e-05f, -4.68599246e-05f,
+   2.34681520e-05f, -9.87330986e-06f, 3.02084027e-06f, -3.18101542e-07f,
+   -3.03776119e-06f, 8.54851623e-06f, -1.85559038e-05f, 3.45783374e-05f,
+   -5.77836618e-05f, 8.84872934e-05f, -1.25556733e-04f, 1.65752601e-04f,
+   -2.03104646e-04f, 2.28378136e-04f, -2.28796780e-04f, 1.88120117e-04f,
+   -8.71978700e-05f, -9.49098830e-05f, 3.79234378e-04f, -7.84555043e-04f,
+   1.32457784e-03f, -2.00470770e-03f, 2.81870645e-03f, -3.74533935e-03f,
+   4.74555092e-03f, -5.76034607e-03f, 6.70961244e-03f, -7.49199325e-03f,
+   7.98612367e-03f, -8.05312023e-03f, 7.53978733e-03f, -6.28198637e-03f,
+   4.10759076e-03f, -8.36797117e-04f, -3.72162741e-03f, 9.78398137e-03f,
+   -1.76213440e-02f, 2.76244450e-02f, -4.04430889e-02f, 5.73108308e-02f,
+   -8.09076577e-02f, 1.18187718e-01f, -1.93629354e-01f, 4.89604503e-01f,
+   7.58993208e-01f, -1.82999000e-01f, 8.79352093e-02f, -4.70278002e-02f,
+   2.37893164e-02f, -8.92180577e-03f, -1.04210537e-03f, 7.72125507e-03f,
+   -1.20114218e-02f, 1.44863464e-02f, -1.55617138e-02f, 1.55675597e-02f,
+   -1.47813400e-02f, 1.34418868e-02f, -1.17550064e-02f, 9.89491865e-03f,
+   -8.00445769e-03f, 6.19528862e-03f, -4.54865908e-03f, 3.11748520e-03f,
+   -1.92928931e-03f, 9.90067492e-04f, -2.88644136e-04f, -1.98668582e-04f,
+   5.03614137e-04f, -6.61801139e-04f, 7.09191605e-04f, -6.79417106e-04f,
+   6.01777923e-04f, -5.00144961e-04f, 3.92578135e-04f, -2.91518809e-04f,
+   2.04411685e-04f, -1.34612870e-04f, 8.24369199e-05f, -4.61605123e-05f,
+   2.29340276e-05f, -9.51362563e-06f, 2.81080543e-06f, -2.17796185e-07f,
+   -3.07406481e-06f, 8.61591798e-06f, -1.86333309e-05f, 3.46076049e-05f,
+   -5.76497623e-05f, 8.79982254e-05f, -1.24426253e-04f, 1.63588295e-04f,
+   -1.99408634e-04f, 2.22566799e-04f, -2.20232760e-04f, 1.76175963e-04f,
+   -7.13616391e-05f, -1.14940747e-04f, 4.03403857e-04f, -8.12273938e-04f,
+   1.35457213e-03f, -2.03489559e-03f, 2.84604635e-03f, -3.76572832e-03f,
+   4.75386716e-03f, -5.75047033e-03f, 6.67460635e-03f, -7.42436480e-03f,
+   7.87818246e-03f, -7.89748784e-03f, 7.32985558e-03f, -6.01274846e-03f,
+   3.77606950e-03f, -4.43097699e-04f, -4.17365786e-03f, 1.02857370e-02f,
+   -1.81581415e-02f, 2.81736813e-02f, -4.09704745e-02f, 5.77624813e-02f,
+   -8.11894909e-02f, 1.18098326e-01f, -1.92534670e-01f, 4.82139885e-01f,
+   7.64618695e-01f, -1.81223214e-01f, 8.63430500e-02f, -4.56684679e-02f,
+   2.26311572e-02f, -7.94190355e-03f, -1.86024455e-03f, 8.39122944e-03f,
+   -1.25462366e-02f, 1.48992902e-02f, -1.58666503e-02f, 1.57790873e-02f,
+   -1.49141159e-02f, 1.35104926e-02f, -1.17733348e-02f, 9.87584982e-03f,
+   -7.95950834e-03f, 6.13436382e-03f, -4.47997171e-03f, 3.04743648e-03f,
+   -1.86260801e-03f, 9.29917675e-04f, -2.36903696e-04f, -2.41285161e-04f,
+   5.37233602e-04f, -6.87120948e-04f, 7.27319159e-04f, -6.91630587e-04f,
+   6.09384617e-04f, -5.04358497e-04f, 3.94458824e-04f, -2.91927921e-04f,
+   2.04003343e-04f, -1.33849098e-04f, 8.16128668e-05f, -4.54414694e-05f,
+   2.23880197e-05f, -9.14791599e-06f, 2.59803824e-06f, -1.16148378e-07f,
+   -3.10872292e-06f, 8.67957624e-06f, -1.87034802e-05f, 3.46245652e-05f,
+   -5.74963997e-05f, 8.74808175e-05f, -1.23257021e-04f, 1.61376171e-04f,
+   -1.95659959e-04f, 2.16699351e-04f, -2.11620951e-04f, 1.64215715e-04f,
+   -5.55518345e-05f, -1.34877424e-04f, 4.27356834e-04f, -8.39627814e-04f,
+   1.38402334e-03f, -2.06431956e-03f, 2.87233572e-03f, -3.78478295e-03f,
+   4.76054195e-03f, -5.73865417e-03f, 6.63740467e-03f, -7.35434191e-03f,
+   7.76779000e-03f, -7.73947360e-03f, 7.11787399e-03f, -5.74198971e-03f,
+   3.44396685e-03f, -5.01577488e-05f, -4.62327339e-03f, 1.07827689e-02f,
+   -1.86875146e-02f, 2.87119597e-02f, -4.14824598e-02f, 5.81930317e-02f,
+   -8.14426169e-02f, 1.17969163e-01f, -1.91383019e-01f, 4.74659175e-01f,
+   7.70172775e-01f, -1.79368779e-01f, 8.47126245e-02f, -4.42880616e-02f,
+   2.14615613e-02f, -6.95652841e-03f, -2.67981365e-03f, 9.05989949e-03f,
+   -1.30778579e-02f, 1.53079201e-02f, -1.61667727e-02f, 1.59856007e-02f,
+   -1.50420517e-02f, 1.35746030e-02f, -1.17876697e-02f, 9.85336676e-03f,
+   -7.91174918e-03f, 6.07122993e-03f, -4.40959958e-03f, 2.97616026e-03f,
+   -1.79510959e-03f, 8.69321695e-04f, -1.84950724e-04f, -2.83945439e-04f,
+   5.70750330e-04f, -7.12278066e-04f, 7.45256664e-04f, -7.03648897e-04f,
+   6.16804697e-04f, -5.08412661e-04f, 3.96210875e-04f, -2.92237441e-04f,
+   2.03522301e-04f, -1.33034351e-04f, 8.07561883e-05f, -4.47014645e-05f,
+   2.18302612e-05f, -8.77628190e-06f, 2.38215762e-06f, -1.31842306e-08f,
+   -3.14167187e-06f, 8.73933550e-06f, -1.87664318e-05f, 3.46292400e-05f,
+   -5.73238722e-05f, 8.69358191e-05f, -1.22051584e-04f, 1.59119314e-04f,
+   -1.91859363e-04f, 2.10783270e-04f, -2.02972820e-04f, 1.52239678e-04f,
+   -3.97738768e-05f, -1.54694018e-04f, 4.51085682e-04f, -8.66618298e-04f,
+   1.41292217e-03f, -2.09294260e-03f, 2.89757131e-03f, -3.80249834e-03f,
+   4.76557016e-03f, -5.72490878e-03f, 6.59801718e-03f, -7.28197722e-03f,
+   7.65497098e-03f, -7.57910963e-03f, 6.90388260e-03f, -5.46976086e-03f,
+   3.11128958e-03f, 3.42145009e-04f, -5.07047214e-03f, 1.12752402e-02f,
+   -1.92094296e-02f, 2.92392503e-02f, -4.19790335e-02f, 5.86025082e-02f,
+   -8.16670507e-02f, 1.17800459e-01f, -1.90175176e-01f, 4.67163473e-01f,
+   7.75654376e-01f, -1.77435622e-01f, 8.30443427e-02f, -4.28870767e-02f,
+   2.02808902e-02f, -5.96607942e-03f, -3.50047043e-03f, 9.72698070e-03f,
+   -1.36062270e-02f, 1.57121569e-02f, -1.64620169e-02f, 1.61870588e-02f,
+   -1.51651176e-02f, 1.36342086e-02f, -1.17980028e-02f, 9.82746202e-03f,
+   -7.86118954e-03f, 6.00590464e-03f, -4.33756132e-03f, 2.90375040e-03f,
+   -1.72688183e-03f, 8.08279845e-04f, -1.32802394e-04f, -3.26593290e-04f,
+   6.04153029e-04f, -7.37262832e-04f, 7.62981188e-04f, -7.15455797e-04f,
+   6.24036475e-04f, -5.12305822e-04f, 3.97831725e-04f, -2.92447163e-04f,
+   2.02968702e-04f, -1.32170273e-04f, 7.98668771e-05f, -4.39420728e-05f,
+   2.12620507e-05f, -8.39879431e-06f, 2.16364083e-06f, 9.08665356e-08f,
+   -3.17293120e-06f, 8.79542040e-06f, -1.88222421e-05f, 3.46215420e-05f,
+   -5.71321834e-05f, 8.63630703e-05f, -1.20808734e-04f, 1.56815295e-04f,
+   -1.88007834e-04f, 2.04815282e-04f, -1.94280583e-04f, 1.40251941e-04f,
+   -2.40330537e-05f, -1.74403249e-04f, 4.74606204e-04f, -8.93236778e-04f,
+   1.44125975e-03f, -2.12079589e-03f, 2.92176940e-03f, -3.81887052e-03f,
+   4.76896018e-03f, -5.70922811e-03f, 6.55645970e-03f, -7.20725348e-03f,
+   7.53977057e-03f, -7.41650676e-03f, 6.68796012e-03f, -5.19624539e-03f,
+   2.77831452e-03f, 7.33487250e-04f, -5.51488902e-03f, 1.17627513e-02f,
+   -1.97235551e-02f, 2.97552329e-02f, -4.24599051e-02f, 5.89907356e-02f,
+   -8.18628371e-02f, 1.17592476e-01f, -1.88911974e-01f, 4.59654391e-01f,
+   7.81062424e-01f, -1.75423488e-01f, 8.13383907e-02f, -4.14657854e-02f,
+   1.90895088e-02f, -4.97087883e-03f, -4.32193838e-03f, 1.03922421e-02f,
+   -1.41309425e-02f, 1.61118489e-02f, -1.67521760e-02f, 1.63833834e-02f,
+   -1.52832214e-02f, 1.36892516e-02f, -1.18043199e-02f, 9.79814585e-03f,
+   -7.80781871e-03f, 5.93833812e-03f, -4.26388020e-03f, 2.83015752e-03f,
+   -1.65785616e-03f, 7.46812206e-04f, -8.04761803e-05f, -3.69269546e-04f,
+   6.37461955e-04f, -7.62066338e-04f, 7.80502916e-04f, -7.27060949e-04f,
+   6.31078205e-04f, -5.16036351e-04f, 3.99321551e-04f, -2.92556448e-04f,
+   2.02342097e-04f, -1.31255743e-04f, 7.89444966e-05f, -4.31630397e-05f,
+   2.06819532e-05f, -8.01530314e-06f, 1.94242170e-06f, 1.96244898e-07f,
+   -3.20252366e-06f, 8.84772817e-06f, -1.88707636e-05f, 3.46017623e-05f,
+   -5.69216863e-05f, 8.57638006e-05f, -1.19530516e-04f, 1.54469235e-04f,
+   -1.84107164e-04f, 1.98797876e-04f, -1.85555400e-04f, 1.28256856e-04f,
+   -8.32957994e-06f, -1.93998756e-04f, 4.97887842e-04f, -9.19474754e-04f,
+   1.46903831e-03f, -2.14784173e-03f, 2.94489996e-03f, -3.83390533e-03f,
+   4.77071293e-03f, -5.69163589e-03f, 6.51275227e-03f, -7.13023683e-03f,
+   7.42221251e-03f, -7.25169806e-03f, 6.47014892e-03f, -4.92145168e-03f,
+   2.44493969e-03f, 1.12386420e-03f, -5.95666701e-03f, 1.22453058e-02f,
+   -2.02298611e-02f, 3.02598849e-02f, -4.29250747e-02f, 5.93576469e-02f,
+   -8.20300058e-02f, 1.17345475e-01f, -1.87594220e-01f, 4.52133328e-01f,
+   7.86395788e-01f, -1.73332229e-01f, 7.95952752e-02f, -4.00247052e-02f,
+   1.78878792e-02f, -3.97133315e-03f, -5.14393952e-03f, 1.10554518e-02f,
+   -1.46520734e-02f, 1.65069196e-02f, -1.70372352e-02f, 1.65745225e-02f,
+   -1.53963491e-02f, 1.37397377e-02f, -1.18066119e-02f, 9.76542011e-03f,
+   -7.75166275e-03f, 5.86861791e-03f, -4.18855064e-03f, 2.75540282e-03f,
+   -1.58812338e-03f, 6.84938335e-04f, -2.79725755e-05f, -4.11918096e-04f,
+   6.70632930e-04f, -7.86679913e-04f, 7.97814108e-04f, -7.38449686e-04f,
+   6.37926103e-04f, -5.19602618e-04f, 4.00679477e-04f, -2.92564830e-04f,
+   2.01643124e-04f, -1.30291446e-04f, 7.79905095e-05f, -4.23644451e-05f,
+   2.00912309e-05f, -7.62669015e-06f, 1.71854367e-06f, 3.02717439e-07f,
+   -3.23044969e-06f, 8.89621879e-06f, -1.89122384e-05f, 3.45699482e-05f,
+   -5.66925410e-05f, 8.51375517e-05f, -1.18217169e-04f, 1.52079432e-04f,
+   -1.80157876e-04f, 1.92736712e-04f, -1.76797912e-04f, 1.16254596e-04f,
+   7.32107947e-06f, -2.13461404e-04f, 5.20938367e-04f, -9.45333741e-04f,
+   1.49622967e-03f, -2.17408338e-03f, 2.96697533e-03f, -3.84758622e-03f,
+   4.77082981e-03f, -5.67213818e-03f, 6.46690000e-03f, -7.05093425e-03f,
+   7.30236014e-03f, -7.08471937e-03f, 6.25056121e-03f, -4.64556366e-03f,
+   2.11138767e-03f, 1.51301804e-03f, -6.39551552e-03f, 1.27226701e-02f,
+   -2.07281075e-02f, 3.07529774e-02f, -4.33743857e-02f, 5.97032420e-02f,
+   -8.21686089e-02f, 1.17059730e-01f, -1.86222732e-01f, 4.44601566e-01f,
+   7.91653454e-01f, -1.71161801e-01f, 7.78152943e-02f, -3.85641754e-02f,
+   1.66761838e-02f, -2.96760723e-03f, -5.96612925e-03f, 1.17163267e-02f,
+   -1.51692657e-02f, 1.68971550e-02f, -1.73169971e-02f, 1.67603735e-02f,
+   -1.55044189e-02f, 1.37856249e-02f, -1.18048703e-02f, 9.72927734e-03f,
+   -7.69273657e-03f, 5.79671422e-03f, -4.11164621e-03f, 2.67955963e-03f,
+   -1.51768187e-03f, 6.22658583e-04f, 2.46567306e-05f, -4.54537832e-04f,
+   7.03675847e-04f, -8.11101403e-04f, 8.14898347e-04f, -7.49620493e-04f,
+   6.44578657e-04f, -5.23001712e-04f, 4.01903584e-04f, -2.92471959e-04f,
+   2.00870854e-04f, -1.29277658e-04f, 7.70052065e-05f, -4.15465038e-05f,
+   1.94897057e-05f, -7.23226276e-06f, 1.49207312e-06f, 4.10252625e-07f,
+   -3.25670953e-06f, 8.94106324e-06f, -1.89466664e-05f, 3.45260160e-05f,
+   -5.64447073e-05f, 8.44845563e-05f, -1.16867828e-04f, 1.49646716e-04f,
+   -1.76163609e-04f, 1.86632504e-04f, -1.68008279e-04f, 1.04257044e-04f,
+   2.29187954e-05f, -2.32797465e-04f, 5.43735572e-04f, -9.70787718e-04f,
+   1.52283628e-03f, -2.19952362e-03f, 2.98797223e-03f, -3.85992043e-03f,
+   4.76931687e-03f, -5.65073965e-03f, 6.41895132e-03f, -6.96938857e-03f,
+   7.18029914e-03f, -6.91568572e-03f, 6.02931203e-03f, -4.36863489e-03f,
+   1.77782634e-03f, 1.90088199e-03f, -6.83122175e-03f, 1.31945396e-02f,
+   -2.12182272e-02f, 3.12344525e-02f, -4.38076928e-02f, 6.00274205e-02f,
+   -8.22786987e-02f, 1.16735503e-01f, -1.84798345e-01f, 4.37060773e-01f,
+   7.96834290e-01f, -1.68912083e-01f, 7.59987459e-02f, -3.70844901e-02f,
+   1.54549973e-02f, -1.96011201e-03f, -6.78836135e-03f, 1.23747429e-02f,
+   -1.56823322e-02f, 1.72823519e-02f, -1.75913963e-02f, 1.69408303e-02f,
+   -1.56073999e-02f, 1.38268806e-02f, -1.17990877e-02f, 9.68973897e-03f,
+   -7.63106486e-03f, 5.72269689e-03f, -4.03316552e-03f, 2.60260003e-03f,
+   -1.44653162e-03f, 5.60033834e-04f, 7.74110304e-05f, -4.97128000e-04f,
+   7.36557413e-04f, -8.35307350e-04f, 8.31759127e-04f, -7.60571624e-04f,
+   6.51029812e-04f, -5.26232063e-04f, 4.02993785e-04f, -2.92277662e-04f,
+   2.00025301e-04f, -1.28213636e-04f, 7.59865507e-05f, -4.07088228e-05f,
+   1.88775484e-05f, -6.83212647e-06f, 1.26308237e-06f, 5.19026401e-07f,
+   -3.28132842e-06f, 8.98218605e-06f, -1.89739458e-05f, 3.44702712e-05f,
+   -5.61786619e-05f, 8.38062188e-05f, -1.15485738e-04f, 1.47174462e-04f,
+   -1.72125030e-04f, 1.80487375e-04f, -1.59198156e-04f, 9.22684630e-05f,
+   3.84583727e-05f, -2.51981895e-04f, 5.66272414e-04f, -9.95838549e-04f,
+   1.54885184e-03f, -2.22412846e-03f, 3.00788949e-03f, -3.87090584e-03f,
+   4.76617692e-03f, -5.62747056e-03f, 6.36891369e-03f, -6.88566174e-03f,
+   7.05599785e-03f, -6.74460363e-03f, 5.80644282e-03f, -4.09071567e-03f,
+   1.44431589e-03f, 2.28738901e-03f, -7.26378383e-03f, 1.36610717e-02f,
+   -2.17000265e-02f, 3.17041725e-02f, -4.42249924e-02f, 6.03302047e-02f,
+   -8.23603496e-02f, 1.16373114e-01f, -1.83321983e-01f, 4.29512024e-01f,
+   8.01937401e-01f, -1.66583031e-01f, 7.41461739e-02f, -3.55863124e-02f,
+   1.42244007e-02f, -9.49179172e-04f, -7.61028938e-03f, 1.30304163e-02f,
+   -1.61911752e-02f, 1.76624320e-02f, -1.78603753e-02f, 1.71158537e-02f,
+   -1.57052614e-02f, 1.38634956e-02f, -1.17892548e-02f, 9.64679662e-03f,
+   -7.56666344e-03f, 5.64658782e-03f, -3.95312905e-03f, 2.52462504e-03f,
+   -1.37476530e-03f, 4.97064088e-04f, 1.30272500e-04f, -5.39632456e-04f,
+   7.69266393e-04f, -8.59295658e-04f, 8.48373922e-04f, -7.71289458e-04f,
+   6.57277997e-04f, -5.29292389e-04f, 4.03948390e-04f, -2.91981298e-04f,
+   1.99106958e-04f, -1.27100284e-04f, 7.49369065e-05f, -3.98533703e-05f,
+   1.82548029e-05f, -6.42692112e-06f, 1.03162472e-06f, 6.28798261e-07f,
+   -3.30432840e-06f, 9.01956628e-06f, -1.89943185e-05f, 3.44027030e-05f,
+   -5.58943757e-05f, 8.31015350e-05f, -1.14069153e-04f, 1.44659920e-04f,
+   -1.68043582e-04f, 1.74303510e-04f, -1.50359454e-04f, 8.02811992e-05f,
+   5.39346220e-05f, -2.71027442e-04f, 5.88564086e-04f, -1.02047843e-03f,
+   1.57426647e-03f, -2.24792585e-03f, 3.02674319e-03f, -3.88054037e-03f,
+   4.76141460e-03f, -5.60231693e-03f, 6.31680759e-03f, -6.79974491e-03f,
+   6.92956150e-03f, -6.57158997e-03f, 5.58203598e-03f, -3.81199364e-03f,
+   1.11097016e-03f, 2.67228438e-03f, -7.69285113e-03f, 1.41218901e-02f,
+   -2.21733619e-02f, 3.21618915e-02f, -4.46260534e-02f, 6.06114641e-02f,
+   -8.24136436e-02f, 1.15972847e-01f, -1.81794405e-01f, 4.21957076e-01f,
+   8.06961536e-01f, -1.64174438e-01f, 7.22577572e-02f, -3.40698846e-02f,
+   1.29850795e-02f, 6.48576097e-05f, -8.43163300e-03f, 1.36831179e-02f,
+   -1.66955274e-02f, 1.80372559e-02f, -1.81237441e-02f, 1.72853712e-02f,
+   -1.57979298e-02f, 1.38954306e-02f, -1.17753716e-02f, 9.60048381e-03f,
+   -7.49951648e-03f, 5.56833111e-03f, -3.87156405e-03f, 2.44558346e-03f,
+   -1.30231155e-03f, 4.33770823e-04f, 1.83223325e-04f, -5.82077657e-04f,
+   8.01822287e-04f, -8.83057888e-04f, 8.64753034e-04f, -7.81782437e-04f,
+   6.63320592e-04f, -5.32181235e-04f, 4.04767110e-04f, -2.91582488e-04f,
+   1.98115289e-04f, -1.25937178e-04f, 7.38559029e-05f, -3.89779234e-05f,
+   1.76213034e-05f, -6.01649845e-06f, 7.97617645e-07f, 7.39608026e-07f,
+   -3.32567856e-06f, 9.05330398e-06f, -1.90076989e-05f, 3.43234351e-05f,
+   -5.55923434e-05f, 8.23719893e-05f, -1.12620321e-04f, 1.42108693e-04f,
+   -1.63920748e-04f, 1.68081489e-04f, -1.41503595e-04f, 6.83110120e-05f,
+   6.93474940e-05f, -2.89927761e-04f, 6.10581716e-04f, -1.04469969e-03f,
+   1.59908272e-03f, -2.27088528e-03f, 3.04450723e-03f, -3.88882682e-03f,
+   4.75503504e-03f, -5.57531090e-03f, 6.26265584e-03f, -6.71167113e-03f,
+   6.80099847e-03f, -6.39668200e-03f, 5.35613252e-03f, -3.53251980e-03f,
+   7.77848065e-04f, 3.05556506e-03f, -8.11856333e-03f, 1.45770004e-02f,
+   -2.26380918e-02f, 3.26075964e-02f, -4.50108796e-02f, 6.08712398e-02f,
+   -8.24386552e-02f, 1.15535051e-01f, -1.80216521e-01f, 4.14396971e-01f,
+   8.11905861e-01f, -1.61686406e-01f, 7.03342333e-02f, -3.25357690e-02f,
+   1.17374286e-02f, 1.08157983e-03f, -9.25204344e-03f, 1.43325664e-02f,
+   -1.71953309e-02f, 1.84067413e-02f, -1.83814466e-02f, 1.74493417e-02f,
+   -1.58853941e-02f, 1.39226876e-02f, -1.17574297e-02f, 9.55077354e-03f,
+   -7.42966263e-03f, 5.48802782e-03f, -3.78849450e-03f, 2.36549764e-03f,
+   -1.22926559e-03f, 3.70174617e-04f, 2.36262567e-04f, -6.24448876e-04f,
+   8.34181963e-04f, -9.06585541e-04f, 8.80889187e-04f, -7.92036182e-04f,
+   6.69155270e-04f, -5.34896972e-04f, 4.05449333e-04f, -2.91081466e-04f,
+   1.97051384e-04f, -1.24725208e-04f, 7.27434453e-05f, -3.80844976e-05f,
+   1.69784580e-05f, -5.60095577e-06f, 5.61434774e-07f, 8.51414313e-07f,
+   -3.34538481e-06f, 9.08340280e-06f, -1.90141691e-05f, 3.42325911e-05f,
+   -5.52725432e-05f, 8.16179381e-05f, -1.11139838e-04f, 1.39518845e-04f,
+   -1.59757095e-04f, 1.61827236e-04f, -1.32631016e-04f, 5.63543181e-05f,
+   8.46817711e-05f, -3.08664545e-04f, 6.32325420e-04f, -1.06850348e-03f,
+   1.62327732e-03f, -2.29300791e-03f, 3.06119327e-03f, -3.89576587e-03f,
+   4.74704569e-03f, -5.54646039e-03f, 6.20646402e-03f, -6.62149070e-03f,
+   6.67037629e-03f, -6.21991418e-03f, 5.12884930e-03f, -3.25234584e-03f,
+   4.45117243e-04f, 3.43697914e-03f, -8.54064245e-03f, 1.50261102e-02f,
+   -2.30940394e-02f, 3.30410860e-02f, -4.53793220e-02f, 6.11094795e-02f,
+   -8.24354887e-02f, 1.15060009e-01f, -1.78589150e-01f, 4.06833351e-01f,
+   8.16769361e-01f, -1.59118861e-01f, 6.83758780e-02f, -3.09843477e-02f,
+   1.04816388e-02f, 2.10081483e-03f, -1.00713745e-02f, 1.49786379e-02f,
+   -1.76902842e-02f, 1.87706929e-02f, -1.86334215e-02f, 1.76076684e-02f,
+   -1.59675870e-02f, 1.39452349e-02f, -1.17354328e-02f, 9.49769374e-03f,
+   -7.35711958e-03f, 5.40564628e-03f, -3.70391551e-03f, 2.28444603e-03f,
+   -1.15562684e-03f, 3.06275557e-04f, 2.89338030e-04f, -6.66703796e-04f,
+   8.66354734e-04f, -9.29876696e-04f, 8.96765792e-04f, -8.02050345e-04f,
+   6.74780051e-04f, -5.37437503e-04f, 4.05994011e-04f, -2.90477474e-04f,
+   1.95914108e-04f, -1.23464721e-04f, 7.16000213e-05f, -3.71733840e-05f,
+   1.63251098e-05f, -5.18041634e-06f, 3.23149408e-07f, 9.64188530e-07f,
+   -3.36352969e-06f, 9.10986546e-06f, -1.90137525e-05f, 3.41302184e-05f,
+   -5.49350043e-05f, 8.08385957e-05f, -1.09626359e-04f, 1.36891264e-04f,
+   -1.55556510e-04f, 1.55541231e-04f, -1.23742080e-04f, 4.44228135e-05f,
+   9.99375334e-05f, -3.27244023e-04f, 6.53796073e-04f, -1.09186710e-03f,
+   1.64685084e-03f, -2.31429772e-03f, 3.07678385e-03f, -3.90135287e-03f,
+   4.73744981e-03f, -5.51576866e-03f, 6.14829035e-03f, -6.52923761e-03f,
+   6.53778668e-03f, -6.04140665e-03f, 4.90030367e-03f, -2.97166011e-03f,
+   1.12944130e-04f, 3.81646282e-03f, -8.95888358e-03f, 1.54691543e-02f,
+   -2.35411432e-02f, 3.34623232e-02f, -4.57313582e-02f, 6.13261573e-02f,
+   -8.24042484e-02f, 1.14548072e-01f, -1.76913247e-01f, 3.99267584e-01f,
+   8.21550906e-01f, -1.56471804e-01f, 6.63830563e-02f, -2.94160042e-02f,
+   9.21831373e-03f, 3.12205777e-03f, -1.08892769e-02f, 1.56210512e-02f,
+   -1.81802046e-02f, 1.91288590e-02f, -1.88794900e-02f, 1.77602638e-02f,
+   -1.60444807e-02f, 1.39630539e-02f, -1.17093762e-02f, 9.44126584e-03f,
+   -7.28192134e-03f, 5.32126520e-03f, -3.61791067e-03f, 2.20240070e-03f,
+   -1.08139426e-03f, 2.42136855e-04f, 3.42448591e-04f, -7.08855048e-04f,
+   8.98308412e-04f, -9.52907722e-04f, 9.12382384e-04f, -8.11822596e-04f,
+   6.80189929e-04f, -5.39801607e-04f, 4.06400068e-04f, -2.89770338e-04f,
+   1.94703593e-04f, -1.22154524e-04f, 7.04259510e-05f, -3.62428509e-05f,
+   1.56614879e-05f, -4.75500428e-06f, 8.23630444e-08f, 1.07796870e-06f,
+   -3.38006271e-06f, 9.13266376e-06f, -1.90065548e-05f, 3.40165025e-05f,
+   -5.45806106e-05f, 8.00356138e-05f, -1.08083506e-04f, 1.34229573e-04f,
+   -1.51319575e-04f, 1.49225962e-04f, -1.14848284e-04f, 3.25205838e-05f,
+   1.15109746e-04f, -3.45642155e-04f, 6.74966199e-04f, -1.11479161e-03f,
+   1.66979828e-03f, -2.33472604e-03f, 3.09127918e-03f, -3.90559528e-03f,
+   4.72626230e-03f, -5.48328087e-03f, 6.08814368e-03f, -6.43497799e-03f,
+   6.40319334e-03f, -5.86116826e-03f, 4.67053941e-03f, -2.69046798e-03f,
+   -2.18612913e-04f, 4.19395091e-03f, -9.37328860e-03f, 1.59060657e-02f,
+   -2.39792317e-02f, 3.38711478e-02f, -4.60669063e-02f, 6.15213141e-02f,
+   -8.23450387e-02f, 1.13999628e-01f, -1.75189719e-01f, 3.91701013e-01f,
+   8.26249719e-01f, -1.53745249e-01f, 6.43563867e-02f, -2.78313253e-02f,
+   7.94754550e-03f, 4.14521666e-03f, -1.17054684e-02f, 1.62595790e-02f,
+   -1.86649989e-02f, 1.94813367e-02f, -1.91196352e-02f, 1.79070886e-02f,
+   -1.61160510e-02f, 1.39761334e-02f, -1.16792591e-02f, 9.38148145e-03f,
+   -7.20408512e-03f, 5.23491064e-03f, -3.53047741e-03f, 2.11946922e-03f,
+   -1.00666576e-03f, 1.77758848e-04f, 3.95576179e-04f, -7.50847103e-04f,
+   9.30030888e-04f, -9.75677627e-04f, 9.27731977e-04f, -8.21340887e-04f,
+   6.85381936e-04f, -5.41987247e-04f, 4.06667503e-04f, -2.88960669e-04f,
+   1.93420696e-04f, -1.20796183e-04f, 6.92211615e-05f, -3.52950410e-05f,
+   1.49890702e-05f, -4.32482739e-06f, -1.60383635e-07f, 1.19249682e-06f,
+   -3.39500593e-06f, 9.15194323e-06f, -1.89925831e-05f, 3.38914797e-05f,
+   -5.42087218e-05f, 7.92084757e-05f, -1.06509593e-04f, 1.31530644e-04f,
+   -1.47047802e-04f, 1.42883335e-04f, -1.05941377e-04f, 2.06400837e-05f,
+   1.30193381e-04f, -3.63871397e-04f, 6.95856579e-04f, -1.13726978e-03f,
+   1.69211277e-03f, -2.35431688e-03f, 3.10469256e-03f, -3.90848983e-03f,
+   4.71348176e-03f, -5.44897141e-03f, 6.02604449e-03f, -6.33870391e-03f,
+   6.26671268e-03f, -5.67932054e-03f, 4.43963800e-03f, -2.40895711e-03f,
+   -5.49441960e-04f, 4.56919707e-03f, -9.78352223e-03f, 1.63365658e-02f,
+   -2.44081784e-02f, 3.42674553e-02f, -4.63858172e-02f, 6.16948828e-02f,
+   -8.22579786e-02f, 1.13414966e-01f, -1.73419327e-01f, 3.84135038e-01f,
+   8.30864668e-01f, -1.50939211e-01f, 6.22961856e-02f, -2.62306463e-02f,
+   6.67015463e-03f, 5.16961701e-03f, -1.25196669e-02f, 1.68939959e-02f,
+   -1.91444103e-02f, 1.98278222e-02f, -1.93536878e-02f, 1.80480815e-02f,
+   -1.61822401e-02f, 1.39844604e-02f, -1.16450908e-02f, 9.31838714e-03f,
+   -7.12359603e-03f, 5.14652207e-03f, -3.44164344e-03f, 2.03559664e-03f,
+   -9.31368035e-04f, 1.13163209e-04f, 4.48702718e-04f, -7.92705629e-04f,
+   9.61542013e-04f, -9.98178264e-04f, 9.42808867e-04f, -8.30612495e-04f,
+   6.90357760e-04f, -5.43994247e-04f, 4.06795560e-04f, -2.88046867e-04f,
+   1.92064908e-04f, -1.19389064e-04f, 6.79853983e-05f, -3.43296015e-05f,
+   1.43062252e-05f, -3.88973240e-06f, -4.05173722e-07f, 1.30803176e-06f,
+   -3.40839006e-06f, 9.16763929e-06f, -1.89719231e-05f, 3.37553538e-05f,
+   -5.38202585e-05f, 7.83589858e-05f, -1.04906765e-04f, 1.28800792e-04f,
+   -1.42742705e-04f, 1.36513860e-04f, -9.70330875e-05f, 8.79683375e-06f,
+   1.45183687e-04f, -3.81925696e-04f, 7.16440321e-04f, -1.15929602e-03f,
+   1.71379512e-03f, -2.37304554e-03f, 3.11700441e-03f, -3.91004141e-03f,
+   4.69911611e-03f, -5.41288499e-03f, 5.96202165e-03f, -6.24045124e-03f,
+   6.12834934e-03f, -5.49590029e-03f, 4.20764182e-03f, -2.12717941e-03f,
+   -8.79485102e-04f, 4.94219922e-03f, -1.01897204e-02f, 1.67606603e-02f,
+   -2.48278212e-02f, 3.46511416e-02f, -4.66881059e-02f, 6.18469119e-02f,
+   -8.21432173e-02f, 1.12794518e-01f, -1.71603084e-01f, 3.76571029e-01f,
+   8.35395038e-01f, -1.48053750e-01f, 6.02031052e-02f, -2.46145036e-02f,
+   5.38623985e-03f, 6.19516382e-03f, -1.33315260e-02f, 1.75240263e-02f,
+   -1.96183417e-02f, 2.01682970e-02f, -1.95815936e-02f, 1.81832053e-02f,
+   -1.62430275e-02f, 1.39880199e-02f, -1.16068628e-02f, 9.25195310e-03f,
+   -7.04050157e-03f, 5.05621219e-03f, -3.35143553e-03f, 1.95080810e-03f,
+   -8.55598715e-04f, 4.83715849e-05f, 5.01826697e-04f, -8.34416016e-04f,
+   9.92799760e-04f, -1.02040032e-03f, 9.57611890e-04f, -8.39624554e-04f,
+   6.95111463e-04f, -5.45820978e-04f, 4.06783074e-04f, -2.87030358e-04f,
+   1.90637409e-04f, -1.17934345e-04f, 6.67213681e-05f, -3.33467033e-05f,
+   1.36145127e-05f, -3.45069679e-06f, -6.51931487e-07f, 1.42431202e-06f,
+   -3.42022054e-06f, 9.17976740e-06f, -1.89446309e-05f, 3.36082048e-05f,
+   -5.34154387e-05f, 7.74862419e-05f, -1.03275670e-04f, 1.26037543e-04f,
+   -1.38404706e-04f, 1.30123895e-04f, -8.81235464e-05f, -3.01285036e-06f,
+   1.60080512e-04f, -3.99787532e-04f, 7.36718590e-04f, -1.18087057e-03f,
+   1.73482578e-03f, -2.39091320e-03f, 3.12822429e-03f, -3.91025469e-03f,
+   4.68317978e-03f, -5.37503045e-03f, 5.89607982e-03f, -6.14027353e-03f,
+   5.98819973e-03f, -5.31094335e-03f, 3.97467101e-03f, -1.84518576e-03f,
+   -1.20857765e-03f, 5.31271286e-03f, -1.05916196e-02f, 1.71780810e-02f,
+   -2.52381079e-02f, 3.50220725e-02f, -4.69736606e-02f, 6.19773977e-02f,
+   -8.20008814e-02f, 1.12138636e-01f, -1.69741884e-01f, 3.69010448e-01f,
+   8.39839697e-01f, -1.45088881e-01f, 5.80774732e-02f, -2.29834449e-02f,
+   4.09631804e-03f, 7.22142821e-03f, -1.41408937e-02f, 1.81495436e-02f,
+   -2.00866163e-02f, 2.05025766e-02f, -1.98032986e-02f, 1.83123779e-02f,
+   -1.62983891e-02f, 1.39868017e-02f, -1.15645966e-02f, 9.18221939e-03f,
+   -6.95483806e-03f, 4.96394746e-03f, -3.25985113e-03f, 1.86518708e-03f,
+   -7.79358787e-04f, -1.66154223e-05f, 5.54896076e-04f, -8.75936646e-04f,
+   1.02380209e-03f, -1.04234274e-03f, 9.72125330e-04f, -8.48376600e-04f,
+   6.99642638e-04f, -5.47465228e-04f, 4.06630483e-04f, -2.85910239e-04f,
+   1.89137238e-04f, -1.16432435e-04f, 6.54266914e-05f, -3.23466411e-05f,
+   1.29141526e-05f, -3.00699207e-06f, -9.00581028e-07f, 1.54130055e-06f,
+   -3.43050260e-06f, 9.18844398e-06f, -1.89107268e-05f, 3.34501128e-05f,
+   -5.29937497e-05f, 7.65905352e-05f, -1.01615078e-04f, 1.23241887e-04f,
+   -1.34038157e-04f, 1.23713573e-04f, -7.92130959e-05f, -1.47773671e-05f,
+   1.74869332e-04f, -4.17463481e-04f, 7.56691385e-04f, -1.20197330e-03f,
+   1.75520568e-03f, -2.40792334e-03f, 3.13834287e-03f, -3.90912779e-03f,
+   4.66568070e-03f, -5.33541152e-03f, 5.82828652e-03f, -6.03820896e-03f,
+   5.84629318e-03f, -5.12457639e-03f, 3.74088180e-03f, -1.56316417e-03f,
+   -1.53655570e-03f, 5.68067841e-03f, -1.09890252e-02f, 1.75887719e-02f,
+   -2.56388839e-02f, 3.53802145e-02f, -4.72424813e-02f, 6.20863736e-02f,
+   -8.18311200e-02f, 1.11447670e-01f, -1.67836636e-01f, 3.61454636e-01f,
+   8.44197869e-01f, -1.42044798e-01f, 5.59198856e-02f, -2.13378202e-02f,
+   2.80091190e-03f, 8.24798178e-03f, -1.49473576e-02f, 1.87702272e-02f,
+   -2.05489509e-02f, 2.08304282e-02f, -2.00186409e-02f, 1.84355062e-02f,
+   -1.63482763e-02f, 1.39807994e-02f, -1.15182893e-02f, 9.10921115e-03f,
+   -6.86660083e-03f, 4.86981729e-03f, -3.16697988e-03f, 1.77873333e-03f,
+   -7.02647434e-04f, -8.17337132e-05f, 6.07909402e-04f, -9.17278870e-04f,
+   1.05454819e-03f, -1.06398284e-03f, 9.86348721e-04f, -8.56866827e-04f,
+   7.03946338e-04f, -5.48926764e-04f, 4.06336214e-04f, -2.84686335e-04f,
+   1.87564670e-04f, -1.14882023e-04f, 6.41018632e-05f, -3.13297023e-05f,
+   1.22039055e-05f, -2.55874556e-06f, -1.15104649e-06f, 1.65918391e-06f,
+   -3.43926877e-06f, 9.19362537e-06f, -1.88703434e-05f, 3.32812888e-05f,
+   -5.25562427e-05f, 7.56738591e-05f, -9.99286640e-05f, 1.20417899e-04f,
+   -1.29643304e-04f, 1.17285352e-04f, -7.03133046e-05f, -2.64928385e-05f,
+   1.89550497e-04f, -4.34930174e-04f, 7.76333327e-04f, -1.22260535e-03f,
+   1.77493074e-03f, -2.42405524e-03f, 3.14735924e-03f, -3.90666863e-03f,
+   4.64662816e-03f, -5.29408175e-03f, 5.75867062e-03f, -5.93432924e-03f,
+   5.70265949e-03f, -4.93680499e-03f, 3.50620481e-03f, -1.28111918e-03f,
+   -1.86336332e-03f, 6.04603393e-03f, -1.13818776e-02f, 1.79926679e-02f,
+   -2.60300338e-02f, 3.57254446e-02f, -4.74944934e-02f, 6.21738620e-02f,
+   -8.16340894e-02f, 1.10722043e-01f, -1.65888250e-01f, 3.53904933e-01f,
+   8.48468661e-01f, -1.38921618e-01f, 5.37309609e-02f, -1.96782593e-02f,
+   1.50012446e-03f, 9.27472580e-03f, -1.57508329e-02f, 1.93860028e-02f,
+   -2.10052896e-02f, 2.11519375e-02f, -2.02276055e-02f, 1.85526125e-02f,
+   -1.63926817e-02f, 1.39700035e-02f, -1.14679402e-02f, 9.03293956e-03f,
+   -6.77585974e-03f, 4.77385055e-03f, -3.07281944e-03f, 1.69147342e-03f,
+   -6.25565823e-04f, -1.46961189e-04f, 6.60847872e-04f, -9.58388962e-04f,
+   1.08499709e-03f, -1.08531967e-03f, 1.00027537e-03f, -8.65083421e-04f,
+   7.08020933e-04f, -5.50203782e-04f, 4.05901141e-04f, -2.83359957e-04f,
+   1.85920493e-04f, -1.13284965e-04f, 6.27488116e-05f, -3.02960871e-05f,
+   1.14853910e-05f, -2.10696612e-06f, -1.40324585e-06f, 1.77769368e-06f,
+   -3.44652767e-06f, 9.19534614e-06f, -1.88234590e-05f, 3.31017327e-05f,
+   -5.21028196e-05f, 7.47345257e-05f, -9.82146230e-05f, 1.17561925e-04f,
+   -1.25221675e-04f, 1.10841458e-04f, -6.14157689e-05f, -3.81668033e-05f,
+   2.04118915e-04f, -4.52199660e-04f, 7.95664906e-04f, -1.24276045e-03f,
+   1.79399550e-03f, -2.43932055e-03f, 3.15528340e-03f, -3.90287931e-03f,
+   4.62602917e-03f, -5.25100995e-03f, 5.68719395e-03f, -5.82862459e-03f,
+   5.55739645e-03f, -4.74778702e-03f, 3.27083538e-03f, -9.99239157e-04f,
+   -2.18889117e-03f, 6.40854193e-03f, -1.17700528e-02f, 1.83895174e-02f,
+   -2.64114458e-02f, 3.60576808e-02f, -4.77296561e-02f, 6.22398965e-02f,
+   -8.14099535e-02f, 1.09962165e-01f, -1.63897663e-01f, 3.46362770e-01f,
+   8.52651119e-01f, -1.35719359e-01f, 5.15110567e-02f, -1.80051252e-02f,
+   1.94801207e-04f, 1.03009790e-02f, -1.65507775e-02f, 1.99964996e-02f,
+   -2.14553848e-02f, 2.14668252e-02f, -2.04300415e-02f, 1.86635889e-02f,
+   -1.64315589e-02f, 1.39544075e-02f, -1.14135742e-02f, 8.95342138e-03f,
+   -6.68258080e-03f, 4.67598066e-03f, -2.97740055e-03f, 1.60343689e-03f,
+   -5.48038690e-04f, -2.12339262e-04f, 7.13693968e-04f, -9.99292010e-04f,
+   1.11517613e-03f, -1.10634544e-03f, 1.01390004e-03f, -8.73033772e-04f,
+   7.11867528e-04f, -5.51295525e-04f, 4.05324157e-04f, -2.81928980e-04f,
+   1.84204531e-04f, -1.11640598e-04f, 6.13671073e-05f, -2.92454297e-05f,
+   1.07578608e-05f, -1.65061329e-06f, -1.65726385e-06f, 1.89687080e-06f,
+   -3.45229932e-06f, 9.19366721e-06f, -1.87702226e-05f, 3.29118120e-05f,
+   -5.16338441e-05f, 7.37747832e-05f, -9.64752762e-05f, 1.14680646e-04f,
+   -1.20775097e-04f, 1.04382059e-04f, -5.25321884e-05f, -4.97839537e-05f,
+   2.18570131e-04f, -4.69266903e-04f, 8.14660161e-04f, -1.26243394e-03f,
+   1.81240076e-03f, -2.45371764e-03f, 3.16210627e-03f, -3.89776356e-03f,
+   4.60389070e-03f, -5.20625198e-03f, 5.61395055e-03f, -5.72113460e-03f,
+   5.41051012e-03f, -4.55746893e-03f, 3.03477910e-03f, -7.17573741e-04f,
+   -2.51308340e-03f, 6.76814234e-03f, -1.21534895e-02f, 1.87793281e-02f,
+   -2.67829839e-02f, 3.63768078e-02f, -4.79479320e-02f, 6.22845143e-02f,
+   -8.11588764e-02f, 1.09168477e-01f, -1.61865801e-01f, 3.38829488e-01f,
+   8.56744528e-01f, -1.32438138e-01f, 4.92609031e-02f, -1.63190570e-02f,
+   -1.11494935e-03f, 1.13266418e-02f, -1.73471048e-02f, 2.06014998e-02f,
+   -2.18991507e-02f, 2.17750724e-02f, -2.06259005e-02f, 1.87684223e-02f,
+   -1.64648984e-02f, 1.39340051e-02f, -1.13551887e-02f, 8.87066405e-03f,
+   -6.58681989e-03f, 4.57633380e-03f, -2.88075232e-03f, 1.51462248e-03f,
+   -4.70167171e-04f, -2.77782354e-04f, 7.66445766e-04f, -1.03997218e-03f,
+   1.14504609e-03f, -1.12705096e-03f, 1.02722144e-03f, -8.80706531e-04f,
+   7.15480302e-04f, -5.52201236e-04f, 4.04604245e-04f, -2.80395529e-04f,
+   1.82418429e-04f, -1.09950321e-04f, 5.99569685e-05f, -2.81793273e-05f,
+   1.00229836e-05f, -1.19071046e-06f, -1.91269260e-06f, 2.01666626e-06f,
+   -3.45656781e-06f, 9.18814203e-06f, -1.87106943e-05f, 3.27114649e-05f,
+   -5.11495164e-05f, 7.27948354e-05f, -9.47111330e-05f, 1.11772555e-04f,
+   -1.16303672e-04f, 9.79136530e-05f, -4.36626578e-05f, -6.13480952e-05f,
+   2.32904393e-04f, -4.86114732e-04f, 8.33320955e-04f, -1.28162617e-03f,
+   1.83013082e-03f, -2.46723322e-03f, 3.16783227e-03f, -3.89132765e-03f,
+   4.58023604e-03f, -5.15981717e-03f, 5.53892460e-03f, -5.61191561e-03f,
+   5.26210153e-03f, -4.36597783e-03f, 2.79815681e-03f, -4.36173374e-04f,
+   -2.83577852e-03f, 7.12477788e-03f, -1.25320023e-02f, 1.91618521e-02f,
+   -2.71445997e-02f, 3.66828069e-02f, -4.81492728e-02f, 6.23077676e-02f,
+   -8.08810592e-02f, 1.08341374e-01f, -1.59793615e-01f, 3.31306338e-01f,
+   8.60747993e-01f, -1.29078239e-01f, 4.69809733e-02f, -1.46205025e-02f,
+   -2.42853933e-03f, 1.23511972e-02f, -1.81394704e-02f, 2.12008823e-02f,
+   -2.23364122e-02f, 2.20764633e-02f, -2.08151285e-02f, 1.88670438e-02f,
+   -1.64926741e-02f, 1.39087969e-02f, -1.12928096e-02f, 8.78470205e-03f,
+   -6.48862356e-03f, 4.47490765e-03f, -2.78287358e-03f, 1.42511702e-03f,
+   -3.91952140e-04f, -3.43310676e-04f, 8.19050765e-04f, -1.08039007e-03f,
+   1.17460452e-03f, -1.14743528e-03f, 1.04022655e-03f, -8.88100069e-04f,
+   7.18859781e-04f, -5.52919286e-04f, 4.03742568e-04f, -2.78758933e-04f,
+   1.80560601e-04f, -1.08214641e-04f, 5.85188100e-05f, -2.70982109e-05f,
+   9.27942801e-06f, -7.27102815e-07f, -2.16945068e-06f, 2.13704220e-06f,
+   -3.45939338e-06f, 9.17926900e-06f, -1.86448360e-05f, 3.25007750e-05f,
+   -5.06500437e-05f, 7.17934890e-05f, -9.29209855e-05f, 1.08835782e-04f,
+   -1.11811954e-04f, 9.14363554e-05f, -3.48073736e-05f, -7.28478990e-05f,
+   2.47107411e-04f, -5.02744224e-04f, 8.51647288e-04f, -1.30031887e-03f,
+   1.84718776e-03f, -2.47987383e-03f, 3.17245885e-03f, -3.88357579e-03f,
+   4.55506984e-03f, -5.11170784e-03f, 5.46219060e-03f, -5.50100999e-03f,
+   5.11220191e-03f, -4.17341385e-03f, 2.56112590e-03f, -1.55224698e-04f,
+   -3.15676606e-03f, 7.47821666e-03f, -1.29054124e-02f, 1.95370428e-02f,
+   -2.74961349e-02f, 3.69755737e-02f, -4.83336933e-02f, 6.23097159e-02f,
+   -8.05766582e-02f, 1.07481256e-01f, -1.57682016e-01f, 3.23794931e-01f,
+   8.64660680e-01f, -1.25639811e-01f, 4.46717478e-02f, -1.29098380e-02f,
+   -3.74559034e-03f, 1.33744618e-02f, -1.89275276e-02f, 2.17943322e-02f,
+   -2.27668714e-02f, 2.23709252e-02f, -2.09975913e-02f, 1.89593825e-02f,
+   -1.65148638e-02f, 1.38787851e-02f, -1.12264426e-02f, 8.69557355e-03f,
+   -6.38798531e-03f, 4.37169941e-03f, -2.68385862e-03f, 1.33492064e-03f,
+   -3.13393830e-04f, -4.08859283e-04f, 8.71508091e-04f, -1.12055580e-03f,
+   1.20385026e-03f, -1.16747781e-03f, 1.05291267e-03f, -8.95213685e-04f,
+   7.22001714e-04f, -5.53449499e-04f, 4.02737613e-04f, -2.77018407e-04f,
+   1.78631846e-04f, -1.06432111e-04f, 5.70530465e-05f, -2.60001434e-05f,
+   8.52749054e-06f, -2.59936428e-07f, -2.42794226e-06f, 2.25803137e-06f,
+   -3.46078559e-06f, 9.16705176e-06f, -1.85728513e-05f, 3.22800988e-05f,
+   -5.01357972e-05f, 7.07731233e-05f, -9.11088064e-05f, 1.05877174e-04f,
+   -1.07300133e-04f, 8.49525750e-05f, -2.59779208e-05f, -8.42796217e-05f,
+   2.61179754e-04f, -5.19150111e-04f, 8.69615935e-04f, -1.31850864e-03f,
+   1.86356658e-03f, -2.49162479e-03f, 3.17598716e-03f, -3.87451611e-03f,
+   4.52840514e-03f, -5.06198872e-03f, 5.38378302e-03f, -5.38851321e-03f,
+   4.96084010e-03f, -3.97978118e-03f, 2.32361583e-03f, 1.25268343e-04f,
+   -3.47614801e-03f, 7.82845914e-03f, -1.32736648e-02f, 1.99048445e-02f,
+   -2.78375763e-02f, 3.72550450e-02f, -4.85011525e-02f, 6.22904189e-02f,
+   -8.02459121e-02f, 1.06588632e-01f, -1.55532062e-01f, 3.16296309e-01f,
+   8.68481815e-01f, -1.22123122e-01f, 4.23340052e-02f, -1.11878663e-02f,
+   -5.06577594e-03f, 1.43960835e-02f, -1.97111946e-02f, 2.23817751e-02f,
+   -2.31905747e-02f, 2.26583928e-02f, -2.11732704e-02f, 1.90454479e-02f,
+   -1.65314507e-02f, 1.38439685e-02f, -1.11560915e-02f, 8.60328972e-03f,
+   -6.28498476e-03f, 4.26684180e-03f, -2.58370675e-03f, 1.24406244e-03f,
+   -2.34595223e-04f, -4.74405882e-04f, 9.23798711e-04f, -1.16041733e-03f,
+   1.23274443e-03f, -1.18717563e-03f, 1.06527505e-03f, -9.02037486e-04f,
+   7.24904763e-04f, -5.53790305e-04f, 4.01590398e-04f, -2.75176542e-04f,
+   1.76633359e-04f, -1.04604900e-04f, 5.55599581e-05f, -2.48875549e-05f,
+   7.76889283e-06f, 2.10647855e-07f, -2.68759050e-06f, 2.37936956e-06f,
+   -3.46072602e-06f, 9.15157489e-06f, -1.84947294e-05f, 3.20494000e-05f,
+   -4.96066787e-05f, 6.97332725e-05f, -8.92725948e-05f, 1.02892278e-04f,
+   -1.02769794e-04f, 7.84645090e-05f, -1.71686461e-05f, -9.56507065e-05f,
+   2.75116879e-04f, -5.35327184e-04f, 8.87246104e-04f, -1.33620738e-03f,
+   1.87926274e-03f, -2.50249798e-03f, 3.17842304e-03f, -3.86415352e-03f,
+   4.50025406e-03f, -5.01061976e-03f, 5.30365529e-03f, -5.27435727e-03f,
+   4.80811950e-03f, -3.78524372e-03f, 2.08582333e-03f, 4.05074563e-04f,
+   -3.79366218e-03f, 8.17527715e-03f, -1.36366449e-02f, 2.02650297e-02f,
+   -2.81687472e-02f, 3.75211500e-02f, -4.86516431e-02f, 6.22499436e-02f,
+   -7.98889995e-02f, 1.05663873e-01f, -1.53344572e-01f, 3.08812112e-01f,
+   8.72210562e-01f, -1.18528180e-01f, 3.99680510e-02f, -9.45490785e-03f,
+   -6.38844538e-03f, 1.54154617e-02f, -2.04899367e-02f, 2.29628123e-02f,
+   -2.36071907e-02f, 2.29386613e-02f, -2.13420093e-02f, 1.91251580e-02f,
+   -1.65424142e-02f, 1.38043482e-02f, -1.10817952e-02f, 8.50787293e-03f,
+   -6.17958512e-03f, 4.16023098e-03f, -2.48245150e-03f, 1.15257257e-03f,
+   -1.55480346e-04f, -5.39991655e-04f, 9.75904521e-04f, -1.19999866e-03f,
+   1.26131251e-03f, -1.20652316e-03f, 1.07730867e-03f, -9.08574322e-04f,
+   7.27569335e-04f, -5.53941354e-04f, 4.00300109e-04f, -2.73230748e-04f,
+   1.74564411e-04f, -1.02732367e-04f, 5.40389519e-05f, -2.37601544e-05f,
+   7.00184364e-06f, 6.84808981e-07f, -2.94848314e-06f, 2.50130506e-06f,
+   -3.45927742e-06f, 9.13285021e-06f, -1.84106193e-05f, 3.18090206e-05f,
+   -4.90635721e-05f, 6.86747298e-05f, -8.74148318e-05f, 9.98877877e-05f,
+   -9.82227211e-05f, 7.19722957e-05f, -8.38255892e-06f, -1.06946354e-04f,
+   2.88914220e-04f, -5.51276549e-04f, 9.04513930e-04f, -1.35339249e-03f,
+   1.89427985e-03f, -2.51248968e-03f, 3.17976507e-03f, -3.85249290e-03f,
+   4.47062030e-03f, -4.95766848e-03f, 5.22191264e-03f, -5.15864091e-03f,
+   4.65404661e-03f, -3.58974352e-03f, 1.84775307e-03f, 6.84281287e-04f,
+   -4.10930812e-03f, 8.51861760e-03f, -1.39942970e-02f, 2.06175484e-02f,
+   -2.84895580e-02f, 3.77738141e-02f, -4.87851389e-02f, 6.21883720e-02f,
+   -7.95061588e-02f, 1.04707509e-01f, -1.51120573e-01f, 3.01343352e-01f,
+   8.75846326e-01f, -1.14855438e-01f, 3.75748873e-02f, -7.71163916e-03f,
+   -7.71326711e-03f, 1.64324939e-02f, -2.12636683e-02f, 2.35373676e-02f,
+   -2.40166653e-02f, 2.32117083e-02f, -2.15038434e-02f, 1.91984996e-02f,
+   -1.65477470e-02f, 1.37599204e-02f, -1.10035595e-02f, 8.40933528e-03f,
+   -6.07185112e-03f, 4.05200431e-03f, -2.38012359e-03f, 1.06045057e-03f,
+   -7.61526244e-05f, -6.05530280e-04f, 1.02780759e-03f, -1.23928406e-03f,
+   1.28951739e-03f, -1.22551166e-03f, 1.08901097e-03f, -9.14821227e-04f,
+   7.29991123e-04f, -5.53902122e-04f, 3.98866017e-04f, -2.71183235e-04f,
+   1.72427535e-04f, -1.00815909e-04f, 5.24935640e-05f, -2.26181382e-05f,
+   6.22808648e-06f, 1.16147464e-06f, -3.21050993e-06f, 2.62357185e-06f,
+   -3.45644980e-06f, 9.11090501e-06f, -1.83205484e-05f, 3.15589568e-05f,
+   -4.85067321e-05f, 6.75978881e-05f, -8.55362232e-05f, 9.68620880e-05f,
+   -9.36589931e-05f, 6.54823889e-05f, 3.71712247e-07f, -1.18170232e-04f,
+   3.02572385e-04f, -5.66981907e-04f, 9.21421044e-04f, -1.37007236e-03f,
+   1.90860173e-03f, -2.52159289e-03f, 3.18001513e-03f, -3.83953983e-03f,
+   4.43953555e-03f, -4.90314048e-03f, 5.13853785e-03f, -5.04140556e-03f,
+   4.49872576e-03f, -3.39341187e-03f, 1.60956371e-03f, 9.62703722e-04f,
+   -4.42292914e-03f, 8.85842647e-03f, -1.43464496e-02f, 2.09623575e-02f,
+   -2.87999753e-02f, 3.80130224e-02f, -4.89016697e-02f, 6.21057823e-02f,
+   -7.90975988e-02f, 1.03719942e-01f, -1.48860976e-01f, 2.93891639e-01f,
+   8.79388213e-01f, -1.11105092e-01f, 3.51549461e-02f, -5.95853059e-03f,
+   -9.03980061e-03f, 1.74466632e-02f, -2.20319852e-02f, 2.41051875e-02f,
+   -2.44188402e-02f, 2.34773401e-02f, -2.16586497e-02f, 1.92654226e-02f,
+   -1.65474284e-02f, 1.37106972e-02f, -1.09213889e-02f, 8.30771867e-03f,
+   -5.96183352e-03f, 3.94215900e-03f, -2.27672188e-03f, 9.67786880e-04f,
+   3.38697282e-06f, -6.71041838e-04f, 1.07950519e-03f, -1.27823546e-03f,
+   1.31735706e-03f, -1.24413858e-03f, 1.10037113e-03f, -9.20770864e-04f,
+   7.32170243e-04f, -5.53671329e-04f, 3.97289172e-04f, -2.69033917e-04f,
+   1.70220956e-04f, -9.88563552e-05f, 5.09210258e-05f, -2.14618594e-05f,
+   5.44787144e-06f, 1.64141511e-06f, -3.47360015e-06f, 2.74613035e-06f,
+   -3.45222566e-06f, 9.08580114e-06f, -1.82245567e-05f, 3.12993216e-05f,
+   -4.79355476e-05f, 6.65023763e-05f, -8.36357940e-05f, 9.38134544e-05f,
+   -8.90831798e-05f, 5.89949996e-05f, 9.09693154e-06f, -1.29311447e-04f,
+   3.16077640e-04f, -5.82444482e-04f, 9.37968842e-04f, -1.38622953e-03f,
+   1.92223256e-03f, -2.52981228e-03f, 3.17917764e-03f, -3.82530899e-03f,
+   4.40700399e-03f, -4.84704180e-03f, 5.05361333e-03f, -4.92269453e-03f,
+   4.34218859e-03f, -3.19634913e-03f, 1.37129915e-03f, 1.24020327e-03f,
+   -4.73432150e-03f, 9.19448119e-03f, -1.46929389e-02f, 2.12992392e-02f,
+   -2.90998630e-02f, 3.82386856e-02f, -4.90012281e-02f, 6.20022677e-02f,
+   -7.86635056e-02f, 1.02701671e-01f, -1.46566838e-01f, 2.86458164e-01f,
+   8.82835448e-01f, -1.07277341e-01f, 3.27087604e-02f, -4.19605756e-03f,
+   -1.03676571e-02f, 1.84577815e-02f, -2.27947403e-02f, 2.46660151e-02f,
+   -2.48134341e-02f, 2.37354934e-02f, -2.18063388e-02f, 1.93258710e-02f,
+   -1.65414512e-02f, 1.36567056e-02f, -1.08353319e-02f, 8.20307061e-03f,
+   -5.84952720e-03f, 3.83069320e-03f, -2.17234786e-03f, 8.74582038e-04f,
+   8.31375146e-05f, -7.36461021e-04f, 1.13094691e-03f, -1.31686276e-03f,
+   1.34482852e-03f, -1.26238633e-03f, 1.11138658e-03f, -9.26424284e-04f,
+   7.34103960e-04f, -5.53248799e-04f, 3.95569456e-04f, -2.66781863e-04f,
+   1.67945196e-04f, -9.68521344e-05f, 4.93217594e-05f, -2.02917308e-05f,
+   4.65988251e-06f, 2.12448185e-06f, -3.73767102e-06f, 2.86915110e-06f,
+   -3.44667023e-06f, 9.05757042e-06f, -1.81228370e-05f, 3.10304604e-05f,
+   -4.73512373e-05f, 6.53908064e-05f, -8.17161126e-05f, 9.07487483e-05f,
+   -8.44970564e-05f, 5.25123178e-05f, 1.77817165e-05f, -1.40366436e-04f,
+   3.29430768e-04f, -5.97660197e-04f, 9.54135263e-04f, -1.40186178e-03f,
+   1.93516898e-03f, -2.53713923e-03f, 3.17725586e-03f, -3.80980433e-03f,
+   4.37304284e-03f, -4.78944834e-03f, 4.96717449e-03f, -4.80260979e-03f,
+   4.18446539e-03f, -2.99859303e-03f, 1.13300164e-03f, 1.51677697e-03f,
+   -5.04358532e-03f, 9.52678733e-03f, -1.50337154e-02f, 2.16282066e-02f,
+   -2.93892194e-02f, 3.84508185e-02f, -4.90838140e-02f, 6.18779212e-02f,
+   -7.82041997e-02f, 1.01653218e-01f, -1.44239128e-01f, 2.79044151e-01f,
+   8.86187553e-01f, -1.03372723e-01f, 3.02371755e-02f, -2.42491462e-03f,
+   -1.16963917e-02f, 1.94654148e-02f, -2.35516578e-02f, 2.52197813e-02f,
+   -2.52004880e-02f, 2.39861067e-02f, -2.19468903e-02f, 1.93798486e-02f,
+   -1.65298041e-02f, 1.35979187e-02f, -1.07453810e-02f, 8.09540227e-03f,
+   -5.73502202e-03f, 3.71775241e-03f, -2.06700084e-03f, 7.80866540e-04f,
+   1.62994373e-04f, -8.01765651e-04f, 1.18213007e-03f, -1.35511451e-03f,
+   1.37189671e-03f, -1.28025224e-03f, 1.12205301e-03f, -9.31773509e-04f,
+   7.35790236e-04f, -5.52633894e-04f, 3.93706461e-04f, -2.64430331e-04f,
+   1.65603080e-04f, -9.48054876e-05f, 4.76983332e-05f, -1.91079889e-05f,
+   3.86590727e-06f, 2.60958495e-06f, -4.00260251e-06f, 2.99236581e-06f,
+   -3.43978581e-06f, 9.02621923e-06f, -1.80153311e-05f, 3.07521841e-05f,
+   -4.67537102e-05f, 6.42610103e-05f, -7.97766043e-05f, 8.76633640e-05f,
+   -7.98977053e-05f, 4.60365372e-05f, 2.64316841e-05f, -1.51342523e-04f,
+   3.42627493e-04f, -6.12623408e-04f, 9.69937886e-04f, -1.41698099e-03f,
+   1.94740726e-03f, -2.54358258e-03f, 3.17425048e-03f, -3.79303284e-03f,
+   4.33766469e-03f, -4.73030889e-03f, 4.87917056e-03f, -4.68108011e-03f,
+   4.02566325e-03f, -2.80021271e-03f, 8.94829980e-04f, 1.79219781e-03f,
+   -5.35046915e-03f, 9.85512882e-03f, -1.53686749e-02f, 2.19490565e-02f,
+   -2.96678692e-02f, 3.86493206e-02f, -4.91494536e-02f, 6.17328510e-02f,
+   -7.77198598e-02f, 1.00575000e-01f, -1.41878664e-01f, 2.71651179e-01f,
+   8.89443636e-01f, -9.93913114e-02f, 2.77406480e-02f, -6.45442517e-04f,
+   -1.30253956e-02f, 2.04692092e-02f, -2.43022833e-02f, 2.57660989e-02f,
+   -2.55796649e-02f, 2.42289957e-02f, -2.20801793e-02f, 1.94273014e-02f,
+   -1.65124908e-02f, 1.35343736e-02f, -1.06515884e-02f, 7.98474532e-03f,
+   -5.61827980e-03f, 3.60322325e-03f, -1.96071528e-03f, 6.86671759e-04f,
+   2.43008195e-04f, -8.66996183e-04f, 1.23303698e-03f, -1.39301491e-03f,
+   1.39858515e-03f, -1.29772932e-03f, 1.13236625e-03f, -9.36820346e-04f,
+   7.37229828e-04f, -5.51826553e-04f, 3.91700480e-04f, -2.61976238e-04f,
+   1.63191027e-04f, -9.27159490e-05f, 4.60501797e-05f, -1.79102281e-05f,
+   3.06568336e-06f, 3.09781240e-06f, -4.26850102e-06f, 3.11581039e-06f,
+   -3.43157990e-06f, 8.99187035e-06f, -1.79022463e-05f, 3.04652040e-05f,
+   -4.61433483e-05f, 6.31154617e-05f, -7.78195244e-05f, 8.45642426e-05f,
+   -7.52912019e-05f, 3.95678617e-05f, 3.50439404e-05f, -1.62225449e-04f,
+   3.55663564e-04f, -6.27335336e-04f, 9.85356513e-04f, -1.43156631e-03f,
+   1.95894693e-03f, -2.54914048e-03f, 3.17016640e-03f, -3.77500569e-03f,
+   4.30087326e-03f, -4.66970308e-03f, 4.78971703e-03f, -4.55820700e-03f,
+   3.86581267e-03f, -2.60124402e-03f, 6.56788121e-04f, 2.06655310e-03f,
+   -5.65497205e-03f, 1.01794554e-02f, -1.56977680e-02f, 2.22617500e-02f,
+   -2.99358144e-02f, 3.88341621e-02f, -4.91981618e-02f, 6.15671761e-02f,
+   -7.72107840e-02f, 9.94675830e-02f, -1.39486596e-01f, 2.64280230e-01f,
+   8.92603159e-01f, -9.53335315e-02f, 2.52200514e-02f, 1.14150788e-03f,
+   -1.43543305e-02f, 2.14688163e-02f, -2.50465255e-02f, 2.63049006e-02f,
+   -2.59510055e-02f, 2.44641397e-02f, -2.22062301e-02f, 1.94682106e-02f,
+   -1.64894871e-02f, 1.34660620e-02f, -1.05539663e-02f, 7.87111279e-03f,
+   -5.49939089e-03f, 3.48725426e-03f, -1.85352529e-03f, 5.91997697e-04f,
+   3.23151966e-04f, -9.32066527e-04f, 1.28364982e-03f, -1.43054849e-03f,
+   1.42485776e-03f, -1.31481141e-03f, 1.14232325e-03f, -9.41562233e-04f,
+   7.38420058e-04f, -5.50825731e-04f, 3.89551045e-04f, -2.59422493e-04f,
+   1.60714641e-04f, -9.05851484e-05f, 4.43776698e-05f, -1.67003764e-05f,
+   2.25944109e-06f, 3.58806619e-06f, -4.53475650e-06f, 3.23942459e-06f,
+   -3.42209523e-06f, 8.95449921e-06f, -1.77836519e-05f, 3.01692799e-05f,
+   -4.55203990e-05f, 6.19546263e-05f, -7.58453898e-05f, 8.14496598e-05f,
+   -7.06763385e-05f, 3.31125884e-05f, 4.36100745e-05f, -1.73015243e-04f,
+   3.68539564e-04f, -6.41782011e-04f, 1.00039167e-03f, -1.44562603e-03f,
+   1.96978846e-03f, -2.55380897e-03f, 3.16500966e-03f, -3.75572429e-03f,
+   4.26270766e-03f, -4.60763695e-03f, 4.69879294e-03f, -4.43403563e-03f,
+   3.70494486e-03f, -2.40178918e-03f, 4.19034157e-04f, 2.33966159e-03f,
+   -5.95689518e-03f, 1.04997177e-02f, -1.60208400e-02f, 2.25662496e-02f,
+   -3.01929638e-02f, 3.90053429e-02f, -4.92299758e-02f, 6.13809936e-02f,
+   -7.66772106e-02f, 9.83314365e-02f, -1.37063846e-01f, 2.56932795e-01f,
+   8.95665467e-01f, -9.11996514e-02f, 2.26758625e-02f, 2.93551409e-03f,
+   -1.56827457e-02f, 2.24638041e-02f, -2.57839989e-02f, 2.68358979e-02f,
+   -2.63142418e-02f, 2.46913712e-02f, -2.23249402e-02f, 1.95025392e-02f,
+   -1.64607987e-02f, 1.33930091e-02f, -1.04525220e-02f, 7.75455497e-03f,
+   -5.37835248e-03f, 3.36984452e-03f, -1.74543005e-03f, 4.96937719e-04f,
+   4.03346407e-04f, -9.96996299e-04f, 1.33396580e-03f, -1.46767730e-03f,
+   1.45071372e-03f, -1.33149477e-03f, 1.15191517e-03f, -9.45993932e-04f,
+   7.39359413e-04f, -5.49631019e-04f, 3.87259672e-04f, -2.56769010e-04f,
+   1.58171097e-04f, -8.84137626e-05f, 4.26813131e-05f, -1.54788304e-05f,
+   1.44744672e-06f, 4.08049755e-06f, -4.80176504e-06f, 3.36316680e-06f,
+   -3.41134091e-06f, 8.91413401e-06f, -1.76595040e-05f, 2.98644118e-05f,
+   -4.48851060e-05f, 6.07769543e-05f, -7.38531526e-05f, 7.83177966e-05f,
+   -6.60575388e-05f, 2.66708794e-05f, 5.21328329e-05f, -1.83712109e-04f,
+   3.81243037e-04f, -6.55963668e-04f, 1.01504533e-03f, -1.45914534e-03f,
+   1.97992194e-03f, -2.55759479e-03f, 3.15878051e-03f, -3.73521121e-03f,
+   4.22317348e-03f, -4.54411563e-03f, 4.60648816e-03f, -4.30863071e-03f,
+   3.54316947e-03f, -2.20194925e-03f, 1.81610274e-04f, 2.61138822e-03f,
+   -6.25619106e-03f, 1.08157108e-02f, -1.63376890e-02f, 2.28623655e-02f,
+   -3.04392315e-02f, 3.91628072e-02f, -4.92449179e-02f, 6.11744523e-02f,
+   -7.61193782e-02f, 9.71670151e-02f, -1.34611383e-01f, 2.49610111e-01f,
+   8.98629844e-01f, -8.69902149e-02f, 2.01088730e-02f, 4.73607797e-03f,
+   -1.70101915e-02f, 2.34539807e-02f, -2.65145544e-02f, 2.73589771e-02f,
+   -2.66692359e-02f, 2.49106288e-02f, -2.24362370e-02f, 1.95302665e-02f,
+   -1.64264292e-02f, 1.33152585e-02f, -1.03473142e-02f, 7.63514545e-03f,
+   -5.25522185e-03f, 3.25099146e-03f, -1.63653598e-03f, 4.01492522e-04f,
+   4.83616226e-04f, -1.06172101e-03f, 1.38393475e-03f, -1.50440051e-03f,
+   1.47614942e-03f, -1.34776416e-03f, 1.16113981e-03f, -9.50114452e-04f,
+   7.40047486e-04f, -5.48242824e-04f, 3.84826242e-04f, -2.54015089e-04f,
+   1.55561022e-04f, -8.62003290e-05f, 4.09616187e-05f, -1.42434992e-05f,
+   6.29419901e-07f, 4.57494934e-06f, -5.06946071e-06f, 3.48699564e-06f,
+   -3.39933968e-06f, 8.87089845e-06f, -1.75300447e-05f, 2.95512218e-05f,
+   -4.42378587e-05f, 5.95850433e-05f, -7.18456795e-05f, 7.51757107e-05f,
+   -6.14365490e-05f, 2.02448846e-05f, 6.06011490e-05f, -1.94302309e-04f,
+   3.93774419e-04f, -6.69876870e-04f, 1.02929783e-03f, -1.47212285e-03f,
+   1.98935228e-03f, -2.56049167e-03f, 3.15149035e-03f, -3.71346995e-03f,
+   4.18228749e-03f, -4.47922293e-03f, 4.51283995e-03f, -4.18204023e-03f,
+   3.38049093e-03f, -2.00176076e-03f, -5.54416583e-05f, 2.88173161e-03f,
+   -6.55281125e-03f, 1.11274365e-02f, -1.66484285e-02f, 2.31501143e-02f,
+   -3.06746177e-02f, 3.93065698e-02f, -4.92430329e-02f, 6.09476343e-02f,
+   -7.55376071e-02f, 9.59748924e-02f, -1.32130206e-01f, 2.42313400e-01f,
+   9.01495755e-01f, -8.27056244e-02f, 1.75198931e-02f, 6.54247822e-03f,
+   -1.83363222e-02f, 2.44389195e-02f, -2.72378642e-02f, 2.78739408e-02f,
+   -2.70159319e-02f, 2.51218583e-02f, -2.25400887e-02f, 1.95513777e-02f,
+   -1.63863692e-02f, 1.32327713e-02f, -1.02383392e-02f, 7.51284137e-03f,
+   -5.13007725e-03f, 3.13085131e-03f, -1.52684213e-03f, 3.05693946e-04f,
+   5.63855981e-04f, -1.12621731e-03f, 1.43355492e-03f, -1.54070335e-03f,
+   1.50113262e-03f, -1.36361190e-03f, 1.16999180e-03f, -9.53919254e-04f,
+   7.40482821e-04f, -5.46660682e-04f, 3.82250582e-04f, -2.51164078e-04f,
+   1.52887704e-04f, -8.39474014e-05f, 3.92190086e-05f, -1.29971950e-05f,
+   -1.92783673e-07f, 5.07124378e-06f, -5.33738830e-06f, 3.61084858e-06f,
+   -3.38610334e-06f, 8.82473705e-06f, -1.73952321e-05f, 2.92296372e-05f,
+   -4.35784677e-05f, 5.83786132e-05f, -6.98221629e-05f, 7.20196040e-05f,
+   -5.68105352e-05f, 1.38367568e-05f, 6.90206070e-05f, -2.04796204e-04f,
+   4.06129664e-04f, -6.83517312e-04f, 1.04316510e-03f, -1.48456905e-03f,
+   1.99807459e-03f, -2.56250589e-03f, 3.14313709e-03f, -3.69050982e-03f,
+   4.14006598e-03f, -4.41292394e-03f, 4.41779289e-03f, -4.05424694e-03f,
+   3.21701891e-03f, -1.80129311e-03f, -2.91964534e-04f, 3.15047079e-03f,
+   -6.84656296e-03f, 1.14346463e-02f, -1.69528089e-02f, 2.34293193e-02f,
+   -3.08989901e-02f, 3.94365713e-02f, -4.92243618e-02f, 6.07007220e-02f,
+   -7.49321356e-02f, 9.47555825e-02f, -1.29621282e-01f, 2.35043958e-01f,
+   9.04262543e-01f, -7.83461183e-02f, 1.49094258e-02f, 8.35428108e-03f,
+   -1.96604729e-02f, 2.54182685e-02f, -2.79536638e-02f, 2.83804704e-02f,
+   -2.73540560e-02f, 2.53249016e-02f, -2.26364452e-02f, 1.95658393e-02f,
+   -1.63406413e-02f, 1.31456088e-02f, -1.01256622e-02f, 7.38773867e-03f,
+   -5.00287581e-03f, 3.00930394e-03f, -1.41638576e-03f, 2.09574282e-04f,
+   6.44116022e-04f, -1.19052595e-03f, 1.48280896e-03f, -1.57657277e-03f,
+   1.52568449e-03f, -1.37904566e-03f, 1.17846928e-03f, -9.57409153e-04f,
+   7.40663963e-04f, -5.44884766e-04f, 3.79533274e-04f, -2.48213037e-04f,
+   1.50147156e-04f, -8.16542088e-05f, 3.74528718e-05f, -1.17394966e-05f,
+   -1.02103854e-06f, 5.56953864e-06f, -5.60563467e-06f, 3.73476519e-06f,
+   -3.37167216e-06f, 8.77578168e-06f, -1.72553464e-05f, 2.88998981e-05f,
+   -4.29081592e-05f, 5.71582787e-05f, -6.77849093e-05f, 6.88536529e-05f,
+   -5.21854708e-05f, 7.44866838e-06f, 7.73883876e-05f, -2.15180189e-04f,
+   4.18305543e-04f, -6.96885516e-04f, 1.05662947e-03f, -1.49646634e-03f,
+   2.00608955e-03f, -2.56364024e-03f, 3.13372980e-03f, -3.66634387e-03f,
+   4.09651315e-03f, -4.34524426e-03f, 4.32147225e-03f, -3.92533746e-03f,
+   3.05278483e-03f, -1.60058297e-03f, -5.27955301e-04f, 3.41769145e-03f,
+   -7.13744573e-03f, 1.17374454e-02f, -1.72508396e-02f, 2.36999504e-02f,
+   -3.11123505e-02f, 3.95528302e-02f, -4.91889566e-02f, 6.04338646e-02f,
+   -7.43032694e-02f, 9.35096666e-02f, -1.27085626e-01f, 2.27803022e-01f,
+   9.06929791e-01f, -7.39121288e-02f, 1.22784050e-02f, 1.01707550e-02f,
+   -2.09823474e-02f, 2.63916031e-02f, -2.86616944e-02f, 2.88784988e-02f,
+   -2.76836380e-02f, 2.55197100e-02f, -2.27252692e-02f, 1.95736438e-02f,
+   -1.62892193e-02f, 1.30537646e-02f, -1.00092962e-02f, 7.25983223e-03f,
+   -4.87371907e-03f, 2.88650766e-03f, -1.30520249e-03f, 1.13134207e-04f,
+   7.24369078e-04f, -1.25456182e-03f, 1.53167802e-03f, -1.61200669e-03f,
+   1.54977152e-03f, -1.39404589e-03f, 1.18656899e-03f, -9.60580655e-04f,
+   7.40591262e-04f, -5.42914378e-04f, 3.76673881e-04f, -2.45165487e-04f,
+   1.47345767e-04f, -7.93236613e-05f, 3.56671844e-05f, -1.04707642e-05f,
+   -1.85347051e-06f, 6.06871436e-06f, -5.87408613e-06f, 3.85852309e-06f,
+   -3.35605910e-06f, 8.72406599e-06f, -1.71103129e-05f, 2.85621427e-05f,
+   -4.22270787e-05f, 5.59244763e-05f, -6.57346463e-05f, 6.56789634e-05f,
+   -4.75601009e-05f, 1.08067513e-06f, 8.56963452e-05f, -2.25454714e-04f,
+   4.30302083e-04f, -7.09969027e-04f, 1.06969161e-03f, -1.50782196e-03f,
+   2.01339973e-03f, -2.56389217e-03f, 3.12327524e-03f, -3.64097347e-03f,
+   4.05167369e-03f, -4.27625189e-03f, 4.22385242e-03f, -3.79535905e-03f,
+   2.88782013e-03f, -1.39973173e-03f, -7.63257907e-04f, 3.68321780e-03f,
+   -7.42527284e-03f, 1.20356372e-02f, -1.75423827e-02f, 2.39619780e-02f,
+   -3.13146189e-02f, 3.96553278e-02f, -4.91368696e-02f, 6.01471700e-02f,
+   -7.36513287e-02f, 9.22376290e-02f, -1.24524221e-01f, 2.20591754e-01f,
+   9.09496844e-01f, -6.94042742e-02f, 9.62746236e-03f, 1.19914608e-02f,
+   -2.23013852e-02f, 2.73587313e-02f, -2.93616354e-02f, 2.93677561e-02f,
+   -2.80044414e-02f, 2.57062241e-02f, -2.28065010e-02f, 1.95747707e-02f,
+   -1.62321273e-02f, 1.29572889e-02f, -9.88925248e-03f, 7.12918071e-03f,
+   -4.74260421e-03f, 2.76246201e-03f, -1.19329186e-03f, 1.64688590e-05f,
+   8.04535463e-04f, -1.31832238e-03f, 1.58016069e-03f, -1.64696877e-03f,
+   1.57339312e-03f, -1.40861422e-03f, 1.19428232e-03f, -9.63431376e-04f,
+   7.40262796e-04f, -5.40749112e-04f, 3.73674819e-04f, -2.42020833e-04f,
+   1.44480378e-04f, -7.69540420e-05f, 3.38589671e-05f, -9.19139893e-06f,
+   -2.68980375e-06f, 6.56954307e-06f, -6.14265173e-06f, 3.98210295e-06f,
+   -3.33927755e-06f, 8.66955270e-06f, -1.69601899e-05f, 2.82165111e-05f,
+   -4.15343784e-05f, 5.46769406e-05f, -6.36700788e-05f, 6.24926761e-05f,
+   -4.29388965e-05f, -5.26096755e-06f, 9.39473466e-05f, -2.35619736e-04f,
+   4.42107994e-04f, -7.22768251e-04f, 1.08235318e-03f, -1.51862542e-03f,
+   2.01999722e-03f, -2.56326725e-03f, 3.11177457e-03f, -3.61442589e-03f,
+   4.00555274e-03f, -4.20592912e-03f, 4.12503257e-03f, -3.66437901e-03f,
+   2.72223586e-03f, -1.19884068e-03f, -9.97831696e-04f, 3.94692039e-03f,
+   -7.71000003e-03f, 1.23290839e-02f, -1.78272575e-02f, 2.42152419e-02f,
+   -3.15057784e-02f, 3.97440568e-02f, -4.90681678e-02f, 5.98408394e-02f,
+   -7.29765669e-02f, 9.09399614e-02f, -1.21937998e-01f, 2.13411540e-01f,
+   9.11963165e-01f, -6.48229495e-02f, 6.95723202e-03f, 1.38157308e-02f,
+   -2.36171875e-02f, 2.83192303e-02f, -3.00533455e-02f, 2.98481341e-02f,
+   -2.83163339e-02f, 2.58843061e-02f, -2.28800885e-02f, 1.95692070e-02f,
+   -1.61693785e-02f, 1.28561892e-02f, -9.76560637e-03f, 6.99586887e-03f,
+   -4.60959459e-03f, 2.63716490e-03f, -1.08076422e-03f, -8.04204901e-05f,
+   8.84639041e-04f, -1.38180610e-03f, 1.62820739e-03f, -1.68145797e-03f,
+   1.59654592e-03f, -1.42273528e-03f, 1.20160868e-03f, -9.65959451e-04f,
+   7.39678100e-04f, -5.38390712e-04f, 3.70535301e-04f, -2.38778943e-04f,
+   1.41551776e-04f, -7.45460420e-05f, 3.20287400e-05f, -7.90180366e-06f,
+   -3.53139785e-06f, 7.07185973e-06f, -6.41124143e-06f, 4.10566236e-06f,
+   -3.32136801e-06f, 8.61239005e-06f, -1.68052920e-05f, 2.78632451e-05f,
+   -4.08317028e-05f, 5.34184583e-05f, -6.15941244e-05f, 5.93019904e-05f,
+   -3.83235165e-05f, -1.15762405e-05f, 1.02130558e-04f, -2.45662231e-04f,
+   4.53723740e-04f, -7.35280395e-04f, 1.09459867e-03f, -1.52887451e-03f,
+   2.02588621e-03f, -2.56176689e-03f, 3.09924479e-03f, -3.58671672e-03f,
+   3.95816984e-03f, -4.13437234e-03f, 4.02504997e-03f, -3.53244529e-03f,
+   2.55603576e-03f, -9.97946132e-04f, -1.23163580e-03f, 4.20875568e-03f,
+   -7.99158029e-03f, 1.26177864e-02f, -1.81055684e-02f, 2.44597606e-02f,
+   -3.16857770e-02f, 3.98190357e-02f, -4.89828996e-02f, 5.95149547e-02f,
+   -7.22793415e-02f, 8.96173194e-02f, -1.19328111e-01f, 2.06263512e-01f,
+   9.14328277e-01f, -6.01686388e-02f, 4.26857732e-03f, 1.56428982e-02f,
+   -2.49294024e-02f, 2.92727556e-02f, -3.07365097e-02f, 3.03194076e-02f,
+   -2.86192466e-02f, 2.60539353e-02f, -2.29460020e-02f, 1.95569396e-02f,
+   -1.61009785e-02f, 1.27504766e-02f, -9.63835139e-03f, 6.85984781e-03f,
+   -4.47477354e-03f, 2.51078093e-03f, -9.67657077e-04f, -1.77501090e-04f,
+   9.64574981e-04f, -1.44492916e-03f, 1.67581672e-03f, -1.71545998e-03f,
+   1.61919883e-03f, -1.43640419e-03f, 1.20854331e-03f, -9.68162378e-04f,
+   7.38837349e-04f, -5.35837724e-04f, 3.67256143e-04f, -2.35443833e-04f,
+   1.38563671e-04f, -7.21018660e-05f, 3.01806285e-05f, -6.60236310e-06f,
+   -4.37634299e-06f, 7.57453927e-06f, -6.67973609e-06f, 4.22890980e-06f,
+   -3.30233797e-06f, 8.55257076e-06f, -1.66454065e-05f, 2.75022776e-05f,
+   -4.01187244e-05f, 5.21465081e-05f, -5.95061465e-05f, 5.61029301e-05f,
+   -3.37110905e-05f, -1.78630398e-05f, 1.10251465e-04f, -2.55592488e-04f,
+   4.65145655e-04f, -7.47501617e-04f, 1.10643625e-03f, -1.53857807e-03f,
+   2.03106599e-03f, -2.55939271e-03f, 3.08567961e-03f, -3.55782849e-03f,
+   3.90954269e-03f, -4.06153919e-03f, 3.92384408e-03f, -3.39954090e-03f,
+   2.38933228e-03f, -7.97116896e-04f, -1.46451627e-03f, 4.46863752e-03f,
+   -8.26983340e-03f, 1.29015194e-02f, -1.83770973e-02f, 2.46953480e-02f,
+   -3.18545736e-02f, 3.98802496e-02f, -4.88811657e-02f, 5.91697916e-02f,
+   -7.15599060e-02f, 8.82701427e-02f, -1.16695397e-01f, 1.99148893e-01f,
+   9.16591704e-01f, -5.54418489e-02f, 1.56226242e-03f, 1.74725093e-02f,
+   -2.62373630e-02f, 3.02189607e-02f, -3.14108729e-02f, 3.07813976e-02f,
+   -2.89130025e-02f, 2.62149815e-02f, -2.30042040e-02f, 1.95379630e-02f,
+   -1.60269402e-02f, 1.26402117e-02f, -9.50758811e-03f, 6.72122464e-03f,
+   -4.33809776e-03f, 2.38318555e-03f, -8.53896956e-04f, -2.74740130e-04f,
+   1.04439328e-03f, -1.50774990e-03f, 1.72297179e-03f, -1.74896244e-03f,
+   1.64137245e-03f, -1.44962699e-03f, 1.21508318e-03f, -9.70039866e-04f,
+   7.37738039e-04f, -5.33091603e-04f, 3.63838160e-04f, -2.32012841e-04f,
+   1.35511800e-04f, -6.96206480e-05f, 2.83103600e-05f, -5.29263571e-06f,
+   -5.22491155e-06f, 8.07867855e-06f, -6.94821028e-06f, 4.35191032e-06f,
+   -3.28222086e-06f, 8.49017488e-06f, -1.64809298e-05f, 2.71343924e-05f,
+   -3.93959745e-05f, 5.08639132e-05f, -5.74083060e-05f, 5.28998571e-05f,
+   -2.91075921e-05f, -2.41193047e-05f, 1.18307580e-04f, -2.65397306e-04f,
+   4.76370973e-04f, -7.59432442e-04f, 1.11786381e-03f, -1.54772424e-03f,
+   2.03553564e-03f, -2.55614961e-03f, 3.07109510e-03f, -3.52780125e-03f,
+   3.85967642e-03f, -3.98745714e-03f, 3.82154970e-03f, -3.26575548e-03f,
+   2.22215638e-03f, -5.96388709e-04f, -1.69643294e-03f, 4.72652353e-03f,
+   -8.54476169e-03f, 1.31803807e-02f, -1.86418500e-02f, 2.49220990e-02f,
+   -3.20121385e-02f, 3.99277247e-02f, -4.87630144e-02f, 5.88054433e-02f,
+   -7.08186477e-02f, 8.68990496e-02f, -1.14040837e-01f, 1.92068875e-01f,
+   9.18753028e-01f, -5.06431088e-02f, -1.16082653e-03f, 1.93038154e-02f,
+   -2.75407191e-02f, 3.11574321e-02f, -3.20761353e-02f, 3.12339254e-02f,
+   -2.91975569e-02f, 2.63674017e-02f, -2.30546668e-02f, 1.95122659e-02f,
+   -1.59472600e-02f, 1.25253852e-02f, -9.37326625e-03f, 6.57999748e-03f,
+   -4.19967668e-03f, 2.25454452e-03f, -7.39632640e-04f, -3.72136128e-04f,
+   1.12406514e-03f, -1.57018634e-03f, 1.76965387e-03f, -1.78196328e-03f,
+   1.66303653e-03f, -1.46238506e-03f, 1.22122548e-03f, -9.71589063e-04f,
+   7.36381975e-04f, -5.30152000e-04f, 3.60280217e-04f, -2.28486853e-04f,
+   1.32402958e-04f, -6.71055313e-05f, 2.64221180e-05f, -3.97474196e-06f,
+   -6.07681159e-06f, 8.58311796e-06f, -7.21607375e-06f, 4.47456932e-06f,
+   -3.26103873e-06f, 8.42523605e-06f, -1.63118766e-05f, 2.67591968e-05f,
+   -3.86637184e-05f, 4.95711574e-05f, -5.53013415e-05f, 4.96937428e-05f,
+   -2.45116680e-05f, -3.03450433e-05f, 1.26290877e-04f, -2.75077327e-04f,
+   4.87399695e-04f, -7.71061634e-04f, 1.12887088e-03f, -1.55631721e-03f,
+   2.03929888e-03f, -2.55203946e-03f, 3.05549614e-03f, -3.49663175e-03f,
+   3.80862039e-03f, -3.91220162e-03f, 3.71817150e-03f, -3.13113653e-03f,
+   2.05453904e-03f, -3.95862444e-04f, -1.92734657e-03f, 4.98228706e-03f,
+   -8.81618634e-03f, 1.34541895e-02f, -1.88996643e-02f, 2.51398720e-02f,
+   -3.21584307e-02f, 3.99614684e-02f, -4.86285500e-02f, 5.84221110e-02f,
+   -7.00558573e-02f, 8.55046511e-02f, -1.11365549e-01f, 1.85024559e-01f,
+   9.20811713e-01f, -4.57729660e-02f, -3.90001480e-03f, 2.11362839e-02f,
+   -2.88390163e-02f, 3.20879780e-02f, -3.27321477e-02f, 3.16767767e-02f,
+   -2.94727180e-02f, 2.65111458e-02f, -2.30973475e-02f, 1.94798503e-02f,
+   -1.58619694e-02f, 1.24060679e-02f, -9.23546962e-03f, 6.43623201e-03f,
+   -4.05950705e-03f, 2.12485809e-03f, -6.24827459e-04f, -4.69592895e-04f,
+   1.20351266e-03f, -1.63223513e-03f, 1.81586156e-03f, -1.81442883e-03f,
+   1.68418814e-03f, -1.47468108e-03f, 1.22696708e-03f, -9.72809095e-04f,
+   7.34767818e-04f, -5.27017633e-04f, 3.56586184e-04f, -2.24868971e-04f,
+   1.29234046e-04f, -6.45547334e-05f, 2.45152496e-05f, -2.64911637e-06f,
+   -6.93176389e-06f, 9.08802849e-06f, -7.48370167e-06f, 4.59684179e-06f,
+   -3.23880408e-06f, 8.35778883e-06f, -1.61381049e-05f, 2.63768270e-05f,
+   -3.79221128e-05f, 4.82664182e-05f, -5.31840597e-05f, 4.64816512e-05f,
+   -1.99278402e-05f, -3.65341184e-05f, 1.34201691e-04f, -2.84632581e-04f,
+   4.98221314e-04f, -7.82390765e-04f, 1.13946188e-03f, -1.56434998e-03f,
+   2.04235129e-03f, -2.54706643e-03f, 3.03888763e-03f, -3.46434885e-03f,
+   3.75638111e-03f, -3.83575354e-03f, 3.61371390e-03f, -2.99575366e-03f,
+   1.88659248e-03f, -1.95671324e-04f, -2.15710513e-03f, 5.23580424e-03f,
+   -9.08406824e-03f, 1.37228202e-02f, -1.91505142e-02f, 2.53485851e-02f,
+   -3.22934426e-02f, 3.99815105e-02f, -4.84778434e-02f, 5.80200180e-02f,
+   -6.92718029e-02f, 8.40874165e-02f, -1.08670458e-01f, 1.78017348e-01f,
+   9.22767341e-01f, -4.08318825e-02f, -6.65462110e-03f, 2.29693837e-02f,
+   -3.01318504e-02f, 3.30101140e-02f, -3.33786160e-02f, 3.21098529e-02f,
+   -2.97383778e-02f, 2.66461000e-02f, -2.31322106e-02f, 1.94407105e-02f,
+   -1.57710984e-02f, 1.22822719e-02f, -9.09426063e-03f, 6.29001949e-03f,
+   -3.91765684e-03f, 1.99412531e-03f, -5.09594625e-04f, -5.67108858e-04f,
+   1.28275808e-03f, -1.69389462e-03f, 1.86154805e-03f, -1.84635608e-03f,
+   1.70482602e-03f, -1.48650154e-03f, 1.23230310e-03f, -9.73698101e-04f,
+   7.32893765e-04f, -5.23692113e-04f, 3.52755073e-04f, -2.21157767e-04f,
+   1.26005936e-04f, -6.19690036e-05f, 2.25904205e-05f, -1.31357774e-06f,
+   -7.79003312e-06f, 9.59324643e-06f, -7.75100034e-06f, 4.71871181e-06f,
+   -3.21555694e-06f, 8.28791508e-06f, -1.59600477e-05f, 2.59881162e-05f,
+   -3.71716742e-05f, 4.69525912e-05f, -5.10592690e-05f, 4.32709567e-05f,
+   -1.53576275e-05f, -4.26866063e-05f, 1.42037461e-04f, -2.94050900e-04f,
+   5.08833560e-04f, -7.93416461e-04f, 1.14962400e-03f, -1.57182151e-03f,
+   2.04469706e-03f, -2.54123705e-03f, 3.02129006e-03f, -3.43096978e-03f,
+   3.70297977e-03f, -3.75821418e-03f, 3.50831519e-03f, -2.85965577e-03f,
+   1.71832077e-03f, 4.24683503e-06f, -2.38570664e-03f, 5.48703317e-03f,
+   -9.34836641e-03f, 1.39862355e-02f, -1.93943623e-02f, 2.55482476e-02f,
+   -3.24171521e-02f, 3.99878696e-02f, -4.83109765e-02f, 5.75992502e-02f,
+   -6.84669465e-02f, 8.26480165e-02f, -1.05956614e-01f, 1.71048120e-01f,
+   9.24619615e-01f, -3.58207412e-02f, -9.42361820e-03f, 2.48023551e-02f,
+   -3.14187668e-02f, 3.39237228e-02f, -3.40152942e-02f, 3.25329490e-02f,
+   -2.99944673e-02f, 2.67722458e-02f, -2.31592394e-02f, 1.93948392e-02f,
+   -1.56746600e-02f, 1.21540083e-02f, -8.94963462e-03f, 6.14130916e-03f,
+   -3.77421849e-03f, 1.86251779e-03f, -3.93972907e-04f, -6.64650346e-04f,
+   1.36169815e-03f, -1.75508321e-03f, 1.90670975e-03f, -1.87773351e-03f,
+   1.72492221e-03f, -1.49784202e-03f, 1.23723084e-03f, -9.74254159e-04f,
+   7.30763073e-04f, -5.20174042e-04f, 3.48787871e-04f, -2.17357927e-04f,
+   1.22722471e-04f, -5.93507575e-05f, 2.06481091e-05f, 2.88444522e-08f,
+   -8.64968388e-06f, 1.00985271e-05f, -8.01753504e-06f, 4.84008069e-06f,
+   -3.19129572e-06f, 8.21561116e-06f, -1.57775903e-05f, 2.55923933e-05f,
+   -3.64121697e-05f, 4.56292910e-05f, -4.89263621e-05f, 4.00575154e-05f,
+   -1.07981441e-05f, -4.88004989e-05f, 1.49795698e-04f, -3.03342065e-04f,
+   5.19243302e-04f, -8.04135459e-04f, 1.15936599e-03f, -1.57873868e-03f,
+   2.04633642e-03f, -2.53455108e-03f, 3.00269178e-03f, -3.39647778e-03f,
+   3.64843430e-03f, -3.67953931e-03f, 3.40187922e-03f, -2.72282446e-03f,
+   1.54986372e-03f, 2.03727031e-04f, -2.61300150e-03f, 5.73589420e-03f,
+   -9.60891135e-03f, 1.42443590e-02f, -1.96310636e-02f, 2.57387161e-02f,
+   -3.25295292e-02f, 3.99805792e-02f, -4.81280908e-02f, 5.71601428e-02f,
+   -6.76415414e-02f, 8.11869279e-02f, -1.03224851e-01f, 1.64118305e-01f,
+   9.26368058e-01f, -3.07398401e-02f, -1.22064753e-02f, 2.66348049e-02f,
+   -3.26991491e-02f, 3.48282456e-02f, -3.46419401e-02f, 3.29458937e-02f,
+   -3.02408356e-02f, 2.68894807e-02f, -2.31784042e-02f, 1.93422548e-02f,
+   -1.55726690e-02f, 1.20213553e-02f, -8.80170614e-03f, 5.99022023e-03f,
+   -3.62916780e-03f, 1.72990630e-03f, -2.77887943e-04f, -7.62184383e-04f,
+   1.44038175e-03f, -1.81585678e-03f, 1.95133244e-03f, -1.90854934e-03f,
+   1.74448697e-03f, -1.50870706e-03f, 1.24174810e-03f, -9.74477560e-04f,
+   7.28371844e-04f, -5.16464235e-04f, 3.44685715e-04f, -2.13466512e-04f,
+   1.19379343e-04f, -5.66990711e-05f, 1.86876696e-05f, 1.37858558e-06f,
+   -9.51261336e-06f, 1.06040707e-05f, -8.28337852e-06f, 4.96098392e-06f,
+   -3.16608862e-06f, 8.14100167e-06f, -1.55909529e-05f, 2.51905076e-05f,
+   -3.56452874e-05f, 4.42972560e-05f, -4.67875143e-05f, 3.68456604e-05f,
+   -6.25534858e-06f, -5.48737953e-05f, 1.57476723e-04f, -3.12493677e-04f,
+   5.29437151e-04f, -8.14549567e-04f, 1.16868468e-03f, -1.58509344e-03f,
+   2.04727007e-03f, -2.52701342e-03f, 2.98311887e-03f, -3.36091570e-03f,
+   3.59276845e-03f, -3.59975779e-03f, 3.29454546e-03f, -2.58535170e-03f,
+   1.38117000e-03f, 4.02766687e-04f, -2.83895177e-03f, 5.98234683e-03f,
+   -9.86566301e-03f, 1.44971497e-02f, -1.98606271e-02f, 2.59200744e-02f,
+   -3.26305628e-02f, 3.99596691e-02f, -4.79292497e-02f, 5.67027964e-02f,
+   -6.67959973e-02f, 7.97048435e-02f, -1.00476325e-01f, 1.57228753e-01f,
+   9.28012371e-01f, -2.55899001e-02f, -1.50020337e-02f, 2.84658223e-02f,
+   -3.39726582e-02f, 3.57233584e-02f, -3.52582671e-02f, 3.33484933e-02f,
+   -3.04774195e-02f, 2.69977674e-02f, -2.31896862e-02f, 1.92829538e-02f,
+   -1.54651348e-02f, 1.18843056e-02f, -8.65042303e-03f, 5.83674945e-03f,
+   -3.48254992e-03f, 1.59646419e-03f, -1.61491786e-04f, -8.59677501e-04f,
+   1.51877967e-03f, -1.87613629e-03f, 1.99539796e-03f, -1.93879928e-03f,
+   1.76351261e-03f, -1.51908107e-03f, 1.24585244e-03f, -9.74365801e-04f,
+   7.25722464e-04f, -5.12563682e-04f, 3.40447528e-04f, -2.09484584e-04f,
+   1.15984003e-04f, -5.40173423e-05f, 1.67135859e-05f, 2.73520209e-06f,
+   -1.03768789e-05f, 1.11087120e-05f, -8.54840255e-06f, 5.08122548e-06f,
+   -3.13992473e-06f, 8.06412845e-06f, -1.54002119e-05f, 2.47824155e-05f,
+   -3.48700232e-05f, 4.29568208e-05f, -4.46434751e-05f, 3.36364647e-05f,
+   -1.72780437e-06f, -6.09066046e-05f, 1.65072837e-04f, -3.21506348e-04f,
+   5.39419707e-04f, -8.24647781e-04f, 1.17757241e-03f, -1.59088662e-03f,
+   2.04750104e-03f, -2.51863291e-03f, 2.96257320e-03f, -3.32427979e-03f,
+   3.53598595e-03f, -3.51894973e-03f, 3.18631902e-03f, -2.44730781e-03f,
+   1.21235265e-03f, 6.01266336e-04f, -3.06351949e-03f, 6.22627046e-03f,
+   -1.01185832e-02f, 1.47444922e-02f, -2.00829152e-02f, 2.60922089e-02f,
+   -3.27202529e-02f, 3.99251841e-02f, -4.77145910e-02f, 5.62274903e-02f,
+   -6.59306347e-02f, 7.82022998e-02f, -9.77119654e-02f, 1.50380805e-01f,
+   9.29552197e-01f, -2.03714520e-02f, -1.78096313e-02f, 3.02949399e-02f,
+   -3.52388322e-02f, 3.66088673e-02f, -3.58641408e-02f, 3.37406509e-02f,
+   -3.07041109e-02f, 2.70970650e-02f, -2.31930595e-02f, 1.92169305e-02f,
+   -1.53520983e-02f, 1.17429448e-02f, -8.49587657e-03f, 5.68099506e-03f,
+   -3.33443563e-03f, 1.46219193e-03f, -4.47478851e-05f, -9.57127253e-04f,
+   1.59681553e-03f, -1.93591835e-03f, 2.03890260e-03f, -1.96845457e-03f,
+   1.78197818e-03f, -1.52896601e-03f, 1.24954130e-03f, -9.73918359e-04f,
+   7.22814759e-04f, -5.08470810e-04f, 3.36077763e-04f, -2.05415854e-04f,
+   1.12532834e-04f, -5.13037048e-05f, 1.47225774e-05f, 4.09825543e-06f,
+   -1.12421922e-05f, 1.16131914e-05f, -8.81251344e-06f, 5.20076219e-06f,
+   -3.11281997e-06f, 7.98495330e-06f, -1.52052899e-05f, 2.43682734e-05f,
+   -3.40866354e-05f, 4.16076546e-05f, -4.24929895e-05f, 3.04268615e-05f,
+   2.78004813e-06f, -6.68929497e-05f, 1.72584390e-04f, -3.30380688e-04f,
+   5.49180724e-04f, -8.34432256e-04f, 1.18603278e-03f, -1.59612077e-03f,
+   2.04703049e-03f, -2.50941142e-03f, 2.94106011e-03f, -3.28660477e-03f,
+   3.47814313e-03f, -3.43709392e-03f, 3.07720387e-03f, -2.30869791e-03f,
+   1.04349677e-03f, 7.99094967e-04f, -3.28655750e-03f, 6.46754773e-03f,
+   -1.03675118e-02f, 1.49862738e-02f, -2.02979036e-02f, 2.62550600e-02f,
+   -3.27985846e-02f, 3.98771577e-02f, -4.74841930e-02f, 5.57343587e-02f,
+   -6.50457889e-02f, 7.66798109e-02f, -9.49327573e-02f, 1.43575490e-01f,
+   9.30987179e-01f, -1.50853638e-02f, -2.06285454e-02f, 3.21216099e-02f,
+   -3.64972241e-02f, 3.74843106e-02f, -3.64592262e-02f, 3.41221765e-02f,
+   -3.09207626e-02f, 2.71872878e-02f, -2.31885146e-02f, 1.91442166e-02f,
+   -1.52336098e-02f, 1.15972860e-02f, -8.33813939e-03f, 5.52298035e-03f,
+   -3.18487291e-03f, 1.32708950e-03f, 7.22285986e-05f, -1.05443737e-03f,
+   1.67451077e-03f, -1.99519936e-03f, 2.08180444e-03f, -1.99751137e-03f,
+   1.79988821e-03f, -1.53835118e-03f, 1.25281035e-03f, -9.73134825e-04f,
+   7.19646632e-04f, -5.04190160e-04f, 3.31575749e-04f, -2.01258386e-04f,
+   1.09027096e-04f, -4.85589771e-05f, 1.27152553e-05f, 5.46730689e-06f,
+   -1.21098929e-05f, 1.21173798e-05f, -9.07561844e-06f, 5.31973092e-06f,
+   -3.08484209e-06f, 7.90363356e-06f, -1.50066726e-05f, 2.39483306e-05f,
+   -3.32964191e-05f, 4.02529076e-05f, -4.03389058e-05f, 2.72242014e-05f,
+   7.26673488e-06f, -7.28329978e-05f, 1.80009345e-04f, -3.39104881e-04f,
+   5.58718340e-04f, -8.43900198e-04f, 1.19405589e-03f, -1.60079054e-03f,
+   2.04586028e-03f, -2.49935617e-03f, 2.91860709e-03f, -3.24790902e-03f,
+   3.41924583e-03f, -3.35429888e-03f, 2.96734506e-03f, -2.16963701e-03f,
+   8.74605495e-04f, 9.96314804e-04f, -3.50806559e-03f, 6.70614140e-03f,
+   -1.06124524e-02f, 1.52224619e-02f, -2.05055699e-02f, 2.64086388e-02f,
+   -3.28655615e-02f, 3.98156457e-02f, -4.72381935e-02f, 5.52236177e-02f,
+   -6.41418844e-02f, 7.51380399e-02f, -9.21396911e-02f, 1.36813939e-01f,
+   9.32317078e-01f, -9.73231159e-03f, -2.34577581e-02f, 3.39450613e-02f,
+   -3.77474800e-02f, 3.83495651e-02f, -3.70434411e-02f, 3.44929174e-02f,
+   -3.11273281e-02f, 2.72684190e-02f, -2.31760312e-02f, 1.90648008e-02f,
+   -1.51096778e-02f, 1.14473486e-02f, -8.17723665e-03f, 5.36272954e-03f,
+   -3.03395907e-03f, 1.19133387e-03f, 1.89397935e-04f, -1.15160551e-03f,
+   1.75176293e-03f, -2.05390248e-03f, 2.12409929e-03f, -2.02595862e-03f,
+   1.81721826e-03f, -1.54723111e-03f, 1.25565834e-03f, -9.72013513e-04f,
+   7.16223032e-04f, -4.99722082e-04f, 3.26942158e-04f, -1.97017827e-04f,
+   1.05471008e-04f, -4.57857568e-05f, 1.06962061e-05f, 6.84187989e-06f,
+   -1.29780283e-05f, 1.26201112e-05f, -9.33758383e-06f, 5.43787610e-06f,
+   -3.05595950e-06f, 7.82016741e-06f, -1.48040299e-05f, 2.35224616e-05f,
+   -3.24991779e-05f, 3.88896042e-05f, -3.81805839e-05f, 2.40244099e-05f,
+   1.17351474e-05f, -7.87248500e-05f, 1.87344995e-04f, -3.47688183e-04f,
+   5.68039657e-04f, -8.53048870e-04f, 1.20164931e-03f, -1.60490139e-03f,
+   2.04399228e-03f, -2.48847157e-03f, 2.89519760e-03f, -3.20817204e-03f,
+   3.35931568e-03f, -3.27051664e-03f, 2.85664015e-03f, -2.03008368e-03f,
+   7.05818471e-04f, 1.19276380e-03f, -3.72789893e-03f, 6.94197556e-03f,
+   -1.08532477e-02f, 1.54529894e-02f, -2.07057856e-02f, 2.65528448e-02f,
+   -3.29211839e-02f, 3.97407003e-02f, -4.69767153e-02f, 5.46956174e-02f,
+   -6.32192269e-02f, 7.35775903e-02f, -8.93337578e-02f, 1.30097210e-01f,
+   9.33541536e-01f, -4.31265775e-03f, -2.62965299e-02f, 3.57648209e-02f,
+   -3.89889479e-02f, 3.92040350e-02f, -3.76163684e-02f, 3.48527208e-02f,
+   -3.13236862e-02f, 2.73403749e-02f, -2.31555998e-02f, 1.89787224e-02f,
+   -1.49803348e-02f, 1.12932250e-02f, -8.01321492e-03f, 5.20034367e-03f,
+   -2.88166967e-03f, 1.05483783e-03f, 3.06834700e-04f, -1.24859845e-03f,
+   1.82862068e-03f, -2.11208104e-03f, 2.16577202e-03f, -2.05378584e-03f,
+   1.83397683e-03f, -1.55561056e-03f, 1.25808385e-03f, -9.70554247e-04f,
+   7.12538778e-04f, -4.95062617e-04f, 3.22178879e-04f, -1.92691034e-04f,
+   1.01859710e-04f, -4.29831198e-05f, 8.66077244e-06f, 8.22243692e-06f,
+   -1.38468622e-05f, 1.31224451e-05f, -9.59849058e-06f, 5.55522411e-06f,
+   -3.02625358e-06f, 7.73463853e-06f, -1.45977911e-05f, 2.30916885e-05f,
+   -3.16953083e-05f, 3.75209020e-05f, -3.60202102e-05f, 2.08316815e-05f,
+   1.61794633e-05f, -8.45665927e-05f, 1.94591790e-04f, -3.56119650e-04f,
+   5.77131868e-04f, -8.61877052e-04f, 1.20881048e-03f, -1.60844880e-03f,
+   2.04143021e-03f, -2.47675972e-03f, 2.87086377e-03f, -3.16744414e-03f,
+   3.29837576e-03f, -3.18577769e-03f, 2.74523441e-03f, -1.89013185e-03f,
+   5.37084125e-04f, 1.38843979e-03f, -3.94602166e-03f, 7.17501249e-03f,
+   -1.10898660e-02f, 1.56778228e-02f, -2.08985675e-02f, 2.66877394e-02f,
+   -3.29654515e-02f, 3.96523774e-02f, -4.66998853e-02f, 5.41504584e-02f,
+   -6.22782186e-02f, 7.19991177e-02f, -8.65159333e-02f, 1.23426318e-01f,
+   9.34660435e-01f, 1.17256027e-03f, -2.91438233e-02f, 3.75801139e-02f,
+   -4.02213335e-02f, 4.00476046e-02f, -3.81779298e-02f, 3.52014080e-02f,
+   -3.15097757e-02f, 2.74031535e-02f, -2.31272057e-02f, 1.88859850e-02f,
+   -1.48455938e-02f, 1.11349346e-02f, -7.84609560e-03f, 5.03582228e-03f,
+   -2.72805314e-03f, 9.17646044e-04f, 4.24384838e-04f, -1.34538219e-03f,
+   1.90505525e-03f, -2.16965703e-03f, 2.20680726e-03f, -2.08098837e-03f,
+   1.85015658e-03f, -1.56347733e-03f, 1.26008352e-03f, -9.68755863e-04f,
+   7.08598061e-04f, -4.90218168e-04f, 3.17284925e-04f, -1.88278835e-04f,
+   9.82015044e-05f, -4.01545803e-05f, 6.61358263e-06f, 9.60583111e-06f,
+   -1.47160608e-05f, 1.36232620e-05f, -9.85772476e-06f, 5.67169855e-06f,
+   -2.99572662e-06f, 7.64708511e-06f, -1.43880461e-05f, 2.26553966e-05f,
+   -3.08850977e-05f, 3.61472885e-05f, -3.38585232e-05f, 1.76470785e-05f,
+   2.05996712e-05f, -9.03583641e-05f, 2.01742776e-04f, -3.64399399e-04f,
+   5.85999689e-04f, -8.70384800e-04f, 1.21553335e-03f, -1.61143614e-03f,
+   2.03817501e-03f, -2.46423436e-03f, 2.84560747e-03f, -3.12571810e-03f,
+   3.23643046e-03f, -3.10016563e-03f, 2.63313320e-03f, -1.74985256e-03f,
+   3.68514564e-04f, 1.58321415e-03f, -4.16239724e-03f, 7.40514044e-03f,
+   -1.13222720e-02f, 1.58968624e-02f, -2.10837964e-02f, 2.68132482e-02f,
+   -3.29983830e-02f, 3.95507365e-02f, -4.64078560e-02f, 5.35884649e-02f,
+   -6.13192879e-02f, 7.04031736e-02f, -8.36871341e-02f, 1.16802454e-01f,
+   9.35673475e-01f, 6.72272546e-03f, -3.19989435e-02f, 3.93904671e-02f,
+   -4.14440855e-02f, 4.08798866e-02f, -3.87278497e-02f, 3.55388969e-02f,
+   -3.16855125e-02f, 2.74566915e-02f, -2.30908487e-02f, 1.87865924e-02f,
+   -1.47055071e-02f, 1.09724952e-02f, -7.67595880e-03f, 4.86927107e-03f,
+   -2.57318444e-03f, 7.79893249e-04f, 5.42084512e-04f, -1.44195417e-03f,
+   1.98099017e-03f, -2.22662906e-03f, 2.24720035e-03f, -2.10754061e-03f,
+   1.86574063e-03f, -1.57082861e-03f, 1.26165641e-03f, -9.66618943e-04f,
+   7.04400591e-04f, -4.85185854e-04f, 3.12264805e-04f, -1.83785771e-04f,
+   9.44925705e-05f, -3.72983050e-05f, 4.55396776e-06f, 1.09942530e-05f,
+   -1.55853286e-05f, 1.41223927e-05f, -1.01156702e-05f, 5.78725439e-06f,
+   -2.96436838e-06f, 7.55754672e-06f, -1.41745759e-05f, 2.22137423e-05f,
+   -3.00688371e-05f, 3.47666355e-05f, -3.16942278e-05f, 1.44675814e-05f,
+   2.49957848e-05f, -9.60945763e-05f, 2.08798054e-04f, -3.72528390e-04f,
+   5.94633806e-04f, -8.78564431e-04f, 1.22182281e-03f, -1.61386351e-03f,
+   2.03423179e-03f, -2.45089736e-03f, 2.81943288e-03f, -3.08303675e-03f,
+   3.17354058e-03f, -3.01368651e-03f, 2.52033980e-03f, -1.60924951e-03f,
+   2.00194292e-04f, 1.77705381e-03f, -4.37688688e-03f, 7.63221178e-03f,
+   -1.15503194e-02f, 1.61100049e-02f, -2.12614629e-02f, 2.69293301e-02f,
+   -3.30199860e-02f, 3.94358374e-02f, -4.61007282e-02f, 5.30097857e-02f,
+   -6.03427328e-02f, 6.87902942e-02f, -8.08484629e-02f, 1.10226601e-01f,
+   9.36580420e-01f, 1.23371519e-02f, -3.48610133e-02f, 4.11951765e-02f,
+   -4.26568091e-02f, 4.17005047e-02f, -3.92658785e-02f, 3.58649902e-02f,
+   -3.18507552e-02f, 2.75009479e-02f, -2.30465401e-02f, 1.86805949e-02f,
+   -1.45601640e-02f, 1.08060073e-02f, -7.50288367e-03f, 4.70071565e-03f,
+   -2.41711363e-03f, 6.41535793e-04f, 6.59817539e-04f, -1.53821870e-03f,
+   2.05642381e-03f, -2.28299224e-03f, 2.28691217e-03f, -2.13343906e-03f,
+   1.88073004e-03f, -1.57766358e-03f, 1.26279960e-03f, -9.64143255e-04f,
+   6.99944852e-04f, -4.79970244e-04f, 3.07118520e-04f, -1.79209703e-04f,
+   9.07340145e-05f, -3.44151777e-05f, 2.48259380e-06f, 1.23872769e-05f,
+   -1.64543762e-05f, 1.46205475e-05f, -1.03722314e-05f, 5.90184891e-06f,
+   -2.93225776e-06f, 7.46610658e-06f, -1.39578333e-05f, 2.17677807e-05f,
+   -2.92469213e-05f, 3.33821372e-05f, -2.95301797e-05f, 1.13004126e-05f,
+   2.93621142e-05f, -1.01775324e-04f, 2.15755790e-04f, -3.80495680e-04f,
+   6.03032939e-04f, -8.86418158e-04f, 1.22766988e-03f, -1.61572942e-03f,
+   2.02960288e-03f, -2.43675732e-03f, 2.79237679e-03f, -3.03941732e-03f,
+   3.10971308e-03f, -2.92637222e-03f, 2.40700296e-03f, -1.46843959e-03f,
+   3.21258631e-05f, 1.96992606e-03f, -4.58948873e-03f, 7.85630383e-03f,
+   -1.17740110e-02f, 1.63172297e-02f, -2.14315448e-02f, 2.70359851e-02f,
+   -3.30302790e-02f, 3.93077582e-02f, -4.57786582e-02f, 5.24147078e-02f,
+   -5.93490265e-02f, 6.71612248e-02f, -7.80008808e-02f, 1.03699781e-01f,
+   9.37381148e-01f, 1.80148482e-02f, -3.77289727e-02f, 4.29935418e-02f,
+   -4.38591652e-02f, 4.25093397e-02f, -3.97919230e-02f, 3.61796245e-02f,
+   -3.20055075e-02f, 2.75359023e-02f, -2.29942463e-02f, 1.85679812e-02f,
+   -1.44095076e-02f, 1.06354691e-02f, -7.32689677e-03f, 4.53018164e-03f,
+   -2.25994317e-03f, 5.02755167e-04f, 7.77543581e-04f, -1.63417286e-03f,
+   2.13132775e-03f, -2.33867369e-03f, 2.32592691e-03f, -2.15867138e-03f,
+   1.89510628e-03f, -1.58397225e-03f, 1.26351207e-03f, -9.61327518e-04f,
+   6.95236202e-04f, -4.74572938e-04f, 3.01846914e-04f, -1.74556830e-04f,
+   8.69306677e-05f, -3.15078651e-05f, 4.00124122e-07f, 1.37826064e-05f,
+   -1.73228527e-05f, 1.51166159e-05f, -1.06268026e-05f, 6.01540250e-06f,
+   -2.89938907e-06f, 7.37273922e-06f, -1.37377810e-05f, 2.13165658e-05f,
+   -2.84191192e-05f, 3.19933679e-05f, -2.73656970e-05f, 8.14151099e-06f,
+   3.37029160e-05f, -1.07398788e-04f, 2.22613802e-04f, -3.88309971e-04f,
+   6.11203548e-04f, -8.93942604e-04f, 1.23308075e-03f, -1.61703897e-03f,
+   2.02429085e-03f, -2.42182007e-03f, 2.76442314e-03f, -2.99483538e-03f,
+   3.04496964e-03f, -2.83825211e-03f, 2.29301723e-03f, -1.32738031e-03f,
+   -1.35552167e-04f, 2.16170424e-03f, -4.80003143e-03f, 8.07723589e-03f,
+   -1.19932089e-02f, 1.65184792e-02f, -2.15939451e-02f, 2.71331985e-02f,
+   -3.30292881e-02f, 3.91665697e-02f, -4.54418026e-02f, 5.18034771e-02f,
+   -5.83384857e-02f, 6.55164421e-02f, -7.51452595e-02f, 9.72230136e-02f,
+   9.38075423e-01f, 2.37553827e-02f, -4.06021588e-02f, 4.47850823e-02f,
+   -4.50505093e-02f, 4.33058254e-02f, -4.03056107e-02f, 3.64825688e-02f,
+   -3.21496315e-02f, 2.75615063e-02f, -2.29339954e-02f, 1.84488147e-02f,
+   -1.42536517e-02f, 1.04609821e-02f, -7.14805163e-03f, 4.35777940e-03f,
+   -2.10164860e-03f, 3.63462575e-04f, 8.95336736e-04f, -1.72978360e-03f,
+   2.20567570e-03f, -2.39372370e-03f, 2.36426527e-03f, -2.18323059e-03f,
+   1.90887600e-03f, -1.58975739e-03f, 1.26379286e-03f, -9.58172197e-04f,
+   6.90269517e-04f, -4.68989398e-04f, 2.96451588e-04f, -1.69823747e-04f,
+   8.30773133e-05f, -2.85754995e-05f, -1.69344105e-06f, 1.51806862e-05f,
+   -1.81910345e-05f, 1.56110254e-05f, -1.08799259e-05f, 6.12793656e-06f,
+   -2.86580416e-06f, 7.27764291e-06f, -1.35145683e-05f, 2.08611636e-05f,
+   -2.75872826e-05f, 3.06009024e-05f, -2.52037044e-05f, 4.99500311e-06f,
+   3.80125457e-05f, -1.12963382e-04f, 2.29372250e-04f, -3.95961280e-04f,
+   6.19134225e-04f, -9.01137013e-04f, 1.23805564e-03f, -1.61778892e-03f,
+   2.01830105e-03f, -2.40608747e-03f, 2.73558497e-03f, -2.94935075e-03f,
+   2.97933491e-03f, -2.74933176e-03f, 2.17853207e-03f, -1.18616573e-03f,
+   -3.02892062e-04f, 2.35238695e-03f, -5.00858435e-03f, 8.29500984e-03f,
+   -1.22078815e-02f, 1.67137235e-02f, -2.17486508e-02f, 2.72209700e-02f,
+   -3.30170281e-02f, 3.90123613e-02f, -4.50903289e-02f, 5.11763543e-02f,
+   -5.73115833e-02f, 6.38566315e-02f, -7.22825527e-02f, 9.07973051e-02f,
+   9.38663185e-01f, 2.95577291e-02f, -4.34795022e-02f, 4.65690233e-02f,
+   -4.62305024e-02f, 4.40898500e-02f, -4.08068597e-02f, 3.67737673e-02f,
+   -3.22830863e-02f, 2.75777504e-02f, -2.28657722e-02f, 1.83231048e-02f,
+   -1.40925869e-02f, 1.02825733e-02f, -6.96637388e-03f, 4.18350799e-03f,
+   -1.94228045e-03f, 2.23704337e-04f, 1.01304229e-03f, -1.82501716e-03f,
+   2.27946509e-03f, -2.44806753e-03f, 2.40187813e-03f, -2.20711157e-03f,
+   1.92203058e-03f, -1.59501226e-03f, 1.26363954e-03f, -9.54676245e-04f,
+   6.85050618e-04f, -4.63226432e-04f, 2.90934142e-04f, -1.65011515e-04f,
+   7.91827842e-05f, -2.56217991e-05f, -3.79605785e-06f, 1.65810088e-05f,
+   -1.90574447e-05f, 1.61026837e-05f, -1.11309992e-05f, 6.23926462e-06f,
+   -2.83151962e-06f, 7.18082083e-06f, -1.32882815e-05f, 2.04014923e-05f,
+   -2.67502419e-05f, 2.92052137e-05f, -2.30428068e-05f, 1.86191915e-06f,
+   4.22910925e-05f, -1.18469114e-04f, 2.36024833e-04f, -4.03449842e-04f,
+   6.26829220e-04f, -9.08002956e-04f, 1.24258862e-03f, -1.61798345e-03f,
+   2.01163418e-03f, -2.38957675e-03f, 2.70589232e-03f, -2.90295156e-03f,
+   2.91281333e-03f, -2.65969918e-03f, 2.06355168e-03f, -1.04486756e-03f,
+   -4.69782855e-04f, 2.54184939e-03f, -5.21501200e-03f, 8.50952230e-03f,
+   -1.24180000e-02f, 1.69028770e-02f, -2.18956489e-02f, 2.72992700e-02f,
+   -3.29935364e-02f, 3.88451964e-02f, -4.47243527e-02f, 5.05336411e-02f,
+   -5.62686808e-02f, 6.21824749e-02f, -6.94138482e-02f, 8.44235793e-02f,
+   9.39144254e-01f, 3.54211926e-02f, -4.63600978e-02f, 4.83448096e-02f,
+   -4.73987050e-02f, 4.48609851e-02f, -4.12953869e-02f, 3.70530672e-02f,
+   -3.24058086e-02f, 2.75845975e-02f, -2.27896068e-02f, 1.81908607e-02f,
+   -1.39263850e-02f, 1.01002641e-02f, -6.78195059e-03f, 4.00748011e-03f,
+   -1.78191718e-03f, 8.36183244e-05f, 1.13065797e-03f, -1.91987050e-03f,
+   2.35262094e-03f, -2.50170450e-03f, 2.43877270e-03f, -2.23028986e-03f,
+   1.93455827e-03f, -1.59973348e-03f, 1.26305106e-03f, -9.50842281e-04f,
+   6.79578166e-04f, -4.57281742e-04f, 2.85293674e-04f, -1.60125041e-04f,
+   7.52444321e-05f, -2.26447992e-05f, -5.90703075e-06f, 1.79831022e-05f,
+   -1.99218539e-05f, 1.65922775e-05f, -1.13800661e-05f, 6.34934713e-06f,
+   -2.79655296e-06f, 7.08219477e-06f, -1.30588915e-05f, 1.99376464e-05f,
+   -2.59082826e-05f, 2.78067873e-05f, -2.08837373e-05f, -1.26075849e-06f,
+   4.65385456e-05f, -1.23910766e-04f, 2.42571652e-04f, -4.10776411e-04f,
+   6.34281256e-04f, -9.14532982e-04f, 1.24668295e-03f, -1.61762291e-03f,
+   2.00429792e-03f, -2.37229187e-03f, 2.67533818e-03f, -2.85568624e-03f,
+   2.84547103e-03f, -2.56935856e-03f, 1.94807909e-03f, -9.03488311e-04f,
+   -6.36141573e-04f, 2.73006107e-03f, -5.41921426e-03f, 8.72063637e-03f,
+   -1.26234321e-02f, 1.70858279e-02f, -2.20348593e-02f, 2.73680836e-02f,
+   -3.29588428e-02f, 3.86651829e-02f, -4.43440489e-02f, 4.98755053e-02f,
+   -5.52101023e-02f, 6.04944639e-02f, -6.65400401e-02f, 7.81029910e-02f,
+   9.39518511e-01f, 4.13448252e-02f, -4.92432080e-02f, 5.01118787e-02f,
+   -4.85547334e-02f, 4.56190556e-02f, -4.17710729e-02f, 3.73203233e-02f,
+   -3.25176902e-02f, 2.75820289e-02f, -2.27054954e-02f, 1.80521533e-02f,
+   -1.37551501e-02f, 9.91417095e-03f, -6.59486838e-03f, 3.82972346e-03f,
+   -1.62061176e-03f, -5.68164724e-05f, 1.24818110e-03f, -2.01424886e-03f,
+   2.42514163e-03f, -2.55462946e-03f, 2.47491105e-03f, -2.25276407e-03f,
+   1.94645813e-03f, -1.60392001e-03f, 1.26202730e-03f, -9.46668733e-04f,
+   6.73851755e-04f, -4.51160537e-04f, 2.79536005e-04f, -1.55162226e-04f,
+   7.12594629e-05f, -1.96454912e-05f, -8.02771683e-06f, 1.93865017e-05f,
+   -2.07855428e-05f, 1.70796284e-05f, -1.16270867e-05f, 6.45829050e-06f,
+   -2.76094488e-06f, 6.98200802e-06f, -1.28268957e-05f, 1.94699460e-05f,
+   -2.50627818e-05f, 2.64061819e-05f, -1.87286987e-05f, -4.36592563e-06f,
+   5.07494224e-05f, -1.29288455e-04f, 2.49011151e-04f, -4.17931820e-04f,
+   6.41488587e-04f, -9.20729479e-04f, 1.25033781e-03f, -1.61670917e-03f,
+   1.99629925e-03f, -2.35424004e-03f, 2.64396425e-03f, -2.80757295e-03f,
+   2.77731242e-03f, -2.47834297e-03f, 1.83226645e-03f, -7.62145675e-04f,
+   -8.01939401e-04f, 2.91698962e-03f, -5.62119158e-03f, 8.92842747e-03f,
+   -1.28241861e-02f, 1.72626451e-02f, -2.21662931e-02f, 2.74274182e-02f,
+   -3.29129770e-02f, 3.84723730e-02f, -4.39495891e-02f, 4.92022559e-02f,
+   -5.41364253e-02f, 5.87933473e-02f, -6.36621416e-02f, 7.18362480e-02f,
+   9.39785898e-01f, 4.73277792e-02f, -5.21276817e-02f, 5.18694669e-02f,
+   -4.96981554e-02f, 4.63637039e-02f, -4.22337204e-02f, 3.75754833e-02f,
+   -3.26187238e-02f, 2.75700297e-02f, -2.26134397e-02f, 1.79069787e-02f,
+   -1.35788154e-02f, 9.72428732e-03f, -6.40515704e-03f, 3.65026691e-03f,
+   -1.45849690e-03f, -1.97484173e-04f, 1.36545708e-03f, -2.10814923e-03f,
+   2.49699946e-03f, -2.60677212e-03f, 2.51028081e-03f, -2.27452326e-03f,
+   1.95771619e-03f, -1.60756533e-03f, 1.26056548e-03f, -9.42156359e-04f,
+   6.67878485e-04f, -4.44864738e-04f, 2.73660378e-04f, -1.50129476e-04f,
+   6.72370079e-05f, -1.66267200e-05f, -1.01553514e-05f, 2.07906796e-05f,
+   -2.16465069e-05f, 1.75636596e-05f, -1.18718654e-05f, 6.56586417e-06f,
+   -2.72469492e-06f, 6.88019509e-06f, -1.25918932e-05f, 1.89982420e-05f,
+   -2.42134847e-05f, 2.50029825e-05f, -1.65769579e-05f, -7.45761690e-06f,
+   5.49279684e-05f, -1.34600516e-04f, 2.55341351e-04f, -4.24920931e-04f,
+   6.48456917e-04f, -9.26590932e-04f, 1.25355273e-03f, -1.61524466e-03f,
+   1.98763283e-03f, -2.33542873e-03f, 2.61175516e-03f, -2.75858468e-03f,
+   2.70836242e-03f, -2.38668406e-03f, 1.71600515e-03f, -6.20795880e-04f,
+   -9.67120926e-04f, 3.10251326e-03f, -5.82078239e-03f, 9.13272612e-03f,
+   -1.30201029e-02f, 1.74331944e-02f, -2.22898778e-02f, 2.74772774e-02f,
+   -3.28559913e-02f, 3.82669009e-02f, -4.35411446e-02f, 4.85141687e-02f,
+   -5.30479327e-02f, 5.70796169e-02f, -6.07809350e-02f, 6.56245425e-02f,
+   9.39946413e-01f, 5.33693135e-02f, -5.50128818e-02f, 5.36171570e-02f,
+   -5.08283973e-02f, 4.70946431e-02f, -4.26830277e-02f, 3.78183499e-02f,
+   -3.27088051e-02f, 2.75485814e-02f, -2.25134827e-02f, 1.77554432e-02f,
+   -1.33975185e-02f, 9.53073241e-03f, -6.21287571e-03f, 3.46922665e-03f,
+   -1.29546784e-03f, -3.38428508e-04f, 1.48259732e-03f, -2.20153970e-03f,
+   2.56816857e-03f, -2.65818113e-03f, 2.54490017e-03f, -2.29555881e-03f,
+   1.96833652e-03f, -1.61066989e-03f, 1.25866709e-03f, -9.37306206e-04f,
+   6.61653234e-04f, -4.38389310e-04f, 2.67668569e-04f, -1.45023499e-04f,
+   6.31703006e-05f, -1.35875107e-05f, -1.22906185e-05f, 2.21960581e-05f,
+   -2.25050881e-05f, 1.80453335e-05f, -1.21144731e-05f, 6.67209997e-06f
+};
+
+static const struct StaticSincTable static_sinc_tables[1] = {
+   {147, 160, 5, 80, sinc_table_147_160_q5}
+};
@@ -56,11 +56,14 @@
 
 #define speex_resampler_init CAT_PREFIX(RANDOM_PREFIX,_resampler_init)
 #define speex_resampler_init_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_init_frac)
+#define speex_resampler_init_alloc CAT_PREFIX(RANDOM_PREFIX,_resampler_init_alloc)
 #define speex_resampler_destroy CAT_PREFIX(RANDOM_PREFIX,_resampler_destroy)
+#define speex_resampler_copy CAT_PREFIX(RANDOM_PREFIX,_resampler_copy)
 #define speex_resampler_process_float CAT_PREFIX(RANDOM_PREFIX,_resampler_process_float)
 #define speex_resampler_process_int CAT_PREFIX(RANDOM_PREFIX,_resampler_process_int)
 #define speex_resampler_process_interleaved_float CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_float)
 #define speex_resampler_process_interleaved_int CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_int)
+#define speex_resampler_process_channels_float CAT_PREFIX(RANDOM_PREFIX,_resampler_process_channels_float)
 #define speex_resampler_set_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate)
 #define speex_resampler_get_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_get_rate)
 #define speex_resampler_set_rate_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate_frac)
@@ -88,6 +91,8 @@
 
 #endif /* OUTSIDE_SPEEX */
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -112,6 +117,15 @@ enum {
 struct SpeexResamplerState_;
 typedef struct SpeexResamplerState_ SpeexResamplerState;
 
+/** Memory allocation functions for a resampler state. alloc() need not clear
+ * the memory. */
+typedef struct {
+   void *(*alloc)(void *user_data, size_t size);
+   void *(*realloc)(void *user_data, void *ptr, size_t size);
+   void (*free)(void *user_data, void *ptr);
+   void *user_data;
+} SpeexResamplerAllocator;
+
 /** Create a new resampler with integer input and output rates.
  * @param nb_channels Number of channels to be processed
  * @param in_rate Input sampling rate (integer number of Hz).
@@ -148,11 +162,32 @@ SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
                                                int quality,
                                                int *err);
 
+/** Same as speex_resampler_init_frac(), with the memory of the state (but not
+ * the filter tables, which are shared) coming from an allocator.
+ * @param allocator Allocation functions, or NULL for the standard ones
+ */
+SpeexResamplerState *speex_resampler_init_alloc(spx_uint32_t nb_channels,
+                                                spx_uint32_t ratio_num,
+                                                spx_uint32_t ratio_den,
+                                                spx_uint32_t in_rate,
+                                                spx_uint32_t out_rate,
+                                                int quality,
+                                                const SpeexResamplerAllocator *allocator,
+                                                int *err);
+
 /** Destroy a resampler state.
  * @param st Resampler state
  */
 void speex_resampler_destroy(SpeexResamplerState *st);
 
+/** Create a resampler state with the same parameters and memory as another.
+ * The filter table is shared rather than computed again.
+ * @param st Resampler state to copy
+ * @return Newly created resampler state
+ * @retval NULL Error: not enough memory
+ */
+SpeexResamplerState *speex_resampler_copy(const SpeexResamplerState *st, int *err);
+
 /** Resample a float array. The input and output buffers must *not* overlap.
  * @param st Resampler state
  * @param channel_index Index of the channel to process for the multi-channel
@@ -217,6 +252,28 @@ int speex_resampler_process_interleaved_int(SpeexResamplerState *st,
                                              spx_int16_t *out,
                                              spx_uint32_t *out_len);
 
+/** Resample channels first_channel to first_channel+nb_channels-1 of a float
+ * array, using the strides set with speex_resampler_set_input_stride() and
+ * speex_resampler_set_output_stride(). Calls on separate channels can run
+ * concurrently. Not available in fixed-point builds.
+ * @param st Resampler state
+ * @param first_channel Index of the first channel to process
+ * @param nb_channels Number of channels to process
+ * @param in Input buffer, starting with the first channel to process
+ * @param in_len Number of input samples in the input buffer. Returns the number
+ * of samples processed. This is all per-channel.
+ * @param out Output buffer, starting with the first channel to process
+ * @param out_len Size of the output buffer. Returns the number of samples written.
+ * This is all per-channel.
+ */
+int speex_resampler_process_channels_float(SpeexResamplerState *st,
+                                            spx_uint32_t first_channel,
+                                            spx_uint32_t nb_channels,
+                                            const float *in,
+                                            spx_uint32_t *in_len,
+                                            float *out,
+                                            spx_uint32_t *out_len);
+
 /** Set (change) the input/output sampling rates (integer value).
  * @param st Resampler state
  * @param in_rate Input sampling rate (integer number of Hz).
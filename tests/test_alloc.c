@@ -0,0 +1,261 @@
+/* Checks that the memory of comments and encoders created with an allocator
+   all comes from it and all goes back to it, through creating, encoding,
+   chaining, cloning and destroying, and that encoders initialized in place
+   stay in their block. With glibc, malloc() and friends are replaced as
+   well, to check that none of this reaches them, and that encoding and
+   chaining don't allocate at all once warmed up. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "test_util.h"
+
+/* Counts the calls reaching malloc() and friends while set. */
+static int armed;
+static long default_allocs;
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+/* The tests are built with hidden visibility too, which would keep these
+   from replacing the ones the library calls. */
+# define EXPORT __attribute__((visibility("default")))
+
+EXPORT void *malloc(size_t size) {
+  if (armed) default_allocs++;
+  return __libc_malloc(size);
+}
+
+EXPORT void *calloc(size_t nmemb, size_t size) {
+  if (armed) default_allocs++;
+  return __libc_calloc(nmemb, size);
+}
+
+EXPORT void *realloc(void *ptr, size_t size) {
+  if (armed) default_allocs++;
+  return __libc_realloc(ptr, size);
+}
+
+EXPORT void free(void *ptr) {
+  if (armed && ptr) default_allocs++;
+  __libc_free(ptr);
+}
+
+# define real_malloc __libc_malloc
+# define real_realloc __libc_realloc
+# define real_free __libc_free
+#else
+# define real_malloc malloc
+# define real_realloc realloc
+# define real_free free
+#endif
+
+typedef struct {
+  long allocs;
+  long frees;
+  long live;
+} AllocCount;
+
+static void *count_alloc(void *user_data, size_t size) {
+  AllocCount *c = (AllocCount *)user_data;
+  void *p = real_malloc(size);
+  if (p) {
+    c->allocs++;
+    c->live++;
+  }
+  return p;
+}
+
+static void *count_realloc(void *user_data, void *ptr, size_t size) {
+  AllocCount *c = (AllocCount *)user_data;
+  void *p = real_realloc(ptr, size);
+  if (p && ptr == NULL) {
+    c->allocs++;
+    c->live++;
+  }
+  return p;
+}
+
+static void count_free(void *user_data, void *ptr) {
+  AllocCount *c = (AllocCount *)user_data;
+  c->frees++;
+  c->live--;
+  real_free(ptr);
+}
+
+/* The output is the test's own memory. */
+static int write_unarmed(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  int was_armed = armed;
+  armed = 0;
+  test_output_append((TestOutput *)user_data, ptr, len);
+  armed = was_armed;
+  return 0;
+}
+
+static int close_nothing(void *user_data) {
+  ((TestOutput *)user_data)->nb_closes++;
+  return 0;
+}
+
+static const OpusEncCallbacks unarmed_callbacks = {write_unarmed, close_nothing};
+
+/* Writes seconds of audio at rate. */
+static void encode_seconds(OggOpusEnc *enc, long *pos, int channels, opus_int32 rate, int seconds) {
+  float pcm[960*2];
+  long end = *pos + (long)rate*seconds;
+  for (;*pos<end;*pos+=rate/50) {
+    test_signal(pcm, channels, *pos, rate/50, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, rate/50) == OPE_OK);
+  }
+}
+
+static void test_allocator(opus_int32 rate) {
+  AllocCount count = {0, 0, 0};
+  OpeAllocator allocator;
+  OggOpusComments *comments;
+  OggOpusEnc *enc;
+  OggOpusEnc *clone;
+  TestOutput out;
+  TestOutput clone_out;
+  TestOggInfo info;
+  long pos = 0;
+  long clone_pos = 0;
+  int err;
+  allocator.alloc = count_alloc;
+  allocator.realloc = count_realloc;
+  allocator.free = count_free;
+  allocator.user_data = &count;
+  test_output_init(&out);
+  test_output_init(&clone_out);
+  default_allocs = 0;
+  armed = 1;
+  comments = ope_comments_create_with_allocator(&allocator);
+  TEST_ASSERT(comments != NULL);
+  TEST_ASSERT(ope_comments_add(comments, "ARTIST", "Someone") == OPE_OK);
+  enc = ope_encoder_create_with_allocator(&unarmed_callbacks, &out, comments, rate, 2, 0, &allocator, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_BITRATE(64000)) == OPE_OK);
+  /* Cloned before it starts encoding. */
+  clone = ope_encoder_clone(enc, &unarmed_callbacks, &clone_out, &err);
+  TEST_ASSERT(clone != NULL);
+  encode_seconds(enc, &pos, 2, rate, 3);
+  encode_seconds(clone, &clone_pos, 2, rate, 2);
+  TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  TEST_ASSERT(ope_encoder_chain_current(clone, comments) == OPE_OK);
+  encode_seconds(enc, &pos, 2, rate, 2);
+  encode_seconds(clone, &clone_pos, 2, rate, 3);
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  TEST_ASSERT(ope_encoder_drain(clone) == OPE_OK);
+  ope_encoder_destroy(enc);
+  ope_encoder_destroy(clone);
+  ope_comments_destroy(comments);
+  armed = 0;
+  TEST_ASSERT(count.allocs > 0);
+  if (count.live != 0 || default_allocs != 0) {
+    test_fail("%ld allocations, %ld frees, %ld calls to malloc() and friends",
+        count.allocs, count.frees, default_allocs);
+  }
+  TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 2);
+  TEST_ASSERT(check_ogg(clone_out.data, clone_out.len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 2);
+  test_output_clear(&out);
+  test_output_clear(&clone_out);
+}
+
+static void test_in_place(opus_int32 rate) {
+  OggOpusComments *comments;
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  unsigned char *mem;
+  size_t size;
+  long pos = 0;
+  int err;
+  size = ope_encoder_get_size(rate, 2, 0, 96000);
+  TEST_ASSERT(size > 0);
+  TEST_ASSERT(ope_encoder_get_size(rate, 2, 0, -1) == 0);
+  TEST_ASSERT(ope_encoder_get_size(rate, 0, 0, 96000) == 0);
+  mem = real_malloc(size);
+  TEST_ASSERT(mem != NULL);
+  test_output_init(&out);
+  comments = ope_comments_create();
+  TEST_ASSERT(comments != NULL);
+  TEST_ASSERT(ope_comments_add(comments, "ARTIST", "Someone") == OPE_OK);
+  enc = ope_encoder_init_in_place(mem, size, NULL, &out, comments, rate, 2, 0, 96000, &err);
+  TEST_ASSERT(enc == NULL && err == OPE_BAD_ARG);
+  enc = ope_encoder_init_in_place(mem, size/4, &unarmed_callbacks, &out, comments, rate, 2, 0, 96000, &err);
+  TEST_ASSERT(enc == NULL && err == OPE_ALLOC_FAIL);
+  default_allocs = 0;
+  armed = 1;
+  enc = ope_encoder_init_in_place(mem, size, &unarmed_callbacks, &out, comments, rate, 2, 0, 96000, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_BITRATE(64000)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_ENCODE_THREADS(2)) == OPE_UNIMPLEMENTED);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DEFERRED_ENCODING(1)) == OPE_UNIMPLEMENTED);
+  TEST_ASSERT(ope_encoder_clone(enc, &unarmed_callbacks, &out, &err) == NULL);
+  TEST_ASSERT(err == OPE_UNIMPLEMENTED);
+  encode_seconds(enc, &pos, 2, rate, 3);
+  TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  encode_seconds(enc, &pos, 2, rate, 2);
+  TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  encode_seconds(enc, &pos, 2, rate, 2);
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  ope_encoder_destroy(enc);
+  armed = 0;
+  if (default_allocs != 0) test_fail("%ld calls to malloc() and friends", default_allocs);
+  TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 3);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+  real_free(mem);
+}
+
+/* Chains a stream every second: a few to warm up, then many more during
+   which nothing may reach malloc() and friends. */
+static void test_steady_state(opus_int32 rate) {
+  OggOpusComments *comments;
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  long pos = 0;
+  int err;
+  int i;
+  test_output_init(&out);
+  comments = ope_comments_create();
+  TEST_ASSERT(comments != NULL);
+  TEST_ASSERT(ope_comments_add(comments, "ARTIST", "Someone") == OPE_OK);
+  enc = ope_encoder_create_callbacks(&unarmed_callbacks, &out, comments, rate, 2, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  for (i=0;i<4;i++) {
+    encode_seconds(enc, &pos, 2, rate, 1);
+    TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  }
+  default_allocs = 0;
+  armed = 1;
+  for (i=0;i<30;i++) {
+    encode_seconds(enc, &pos, 2, rate, 1);
+    TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  }
+  armed = 0;
+  if (default_allocs != 0) test_fail("%ld calls to malloc() and friends", default_allocs);
+  encode_seconds(enc, &pos, 2, rate, 1);
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 35);
+  test_output_clear(&out);
+}
+
+int main(void) {
+  test_allocator(48000);
+  test_allocator(44100);
+  test_in_place(48000);
+  test_in_place(44100);
+  test_steady_state(48000);
+  test_steady_state(44100);
+  return 0;
+}
@@ -0,0 +1,504 @@
+/* Checks the settings that change the size of the buffers: the decision delay
+   cap given when creating an encoder, a frame size change that cannot get its
+   memory, encoding 16 kHz input at 16 kHz, the size of the async ring and the
+   backlog limit of deferred encoding and encode threads. Then the ones that
+   move the input rate: OPE_SET_INPUT_RATE() mid-stream and the drift
+   controller. Last, encoders sharing a pool, and the underruns counted when
+   the writes to an async encoder stall, with a thread of its own or a pool. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#include "test_util.h"
+
+/* Fails every allocation while set. */
+static int fail_allocs;
+/* Largest allocation so far. */
+static size_t max_alloc;
+
+static void *test_alloc(void *user_data, size_t size) {
+  (void)user_data;
+  if (size > max_alloc) max_alloc = size;
+  return fail_allocs ? NULL : malloc(size);
+}
+
+static void *test_realloc(void *user_data, void *ptr, size_t size) {
+  (void)user_data;
+  if (size > max_alloc) max_alloc = size;
+  return fail_allocs ? NULL : realloc(ptr, size);
+}
+
+static void test_free(void *user_data, void *ptr) {
+  (void)user_data;
+  free(ptr);
+}
+
+static const OpeAllocator failing_allocator = {test_alloc, test_realloc, test_free, NULL};
+
+/* Encodes a second of audio at rate with enc and checks the result. */
+static void encode_and_check_rate(OggOpusEnc *enc, TestOutput *out, int channels, opus_int32 rate) {
+  float pcm[960*2];
+  TestOggInfo info;
+  long pos;
+  for (pos=0;pos<rate;pos+=rate/50) {
+    test_signal(pcm, channels, pos, rate/50, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, rate/50) == OPE_OK);
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  TEST_ASSERT(check_ogg(out->data, out->len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 1);
+  TEST_ASSERT(info.duration[0] == 48000);
+}
+
+static void encode_and_check(OggOpusEnc *enc, TestOutput *out, int channels) {
+  encode_and_check_rate(enc, out, channels, 48000);
+}
+
+static void test_max_delay(void) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  opus_int32 value;
+  int err;
+  test_output_init(&out);
+  TEST_ASSERT(ope_encoder_create_with_max_delay(&test_callbacks, &out, comments, 48000, 2, 0, -1, &err) == NULL);
+  TEST_ASSERT(err == OPE_BAD_ARG);
+  enc = ope_encoder_create_with_max_delay(&test_callbacks, &out, comments, 48000, 2, 0, 4800, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_MAX_DECISION_DELAY(&value)) == OPE_OK && value == 4800);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_DECISION_DELAY(&value)) == OPE_OK && value == 4800);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(96000)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_DECISION_DELAY(&value)) == OPE_OK && value == 4800);
+  encode_and_check(enc, &out, 2);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+static void test_frame_size_alloc_fail(void) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  int err;
+  test_output_init(&out);
+  enc = ope_encoder_create_with_allocator(&test_callbacks, &out, comments, 48000, 1, 0, &failing_allocator, &err);
+  TEST_ASSERT(enc != NULL);
+  fail_allocs = 1;
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_60_MS)) != OPE_OK);
+  fail_allocs = 0;
+  /* Still encodes 20 ms frames, which the buffer has room for. */
+  encode_and_check(enc, &out, 1);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+static void test_native_rate(int native) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  opus_int32 value;
+  int err;
+  test_output_init(&out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, 16000, 2, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_NATIVE_RATE(&value)) == OPE_OK && value == 0);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_NATIVE_RATE(2)) == OPE_BAD_ARG);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_NATIVE_RATE(native)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_NATIVE_RATE(&value)) == OPE_OK && value == native);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_BITRATE(32000)) == OPE_OK);
+  /* libopus would lose the bitrate. */
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_NATIVE_RATE(!native)) == OPE_TOO_LATE);
+  encode_and_check_rate(enc, &out, 2, 16000);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+/* Changes the input rate in the middle of a stream, and once right before
+   chaining, with the given resampler quality. Each stream must last exactly as
+   long as what was written to it, whatever the rates. */
+static void test_input_rate_change(int quality) {
+  static const opus_int32 rates[] = {48000, 44100, 16000, 96000, 48000};
+  static const long lengths[] = {12345, 20001, 7777, 30011, 5003};
+  /* A multiple of all the rates, for adding up exact durations. */
+  const long long unit = 14112000;
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  float pcm[960*2];
+  long long exact = 0;
+  long long first = 0;
+  opus_int32 value;
+  int err;
+  int i;
+  test_output_init(&out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, rates[0], 2, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_RESAMPLER_QUALITY(quality)) == OPE_OK);
+  for (i=0;i<5;i++) {
+    long pos;
+    if (i > 0) TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_INPUT_RATE(rates[i])) == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_INPUT_RATE(&value)) == OPE_OK && value == rates[i]);
+    if (i == 2) {
+      first = (exact*48000 + unit - 1)/unit;
+      TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+    }
+    for (pos=0;pos<lengths[i];pos+=960) {
+      int len = (int)(lengths[i] - pos < 960 ? lengths[i] - pos : 960);
+      test_signal(pcm, 2, pos, len, rates[i]);
+      TEST_ASSERT(ope_encoder_write_float(enc, pcm, len) == OPE_OK);
+    }
+    exact += lengths[i]*(unit/rates[i]);
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+  TEST_ASSERT(info.nb_streams == 2);
+  if (info.duration[0] != first || info.duration[0] + info.duration[1] != (exact*48000 + unit - 1)/unit) {
+    test_fail("input rate change: durations %lld and %lld, expected %lld and %lld", info.duration[0],
+        info.duration[1], first, (exact*48000 + unit - 1)/unit - first);
+  }
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+/* Feeds the drift controller a source whose clock is off by skew ppm, the
+   caller writing what the corrected rate says is due every 10 ms. Over the
+   last third, once settled, the correction must stay on the 10 ppm steps
+   either side of the skew, switching between them at most every 10 s, and
+   the fill must stay within 1 ms of the target. */
+static void test_drift(opus_int32 rate, int skew, int seconds) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  float pcm[2048];
+  double captured = 0;
+  long written = 0;
+  double write_time = 0;
+  opus_int32 correction = 0;
+  opus_int32 last_correction = 0;
+  int min_correction = 1000000000;
+  int max_correction = -1000000000;
+  int max_error = 0;
+  int changes = 0;
+  int t;
+  int err;
+  enc = ope_encoder_create_pull(comments, rate, 1, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DRIFT_TARGET(960)) == OPE_OK);
+  for (t=1;t<=seconds*100;t++) {
+    unsigned char *page;
+    opus_int32 len;
+    long n;
+    int fill;
+    captured += rate*.01*(1 + skew*1e-6);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_RATE_CORRECTION(&correction)) == OPE_OK);
+    n = (long)((t*.01 - write_time)*rate*(1 + correction*1e-9));
+    if (n > (long)captured - written) n = (long)captured - written;
+    if (n > 0) {
+      TEST_ASSERT(n <= 2048);
+      test_signal(pcm, 1, written, n, rate);
+      TEST_ASSERT(ope_encoder_write_float(enc, pcm, n) == OPE_OK);
+      written += n;
+      write_time += n/(rate*(1 + correction*1e-9));
+    }
+    while (ope_encoder_get_page(enc, &page, &len, 0)) {}
+    fill = (int)((captured - written)*48000/rate);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DRIFT_FILL(fill)) == OPE_OK);
+    if (t > seconds*200/3) {
+      if (correction < min_correction) min_correction = correction;
+      if (correction > max_correction) max_correction = correction;
+      if (abs(fill - 960) > max_error) max_error = abs(fill - 960);
+      changes += correction != last_correction;
+    }
+    last_correction = correction;
+  }
+  /* Only the skew itself if it is a whole number of steps. */
+  if (min_correction <= skew*1000 - 10000 || max_correction >= skew*1000 + 10000) {
+    test_fail("drift of %d ppm at %d Hz: correction from %d to %d ppb", skew, (int)rate,
+        min_correction, max_correction);
+  }
+  if (changes > seconds/30) test_fail("drift of %d ppm at %d Hz: %d changes", skew, (int)rate, changes);
+  if (max_error > 48) test_fail("drift of %d ppm at %d Hz: fill off by %d", skew, (int)rate, max_error);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+}
+
+static void test_async_buffer(void) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  opus_int32 value;
+  int err;
+  test_output_init(&out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, 48000, 2, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  /* Big enough for the whole second, so that nothing gets dropped. */
+  err = ope_encoder_ctl(enc, OPE_SET_ASYNC_BUFFER(48001));
+  /* Not available when built without threads. */
+  if (err != OPE_UNIMPLEMENTED) {
+    TEST_ASSERT(err == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_ASYNC_BUFFER(&value)) == OPE_OK && value == 65536);
+  }
+  encode_and_check(enc, &out, 2);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+static void test_max_backlog(void) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  float pcm[960];
+  long pos = 0;
+  int err;
+  test_output_init(&out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, 48000, 1, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DEFERRED_ENCODING(1)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_MAX_BACKLOG(48000)) == OPE_OK);
+  /* The decision delay and a second of backlog, plus some slack. */
+  for (;;) {
+    test_signal(pcm, 1, pos, 960, 48000);
+    err = ope_encoder_write_float(enc, pcm, 960);
+    if (err == OPE_BUFFER_FULL) break;
+    TEST_ASSERT(err == OPE_OK);
+    pos += 960;
+    TEST_ASSERT(pos < 96000 + 48000 + 12000);
+  }
+  TEST_ASSERT(pos >= 96000 + 48000 - 960);
+  /* Encoding some makes room again. */
+  TEST_ASSERT(ope_encoder_step(enc, 10) == 10);
+  TEST_ASSERT(ope_encoder_write_float(enc, pcm, 960) == OPE_OK);
+  pos += 960;
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+  TEST_ASSERT(info.duration[0] == pos);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+/* Encodes seconds of audio on 4 threads with the backlog limited to
+   max_backlog, which keeps the buffer small. */
+static void test_encode_threads_backlog(opus_int32 max_backlog, int seconds) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  float pcm[960];
+  long pos;
+  int err;
+  test_output_init(&out);
+  enc = ope_encoder_create_with_allocator(&test_callbacks, &out, comments, 48000, 1, 0, &failing_allocator, &err);
+  TEST_ASSERT(enc != NULL);
+  err = ope_encoder_ctl(enc, OPE_SET_ENCODE_THREADS(4));
+  if (err != OPE_UNIMPLEMENTED) {
+    TEST_ASSERT(err == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_MAX_BACKLOG(max_backlog)) == OPE_OK);
+    max_alloc = 0;
+    for (pos=0;pos<48000L*seconds;pos+=960) {
+      test_signal(pcm, 1, pos, 960, 48000);
+      TEST_ASSERT(ope_encoder_write_float(enc, pcm, 960) == OPE_OK);
+    }
+    TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+    /* The buffer and its mirror, with a second of slack. */
+    TEST_ASSERT(max_alloc < 2*sizeof(float)*(96000 + max_backlog + 48000));
+    TEST_ASSERT(check_ogg(out.data, out.len, &info) == 0);
+    TEST_ASSERT(info.duration[0] == 48000L*seconds);
+  }
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+#define POOL_ENCODERS 9
+
+/* Encodes 2 s of the test signal on POOL_ENCODERS encoders sharing a pool of
+   nb_threads threads, writing to each in turn, and checks that each stream is
+   what encoding synchronously gives. The rings hold all of it, so nothing is
+   dropped however late the pool gets to an encoder. Every third encoder is
+   destroyed without draining right after its last write, likely while it is
+   still queued, and the others are drained then. */
+static void test_pool(int nb_threads) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEncPool *pool;
+  OggOpusEnc *enc[POOL_ENCODERS];
+  OggOpusEnc *sync[POOL_ENCODERS];
+  TestOutput out[POOL_ENCODERS];
+  TestOutput sync_out[POOL_ENCODERS];
+  float pcm[882*2];
+  opus_int32 value;
+  long step;
+  int err;
+  int i;
+  pool = ope_pool_create(nb_threads, &err);
+  /* Not available when built without threads. */
+  if (pool == NULL) {
+    TEST_ASSERT(err == OPE_UNIMPLEMENTED);
+    ope_comments_destroy(comments);
+    return;
+  }
+  for (i=0;i<POOL_ENCODERS;i++) {
+    opus_int32 rate = i%2 ? 44100 : 48000;
+    int channels = 1 + i%2;
+    test_output_init(&out[i]);
+    test_output_init(&sync_out[i]);
+    enc[i] = ope_encoder_create_callbacks(&test_callbacks, &out[i], comments, rate, channels, 0, &err);
+    sync[i] = ope_encoder_create_callbacks(&test_callbacks, &sync_out[i], comments, rate, channels, 0, &err);
+    TEST_ASSERT(enc[i] != NULL && sync[i] != NULL);
+    TEST_ASSERT(ope_encoder_ctl(enc[i], OPE_SET_SERIALNO(1000 + i)) == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(sync[i], OPE_SET_SERIALNO(1000 + i)) == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(enc[i], OPE_SET_ENCODER_POOL(pool)) == OPE_OK);
+    TEST_ASSERT(ope_encoder_ctl(enc[i], OPE_SET_ASYNC_BUFFER(2*rate)) == OPE_OK);
+  }
+  for (step=0;step<100;step++) {
+    for (i=0;i<POOL_ENCODERS;i++) {
+      opus_int32 rate = i%2 ? 44100 : 48000;
+      test_signal(pcm, 1 + i%2, step*(rate/50), rate/50, rate);
+      TEST_ASSERT(ope_encoder_write_float(enc[i], pcm, rate/50) == OPE_OK);
+      TEST_ASSERT(ope_encoder_write_float(sync[i], pcm, rate/50) == OPE_OK);
+    }
+  }
+  for (i=0;i<POOL_ENCODERS;i++) {
+    TEST_ASSERT(ope_encoder_ctl(enc[i], OPE_GET_ASYNC_OVERRUNS(&value)) == OPE_OK && value == 0);
+    if (i%3 == 2) {
+      ope_encoder_destroy(enc[i]);
+      enc[i] = NULL;
+    } else {
+      TEST_ASSERT(ope_encoder_drain(enc[i]) == OPE_OK);
+    }
+  }
+  for (i=0;i<POOL_ENCODERS;i++) {
+    TestOggInfo info;
+    TEST_ASSERT(ope_encoder_drain(sync[i]) == OPE_OK);
+    if (enc[i] != NULL) {
+      TEST_ASSERT(check_ogg(out[i].data, out[i].len, &info) == 0);
+      if (out[i].len != sync_out[i].len || memcmp(out[i].data, sync_out[i].data, out[i].len) != 0) {
+        test_fail("pool of %d threads, encoder %d: different output", nb_threads, i);
+      }
+      ope_encoder_destroy(enc[i]);
+    }
+    ope_encoder_destroy(sync[i]);
+    test_output_clear(&out[i]);
+    test_output_clear(&sync_out[i]);
+  }
+  ope_pool_destroy(pool);
+  ope_comments_destroy(comments);
+}
+
+static void sleep_ms(int ms) {
+#ifdef _WIN32
+  Sleep(ms);
+#else
+  struct timespec ts;
+  ts.tv_sec = ms/1000;
+  ts.tv_nsec = (ms%1000)*1000000L;
+  nanosleep(&ts, NULL);
+#endif
+}
+
+/* Waits (up to 10 s) for the underruns of an async encoder to reach count. */
+static opus_int32 wait_underruns(OggOpusEnc *enc, opus_int32 count) {
+  opus_int32 value = 0;
+  int i;
+  for (i=0;i<1000;i++) {
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_ASYNC_UNDERRUNS(&value)) == OPE_OK);
+    if (value >= count) break;
+    sleep_ms(10);
+  }
+  return value;
+}
+
+/* Writes 100 ms faster than real time, then stalls for 500 ms and writes
+   40 ms, twice. Only the stalls are underruns, each counted once, even though
+   the encoder runs out of samples after every write. */
+static void test_underruns(int nb_threads) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEncPool *pool = NULL;
+  OggOpusEnc *enc;
+  TestOutput out;
+  float pcm[4800];
+  opus_int32 value;
+  int err;
+  int i;
+  if (nb_threads > 0) {
+    pool = ope_pool_create(nb_threads, &err);
+    /* Not available when built without threads. */
+    if (pool == NULL) {
+      TEST_ASSERT(err == OPE_UNIMPLEMENTED);
+      ope_comments_destroy(comments);
+      return;
+    }
+  }
+  test_output_init(&out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, 48000, 1, 0, &err);
+  TEST_ASSERT(enc != NULL);
+  /* So that the pool gets the encoder once it has a frame. */
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(0)) == OPE_OK);
+  if (pool) TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_ENCODER_POOL(pool)) == OPE_OK);
+  err = ope_encoder_ctl(enc, OPE_SET_ASYNC_BUFFER(48000));
+  if (err == OPE_UNIMPLEMENTED) {
+    ope_encoder_destroy(enc);
+  } else {
+    TEST_ASSERT(err == OPE_OK);
+    for (i=0;i<10;i++) {
+      test_signal(pcm, 1, i*480, 480, 48000);
+      TEST_ASSERT(ope_encoder_write_float(enc, pcm, 480) == OPE_OK);
+    }
+    sleep_ms(500);
+    TEST_ASSERT(wait_underruns(enc, 0) == 0);
+    test_signal(pcm, 1, 4800, 1920, 48000);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, 1920) == OPE_OK);
+    TEST_ASSERT(wait_underruns(enc, 1) == 1);
+    sleep_ms(500);
+    test_signal(pcm, 1, 6720, 1920, 48000);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, 1920) == OPE_OK);
+    TEST_ASSERT(wait_underruns(enc, 2) == 2);
+    for (i=0;i<10;i++) {
+      test_signal(pcm, 1, 8640 + i*480, 480, 48000);
+      TEST_ASSERT(ope_encoder_write_float(enc, pcm, 480) == OPE_OK);
+    }
+    sleep_ms(100);
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_GET_ASYNC_UNDERRUNS(&value)) == OPE_OK && value == 2);
+    TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+    ope_encoder_destroy(enc);
+  }
+  if (pool) ope_pool_destroy(pool);
+  ope_comments_destroy(comments);
+  test_output_clear(&out);
+}
+
+int main(void) {
+  test_max_delay();
+  test_frame_size_alloc_fail();
+  test_native_rate(0);
+  test_native_rate(1);
+  /* The default, and the longest resampler delays. */
+  test_input_rate_change(5);
+  test_input_rate_change(10);
+  /* Between steps, and on one. */
+  test_drift(48000, 37, 900);
+  test_drift(16000, 83, 900);
+  test_drift(96000, -504, 900);
+  test_drift(44100, -350, 900);
+  test_async_buffer();
+  test_max_backlog();
+  /* Too small for parallel segments, then 4 segments of 2.5 s. */
+  test_encode_threads_backlog(48000, 10);
+  test_encode_threads_backlog(480000, 30);
+  test_pool(1);
+  test_pool(2);
+  test_pool(4);
+  test_underruns(0);
+  test_underruns(2);
+  return 0;
+}
@@ -0,0 +1,541 @@
+/* Encodes a test signal at various rates, channel counts, decision delays and
+   write sizes, through the callback and the pull API, chaining once in the
+   middle, and checks that the result is valid Ogg Opus of the right
+   duration. Then checks that the ways of encoding the same signal that should
+   give the same stream do: write sizes, planar writes, sample formats,
+   stream threads, resampler threads, cloning and reusing an encoder. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_util.h"
+
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
+
+static void get_pages(OggOpusEnc *enc, TestOutput *out, int flush) {
+  unsigned char *page;
+  opus_int32 len;
+  while (ope_encoder_get_page(enc, &page, &len, flush)) test_output_append(out, page, len);
+}
+
+static void encode(opus_int32 rate, int channels, int delay, int write_size, int pull) {
+  OggOpusComments *comments;
+  OggOpusEnc *enc;
+  TestOutput out;
+  TestOggInfo info;
+  float *pcm;
+  long n = rate*7/10 + 13;
+  long chain_at = n/3 + 5;
+  long pos;
+  int err;
+  test_output_init(&out);
+  comments = ope_comments_create();
+  TEST_ASSERT(comments != NULL);
+  if (pull) enc = ope_encoder_create_pull(comments, rate, channels, channels > 2, &err);
+  else enc = ope_encoder_create_callbacks(&test_callbacks, &out, comments, rate, channels, channels > 2, &err);
+  if (enc == NULL) test_fail("cannot create an encoder: %s", ope_strerror(err));
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(delay)) == OPE_OK);
+  pcm = malloc(sizeof(*pcm)*write_size*channels);
+  TEST_ASSERT(pcm != NULL);
+  for (pos=0;pos<n;) {
+    int len = MIN(write_size, n - pos);
+    if (pos < chain_at) len = MIN(len, chain_at - pos);
+    else if (pos == chain_at) TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+    test_signal(pcm, channels, pos, len, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, len) == OPE_OK);
+    if (pull) get_pages(enc, &out, 0);
+    pos += len;
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  if (pull) get_pages(enc, &out, 1);
+  ope_encoder_destroy(enc);
+  ope_comments_destroy(comments);
+  free(pcm);
+  if (check_ogg(out.data, out.len, &info) != 0) {
+    test_fail("rate %d, %d channels, delay %d, writes of %d%s: invalid output",
+        (int)rate, channels, delay, write_size, pull ? ", pull" : "");
+  }
+  TEST_ASSERT(info.nb_streams == 2);
+  TEST_ASSERT(out.nb_closes == !pull);
+  if (info.duration[0] != test_duration48k(chain_at, rate)
+      || info.duration[1] != test_duration48k(n, rate) - test_duration48k(chain_at, rate)) {
+    test_fail("rate %d, %d channels, delay %d, writes of %d%s: durations %lld and %lld",
+        (int)rate, channels, delay, write_size, pull ? ", pull" : "",
+        info.duration[0], info.duration[1]);
+  }
+  test_output_clear(&out);
+}
+
+/* Creates an encoder writing to out with fixed serial numbers, so that two
+   encodes of the same signal can be compared byte for byte. Returns NULL if
+   the family is not supported by the libopus it is built with. */
+static OggOpusEnc *create_fixed(TestOutput *out, OggOpusComments *comments, opus_int32 rate, int channels, int family) {
+  OggOpusEnc *enc;
+  int err;
+  test_output_init(out);
+  enc = ope_encoder_create_callbacks(&test_callbacks, out, comments, rate, channels, family, &err);
+  if (enc == NULL && err == OPE_UNIMPLEMENTED) return NULL;
+  if (enc == NULL) test_fail("cannot create an encoder: %s", ope_strerror(err));
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_SERIALNO(1000)) == OPE_OK);
+  return enc;
+}
+
+static void chain_fixed(OggOpusEnc *enc, OggOpusComments *comments) {
+  TEST_ASSERT(ope_encoder_chain_current(enc, comments) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_SERIALNO(1001)) == OPE_OK);
+}
+
+static void check_same(TestOutput *a, TestOutput *b, const char *what) {
+  TestOggInfo info;
+  TEST_ASSERT(check_ogg(a->data, a->len, &info) == 0);
+  if (a->len != b->len || memcmp(a->data, b->data, a->len) != 0) test_fail("%s: different output", what);
+  test_output_clear(a);
+  test_output_clear(b);
+}
+
+/* Writes seconds of the test signal in writes of 960, chaining halfway. */
+static void encode_fixed(OggOpusEnc *enc, OggOpusComments *comments, int channels, opus_int32 rate, int seconds) {
+  float pcm[960*8];
+  long pos;
+  for (pos=0;pos<rate*seconds;pos+=960) {
+    if (pos == rate*seconds/2/960*960) chain_fixed(enc, comments);
+    test_signal(pcm, channels, pos, 960, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, 960) == OPE_OK);
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+}
+
+/* The elementary streams encoded on threads and repacketized into a
+   multistream packet must give what libopus gives, lookahead included. */
+static void test_stream_threads(int family, int channels, int delay) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput seq;
+  TestOutput par;
+  char what[64];
+  int err;
+  if ( (enc = create_fixed(&seq, comments, 48000, channels, family)) == NULL) {
+    ope_comments_destroy(comments);
+    return;
+  }
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(delay)) == OPE_OK);
+  encode_fixed(enc, comments, channels, 48000, 6);
+  ope_encoder_destroy(enc);
+  enc = create_fixed(&par, comments, 48000, channels, family);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(delay)) == OPE_OK);
+  err = ope_encoder_ctl(enc, OPE_SET_STREAM_THREADS(3));
+  /* Not available when built without threads. */
+  if (err != OPE_UNIMPLEMENTED) {
+    TEST_ASSERT(err == OPE_OK);
+    encode_fixed(enc, comments, channels, 48000, 6);
+    sprintf(what, "family %d, %d channels, delay %d, stream threads", family, channels, delay);
+    check_same(&seq, &par, what);
+  }
+  ope_encoder_destroy(enc);
+  test_output_clear(&seq);
+  test_output_clear(&par);
+  ope_comments_destroy(comments);
+}
+
+/* Encoders whose streams can't be encoded on their own refuse threads. */
+static void test_stream_threads_unavailable(int family, int channels) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput out;
+  if ( (enc = create_fixed(&out, comments, 48000, channels, family)) == NULL) {
+    ope_comments_destroy(comments);
+    return;
+  }
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_STREAM_THREADS(3)) == OPE_UNIMPLEMENTED);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_STREAM_THREADS(1)) == OPE_OK);
+  ope_encoder_destroy(enc);
+  test_output_clear(&out);
+  ope_comments_destroy(comments);
+}
+
+/* Ways of writing the same signal for write_signal(). */
+#define WRITE_FLOAT 0
+#define WRITE_FLOAT_PLANAR 1
+#define WRITE_INT16 2
+#define WRITE_INT16_PLANAR 3
+
+/* Writes a second of the test signal the given way, in writes of odd sizes. */
+static void write_signal(OggOpusEnc *enc, int channels, opus_int32 rate, int how) {
+  static const int write_sizes[] = {1, 17, 331, 967};
+  float pcm[967*8];
+  float planar[8][967];
+  opus_int16 pcm16[967*8];
+  opus_int16 planar16[8][967];
+  const float *float_ptrs[8];
+  const opus_int16 *int16_ptrs[8];
+  long pos;
+  int w = 0;
+  int c;
+  int i;
+  for (c=0;c<channels;c++) {
+    float_ptrs[c] = planar[c];
+    int16_ptrs[c] = planar16[c];
+  }
+  for (pos=0;pos<rate;pos+=write_sizes[w], w=(w+1)%4) {
+    int len = MIN(write_sizes[w], rate - pos);
+    test_signal(pcm, channels, pos, len, rate);
+    for (i=0;i<len*channels;i++) {
+      float x = pcm[i]*32768.f;
+      pcm16[i] = (opus_int16)(x > 32767 ? 32767 : x < -32768 ? -32768 : x);
+      planar[i%channels][i/channels] = pcm[i];
+      planar16[i%channels][i/channels] = pcm16[i];
+    }
+    switch (how) {
+      case WRITE_FLOAT: TEST_ASSERT(ope_encoder_write_float(enc, pcm, len) == OPE_OK); break;
+      case WRITE_FLOAT_PLANAR: TEST_ASSERT(ope_encoder_write_float_planar(enc, float_ptrs, len) == OPE_OK); break;
+      case WRITE_INT16: TEST_ASSERT(ope_encoder_write(enc, pcm16, len) == OPE_OK); break;
+      default: TEST_ASSERT(ope_encoder_write_planar(enc, int16_ptrs, len) == OPE_OK); break;
+    }
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+}
+
+/* Encodes the test signal written one way and another, and checks that both
+   give the same stream. */
+static void check_same_writes(opus_int32 rate, int channels, int how_a, int how_b, const char *what) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput a;
+  TestOutput b;
+  char full[80];
+  int family = channels > 2;
+  enc = create_fixed(&a, comments, rate, channels, family);
+  write_signal(enc, channels, rate, how_a);
+  ope_encoder_destroy(enc);
+  enc = create_fixed(&b, comments, rate, channels, family);
+  write_signal(enc, channels, rate, how_b);
+  ope_encoder_destroy(enc);
+  sprintf(full, "%s, rate %d, %d channels", what, (int)rate, channels);
+  check_same(&a, &b, full);
+  ope_comments_destroy(comments);
+}
+
+/* Writes seconds of the test signal in writes of write_size, chaining at the
+   same sample whatever the size. */
+static void write_sized_signal(OggOpusEnc *enc, OggOpusComments *comments, int channels, opus_int32 rate,
+    int seconds, int write_size) {
+  float *pcm = malloc(sizeof(*pcm)*write_size*channels);
+  long chain_at = rate*seconds/3 + 7;
+  long pos;
+  TEST_ASSERT(pcm != NULL);
+  for (pos=0;pos<rate*seconds;) {
+    int len = MIN(write_size, rate*seconds - pos);
+    if (pos < chain_at) len = MIN(len, chain_at - pos);
+    else if (pos == chain_at) chain_fixed(enc, comments);
+    test_signal(pcm, channels, pos, len, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, len) == OPE_OK);
+    pos += len;
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  free(pcm);
+}
+
+/* Small writes, gathered before resampling, must give what large ones give. */
+static void test_write_sizes(opus_int32 rate, int channels) {
+  static const int write_sizes[] = {1, 17, 255, 256, 4096};
+  OggOpusComments *comments = ope_comments_create();
+  int w;
+  for (w=0;w<(int)(sizeof(write_sizes)/sizeof(write_sizes[0]));w++) {
+    OggOpusEnc *enc;
+    TestOutput a;
+    TestOutput b;
+    char what[80];
+    enc = create_fixed(&a, comments, rate, channels, channels > 2);
+    write_sized_signal(enc, comments, channels, rate, 2, 960);
+    ope_encoder_destroy(enc);
+    enc = create_fixed(&b, comments, rate, channels, channels > 2);
+    write_sized_signal(enc, comments, channels, rate, 2, write_sizes[w]);
+    ope_encoder_destroy(enc);
+    sprintf(what, "writes of %d, rate %d, %d channels", write_sizes[w], (int)rate, channels);
+    check_same(&a, &b, what);
+  }
+  ope_comments_destroy(comments);
+}
+
+/* Resampling groups of channels on threads must give what resampling them
+   all on the calling thread gives, however the channels get split. */
+static void test_resampler_threads(opus_int32 rate, int channels) {
+  static const int threads[] = {2, 5};
+  OggOpusComments *comments = ope_comments_create();
+  int family = channels > 8 ? 255 : channels > 2;
+  int t;
+  for (t=0;t<2;t++) {
+    OggOpusEnc *enc;
+    TestOutput a;
+    TestOutput b;
+    char what[80];
+    int err;
+    if ( (enc = create_fixed(&a, comments, rate, channels, family)) == NULL) break;
+    TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_RESAMPLER_THREADS(1)) == OPE_OK);
+    write_sized_signal(enc, comments, channels, rate, 2, 331);
+    ope_encoder_destroy(enc);
+    enc = create_fixed(&b, comments, rate, channels, family);
+    err = ope_encoder_ctl(enc, OPE_SET_RESAMPLER_THREADS(threads[t]));
+    /* Not available when built without threads. */
+    if (err == OPE_UNIMPLEMENTED) {
+      ope_encoder_destroy(enc);
+      test_output_clear(&a);
+      test_output_clear(&b);
+      break;
+    }
+    TEST_ASSERT(err == OPE_OK);
+    write_sized_signal(enc, comments, channels, rate, 2, 331);
+    ope_encoder_destroy(enc);
+    sprintf(what, "%d resampler threads, rate %d, %d channels", threads[t], (int)rate, channels);
+    check_same(&a, &b, what);
+  }
+  ope_comments_destroy(comments);
+}
+
+/* Planar writes must give what the same samples interleaved give. */
+static void test_planar(opus_int32 rate, int channels) {
+  check_same_writes(rate, channels, WRITE_FLOAT, WRITE_FLOAT_PLANAR, "float planar");
+  check_same_writes(rate, channels, WRITE_INT16, WRITE_INT16_PLANAR, "16-bit planar");
+}
+
+/* Stores the byte bytes of u at p, least significant first unless big. */
+static void put_bytes(unsigned char *p, unsigned long long u, int bytes, int big) {
+  int i;
+  for (i=0;i<bytes;i++) p[big ? bytes-1-i : i] = (unsigned char)(u >> 8*i);
+}
+
+/* Stores a sample in format at p, from its value MSB-aligned in 32 bits and
+   the same as a float. */
+static int put_sample(unsigned char *p, int format, opus_int32 v, float f) {
+  double d = f;
+  opus_int16 v16 = (opus_int16)(v/65536);
+  opus_uint32 uf;
+  unsigned long long ud;
+  memcpy(&uf, &f, 4);
+  memcpy(&ud, &d, 8);
+  switch (format) {
+    case OPE_FORMAT_S16: memcpy(p, &v16, 2); return 2;
+    case OPE_FORMAT_S32: memcpy(p, &v, 4); return 4;
+    case OPE_FORMAT_FLOAT: memcpy(p, &f, 4); return 4;
+    case OPE_FORMAT_F64: memcpy(p, &d, 8); return 8;
+    case OPE_FORMAT_S16LE: case OPE_FORMAT_S16BE:
+      put_bytes(p, (opus_uint32)v >> 16, 2, format == OPE_FORMAT_S16BE);
+      return 2;
+    case OPE_FORMAT_S24LE: case OPE_FORMAT_S24BE:
+      put_bytes(p, (opus_uint32)v >> 8, 3, format == OPE_FORMAT_S24BE);
+      return 3;
+    case OPE_FORMAT_S32LE: case OPE_FORMAT_S32BE:
+      put_bytes(p, (opus_uint32)v, 4, format == OPE_FORMAT_S32BE);
+      return 4;
+    case OPE_FORMAT_F32LE: case OPE_FORMAT_F32BE:
+      put_bytes(p, uf, 4, format == OPE_FORMAT_F32BE);
+      return 4;
+    default:
+      put_bytes(p, ud, 8, format == OPE_FORMAT_F64BE);
+      return 8;
+  }
+}
+
+/* Writes a second of the test signal rounded to bits in format, or as floats
+   with ope_encoder_write_float() if format is -1, in writes of odd sizes. */
+static void write_format_signal(OggOpusEnc *enc, int channels, opus_int32 rate, int format, int bits) {
+  static const int write_sizes[] = {1, 17, 331, 967};
+  float scale = (float)(1L << (bits - 1));
+  float pcm[967*8];
+  unsigned char bytes[967*8*8];
+  long pos;
+  int w = 0;
+  int i;
+  for (pos=0;pos<rate;pos+=write_sizes[w], w=(w+1)%4) {
+    int len = MIN(write_sizes[w], rate - pos);
+    unsigned char *p = bytes;
+    test_signal(pcm, channels, pos, len, rate);
+    for (i=0;i<len*channels;i++) {
+      float x = (float)floor(pcm[i]*scale + .5f);
+      x = x > scale - 1 ? scale - 1 : x < -scale ? -scale : x;
+      pcm[i] = x/scale;
+      if (format >= 0) p += put_sample(p, format, (opus_int32)x*(opus_int32)(1L << (32 - bits)), pcm[i]);
+    }
+    if (format < 0) TEST_ASSERT(ope_encoder_write_float(enc, pcm, len) == OPE_OK);
+    else TEST_ASSERT(ope_encoder_write_format(enc, bytes, format, len) == OPE_OK);
+  }
+  TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+}
+
+/* Every format of ope_encoder_write_format() holding the signal exactly must
+   give what writing it as floats gives, with 16 and 24-bit samples. */
+static void test_formats(opus_int32 rate, int channels) {
+  OggOpusComments *comments = ope_comments_create();
+  int bits;
+  int format;
+  for (bits=16;bits<=24;bits+=8) {
+    for (format=OPE_FORMAT_S16;format<=OPE_FORMAT_F64BE;format++) {
+      OggOpusEnc *enc;
+      TestOutput a;
+      TestOutput b;
+      char what[80];
+      if (bits > 16 && (format == OPE_FORMAT_S16 || format == OPE_FORMAT_S16LE || format == OPE_FORMAT_S16BE)) {
+        continue;
+      }
+      enc = create_fixed(&a, comments, rate, channels, channels > 2);
+      write_format_signal(enc, channels, rate, -1, bits);
+      ope_encoder_destroy(enc);
+      enc = create_fixed(&b, comments, rate, channels, channels > 2);
+      write_format_signal(enc, channels, rate, format, bits);
+      ope_encoder_destroy(enc);
+      sprintf(what, "format %d, %d-bit samples, rate %d, %d channels", format, bits, (int)rate, channels);
+      check_same(&a, &b, what);
+    }
+  }
+  ope_comments_destroy(comments);
+}
+
+/* Settings other than the defaults, kept by the encoders under test. */
+static void configure(OggOpusEnc *enc, int channels, int delay) {
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_BITRATE(channels*40000)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPUS_SET_EXPERT_FRAME_DURATION(OPUS_FRAMESIZE_40_MS)) == OPE_OK);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_DECISION_DELAY(delay)) == OPE_OK);
+}
+
+/* A clone of a configured encoder must give what an encoder configured the
+   same way gives, long after its buffer has wrapped through the mirror. */
+static void test_clone(opus_int32 rate, int channels, int delay) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *proto;
+  OggOpusEnc *enc;
+  TestOutput fresh;
+  TestOutput cloned;
+  TestOutput unused;
+  char what[64];
+  int err;
+  enc = create_fixed(&fresh, comments, rate, channels, channels > 2);
+  configure(enc, channels, delay);
+  encode_fixed(enc, comments, channels, rate, 6);
+  ope_encoder_destroy(enc);
+  proto = create_fixed(&unused, comments, rate, channels, channels > 2);
+  configure(proto, channels, delay);
+  test_output_init(&cloned);
+  enc = ope_encoder_clone(proto, &test_callbacks, &cloned, &err);
+  if (enc == NULL) test_fail("cannot clone an encoder: %s", ope_strerror(err));
+  ope_encoder_destroy(proto);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_SERIALNO(1000)) == OPE_OK);
+  encode_fixed(enc, comments, channels, rate, 6);
+  ope_encoder_destroy(enc);
+  sprintf(what, "clone, rate %d, %d channels, delay %d", (int)rate, channels, delay);
+  check_same(&fresh, &cloned, what);
+  test_output_clear(&unused);
+  ope_comments_destroy(comments);
+}
+
+/* Like create_fixed(), through the pull API if pull is set. */
+static OggOpusEnc *create_fixed_api(TestOutput *out, OggOpusComments *comments, opus_int32 rate, int channels,
+    int pull) {
+  OggOpusEnc *enc;
+  int err;
+  if (!pull) return create_fixed(out, comments, rate, channels, channels > 2);
+  test_output_init(out);
+  enc = ope_encoder_create_pull(comments, rate, channels, channels > 2, &err);
+  if (enc == NULL) test_fail("cannot create an encoder: %s", ope_strerror(err));
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_SERIALNO(1000)) == OPE_OK);
+  return enc;
+}
+
+/* Encodes the test signal with an encoder reset after encoding something
+   else, and checks that it gives what a new encoder gives. */
+static void check_reset(opus_int32 rate, int channels, int drain, int pull) {
+  OggOpusComments *comments = ope_comments_create();
+  OggOpusEnc *enc;
+  TestOutput fresh;
+  TestOutput first;
+  TestOutput reused;
+  float pcm[960*8];
+  char what[80];
+  long pos;
+  enc = create_fixed_api(&fresh, comments, rate, channels, pull);
+  configure(enc, channels, 4800);
+  encode_fixed(enc, comments, channels, rate, 3);
+  if (pull) get_pages(enc, &fresh, 1);
+  ope_encoder_destroy(enc);
+  enc = create_fixed_api(&first, comments, rate, channels, pull);
+  configure(enc, channels, 4800);
+  /* Another part of the signal, which leaves the resampler and LPC history
+     different from a new encoder's. */
+  for (pos=0;pos<rate*3/2;pos+=960) {
+    test_signal(pcm, channels, rate*5 + pos, 960, rate);
+    TEST_ASSERT(ope_encoder_write_float(enc, pcm, 960) == OPE_OK);
+  }
+  if (drain) TEST_ASSERT(ope_encoder_drain(enc) == OPE_OK);
+  /* Leaves what is not flushed yet for the reset to drop. */
+  if (pull) get_pages(enc, &first, 0);
+  test_output_init(&reused);
+  TEST_ASSERT(ope_encoder_reset(enc, pull ? NULL : &reused, comments) == OPE_OK);
+  TEST_ASSERT(first.nb_closes == !pull);
+  TEST_ASSERT(ope_encoder_ctl(enc, OPE_SET_SERIALNO(1000)) == OPE_OK);
+  encode_fixed(enc, comments, channels, rate, 3);
+  if (pull) get_pages(enc, &reused, 1);
+  ope_encoder_destroy(enc);
+  sprintf(what, "reset, rate %d, %d channels%s%s", (int)rate, channels, drain ? ", drained" : "",
+      pull ? ", pull" : "");
+  check_same(&fresh, &reused, what);
+  test_output_clear(&first);
+  ope_comments_destroy(comments);
+}
+
+/* Reset encoders must give what new ones give, drained or not, with the
+   callbacks and the pull API. */
+static void test_reset(opus_int32 rate, int channels) {
+  check_reset(rate, channels, 0, 0);
+  check_reset(rate, channels, 1, 0);
+  check_reset(rate, channels, 0, 1);
+  check_reset(rate, channels, 1, 1);
+}
+
+int main(void) {
+  static const opus_int32 rates[] = {48000, 44100, 16000};
+  static const int channels[] = {1, 2, 6};
+  static const int delays[] = {0, 4800, 96000};
+  static const int write_sizes[] = {1, 17, 960, 4096};
+  int r, c, d, w;
+  for (r=0;r<3;r++) {
+    for (c=0;c<3;c++) {
+      for (d=0;d<3;d++) {
+        for (w=0;w<4;w++) encode(rates[r], channels[c], delays[d], write_sizes[w], 0);
+      }
+      encode(rates[r], channels[c], 4800, 960, 1);
+    }
+  }
+  test_write_sizes(44100, 2);
+  test_write_sizes(16000, 1);
+  /* Groups of one channel, uneven groups, and more channels than family 1
+     has. */
+  test_resampler_threads(44100, 3);
+  test_resampler_threads(44100, 8);
+  test_resampler_threads(44100, 33);
+  test_resampler_threads(96000, 3);
+  test_resampler_threads(96000, 8);
+  test_resampler_threads(96000, 33);
+  /* Resampled too, and up to the most channels of family 1. */
+  test_planar(48000, 3);
+  test_planar(44100, 6);
+  test_planar(48000, 8);
+  test_formats(48000, 2);
+  test_formats(44100, 3);
+  /* 2 s of decision delay goes past what libopus analyses. */
+  test_stream_threads(255, 6, 4800);
+  test_stream_threads(255, 6, 96000);
+  test_stream_threads(2, 4, 96000);
+  test_stream_threads_unavailable(0, 2);
+  test_stream_threads_unavailable(1, 6);
+  test_stream_threads_unavailable(3, 4);
+  test_stream_threads_unavailable(255, 1);
+  test_clone(48000, 2, 96000);
+  test_clone(44100, 2, 4800);
+  test_clone(44100, 6, 96000);
+  test_reset(48000, 2);
+  test_reset(44100, 2);
+  /* The multichannel resampler keeps each channel's history apart. */
+  test_reset(48000, 6);
+  test_reset(44100, 6);
+  return 0;
+}
@@ -0,0 +1,130 @@
+/* Checks the cache of resampler filter tables: resamplers with the same
+   parameters share one table, which outlives them until
+   SINC_CACHE_MAX_UNUSED more recently used tables are unused as well, and is
+   freed exactly once. Then that the precomputed tables in
+   src/resample_tables.h are the ones the resampler computes without them (as
+   it does when built with RESAMPLE_NO_STATIC_TABLES), so that they don't go
+   stale when the filter design changes. Builds the resampler itself to look
+   at its state, like the benchmarks (see bench/resampler_variant.h). */
+
+#include <stdlib.h>
+#include "test_util.h"
+
+/* Counts the frees of one table. stdlib.h is included above, so only the
+   calls in resample.c go through this. */
+static const void *watched;
+static int watched_frees;
+
+static void counted_free(void *ptr) {
+  if (ptr != NULL && ptr == watched) watched_frees++;
+  free(ptr);
+}
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#undef HAVE_CONFIG_H
+#endif
+#undef RANDOM_PREFIX
+#define RANDOM_PREFIX test_sinc_table
+#define free counted_free
+#include "../src/resample.c"
+#undef free
+
+/* The tables are printed with enough digits to give back the same floats, this
+   only leaves room for a different libm. */
+#define TABLE_TOLERANCE 1e-7
+
+#if !defined(FIXED_POINT) && !defined(RESAMPLE_NO_STATIC_TABLES)
+static void test_static_tables(void) {
+  int i;
+  for (i=0;i<(int)(sizeof(static_sinc_tables)/sizeof(static_sinc_tables[0]));i++) {
+    const struct StaticSincTable *t = &static_sinc_tables[i];
+    SpeexResamplerState *st;
+    spx_word16_t *table;
+    spx_uint32_t j;
+    st = speex_resampler_init_frac(1, t->num_rate, t->den_rate, t->num_rate, t->den_rate, t->quality, NULL);
+    TEST_ASSERT(st != NULL && st->filt_len == t->filt_len);
+    table = malloc(sizeof(*table)*st->filt_len*st->den_rate);
+    TEST_ASSERT(table != NULL);
+    sinc_table_fill(st, table, 1);
+    for (j=0;j<st->filt_len*st->den_rate;j++) {
+      if (fabs(table[j] - t->table[j]) > TABLE_TOLERANCE) {
+        test_fail("table %u/%u quality %d: %.8e computed, %.8e precomputed at %u, run make resample-tables",
+            (unsigned)t->num_rate, (unsigned)t->den_rate, t->quality, table[j], t->table[j], (unsigned)j);
+      }
+    }
+    free(table);
+    speex_resampler_destroy(st);
+  }
+}
+#endif
+
+#ifdef SINC_TABLE_CACHE
+static int in_cache(const sinc_table_entry *e) {
+  const sinc_table_entry *curr;
+  for (curr=sinc_cache;curr;curr=curr->next) {
+    if (curr == e) return 1;
+  }
+  return 0;
+}
+
+static void test_cache(void) {
+  SpeexResamplerState *a;
+  SpeexResamplerState *b;
+  sinc_table_entry *e;
+  int q;
+  int unused;
+  TEST_ASSERT(sinc_cache == NULL);
+  a = speex_resampler_init(1, 32000, 48000, 4, NULL);
+  b = speex_resampler_init(2, 32000, 48000, 4, NULL);
+  TEST_ASSERT(a != NULL && b != NULL);
+  e = a->sinc_entry;
+  TEST_ASSERT(e != NULL && b->sinc_entry == e && e->refs == 2);
+  TEST_ASSERT(a->sinc_table == e->table && b->sinc_table == e->table);
+  watched = e->table;
+  speex_resampler_destroy(a);
+  TEST_ASSERT(e->refs == 1 && watched_frees == 0);
+  speex_resampler_destroy(b);
+  /* Kept for the next resampler that needs it. */
+  TEST_ASSERT(e->refs == 0 && in_cache(e) && watched_frees == 0);
+  /* Each other quality leaves one more unused table in front of it. */
+  unused = 0;
+  for (q=0;q<=10 && unused<SINC_CACHE_MAX_UNUSED;q++) {
+    if (q == 4) continue;
+    a = speex_resampler_init(1, 32000, 48000, q, NULL);
+    TEST_ASSERT(a != NULL && a->sinc_entry != e);
+    speex_resampler_destroy(a);
+    unused++;
+    if (unused < SINC_CACHE_MAX_UNUSED) {
+      TEST_ASSERT(in_cache(e) && watched_frees == 0);
+    }
+  }
+  TEST_ASSERT(unused == SINC_CACHE_MAX_UNUSED);
+  TEST_ASSERT(watched_frees == 1);
+  /* The evicted entry is gone, the next resampler computes a new one. */
+  a = speex_resampler_init(1, 32000, 48000, 4, NULL);
+  TEST_ASSERT(a != NULL && a->sinc_entry->refs == 1);
+  speex_resampler_destroy(a);
+  TEST_ASSERT(watched_frees == 1);
+}
+#endif
+
+int main(void) {
+  /* First, with the cache still empty. */
+#ifdef SINC_TABLE_CACHE
+  test_cache();
+#endif
+#if !defined(FIXED_POINT) && !defined(RESAMPLE_NO_STATIC_TABLES)
+  test_static_tables();
+#ifdef RESAMPLE_FULL_SINC_TABLE
+  {
+    /* 44.1 kHz input at the quality of the encoder uses its table as is, with
+       nothing computed or cached. */
+    SpeexResamplerState *st = speex_resampler_init(1, 44100, 48000, 5, NULL);
+    TEST_ASSERT(st != NULL && st->sinc_table == sinc_table_147_160_q5 && st->sinc_entry == NULL);
+    speex_resampler_destroy(st);
+  }
+#endif
+#endif
+  return 0;
+}
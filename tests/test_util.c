@@ -0,0 +1,168 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "test_util.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+void test_fail(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+  fprintf(stderr, "\n");
+  exit(1);
+}
+
+void test_output_init(TestOutput *out) {
+  out->data = NULL;
+  out->len = out->alloc = 0;
+  out->nb_closes = 0;
+}
+
+void test_output_clear(TestOutput *out) {
+  free(out->data);
+  test_output_init(out);
+}
+
+void test_output_append(TestOutput *out, const unsigned char *data, long len) {
+  if (out->len + len > out->alloc) {
+    long alloc = 2*out->alloc + len;
+    unsigned char *p = realloc(out->data, alloc);
+    if (p == NULL) test_fail("out of memory");
+    out->data = p;
+    out->alloc = alloc;
+  }
+  memcpy(&out->data[out->len], data, len);
+  out->len += len;
+}
+
+static int test_write(void *user_data, const unsigned char *ptr, opus_int32 len) {
+  test_output_append((TestOutput *)user_data, ptr, len);
+  return 0;
+}
+
+static int test_close(void *user_data) {
+  ((TestOutput *)user_data)->nb_closes++;
+  return 0;
+}
+
+const OpusEncCallbacks test_callbacks = {test_write, test_close};
+
+static opus_uint32 read32(const unsigned char *p) {
+  return p[0] | (opus_uint32)p[1]<<8 | (opus_uint32)p[2]<<16 | (opus_uint32)p[3]<<24;
+}
+
+static opus_uint32 ogg_crc(const unsigned char *p, long len) {
+  static opus_uint32 table[256];
+  opus_uint32 crc = 0;
+  long i;
+  if (table[1] == 0) {
+    for (i=0;i<256;i++) {
+      opus_uint32 r = (opus_uint32)i<<24;
+      int k;
+      for (k=0;k<8;k++) r = r&0x80000000U ? r<<1 ^ 0x04c11db7 : r<<1;
+      table[i] = r;
+    }
+  }
+  for (i=0;i<len;i++) {
+    /* The CRC field itself counts as zeros. */
+    unsigned char c = i >= 22 && i < 26 ? 0 : p[i];
+    crc = crc<<8 ^ table[(crc>>24 ^ c)&0xff];
+  }
+  return crc;
+}
+
+static int bad(long pos, const char *what) {
+  fprintf(stderr, "invalid Ogg data at byte %ld: %s\n", pos, what);
+  return -1;
+}
+
+int check_ogg(const unsigned char *data, long len, TestOggInfo *info) {
+  long pos = 0;
+  int cur = -1;
+  int ended = 1;
+  opus_uint32 serial = 0;
+  opus_uint32 seq = 0;
+  long long last_granule = 0;
+  /* Packets completed so far in the current stream. */
+  int packets = 0;
+  memset(info, 0, sizeof(*info));
+  while (pos < len) {
+    const unsigned char *p = &data[pos];
+    const unsigned char *body;
+    int nb_segs;
+    long body_len = 0;
+    long long granule;
+    int flags;
+    int i;
+    if (len - pos < 27 || memcmp(p, "OggS", 4) != 0 || p[4] != 0) return bad(pos, "no page header");
+    nb_segs = p[26];
+    if (len - pos < 27 + nb_segs) return bad(pos, "truncated page");
+    for (i=0;i<nb_segs;i++) body_len += p[27+i];
+    if (len - pos < 27 + nb_segs + body_len) return bad(pos, "truncated page");
+    if (ogg_crc(p, 27 + nb_segs + body_len) != read32(&p[22])) return bad(pos, "wrong CRC");
+    body = &p[27 + nb_segs];
+    flags = p[5];
+    granule = (long long)((unsigned long long)read32(&p[6]) | (unsigned long long)read32(&p[10])<<32);
+    if (flags&0x02) {
+      if (!ended) return bad(pos, "new stream before the end of the previous one");
+      if (++cur == TEST_MAX_STREAMS) return bad(pos, "too many streams");
+      if (nb_segs != 1 || body_len < 19 || memcmp(body, "OpusHead", 8) != 0) return bad(pos, "no OpusHead");
+      if (granule != 0) return bad(pos, "non-zero granule position for OpusHead");
+      info->pre_skip[cur] = body[10] | body[11]<<8;
+      serial = read32(&p[14]);
+      seq = 0;
+      ended = 0;
+      last_granule = 0;
+      packets = 0;
+    } else {
+      if (ended) return bad(pos, "page outside of a stream");
+      if (read32(&p[14]) != serial) return bad(pos, "unexpected serial number");
+      if (packets == 1 && (flags&0x01 || body_len < 8 || memcmp(body, "OpusTags", 8) != 0)) return bad(pos, "no OpusTags");
+    }
+    if (read32(&p[18]) != seq++) return bad(pos, "wrong page sequence number");
+    for (i=0;i<nb_segs;i++) {
+      if (p[27+i] == 255) continue;
+      packets++;
+      /* OpusTags must end its page. */
+      if (packets == 2 && i != nb_segs-1) return bad(pos, "audio on the OpusTags page");
+    }
+    if (packets <= 2 && granule > 0) return bad(pos, "non-zero granule position for a header page");
+    if (granule != -1) {
+      if (granule < last_granule) return bad(pos, "granule position going backwards");
+      last_granule = granule;
+    }
+    if (flags&0x04) {
+      if (packets <= 2) return bad(pos, "stream without audio");
+      ended = 1;
+      info->duration[cur] = granule - info->pre_skip[cur];
+    }
+    info->nb_pages++;
+    pos += 27 + nb_segs + body_len;
+  }
+  if (!ended) return bad(pos, "last stream not ended");
+  info->nb_streams = cur + 1;
+  return 0;
+}
+
+void test_signal(float *pcm, int channels, long start, int n, opus_int32 rate) {
+  int i;
+  int c;
+  for (i=0;i<n;i++) {
+    long t = start + i;
+    for (c=0;c<channels;c++) {
+      opus_uint32 r = (opus_uint32)t*2654435761U ^ (opus_uint32)c*40503U;
+      float noise = ((r>>16&0xffff)/65536.f - .5f)*.02f;
+      pcm[i*channels + c] = .3f*(float)sin(2*M_PI*(220*(c+1) + 50)*t/rate) + noise;
+    }
+  }
+}
+
+long long test_duration48k(long long n, opus_int32 rate) {
+  return (n*48000 + rate - 1)/rate;
+}
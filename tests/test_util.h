@@ -0,0 +1,53 @@
+/* Helpers shared by the tests run with make check. */
+
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include "opusenc.h"
+
+/* Ogg data collected from the callbacks (or ope_encoder_get_page()). */
+typedef struct {
+  unsigned char *data;
+  long len;
+  long alloc;
+  int nb_closes;
+} TestOutput;
+
+/* What check_ogg() found in the data. */
+#define TEST_MAX_STREAMS 64
+typedef struct {
+  int nb_streams;
+  int nb_pages;
+  int pre_skip[TEST_MAX_STREAMS];
+  /* Last granule position minus the pre-skip, in samples at 48 kHz. */
+  long long duration[TEST_MAX_STREAMS];
+} TestOggInfo;
+
+extern const OpusEncCallbacks test_callbacks;
+
+/* Prints the message and exits with a failure. */
+void test_fail(const char *fmt, ...);
+
+#define TEST_ASSERT(cond) do { \
+    if (!(cond)) test_fail("%s:%d: assertion failed: %s", __FILE__, __LINE__, #cond); \
+  } while (0)
+
+void test_output_init(TestOutput *out);
+void test_output_clear(TestOutput *out);
+void test_output_append(TestOutput *out, const unsigned char *data, long len);
+
+/* Checks that the data is a sequence of valid Ogg Opus streams (page CRCs,
+   sequence numbers, BOS/EOS flags, headers and granule positions), one after
+   the other as chaining makes them. Returns 0 if so, -1 with a message
+   printed otherwise. */
+int check_ogg(const unsigned char *data, long len, TestOggInfo *info);
+
+/* Deterministic test signal: tones and a little noise, with sample i of
+   channel c only depending on i and c. */
+void test_signal(float *pcm, int channels, long start, int n, opus_int32 rate);
+
+/* Number of samples at 48 kHz that n input samples at rate last, rounded up
+   like the granule positions. */
+long long test_duration48k(long long n, opus_int32 rate);
+
+#endif